@@ -0,0 +1,45 @@
+# Begin standard header
+sp 		:= $(sp).x
+dirstack_$(sp)	:= $(d)
+d		:= $(dir)
+# End standard header
+
+dir := $(d)/common
+include $(dir)/Rules.mk
+
+dir := $(d)/glyph_generation
+include $(dir)/Rules.mk
+
+dir := $(d)/distance_field
+include $(dir)/Rules.mk
+
+dir := $(d)/glyph_metrics
+include $(dir)/Rules.mk
+
+dir := $(d)/filled_path
+include $(dir)/Rules.mk
+
+dir := $(d)/path_tessellation
+include $(dir)/Rules.mk
+
+dir := $(d)/path_edit
+include $(dir)/Rules.mk
+
+dir := $(d)/triangulation_arena
+include $(dir)/Rules.mk
+
+dir := $(d)/stroked_path_build
+include $(dir)/Rules.mk
+
+dir := $(d)/dash_pattern
+include $(dir)/Rules.mk
+
+ifeq ($(BUILD_NULL),1)
+dir := $(d)/painter_scenes
+include $(dir)/Rules.mk
+endif
+
+# Begin standard footer
+d		:= $(dirstack_$(sp))
+sp		:= $(basename $(sp))
+# End standard footer
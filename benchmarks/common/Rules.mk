@@ -0,0 +1,13 @@
+# Begin standard header
+sp 		:= $(sp).x
+dirstack_$(sp)	:= $(d)
+d		:= $(dir)
+# End standard header
+
+COMMON_BENCH_SOURCES += demos/common/generic_command_line.cpp
+COMMON_BENCH_SOURCES += $(call filelist, bench_base.cpp)
+
+# Begin standard footer
+d		:= $(dirstack_$(sp))
+sp		:= $(basename $(sp))
+# End standard footer
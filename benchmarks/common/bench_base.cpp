@@ -0,0 +1,39 @@
+/*!
+ * \file bench_base.cpp
+ * \brief file bench_base.cpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#include <iostream>
+#include <string>
+#include "bench_base.hpp"
+
+int
+bench_base::
+main(int argc, char **argv)
+{
+  if (argc == 2 && std::string(argv[1]) == "-help")
+    {
+      std::cout << "\n\nUsage: " << argv[0];
+      print_help(std::cout);
+      print_detailed_help(std::cout);
+      return 0;
+    }
+
+  parse_command_line(argc, argv);
+  std::cout << "\n";
+
+  return run_cases();
+}
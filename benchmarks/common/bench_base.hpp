@@ -0,0 +1,113 @@
+/*!
+ * \file bench_base.hpp
+ * \brief file bench_base.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#ifndef FASTUIDRAW_BENCH_BENCH_BASE_HPP
+#define FASTUIDRAW_BENCH_BENCH_BASE_HPP
+
+#include <algorithm>
+
+#include "generic_command_line.hpp"
+#include "simple_time.hpp"
+
+/* Base class for the benchmarks: a benchmark registers its
+ * command line arguments to the bench_base and implements
+ * run_cases(); the main() of the program is then just
+ *
+ *   int main(int argc, char **argv)
+ *   {
+ *     foo_bench B;
+ *     return B.main(argc, argv);
+ *   }
+ */
+class bench_base:public command_line_register
+{
+public:
+  virtual
+  ~bench_base()
+  {}
+
+  /* Print the help if asked for, otherwise parse the
+   * command line and call run_cases(); returns the value
+   * that run_cases() returns.
+   */
+  int
+  main(int argc, char **argv);
+
+protected:
+  /* To be implemented by a derived class to run the cases
+   * of the benchmark and report the results.
+   */
+  virtual
+  int
+  run_cases(void) = 0;
+};
+
+/* The command line argument "repeat" for the benchmarks that
+ * run each configuration several times and report the fastest
+ * run, see fastest_time.
+ */
+class repeat_argument:public command_line_argument_value<unsigned int>
+{
+public:
+  repeat_argument(unsigned int default_value, command_line_register &parent):
+    command_line_argument_value<unsigned int>(default_value, "repeat",
+                                              "number of times to run each configuration, "
+                                              "the fastest run is reported", parent)
+  {}
+
+  /* number of times to run each configuration, at least 1 */
+  unsigned int
+  count(void) const
+  {
+    return std::max(1u, value());
+  }
+};
+
+/* The time of the fastest of the runs of a configuration */
+class fastest_time
+{
+public:
+  fastest_time(void):
+    m_ms(-1.0)
+  {}
+
+  /* record a run that took the time elapsed since timer started */
+  void
+  record(const simple_time &timer)
+  {
+    record(static_cast<double>(timer.elapsed_us()) / 1000.0);
+  }
+
+  void
+  record(double ms)
+  {
+    m_ms = (m_ms < 0.0) ? ms : std::min(ms, m_ms);
+  }
+
+  /* time in milliseconds of the fastest run recorded */
+  double
+  ms(void) const
+  {
+    return std::max(0.0, m_ms);
+  }
+
+private:
+  double m_ms;
+};
+
+#endif
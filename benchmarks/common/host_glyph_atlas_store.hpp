@@ -0,0 +1,84 @@
+/*!
+ * \file host_glyph_atlas_store.hpp
+ * \brief file host_glyph_atlas_store.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#ifndef FASTUIDRAW_BENCH_HOST_GLYPH_ATLAS_STORE_HPP
+#define FASTUIDRAW_BENCH_HOST_GLYPH_ATLAS_STORE_HPP
+
+#include <vector>
+#include <algorithm>
+#include <fastuidraw/text/glyph_atlas.hpp>
+
+/* A GlyphAtlasBackingStoreBase backed by host memory so
+ * that benchmarks can exercise GlyphCache and GlyphAtlas
+ * without a GL context.
+ */
+class HostGlyphAtlasStore:public fastuidraw::GlyphAtlasBackingStoreBase
+{
+public:
+  explicit
+  HostGlyphAtlasStore(unsigned int psize):
+    fastuidraw::GlyphAtlasBackingStoreBase(psize),
+    m_data(psize, 0u)
+  {}
+
+  virtual
+  void
+  set_values(unsigned int location, fastuidraw::c_array<const uint32_t> pdata)
+  {
+    std::copy(pdata.begin(), pdata.end(), m_data.begin() + location);
+  }
+
+  virtual
+  void
+  flush(void)
+  {}
+
+  virtual
+  bool
+  can_copy_values(void) const
+  {
+    return true;
+  }
+
+  virtual
+  void
+  copy_values(unsigned int dst, unsigned int src, unsigned int count)
+  {
+    std::copy(m_data.begin() + src, m_data.begin() + src + count,
+              m_data.begin() + dst);
+  }
+
+  fastuidraw::c_array<const uint32_t>
+  values(void) const
+  {
+    return fastuidraw::c_array<const uint32_t>(m_data.data(), m_data.size());
+  }
+
+protected:
+  virtual
+  void
+  resize_implement(unsigned int new_size)
+  {
+    m_data.resize(new_size, 0u);
+  }
+
+private:
+  std::vector<uint32_t> m_data;
+};
+
+#endif
@@ -0,0 +1,374 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+#include <fastuidraw/path.hpp>
+#include <fastuidraw/tessellated_path.hpp>
+#include <fastuidraw/path_dash_effect.hpp>
+#include <fastuidraw/painter/shader_data/painter_dashed_stroke_params.hpp>
+
+#include "bench_base.hpp"
+#include "simple_time.hpp"
+
+using namespace fastuidraw;
+
+/* Benchmark for finding the interval of a dash pattern that a
+ * distance along a path falls in, as a function of the length of
+ * the dash pattern. For each pattern length, the data that
+ * PainterDashedStrokeParams packs for the shaders is searched on
+ * the CPU in the same way that the shader fastuidraw_compute_interval()
+ * used to, i.e. by reading the prefix sums one block at a time, and
+ * in the same way it does now, i.e. by reading one block of each
+ * level of the packed data; the results of each must be the same.
+ * The shader only walks the tree for patterns of more than
+ * linear_search_max_blocks blocks and scans linearly otherwise;
+ * that choice is reported as "shader". In addition, the time
+ * taken by PathDashEffect to dash a path with the pattern is
+ * reported.
+ */
+class dash_pattern_bench:public bench_base
+{
+public:
+  dash_pattern_bench(void);
+
+protected:
+  virtual
+  int
+  run_cases(void);
+
+private:
+  class interval
+  {
+  public:
+    bool
+    operator==(const interval &rhs) const
+    {
+      return m_ID == rhs.m_ID
+        && m_begin == rhs.m_begin
+        && m_end == rhs.m_end
+        && m_sign == rhs.m_sign;
+    }
+
+    int m_ID;
+    float m_begin, m_end, m_sign;
+  };
+
+  class packed_pattern
+  {
+  public:
+    explicit
+    packed_pattern(const PainterDashedStrokeParams &params);
+
+    c_array<const uvec4>
+    intervals(void) const
+    {
+      return c_array<const uvec4>(m_data.data(), m_data.size()).sub_array(FASTUIDRAW_NUMBER_BLOCK4_NEEDED(PainterDashedStrokeParams::stroke_static_data_size));
+    }
+
+    std::vector<uvec4> m_data;
+    float m_total_length;
+    float m_first_interval_start;
+    uint32_t m_number_intervals;
+  };
+
+  static
+  interval
+  linear_lookup(const packed_pattern &P, float in_distance, unsigned int *num_reads);
+
+  static
+  interval
+  tree_lookup(const packed_pattern &P, float in_distance, unsigned int *num_reads);
+
+  /* same choice as fastuidraw_compute_interval() makes with
+   * FASTUIDRAW_DASH_PATTERN_LINEAR_SEARCH_MAX_BLOCKS
+   */
+  static
+  interval
+  shader_lookup(const packed_pattern &P, float in_distance, unsigned int *num_reads)
+  {
+    return ((P.m_number_intervals + 3u) >> 2u) <= linear_search_max_blocks ?
+      linear_lookup(P, in_distance, num_reads) :
+      tree_lookup(P, in_distance, num_reads);
+  }
+
+  enum
+    {
+      linear_search_max_blocks = 16u
+    };
+
+  void
+  add_contour(Path *dst, unsigned int id);
+
+  command_line_argument_value<unsigned int> m_max_pattern_length;
+  command_line_argument_value<unsigned int> m_num_lookups;
+  command_line_argument_value<unsigned int> m_num_contours;
+  command_line_argument_value<unsigned int> m_curves_per_contour;
+};
+
+dash_pattern_bench::packed_pattern::
+packed_pattern(const PainterDashedStrokeParams &params):
+  m_data(params.data_size())
+{
+  c_array<const uint32_t> raw;
+
+  params.pack_data(c_array<uvec4>(m_data.data(), m_data.size()));
+  raw = c_array<const uvec4>(m_data.data(), m_data.size()).flatten_array();
+  m_total_length = unpack_float(raw[PainterDashedStrokeParams::stroke_total_length_offset]);
+  m_first_interval_start = unpack_float(raw[PainterDashedStrokeParams::stroke_first_interval_start_offset]);
+  m_number_intervals = raw[PainterDashedStrokeParams::stroke_number_intervals_offset];
+}
+
+dash_pattern_bench::
+dash_pattern_bench(void):
+  m_max_pattern_length(1024, "max_pattern_length",
+                       "the number of elements of the dash pattern goes "
+                       "from 1 to this value, doubling each time", *this),
+  m_num_lookups(1u << 20u, "num_lookups", "number of distances looked up for each pattern length", *this),
+  m_num_contours(50, "num_contours", "number of contours of the path dashed by PathDashEffect", *this),
+  m_curves_per_contour(50, "curves_per_contour", "number of curves of each contour", *this)
+{}
+
+dash_pattern_bench::interval
+dash_pattern_bench::
+linear_lookup(const packed_pattern &P, float in_distance, unsigned int *num_reads)
+{
+  c_array<const uvec4> data(P.intervals());
+  interval R;
+  float d, ff, fd, lastd;
+
+  fd = std::floor(in_distance / P.m_total_length);
+  ff = P.m_total_length * fd;
+  d = in_distance - ff;
+  lastd = P.m_first_interval_start;
+
+  R.m_ID = -1;
+  R.m_begin = R.m_end = 0.0f;
+  R.m_sign = -1.0f;
+  for (unsigned int loc = 0; loc < data.size() && lastd < P.m_total_length; ++loc)
+    {
+      ++*num_reads;
+      for (unsigned int c = 0; c < 4; ++c)
+        {
+          float v(unpack_float(data[loc][c]));
+          if (d < v)
+            {
+              R.m_begin = ff + lastd;
+              R.m_end = ff + v;
+              R.m_ID = 4 * loc + c + static_cast<int>(fd) * static_cast<int>(P.m_number_intervals);
+              R.m_sign = (c & 1u) ? -1.0f : 1.0f;
+              return R;
+            }
+          lastd = v;
+        }
+    }
+  return R;
+}
+
+dash_pattern_bench::interval
+dash_pattern_bench::
+tree_lookup(const packed_pattern &P, float in_distance, unsigned int *num_reads)
+{
+  c_array<const uvec4> data(P.intervals());
+  unsigned int level, level_offset, level0_size, num_blocks, block;
+  float d, ff, fd, lower, upper(0.0f);
+  interval R;
+
+  fd = std::floor(in_distance / P.m_total_length);
+  ff = P.m_total_length * fd;
+  d = in_distance - ff;
+
+  R.m_ID = -1;
+  R.m_begin = R.m_end = 0.0f;
+  R.m_sign = -1.0f;
+
+  level0_size = (P.m_number_intervals + 3u) >> 2u;
+  num_blocks = level0_size;
+  level = 0u;
+  level_offset = 0u;
+  while (num_blocks > 1u)
+    {
+      level_offset += num_blocks;
+      num_blocks = (num_blocks + 3u) >> 2u;
+      ++level;
+    }
+
+  block = 0u;
+  lower = P.m_first_interval_start;
+  for (;;)
+    {
+      unsigned int c;
+
+      ++*num_reads;
+      for (c = 0; c < 4 && d >= unpack_float(data[level_offset + block][c]); ++c)
+        {}
+
+      if (c == 4)
+        {
+          return R;
+        }
+
+      if (c > 0)
+        {
+          lower = unpack_float(data[level_offset + block][c - 1]);
+        }
+      upper = unpack_float(data[level_offset + block][c]);
+
+      block = 4u * block + c;
+      if (level == 0u)
+        {
+          break;
+        }
+
+      --level;
+      level_offset -= (level0_size + (1u << (2u * level)) - 1u) >> (2u * level);
+    }
+
+  R.m_begin = ff + lower;
+  R.m_end = ff + upper;
+  R.m_ID = block + static_cast<int>(fd) * static_cast<int>(P.m_number_intervals);
+  R.m_sign = (block & 1u) ? -1.0f : 1.0f;
+  return R;
+}
+
+void
+dash_pattern_bench::
+add_contour(Path *dst, unsigned int id)
+{
+  unsigned int seed(777u + 4099u * id);
+  auto next = [&seed]()
+    {
+      seed = seed * 1664525u + 1013904223u;
+      return static_cast<float>(seed >> 8u) / static_cast<float>(1u << 24u);
+    };
+
+  vec2 p(2000.0f * next(), 2000.0f * next());
+  *dst << p;
+  for (unsigned int i = 0; i < m_curves_per_contour.value(); ++i)
+    {
+      vec2 ct(p + vec2(200.0f * next() - 100.0f, 200.0f * next() - 100.0f));
+
+      p += vec2(200.0f * next() - 100.0f, 200.0f * next() - 100.0f);
+      *dst << Path::control_point(ct) << p;
+    }
+  *dst << Path::contour_close();
+}
+
+int
+dash_pattern_bench::
+run_cases(void)
+{
+  Path path;
+  for (unsigned int c = 0; c < m_num_contours.value(); ++c)
+    {
+      add_contour(&path, c);
+    }
+  const TessellatedPath &tess(path.tessellation(-1.0f));
+
+  std::cout << std::setw(10) << "elements"
+            << std::setw(10) << "blocks"
+            << std::setw(14) << "linear(reads)"
+            << std::setw(12) << "tree(reads)"
+            << std::setw(14) << "linear(ns)"
+            << std::setw(12) << "tree(ns)"
+            << std::setw(14) << "shader(ns)"
+            << std::setw(10) << "speedup"
+            << std::setw(14) << "effect(ms)"
+            << "\n";
+
+  for (unsigned int n = 1; n <= std::max(1u, m_max_pattern_length.value()); n *= 2u)
+    {
+      std::vector<PainterDashedStrokeParams::DashPatternElement> pattern(n);
+      std::vector<float> distances(m_num_lookups.value());
+      PainterDashedStrokeParams params;
+      PathDashEffect effect;
+      PathEffect::Storage storage;
+      unsigned int seed(31337u * n), linear_reads(0), tree_reads(0), shader_reads(0);
+      int linear_sum(0), tree_sum(0), shader_sum(0);
+      bool mismatch(false);
+      double linear_ns, tree_ns, shader_ns, effect_ms;
+
+      auto next = [&seed]()
+        {
+          seed = seed * 1664525u + 1013904223u;
+          return static_cast<float>(seed >> 8u) / static_cast<float>(1u << 24u);
+        };
+
+      for (PainterDashedStrokeParams::DashPatternElement &e : pattern)
+        {
+          e.m_draw_length = 1.0f + 9.0f * next();
+          e.m_space_length = 1.0f + 9.0f * next();
+          effect.add_dash(e.m_draw_length, e.m_space_length);
+        }
+      params.dash_pattern(c_array<const PainterDashedStrokeParams::DashPatternElement>(pattern.data(), pattern.size()));
+
+      packed_pattern P(params);
+      for (float &d : distances)
+        {
+          d = 3.0f * P.m_total_length * next();
+        }
+
+      simple_time linear_timer;
+      for (float d : distances)
+        {
+          linear_sum += linear_lookup(P, d, &linear_reads).m_ID;
+        }
+      linear_ns = 1000.0 * static_cast<double>(linear_timer.elapsed_us()) / std::max(1.0, static_cast<double>(distances.size()));
+
+      simple_time tree_timer;
+      for (float d : distances)
+        {
+          tree_sum += tree_lookup(P, d, &tree_reads).m_ID;
+        }
+      tree_ns = 1000.0 * static_cast<double>(tree_timer.elapsed_us()) / std::max(1.0, static_cast<double>(distances.size()));
+
+      simple_time shader_timer;
+      for (float d : distances)
+        {
+          shader_sum += shader_lookup(P, d, &shader_reads).m_ID;
+        }
+      shader_ns = 1000.0 * static_cast<double>(shader_timer.elapsed_us()) / std::max(1.0, static_cast<double>(distances.size()));
+
+      for (unsigned int i = 0, endi = std::min(4096u, m_num_lookups.value()); i < endi && !mismatch; ++i)
+        {
+          unsigned int a(0), b(0);
+          mismatch = !(linear_lookup(P, distances[i], &a) == tree_lookup(P, distances[i], &b));
+        }
+      mismatch = mismatch || (linear_sum != tree_sum) || (linear_sum != shader_sum);
+
+      simple_time effect_timer;
+      for (unsigned int c = 0, endc = tess.number_contours(); c < endc; ++c)
+        {
+          for (unsigned int e = 0, ende = tess.number_edges(c); e < ende; ++e)
+            {
+              effect.process_chain(tess.edge_segment_chain(c, e), storage);
+            }
+        }
+      effect_ms = static_cast<double>(effect_timer.elapsed_us()) / 1000.0;
+
+      std::cout << std::setw(10) << n
+                << std::setw(10) << P.intervals().size()
+                << std::setw(14) << std::fixed << std::setprecision(2)
+                << static_cast<double>(linear_reads) / std::max(1.0, static_cast<double>(distances.size()))
+                << std::setw(12)
+                << static_cast<double>(tree_reads) / std::max(1.0, static_cast<double>(distances.size()))
+                << std::setw(14) << linear_ns
+                << std::setw(12) << tree_ns
+                << std::setw(14) << shader_ns
+                << std::setw(10) << linear_ns / std::max(shader_ns, 1e-3)
+                << std::setw(14) << effect_ms
+                << (mismatch ? "  MISMATCH" : "")
+                << "\n";
+    }
+
+  return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+  dash_pattern_bench B;
+  return B.main(argc, argv);
+}
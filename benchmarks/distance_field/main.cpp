@@ -0,0 +1,270 @@
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include <thread>
+#include <string>
+#include <algorithm>
+
+#include <fastuidraw/text/glyph_cache.hpp>
+#include <fastuidraw/text/font_freetype.hpp>
+#include <fastuidraw/text/glyph_generate_params.hpp>
+
+#include "bench_base.hpp"
+#include "simple_time.hpp"
+#include "cast_c_array.hpp"
+#include "host_glyph_atlas_store.hpp"
+
+using namespace fastuidraw;
+
+/* Micro-benchmark for generating distance field glyphs: for each
+ * pixel size, the glyphs of a corpus of fonts are generated with
+ * the reference generator (see
+ * GlyphGenerateParams::distance_field_reference_generator()),
+ * and with the default generator scalar single threaded, with
+ * SIMD and with SIMD across several threads. The uploaded data
+ * of each configuration is hashed to check that all
+ * configurations produce the same bytes as the reference.
+ */
+class distance_field_bench:public bench_base
+{
+public:
+  distance_field_bench(void);
+
+protected:
+  virtual
+  int
+  run_cases(void);
+
+private:
+  class config
+  {
+  public:
+    std::string m_label;
+    unsigned int m_threads;
+    bool m_simd;
+    bool m_reference;
+  };
+
+  static
+  std::vector<std::string>
+  split(const std::string &str, char sep);
+
+  void
+  run_size(unsigned int pixel_size, const std::vector<config> &configs);
+
+  command_line_argument_value<std::string> m_fonts;
+  command_line_argument_value<std::string> m_pixel_sizes;
+  command_line_argument_value<unsigned int> m_threads;
+  command_line_argument_value<unsigned int> m_num_glyphs;
+  repeat_argument m_repeat;
+
+  reference_counted_ptr<FreeTypeLib> m_lib;
+  std::vector<reference_counted_ptr<FreeTypeFace::GeneratorBase> > m_corpus;
+};
+
+distance_field_bench::
+distance_field_bench(void):
+  m_fonts("/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+          "fonts", "colon separated list of font files from which to generate glyphs",
+          *this),
+  m_pixel_sizes("48,128,256,512", "pixel_sizes",
+                "comma separated list of values for "
+                "GlyphGenerateParams::distance_field_pixel_size()", *this),
+  m_threads(std::max(2u, std::thread::hardware_concurrency()), "threads",
+            "number of threads for the multi-threaded configuration", *this),
+  m_num_glyphs(0, "num_glyphs",
+               "number of glyphs to generate from each font, 0 means all glyphs",
+               *this),
+  m_repeat(1, *this)
+{}
+
+std::vector<std::string>
+distance_field_bench::
+split(const std::string &str, char sep)
+{
+  std::vector<std::string> R;
+  std::istringstream istr(str);
+  std::string token;
+
+  while (std::getline(istr, token, sep))
+    {
+      if (!token.empty())
+        {
+          R.push_back(token);
+        }
+    }
+  return R;
+}
+
+void
+distance_field_bench::
+run_size(unsigned int pixel_size, const std::vector<config> &configs)
+{
+  std::vector<reference_counted_ptr<FontFreeType> > fonts;
+  std::vector<std::vector<uint32_t> > glyph_codes;
+  uint64_t reference_hash(0);
+  double reference_ms(0.0);
+  unsigned int total_glyphs(0);
+
+  /* distance_field_pixel_size() can only change while no fonts are alive */
+  if (GlyphGenerateParams::distance_field_pixel_size(pixel_size) == routine_fail)
+    {
+      std::cerr << "Unable to set distance field pixel size to " << pixel_size << "\n";
+      return;
+    }
+
+  for (const auto &gen : m_corpus)
+    {
+      unsigned int num;
+
+      fonts.push_back(FASTUIDRAWnew FontFreeType(gen, m_lib));
+      num = fonts.back()->number_glyphs();
+      if (m_num_glyphs.value() != 0)
+        {
+          num = std::min(num, m_num_glyphs.value());
+        }
+
+      glyph_codes.push_back(std::vector<uint32_t>());
+      for (unsigned int i = 0; i < num; ++i)
+        {
+          glyph_codes.back().push_back(i);
+        }
+      total_glyphs += num;
+    }
+
+  for (const config &C : configs)
+    {
+      fastest_time best;
+      double best_ms;
+      uint64_t hash(0);
+
+      GlyphGenerateParams::distance_field_generation_threads(C.m_threads);
+      GlyphGenerateParams::distance_field_simd(C.m_simd);
+      GlyphGenerateParams::distance_field_reference_generator(C.m_reference);
+
+      for (unsigned int r = 0; r < m_repeat.count(); ++r)
+        {
+          reference_counted_ptr<HostGlyphAtlasStore> store;
+          reference_counted_ptr<GlyphCache> cache;
+          std::vector<std::vector<Glyph> > glyphs(fonts.size());
+
+          store = FASTUIDRAWnew HostGlyphAtlasStore(1024 * 1024);
+          cache = FASTUIDRAWnew GlyphCache(FASTUIDRAWnew GlyphAtlas(store));
+
+          /* only the generation is timed, uploading is not */
+          simple_time timer;
+          for (unsigned int f = 0; f < fonts.size(); ++f)
+            {
+              glyphs[f].resize(glyph_codes[f].size());
+              cache->fetch_glyphs(GlyphRenderer(distance_field_glyph), fonts[f].get(),
+                                  cast_c_array(glyph_codes[f]),
+                                  cast_c_array(glyphs[f]), false);
+            }
+          best.record(timer);
+
+          /* FNV-1a hash of the uploaded data */
+          hash = 14695981039346656037ull;
+          for (const auto &v : glyphs)
+            {
+              for (Glyph G : v)
+                {
+                  G.upload_to_atlas();
+                }
+            }
+          for (uint32_t v : store->values())
+            {
+              hash ^= v;
+              hash *= 1099511628211ull;
+            }
+        }
+
+      best_ms = best.ms();
+      if (&C == &configs.front())
+        {
+          reference_hash = hash;
+          reference_ms = best_ms;
+        }
+
+      std::cout << std::setw(8) << pixel_size
+                << std::setw(20) << C.m_label
+                << std::setw(10) << total_glyphs
+                << std::setw(14) << std::fixed << std::setprecision(2) << best_ms
+                << std::setw(14) << std::setprecision(1)
+                << static_cast<double>(total_glyphs) * 1000.0 / std::max(best_ms, 1e-3)
+                << std::setw(10) << std::setprecision(2)
+                << reference_ms / std::max(best_ms, 1e-3)
+                << std::setw(20) << std::hex << hash << std::dec
+                << ((hash == reference_hash) ? "" : "  MISMATCH")
+                << "\n";
+    }
+}
+
+int
+distance_field_bench::
+run_cases(void)
+{
+  m_lib = FASTUIDRAWnew FreeTypeLib();
+  for (const std::string &file : split(m_fonts.value(), ':'))
+    {
+      reference_counted_ptr<FreeTypeFace::GeneratorBase> gen;
+
+      gen = FASTUIDRAWnew FreeTypeFace::GeneratorFile(file.c_str(), 0);
+      if (gen->check_creation(m_lib) == routine_fail)
+        {
+          std::cerr << "Unable to create font from \"" << file << "\", skipping\n";
+          continue;
+        }
+      m_corpus.push_back(gen);
+    }
+
+  if (m_corpus.empty())
+    {
+      std::cerr << "No fonts to generate glyphs from\n";
+      return -1;
+    }
+
+  std::vector<config> configs(4);
+  std::ostringstream threads_label;
+
+  threads_label << "simd, " << m_threads.value() << " threads";
+  configs[0].m_label = "reference";
+  configs[0].m_threads = 1;
+  configs[0].m_simd = false;
+  configs[0].m_reference = true;
+  configs[1].m_label = "scalar, 1 thread";
+  configs[1].m_threads = 1;
+  configs[1].m_simd = false;
+  configs[1].m_reference = false;
+  configs[2].m_label = "simd, 1 thread";
+  configs[2].m_threads = 1;
+  configs[2].m_simd = true;
+  configs[2].m_reference = false;
+  configs[3].m_label = threads_label.str();
+  configs[3].m_threads = m_threads.value();
+  configs[3].m_simd = true;
+  configs[3].m_reference = false;
+
+  std::cout << std::setw(8) << "size"
+            << std::setw(20) << "config"
+            << std::setw(10) << "glyphs"
+            << std::setw(14) << "time(ms)"
+            << std::setw(14) << "glyphs/sec"
+            << std::setw(10) << "speedup"
+            << std::setw(20) << "hash"
+            << "\n";
+
+  for (const std::string &sz : split(m_pixel_sizes.value(), ','))
+    {
+      run_size(std::max(1, std::atoi(sz.c_str())), configs);
+    }
+
+  return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+  distance_field_bench B;
+  return B.main(argc, argv);
+}
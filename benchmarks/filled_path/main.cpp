@@ -0,0 +1,313 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+#include <fastuidraw/path.hpp>
+#include <fastuidraw/tessellated_path.hpp>
+#include <fastuidraw/painter/attribute_data/filled_path.hpp>
+#include <fastuidraw/painter/attribute_data/painter_attribute_data.hpp>
+
+#include "bench_base.hpp"
+#include "simple_time.hpp"
+
+using namespace fastuidraw;
+
+/* Benchmark for the triangulation of FilledPath: a corpus of
+ * typical UI shapes (rectangles, rounded rectangles, circles,
+ * pills, tabs and arrows) is filled, once with the triangulation
+ * done by GLU-tess and once with FilledPath::fast_triangulation()
+ * enabled. For each shape, the area covered by each winding number
+ * and the number of aa-fuzz indices of each non-zero winding number
+ * are compared between the two to check that the triangulations fill
+ * the same regions. The aa-fuzz of winding number 0 is not compared
+ * because GLU-tess splits the boundary of that region where the
+ * contour touches the bounding box in a way that depends on the
+ * orientation of the contour.
+ */
+class filled_path_bench:public bench_base
+{
+public:
+  filled_path_bench(void);
+
+protected:
+  virtual
+  int
+  run_cases(void);
+
+private:
+  enum shape_t
+    {
+      shape_rect,
+      shape_rounded_rect,
+      shape_circle,
+      shape_pill,
+      shape_tab,
+      shape_arrow,
+
+      number_shapes
+    };
+
+  class fill_summary
+  {
+  public:
+    bool
+    operator==(const fill_summary &rhs) const;
+
+    std::vector<int> m_windings;
+    std::vector<double> m_areas;
+    std::vector<unsigned int> m_aa_fuzz_indices;
+  };
+
+  static
+  const char*
+  label(enum shape_t s);
+
+  static
+  void
+  add_shape(enum shape_t s, const vec2 &pt, const vec2 &sz, Path *dst);
+
+  static
+  fill_summary
+  summarize(const FilledPath &filled);
+
+  double
+  run_shape(enum shape_t s, bool fast, fill_summary *out_summary);
+
+  command_line_argument_value<unsigned int> m_num_paths;
+  command_line_argument_value<float> m_tolerance;
+  repeat_argument m_repeat;
+};
+
+filled_path_bench::
+filled_path_bench(void):
+  m_num_paths(2000, "num_paths", "number of paths of each shape to fill", *this),
+  m_tolerance(0.5f, "tolerance", "tessellation tolerance of the paths", *this),
+  m_repeat(3, *this)
+{}
+
+bool
+filled_path_bench::fill_summary::
+operator==(const fill_summary &rhs) const
+{
+  if (m_windings != rhs.m_windings
+      || m_aa_fuzz_indices != rhs.m_aa_fuzz_indices)
+    {
+      return false;
+    }
+
+  for (unsigned int i = 0; i < m_areas.size(); ++i)
+    {
+      if (std::fabs(m_areas[i] - rhs.m_areas[i]) > 1e-4 * std::max(1.0, std::fabs(m_areas[i])))
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+const char*
+filled_path_bench::
+label(enum shape_t s)
+{
+  static const char *labels[number_shapes] =
+    {
+      "rect",
+      "rounded-rect",
+      "circle",
+      "pill",
+      "tab",
+      "arrow",
+    };
+  return labels[s];
+}
+
+void
+filled_path_bench::
+add_shape(enum shape_t s, const vec2 &pt, const vec2 &sz, Path *dst)
+{
+  float r(0.25f * std::min(sz.x(), sz.y()));
+  vec2 q(pt + sz);
+
+  switch (s)
+    {
+    case shape_rect:
+      *dst << pt
+           << vec2(q.x(), pt.y())
+           << q
+           << vec2(pt.x(), q.y())
+           << Path::contour_close();
+      break;
+
+    case shape_rounded_rect:
+      *dst << vec2(pt.x() + r, pt.y())
+           << vec2(q.x() - r, pt.y())
+           << Path::arc(0.5f * FASTUIDRAW_PI, vec2(q.x(), pt.y() + r))
+           << vec2(q.x(), q.y() - r)
+           << Path::arc(0.5f * FASTUIDRAW_PI, vec2(q.x() - r, q.y()))
+           << vec2(pt.x() + r, q.y())
+           << Path::arc(0.5f * FASTUIDRAW_PI, vec2(pt.x(), q.y() - r))
+           << vec2(pt.x(), pt.y() + r)
+           << Path::contour_close_arc(0.5f * FASTUIDRAW_PI);
+      break;
+
+    case shape_circle:
+      r = 0.5f * std::min(sz.x(), sz.y());
+      *dst << vec2(pt.x() + r, pt.y())
+           << Path::arc(FASTUIDRAW_PI, vec2(pt.x() + r, pt.y() + 2.0f * r))
+           << Path::contour_close_arc(FASTUIDRAW_PI);
+      break;
+
+    case shape_pill:
+      r = 0.5f * sz.y();
+      *dst << vec2(pt.x() + r, pt.y())
+           << vec2(q.x() - r, pt.y())
+           << Path::arc(FASTUIDRAW_PI, vec2(q.x() - r, q.y()))
+           << vec2(pt.x() + r, q.y())
+           << Path::contour_close_arc(FASTUIDRAW_PI);
+      break;
+
+    case shape_tab:
+      *dst << pt
+           << vec2(q.x(), pt.y())
+           << vec2(q.x(), q.y() - r)
+           << Path::arc(0.5f * FASTUIDRAW_PI, vec2(q.x() - r, q.y()))
+           << vec2(pt.x() + r, q.y())
+           << Path::arc(0.5f * FASTUIDRAW_PI, vec2(pt.x(), q.y() - r))
+           << Path::contour_close();
+      break;
+
+    case shape_arrow:
+      *dst << pt
+           << vec2(q.x(), pt.y() + 0.5f * sz.y())
+           << vec2(pt.x(), q.y())
+           << vec2(pt.x() + 0.3f * sz.x(), pt.y() + 0.5f * sz.y())
+           << Path::contour_close();
+      break;
+
+    default:
+      FASTUIDRAWassert(!"Bad shape_t value");
+    }
+}
+
+filled_path_bench::fill_summary
+filled_path_bench::
+summarize(const FilledPath &filled)
+{
+  fill_summary R;
+
+  for (unsigned int s = 0; s < filled.number_subsets(); ++s)
+    {
+      FilledPath::Subset S(filled.subset(s));
+      const PainterAttributeData &data(S.painter_data());
+      const PainterAttributeData &aa_data(S.aa_fuzz_painter_data());
+      c_array<const PainterAttribute> attribs(data.attribute_data_chunk(0));
+
+      for (int w : S.winding_numbers())
+        {
+          c_array<const PainterIndex> indices;
+          unsigned int aa_chunk;
+          double area(0.0);
+
+          indices = data.index_data_chunk(FilledPath::Subset::fill_chunk_from_winding_number(w));
+          for (unsigned int i = 0; i + 2 < indices.size(); i += 3)
+            {
+              vec2 p[3];
+
+              for (unsigned int k = 0; k < 3; ++k)
+                {
+                  const PainterAttribute &a(attribs[indices[i + k]]);
+                  p[k] = vec2(unpack_float(a.m_attrib0.x()), unpack_float(a.m_attrib0.y()));
+                }
+              area += 0.5 * std::fabs((p[1].x() - p[0].x()) * (p[2].y() - p[0].y())
+                                      - (p[2].x() - p[0].x()) * (p[1].y() - p[0].y()));
+            }
+
+          aa_chunk = FilledPath::Subset::aa_fuzz_chunk_from_winding_number(w);
+          R.m_windings.push_back(w);
+          R.m_areas.push_back(area);
+          R.m_aa_fuzz_indices.push_back((w != 0) ? aa_data.index_data_chunk(aa_chunk).size() : 0u);
+        }
+    }
+  return R;
+}
+
+double
+filled_path_bench::
+run_shape(enum shape_t s, bool fast, fill_summary *out_summary)
+{
+  fastest_time best;
+
+  FilledPath::fast_triangulation(fast);
+  for (unsigned int r = 0; r < m_repeat.count(); ++r)
+    {
+      /* the FilledPath of a TessellatedPath is made only once,
+       * so each run needs its own paths.
+       */
+      std::vector<Path> paths(m_num_paths.value());
+      std::vector<const TessellatedPath*> tessellations;
+
+      for (unsigned int i = 0; i < paths.size(); ++i)
+        {
+          vec2 sz(40.0f + static_cast<float>(i % 7), 20.0f + static_cast<float>(i % 5));
+          vec2 pt(static_cast<float>(i % 50), static_cast<float>(i / 50));
+
+          add_shape(s, pt, sz, &paths[i]);
+          tessellations.push_back(&paths[i].tessellation(m_tolerance.value()));
+        }
+
+      /* only the construction and triangulation is timed */
+      simple_time timer;
+      for (const TessellatedPath *T : tessellations)
+        {
+          T->filled().prepare(1);
+        }
+      best.record(timer);
+
+      *out_summary = summarize(tessellations.front()->filled());
+    }
+
+  return best.ms();
+}
+
+int
+filled_path_bench::
+run_cases(void)
+{
+  std::cout << std::setw(14) << "shape"
+            << std::setw(10) << "paths"
+            << std::setw(14) << "glu(ms)"
+            << std::setw(14) << "fast(ms)"
+            << std::setw(10) << "speedup"
+            << "\n";
+
+  for (int s = 0; s < number_shapes; ++s)
+    {
+      enum shape_t shape(static_cast<enum shape_t>(s));
+      fill_summary glu_summary, fast_summary;
+      double glu_ms, fast_ms;
+
+      glu_ms = run_shape(shape, false, &glu_summary);
+      fast_ms = run_shape(shape, true, &fast_summary);
+
+      std::cout << std::setw(14) << label(shape)
+                << std::setw(10) << m_num_paths.value()
+                << std::setw(14) << std::fixed << std::setprecision(2) << glu_ms
+                << std::setw(14) << fast_ms
+                << std::setw(10) << glu_ms / std::max(fast_ms, 1e-3)
+                << ((glu_summary == fast_summary) ? "" : "  MISMATCH")
+                << "\n";
+    }
+  FilledPath::fast_triangulation(true);
+
+  return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+  filled_path_bench B;
+  return B.main(argc, argv);
+}
@@ -0,0 +1,244 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <string>
+#include <algorithm>
+
+#include <fastuidraw/text/glyph_cache.hpp>
+#include <fastuidraw/text/font_freetype.hpp>
+
+#include "bench_base.hpp"
+#include "simple_time.hpp"
+#include "cast_c_array.hpp"
+#include "host_glyph_atlas_store.hpp"
+
+using namespace fastuidraw;
+
+/* Stress benchmark for GlyphCache: N threads request glyphs
+ * from a single GlyphCache and the throughput of glyph generation
+ * is reported for each thread count. In "shared" mode every thread
+ * requests the same glyphs so that concurrent requests for the same
+ * glyph wait on a single generation; otherwise the glyphs are
+ * partitioned between the threads.
+ */
+class glyph_generation_bench:public bench_base
+{
+public:
+  glyph_generation_bench(void);
+
+protected:
+  virtual
+  int
+  run_cases(void);
+
+private:
+  void
+  run_threads(unsigned int num_threads, const std::vector<uint32_t> &glyph_codes);
+
+  static
+  void
+  thread_work(GlyphCache *cache, GlyphRenderer renderer, const FontBase *font,
+              c_array<const uint32_t> glyph_codes, unsigned int batch_size,
+              bool upload);
+
+  GlyphRenderer
+  renderer(void) const;
+
+  command_line_argument_value<std::string> m_font_file;
+  command_line_argument_value<int> m_face_index;
+  enumerated_command_line_argument_value<enum glyph_type> m_type;
+  command_line_argument_value<int> m_coverage_pixel_size;
+  command_line_argument_value<unsigned int> m_max_threads;
+  command_line_argument_value<unsigned int> m_num_glyphs;
+  command_line_argument_value<unsigned int> m_batch_size;
+  command_line_argument_value<unsigned int> m_num_faces;
+  command_line_argument_value<bool> m_shared;
+  command_line_argument_value<bool> m_upload;
+
+  reference_counted_ptr<FreeTypeLib> m_lib;
+  double m_single_thread_rate;
+};
+
+glyph_generation_bench::
+glyph_generation_bench(void):
+  m_font_file("/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+              "font", "font file from which to generate glyphs", *this),
+  m_face_index(0, "face_index", "face index into font file", *this),
+  m_type(restricted_rays_glyph,
+         enumerated_string_type<enum glyph_type>()
+         .add_entry("coverage", coverage_glyph, "coverage glyphs")
+         .add_entry("distance_field", distance_field_glyph, "distance field glyphs")
+         .add_entry("restricted_rays", restricted_rays_glyph, "restricted rays glyphs")
+         .add_entry("banded_rays", banded_rays_glyph, "banded rays glyphs"),
+         "renderer", "glyph renderer type to generate", *this),
+  m_coverage_pixel_size(24, "coverage_pixel_size",
+                        "pixel size when generating coverage glyphs", *this),
+  m_max_threads(std::max(1u, std::thread::hardware_concurrency()), "max_threads",
+                "maximum number of threads; the benchmark runs with 1, 2, 4, ... "
+                "threads up to this value", *this),
+  m_num_glyphs(0, "num_glyphs",
+               "number of glyphs to generate, 0 means all glyphs of the font",
+               *this),
+  m_batch_size(32, "batch_size",
+               "number of glyphs each thread fetches per call to GlyphCache::fetch_glyphs()",
+               *this),
+  m_num_faces(0, "num_faces",
+              "number of FT_Face objects the FontFreeType holds, 0 means "
+              "to use the number of threads of the run", *this),
+  m_shared(false, "shared",
+           "if true, each thread requests all glyphs, otherwise the glyphs "
+           "are partitioned among the threads", *this),
+  m_upload(false, "upload", "if true, also upload the glyphs to the atlas", *this),
+  m_single_thread_rate(0.0)
+{}
+
+GlyphRenderer
+glyph_generation_bench::
+renderer(void) const
+{
+  if (m_type.value() == coverage_glyph)
+    {
+      return GlyphRenderer(m_coverage_pixel_size.value());
+    }
+  return GlyphRenderer(m_type.value());
+}
+
+void
+glyph_generation_bench::
+thread_work(GlyphCache *cache, GlyphRenderer renderer, const FontBase *font,
+            c_array<const uint32_t> glyph_codes, unsigned int batch_size,
+            bool upload)
+{
+  std::vector<Glyph> glyphs(batch_size);
+  while (!glyph_codes.empty())
+    {
+      unsigned int cnt;
+
+      cnt = std::min(batch_size, static_cast<unsigned int>(glyph_codes.size()));
+      cache->fetch_glyphs(renderer, font, glyph_codes.sub_array(0, cnt),
+                          cast_c_array(glyphs).sub_array(0, cnt), upload);
+      glyph_codes = glyph_codes.sub_array(cnt);
+    }
+}
+
+void
+glyph_generation_bench::
+run_threads(unsigned int num_threads, const std::vector<uint32_t> &glyph_codes)
+{
+  reference_counted_ptr<FreeTypeFace::GeneratorBase> gen;
+  reference_counted_ptr<FontFreeType> font;
+  reference_counted_ptr<GlyphCache> cache;
+  std::vector<std::vector<uint32_t> > per_thread_codes(num_threads);
+  std::vector<std::thread> threads;
+  unsigned int num_faces, total_requests(0);
+
+  num_faces = (m_num_faces.value() != 0) ? m_num_faces.value() : num_threads;
+  gen = FASTUIDRAWnew FreeTypeFace::GeneratorFile(m_font_file.value().c_str(), m_face_index.value());
+  font = FASTUIDRAWnew FontFreeType(gen, m_lib, num_faces);
+  cache = FASTUIDRAWnew GlyphCache(FASTUIDRAWnew GlyphAtlas(FASTUIDRAWnew HostGlyphAtlasStore(1024 * 1024)));
+
+  for (unsigned int i = 0; i < glyph_codes.size(); ++i)
+    {
+      if (m_shared.value())
+        {
+          for (unsigned int t = 0; t < num_threads; ++t)
+            {
+              per_thread_codes[t].push_back(glyph_codes[i]);
+            }
+        }
+      else
+        {
+          per_thread_codes[i % num_threads].push_back(glyph_codes[i]);
+        }
+    }
+
+  for (const auto &v : per_thread_codes)
+    {
+      total_requests += v.size();
+    }
+
+  simple_time timer;
+  for (unsigned int t = 0; t < num_threads; ++t)
+    {
+      threads.push_back(std::thread(thread_work, cache.get(), renderer(), font.get(),
+                                    cast_c_array(per_thread_codes[t]),
+                                    std::max(1u, m_batch_size.value()),
+                                    m_upload.value()));
+    }
+  for (auto &t : threads)
+    {
+      t.join();
+    }
+
+  double ms, rate;
+  ms = static_cast<double>(timer.elapsed_us()) / 1000.0;
+  rate = static_cast<double>(glyph_codes.size()) * 1000.0 / std::max(ms, 1e-3);
+  if (num_threads == 1)
+    {
+      m_single_thread_rate = rate;
+    }
+
+  std::cout << std::setw(8) << num_threads
+            << std::setw(10) << num_faces
+            << std::setw(10) << glyph_codes.size()
+            << std::setw(10) << total_requests
+            << std::setw(14) << std::fixed << std::setprecision(2) << ms
+            << std::setw(14) << std::setprecision(1) << rate
+            << std::setw(10) << std::setprecision(2)
+            << rate / std::max(m_single_thread_rate, 1e-6)
+            << "\n";
+}
+
+int
+glyph_generation_bench::
+run_cases(void)
+{
+  reference_counted_ptr<FreeTypeFace::GeneratorBase> gen;
+  gen = FASTUIDRAWnew FreeTypeFace::GeneratorFile(m_font_file.value().c_str(), m_face_index.value());
+
+  m_lib = FASTUIDRAWnew FreeTypeLib();
+  if (gen->check_creation(m_lib) == routine_fail)
+    {
+      std::cerr << "Unable to create font from \"" << m_font_file.value()
+                << "\", face index = " << m_face_index.value() << "\n";
+      return -1;
+    }
+
+  unsigned int number_glyphs;
+  std::vector<uint32_t> glyph_codes;
+
+  number_glyphs = FontFreeType(gen, m_lib, 1).number_glyphs();
+  if (m_num_glyphs.value() != 0)
+    {
+      number_glyphs = std::min(number_glyphs, m_num_glyphs.value());
+    }
+  for (unsigned int i = 0; i < number_glyphs; ++i)
+    {
+      glyph_codes.push_back(i);
+    }
+
+  std::cout << std::setw(8) << "threads"
+            << std::setw(10) << "faces"
+            << std::setw(10) << "glyphs"
+            << std::setw(10) << "requests"
+            << std::setw(14) << "time(ms)"
+            << std::setw(14) << "glyphs/sec"
+            << std::setw(10) << "speedup"
+            << "\n";
+
+  for (unsigned int t = 1; t < m_max_threads.value(); t *= 2)
+    {
+      run_threads(t, glyph_codes);
+    }
+  run_threads(std::max(1u, m_max_threads.value()), glyph_codes);
+
+  return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+  glyph_generation_bench B;
+  return B.main(argc, argv);
+}
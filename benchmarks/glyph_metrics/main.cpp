@@ -0,0 +1,241 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <string>
+#include <algorithm>
+
+#include <fastuidraw/text/glyph_cache.hpp>
+#include <fastuidraw/text/font_freetype.hpp>
+
+#include "bench_base.hpp"
+#include "simple_time.hpp"
+#include "cast_c_array.hpp"
+#include "host_glyph_atlas_store.hpp"
+
+using namespace fastuidraw;
+
+/* Benchmark for GlyphCache::fetch_glyph_metrics(): N threads
+ * each fetch the metrics of long runs of glyphs from a single
+ * GlyphCache whose metrics are already computed, once with the
+ * metrics looked up through the locked map of the GlyphCache
+ * and once through the dense per-font tables.
+ */
+class glyph_metrics_bench:public bench_base
+{
+public:
+  glyph_metrics_bench(void);
+
+protected:
+  virtual
+  int
+  run_cases(void);
+
+private:
+  double
+  run_threads(GlyphCache *cache, const FontBase *font,
+              unsigned int num_threads, bool per_glyph);
+
+  static
+  void
+  thread_work(GlyphCache *cache, const FontBase *font,
+              c_array<const uint32_t> glyph_codes,
+              unsigned int run_length, unsigned int num_passes,
+              bool per_glyph, float *out_sum);
+
+  command_line_argument_value<std::string> m_font_file;
+  command_line_argument_value<int> m_face_index;
+  command_line_argument_value<unsigned int> m_max_threads;
+  command_line_argument_value<unsigned int> m_num_glyphs;
+  command_line_argument_value<unsigned int> m_run_length;
+  command_line_argument_value<unsigned int> m_num_passes;
+
+  std::vector<uint32_t> m_glyph_codes;
+  float m_reference_sum;
+};
+
+glyph_metrics_bench::
+glyph_metrics_bench(void):
+  m_font_file("/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+              "font", "font file from which to fetch glyph metrics", *this),
+  m_face_index(0, "face_index", "face index into font file", *this),
+  m_max_threads(std::max(1u, std::thread::hardware_concurrency()), "max_threads",
+                "maximum number of threads; the benchmark runs with 1, 2, 4, ... "
+                "threads up to this value", *this),
+  m_num_glyphs(100000, "num_glyphs",
+               "number of glyphs each thread fetches per pass", *this),
+  m_run_length(100000, "run_length",
+               "number of glyphs per call to GlyphCache::fetch_glyph_metrics()",
+               *this),
+  m_num_passes(10, "num_passes", "number of passes each thread makes", *this),
+  m_reference_sum(0.0f)
+{}
+
+void
+glyph_metrics_bench::
+thread_work(GlyphCache *cache, const FontBase *font,
+            c_array<const uint32_t> glyph_codes,
+            unsigned int run_length, unsigned int num_passes,
+            bool per_glyph, float *out_sum)
+{
+  std::vector<GlyphMetrics> metrics(glyph_codes.size());
+  float sum(0.0f);
+
+  for (unsigned int pass = 0; pass < num_passes; ++pass)
+    {
+      if (per_glyph)
+        {
+          for (unsigned int i = 0; i < glyph_codes.size(); ++i)
+            {
+              metrics[i] = cache->fetch_glyph_metrics(font, glyph_codes[i]);
+            }
+        }
+      else
+        {
+          for (unsigned int i = 0; i < glyph_codes.size(); i += run_length)
+            {
+              unsigned int cnt;
+
+              cnt = std::min(run_length, static_cast<unsigned int>(glyph_codes.size()) - i);
+              cache->fetch_glyph_metrics(font, glyph_codes.sub_array(i, cnt),
+                                         cast_c_array(metrics).sub_array(i, cnt));
+            }
+        }
+    }
+
+  /* use the metrics so that the fetches are not optimized
+   * away and so that the two modes can be compared.
+   */
+  for (const GlyphMetrics &M : metrics)
+    {
+      sum += M.advance().x();
+    }
+  *out_sum = sum;
+}
+
+double
+glyph_metrics_bench::
+run_threads(GlyphCache *cache, const FontBase *font,
+            unsigned int num_threads, bool per_glyph)
+{
+  std::vector<std::thread> threads;
+  std::vector<float> sums(num_threads, 0.0f);
+  unsigned int run_length(std::max(1u, m_run_length.value()));
+
+  simple_time timer;
+  for (unsigned int t = 0; t < num_threads; ++t)
+    {
+      threads.push_back(std::thread(thread_work, cache, font,
+                                    cast_c_array(m_glyph_codes),
+                                    run_length, m_num_passes.value(),
+                                    per_glyph, &sums[t]));
+    }
+  for (auto &t : threads)
+    {
+      t.join();
+    }
+
+  double ms, total;
+  ms = static_cast<double>(timer.elapsed_us()) / 1000.0;
+  total = static_cast<double>(m_glyph_codes.size())
+    * static_cast<double>(m_num_passes.value() * num_threads);
+
+  for (float s : sums)
+    {
+      if (s != m_reference_sum)
+        {
+          std::cerr << "Metrics differ between runs\n";
+        }
+    }
+
+  /* nanoseconds per glyph */
+  return ms * 1e6 / std::max(total, 1.0);
+}
+
+int
+glyph_metrics_bench::
+run_cases(void)
+{
+  reference_counted_ptr<FreeTypeFace::GeneratorBase> gen;
+  reference_counted_ptr<FreeTypeLib> lib;
+
+  gen = FASTUIDRAWnew FreeTypeFace::GeneratorFile(m_font_file.value().c_str(), m_face_index.value());
+  lib = FASTUIDRAWnew FreeTypeLib();
+  if (gen->check_creation(lib) == routine_fail)
+    {
+      std::cerr << "Unable to create font from \"" << m_font_file.value()
+                << "\", face index = " << m_face_index.value() << "\n";
+      return -1;
+    }
+
+  reference_counted_ptr<FontFreeType> font;
+  reference_counted_ptr<GlyphCache> cache;
+  unsigned int number_glyphs;
+
+  font = FASTUIDRAWnew FontFreeType(gen, lib);
+  cache = FASTUIDRAWnew GlyphCache(FASTUIDRAWnew GlyphAtlas(FASTUIDRAWnew HostGlyphAtlasStore(1024)));
+  number_glyphs = std::max(1u, font->number_glyphs());
+
+  /* a deterministic scattering of the glyphs of the font */
+  for (unsigned int i = 0; i < m_num_glyphs.value(); ++i)
+    {
+      m_glyph_codes.push_back((i * 2654435761u) % number_glyphs);
+    }
+
+  /* compute all metrics up front and record the reference sum */
+  {
+    std::vector<GlyphMetrics> metrics(m_glyph_codes.size());
+
+    cache->fetch_glyph_metrics(font.get(), cast_c_array(m_glyph_codes), cast_c_array(metrics));
+    for (const GlyphMetrics &M : metrics)
+      {
+        m_reference_sum += M.advance().x();
+      }
+  }
+
+  std::cout << std::setw(8) << "threads"
+            << std::setw(12) << "mode"
+            << std::setw(16) << "map(ns/glyph)"
+            << std::setw(16) << "dense(ns/glyph)"
+            << std::setw(10) << "speedup"
+            << "\n";
+
+  std::vector<unsigned int> thread_counts;
+  for (unsigned int t = 1; t < m_max_threads.value(); t *= 2)
+    {
+      thread_counts.push_back(t);
+    }
+  thread_counts.push_back(std::max(1u, m_max_threads.value()));
+
+  for (unsigned int t : thread_counts)
+    {
+      for (int per_glyph = 0; per_glyph < 2; ++per_glyph)
+        {
+          double map_ns, dense_ns;
+
+          cache->dense_glyph_metrics(false);
+          map_ns = run_threads(cache.get(), font.get(), t, per_glyph);
+
+          /* the first fetch publishes the metrics to the dense table */
+          cache->dense_glyph_metrics(true);
+          run_threads(cache.get(), font.get(), 1, false);
+          dense_ns = run_threads(cache.get(), font.get(), t, per_glyph);
+
+          std::cout << std::setw(8) << t
+                    << std::setw(12) << (per_glyph ? "per-glyph" : "bulk")
+                    << std::setw(16) << std::fixed << std::setprecision(2) << map_ns
+                    << std::setw(16) << dense_ns
+                    << std::setw(10) << map_ns / std::max(dense_ns, 1e-6)
+                    << "\n";
+        }
+    }
+
+  return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+  glyph_metrics_bench B;
+  return B.main(argc, argv);
+}
@@ -0,0 +1,908 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <map>
+#include <memory>
+#include <functional>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+#include <fastuidraw/path.hpp>
+#include <fastuidraw/painter/painter.hpp>
+#include <fastuidraw/painter/attribute_data/glyph_sequence.hpp>
+#include <fastuidraw/painter/attribute_data/glyph_run.hpp>
+#include <fastuidraw/painter/effects/painter_effect_brush.hpp>
+#include <fastuidraw/painter/shader_data/painter_dashed_stroke_params.hpp>
+#include <fastuidraw/text/font_freetype.hpp>
+#include <fastuidraw/null_backend/painter_engine_null.hpp>
+
+#include "bench_base.hpp"
+#include "simple_time.hpp"
+
+using namespace fastuidraw;
+
+/* Reproducible benchmark of Painter: a fixed set of scenes is
+ * drawn with a Painter whose engine is the null (headless)
+ * backend, so that the time taken for each frame is the CPU
+ * time spent by Painter and PainterPacker to produce the
+ * attribute, index and data-store data. For each scene the
+ * time per frame is reported together with the values of
+ * Painter::query_stats() and the counters of PainterEngineNull
+ * for one frame; the report is JSON with one scene per line
+ * and can be compared against a report saved from an earlier
+ * run with the option baseline.
+ */
+class painter_bench:public bench_base
+{
+public:
+  painter_bench(void);
+
+protected:
+  virtual
+  int
+  run_cases(void);
+
+private:
+  enum
+    {
+      number_rects = 20000,
+      number_glyphs = 4000,
+      glyphs_per_line = 100,
+      label_columns = 20,
+      label_rows = 20,
+      glyphs_per_label = 6,
+      clip_depth = 12,
+      layer_depth = 4,
+    };
+
+  class result
+  {
+  public:
+    std::string m_name;
+    double m_mean_ms, m_median_ms, m_min_ms;
+    std::vector<unsigned int> m_stats;
+    std::vector<uint64_t> m_counters;
+    uint64_t m_checksum;
+  };
+
+  class scene
+  {
+  public:
+    std::string m_name;
+    std::function<void (Painter&)> m_draw;
+  };
+
+  class display_list:public PainterDisplayList
+  {
+  public:
+    explicit
+    display_list(const std::function<void (Painter&)> &f):
+      m_draw(f)
+    {}
+
+    virtual
+    void
+    draw_content(Painter &painter) const override
+    {
+      m_draw(painter);
+    }
+
+  private:
+    std::function<void (Painter&)> m_draw;
+  };
+
+  void
+  create_paths(void);
+
+  bool
+  create_glyph_sequence(void);
+
+  void
+  create_labels(void);
+
+  void
+  draw_rects(Painter &painter);
+
+  void
+  record_rects(void);
+
+  void
+  draw_rects_display_list(Painter &painter);
+
+  void
+  draw_blend_interleaved(Painter &painter, unsigned int reorder_window);
+
+  void
+  draw_path_fill(Painter &painter, float zoom);
+
+  void
+  draw_dashed_stroke(Painter &painter);
+
+  void
+  draw_glyphs(Painter &painter, GlyphRenderer renderer);
+
+  void
+  draw_glyphs_icons_interleaved(Painter &painter, unsigned int reorder_window);
+
+  void
+  draw_clip_stack(Painter &painter);
+
+  void
+  draw_layers(Painter &painter, int depth);
+
+  result
+  run_scene(const scene &S);
+
+  void
+  write_json(std::ostream &dst, const std::vector<result> &results);
+
+  static
+  std::string
+  json_line(const result &R);
+
+  int
+  compare_against_baseline(const std::vector<result> &results);
+
+  command_line_argument_value<unsigned int> m_frames;
+  command_line_argument_value<unsigned int> m_warmup_frames;
+  command_line_argument_value<int> m_width, m_height;
+  command_line_argument_value<std::string> m_font_file;
+  command_line_argument_value<int> m_face_index;
+  command_line_argument_value<bool> m_checksum;
+  command_line_argument_value<std::string> m_json_file;
+  command_line_argument_value<std::string> m_baseline;
+  command_line_argument_value<float> m_tolerance;
+
+  reference_counted_ptr<null::PainterEngineNull> m_engine;
+  reference_counted_ptr<Painter> m_painter;
+  reference_counted_ptr<PainterSurface> m_surface;
+  reference_counted_ptr<PainterCommandList> m_rects_list;
+  reference_counted_ptr<display_list> m_rects_display_list;
+  unsigned int m_rects_display_list_frame;
+  reference_counted_ptr<PainterEffectBrush> m_effect;
+  reference_counted_ptr<FreeTypeLib> m_lib;
+  reference_counted_ptr<FontFreeType> m_font;
+  std::unique_ptr<GlyphSequence> m_glyph_sequence;
+  std::unique_ptr<GlyphRun> m_labels;
+  Path m_fill_path, m_clip_path, m_icon_path;
+  std::vector<PainterDashedStrokeParams::DashPatternElement> m_dash_pattern;
+};
+
+painter_bench::
+painter_bench(void):
+  m_frames(50, "frames", "number of timed frames drawn for each scene", *this),
+  m_warmup_frames(5, "warmup_frames",
+                  "number of frames drawn for each scene before timing, these "
+                  "frames generate the glyph and tessellation data the scene uses",
+                  *this),
+  m_width(1024, "width", "width of the surface to which to draw", *this),
+  m_height(768, "height", "height of the surface to which to draw", *this),
+  m_font_file("/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+              "font", "font file for the glyph scenes; if the font cannot be "
+              "loaded, the glyph scenes are skipped", *this),
+  m_face_index(0, "face_index", "face index into font file", *this),
+  m_checksum(false, "checksum",
+             "if true, hash the data of one frame of each scene and report it "
+             "so that changes to what Painter generates can be detected",
+             *this),
+  m_json_file("painter-bench.json", "json_file", "file to which to write the report", *this),
+  m_baseline("", "baseline", "if non-empty, a report from an earlier run "
+             "against which to compare; the exit code is non-zero if any "
+             "scene is slower than its baseline by more than tolerance",
+             *this),
+  m_tolerance(0.1f, "tolerance", "fraction by which the minimum time per frame "
+              "of a scene may exceed the baseline before it is reported as "
+              "a regression", *this)
+{}
+
+void
+painter_bench::
+create_paths(void)
+{
+  unsigned int seed(1234u);
+  auto next = [&seed]()
+    {
+      seed = seed * 1664525u + 1013904223u;
+      return static_cast<float>(seed >> 8u) / static_cast<float>(1u << 24u);
+    };
+
+  /* a large path of many contours made of quadratic and
+   * cubic curves, filled and stroked at different zooms.
+   */
+  for (unsigned int c = 0; c < 16; ++c)
+    {
+      vec2 center(1024.0f * next(), 768.0f * next());
+      float radius(100.0f + 200.0f * next());
+      const unsigned int num_curves(32);
+
+      for (unsigned int i = 0; i < num_curves; ++i)
+        {
+          float t0(2.0f * FASTUIDRAW_PI * static_cast<float>(i) / static_cast<float>(num_curves));
+          float t1(2.0f * FASTUIDRAW_PI * (static_cast<float>(i) + 0.5f) / static_cast<float>(num_curves));
+          float r0(radius * (0.6f + 0.4f * next()));
+          float r1(radius * (0.6f + 0.8f * next()));
+          vec2 p(center + r0 * vec2(std::cos(t0), std::sin(t0)));
+          vec2 ct(center + r1 * vec2(std::cos(t1), std::sin(t1)));
+
+          m_fill_path << p;
+          if (i & 1u)
+            {
+              m_fill_path << Path::control_point(ct);
+            }
+          else
+            {
+              m_fill_path << Path::control_point(ct)
+                          << Path::control_point(0.5f * (ct + center));
+            }
+        }
+      m_fill_path << Path::contour_close();
+    }
+
+  m_clip_path << vec2(0.0f, 0.0f)
+              << Path::control_point(vec2(60.0f, -40.0f))
+              << vec2(120.0f, 0.0f)
+              << Path::control_point(vec2(160.0f, 60.0f))
+              << vec2(120.0f, 120.0f)
+              << vec2(0.0f, 120.0f)
+              << Path::contour_close();
+
+  /* a small icon drawn next to each label of the
+   * glyphs_icons_interleaved scenes.
+   */
+  for (unsigned int i = 0; i < 10; ++i)
+    {
+      float t(2.0f * FASTUIDRAW_PI * static_cast<float>(i) / 10.0f);
+      float r((i & 1u) ? 2.5f : 6.0f);
+
+      m_icon_path << vec2(6.0f, 6.0f) + r * vec2(std::cos(t), std::sin(t));
+    }
+  m_icon_path << Path::contour_close();
+
+  for (unsigned int i = 0; i < 8; ++i)
+    {
+      PainterDashedStrokeParams::DashPatternElement e;
+
+      e.m_draw_length = 4.0f + 4.0f * static_cast<float>(i);
+      e.m_space_length = 2.0f + 2.0f * static_cast<float>(i & 3u);
+      m_dash_pattern.push_back(e);
+    }
+}
+
+bool
+painter_bench::
+create_glyph_sequence(void)
+{
+  reference_counted_ptr<FreeTypeFace::GeneratorBase> gen;
+
+  m_lib = FASTUIDRAWnew FreeTypeLib();
+  gen = FASTUIDRAWnew FreeTypeFace::GeneratorFile(m_font_file.value().c_str(), m_face_index.value());
+  if (gen->check_creation(m_lib) == routine_fail)
+    {
+      return false;
+    }
+
+  const float format_size(16.0f);
+  unsigned int font_glyphs;
+
+  m_font = FASTUIDRAWnew FontFreeType(gen, m_lib);
+  m_glyph_sequence.reset(FASTUIDRAWnew GlyphSequence(format_size, Painter::y_increases_downwards,
+                                                     m_engine->glyph_cache()));
+
+  /* lay the glyphs out on a fixed grid, the benchmark is about
+   * how long Painter takes to draw a long run of glyphs and
+   * not about the quality of the layout.
+   */
+  font_glyphs = std::max(2u, m_font->number_glyphs());
+  for (unsigned int i = 0; i < number_glyphs; ++i)
+    {
+      uint32_t glyph_code(1u + (7u * i) % (font_glyphs - 1u));
+      vec2 pen(0.6f * format_size * static_cast<float>(i % glyphs_per_line),
+               1.2f * format_size * static_cast<float>(1u + i / glyphs_per_line));
+
+      m_glyph_sequence->add_glyph(GlyphSource(m_font.get(), glyph_code), pen);
+    }
+  return true;
+}
+
+void
+painter_bench::
+create_labels(void)
+{
+  const float format_size(12.0f);
+  const vec2 cell(static_cast<float>(m_width.value()) / static_cast<float>(label_columns),
+                  static_cast<float>(m_height.value()) / static_cast<float>(label_rows));
+  unsigned int font_glyphs;
+
+  /* the glyphs of each label are consecutive in m_labels,
+   * the label L is the range [L * glyphs_per_label, (L + 1) * glyphs_per_label)
+   */
+  m_labels.reset(FASTUIDRAWnew GlyphRun(format_size, Painter::y_increases_downwards,
+                                        m_engine->glyph_cache()));
+  font_glyphs = std::max(2u, m_font->number_glyphs());
+  for (unsigned int L = 0; L < label_columns * label_rows; ++L)
+    {
+      vec2 origin(cell.x() * static_cast<float>(L % label_columns),
+                  cell.y() * static_cast<float>(L / label_columns));
+
+      for (unsigned int i = 0; i < glyphs_per_label; ++i)
+        {
+          uint32_t glyph_code(1u + (11u * L + 3u * i) % (font_glyphs - 1u));
+          vec2 pen(origin + vec2(16.0f + 0.6f * format_size * static_cast<float>(i), format_size));
+
+          m_labels->add_glyph(GlyphSource(m_font.get(), glyph_code), pen);
+        }
+    }
+}
+
+void
+painter_bench::
+draw_rects(Painter &painter)
+{
+  const int cols(200);
+  PainterBrush brush;
+
+  for (int i = 0; i < number_rects; ++i)
+    {
+      float x(5.0f * static_cast<float>(i % cols)), y(5.0f * static_cast<float>(i / cols));
+
+      brush.color(static_cast<float>(i & 3) / 3.0f,
+                  static_cast<float>((i >> 2) & 3) / 3.0f,
+                  0.5f, 1.0f);
+      painter.fill_rect(brush, Rect().min_point(x, y).max_point(x + 4.0f, y + 4.0f), false);
+    }
+}
+
+void
+painter_bench::
+record_rects(void)
+{
+  /* the rects scene recorded once by a different Painter;
+   * each frame of the scene rects_command_list only merges
+   * the recorded data and so gives the render thread cost
+   * of content recorded with PainterCommandList.
+   */
+  Painter recorder(m_engine);
+
+  m_rects_list = FASTUIDRAWnew PainterCommandList(ivec2(m_width.value(), m_height.value()));
+  recorder.begin(m_rects_list, Painter::y_increases_downwards);
+  draw_rects(recorder);
+  recorder.end();
+}
+
+void
+painter_bench::
+draw_rects_display_list(Painter &painter)
+{
+  /* the rects scene as a PainterDisplayList scrolled by a
+   * different amount each frame; only the first frame records
+   * the content, the other frames copy the retained data and
+   * rewrite the item matrices.
+   */
+  if (!m_rects_display_list)
+    {
+      m_rects_display_list = FASTUIDRAWnew display_list([this](Painter &p) { draw_rects(p); });
+      m_rects_display_list_frame = 0;
+    }
+
+  painter.save();
+  painter.translate(vec2(0.0f, -static_cast<float>(m_rects_display_list_frame++ % 16u)));
+  painter.draw_display_list(*m_rects_display_list);
+  painter.restore();
+}
+
+void
+painter_bench::
+draw_blend_interleaved(Painter &painter, unsigned int reorder_window)
+{
+  /* the rects of the rects scene, alternating between two
+   * blend modes so that each rect needs a draw break unless
+   * the (non-overlapping) rects are reordered.
+   */
+  const int cols(200);
+  unsigned int prev_window(painter.draw_reorder_window());
+  PainterBrush brush;
+
+  painter.save();
+  painter.draw_reorder_window(reorder_window);
+  for (int i = 0; i < number_rects; ++i)
+    {
+      float x(5.0f * static_cast<float>(i % cols)), y(5.0f * static_cast<float>(i / cols));
+
+      painter.blend_shader((i & 1) ?
+                           Painter::blend_w3c_multiply :
+                           Painter::blend_porter_duff_src_over);
+      brush.color(static_cast<float>(i & 3) / 3.0f, 0.5f, 0.5f, 0.5f);
+      painter.fill_rect(brush, Rect().min_point(x, y).max_point(x + 4.0f, y + 4.0f), false);
+    }
+  painter.draw_reorder_window(prev_window);
+  painter.restore();
+}
+
+void
+painter_bench::
+draw_path_fill(Painter &painter, float zoom)
+{
+  PainterBrush brush;
+
+  brush.color(0.2f, 0.4f, 0.8f, 0.75f);
+  painter.save();
+  painter.translate(vec2(0.5f * static_cast<float>(m_width.value()),
+                         0.5f * static_cast<float>(m_height.value())));
+  painter.scale(zoom);
+  painter.translate(vec2(-512.0f, -384.0f));
+  painter.fill_path(brush, m_fill_path, Painter::nonzero_fill_rule, true);
+  painter.restore();
+}
+
+void
+painter_bench::
+draw_dashed_stroke(Painter &painter)
+{
+  PainterBrush brush;
+  PainterDashedStrokeParams params;
+
+  brush.color(0.9f, 0.3f, 0.1f, 1.0f);
+  params
+    .width(6.0f)
+    .dash_pattern(c_array<const PainterDashedStrokeParams::DashPatternElement>(m_dash_pattern.data(),
+                                                                               m_dash_pattern.size()));
+  painter.stroke_dashed_path(brush, params, m_fill_path,
+                             StrokingStyle()
+                             .join_style(Painter::rounded_joins)
+                             .cap_style(Painter::square_caps));
+}
+
+void
+painter_bench::
+draw_glyphs(Painter &painter, GlyphRenderer renderer)
+{
+  PainterBrush brush;
+
+  brush.color(0.0f, 0.0f, 0.0f, 1.0f);
+  painter.draw_glyphs(brush, *m_glyph_sequence, renderer);
+}
+
+void
+painter_bench::
+draw_glyphs_icons_interleaved(Painter &painter, unsigned int reorder_window)
+{
+  /* a list of labels each made of an icon followed by its
+   * text, as a UI draws them; the icons are composited with
+   * a different blend mode than the glyphs so that each label
+   * needs two draw breaks unless the (non-overlapping) labels
+   * are reordered, which needs the bounds of the path fills
+   * and of the glyph runs.
+   */
+  const vec2 cell(static_cast<float>(m_width.value()) / static_cast<float>(label_columns),
+                  static_cast<float>(m_height.value()) / static_cast<float>(label_rows));
+  unsigned int prev_window(painter.draw_reorder_window());
+  PainterBrush icon_brush, text_brush;
+
+  icon_brush.color(0.9f, 0.6f, 0.1f, 1.0f);
+  text_brush.color(0.0f, 0.0f, 0.0f, 1.0f);
+
+  painter.save();
+  painter.draw_reorder_window(reorder_window);
+  for (unsigned int L = 0; L < label_columns * label_rows; ++L)
+    {
+      vec2 origin(cell.x() * static_cast<float>(L % label_columns),
+                  cell.y() * static_cast<float>(L / label_columns));
+
+      painter.save();
+      painter.blend_shader(Painter::blend_w3c_multiply);
+      painter.translate(origin);
+      painter.fill_path(icon_brush, m_icon_path, Painter::nonzero_fill_rule, false);
+      painter.restore();
+
+      painter.draw_glyphs(text_brush, *m_labels, L * glyphs_per_label, glyphs_per_label,
+                          GlyphRenderer(banded_rays_glyph));
+    }
+  painter.draw_reorder_window(prev_window);
+  painter.restore();
+}
+
+void
+painter_bench::
+draw_clip_stack(Painter &painter)
+{
+  PainterBrush brush;
+  Rect R;
+
+  R
+    .min_point(0.0f, 0.0f)
+    .max_point(static_cast<float>(m_width.value()), static_cast<float>(m_height.value()));
+
+  for (int d = 0; d < clip_depth; ++d)
+    {
+      painter.save();
+      painter.clip_in_rect(R);
+      if (d & 1)
+        {
+          painter.save();
+          painter.translate(0.5f * (R.m_min_point + R.m_max_point));
+          painter.clip_out_path(m_clip_path, Painter::nonzero_fill_rule);
+          painter.restore();
+        }
+
+      brush.color(static_cast<float>(d) / static_cast<float>(clip_depth), 0.5f, 0.5f, 1.0f);
+      painter.fill_rect(brush, R);
+      painter.fill_path(brush, m_clip_path, Painter::nonzero_fill_rule, true);
+
+      R.m_min_point += vec2(16.0f, 12.0f);
+      R.m_max_point -= vec2(16.0f, 12.0f);
+    }
+
+  for (int d = 0; d < clip_depth; ++d)
+    {
+      painter.restore();
+    }
+}
+
+void
+painter_bench::
+draw_layers(Painter &painter, int depth)
+{
+  PainterBrush brush;
+
+  if (depth == 0)
+    {
+      return;
+    }
+
+  /* alternate between transparency layers and
+   * layers with a PainterEffect applied.
+   */
+  if (depth & 1)
+    {
+      painter.begin_layer(0.8f);
+    }
+  else
+    {
+      PainterEffectBrushParams params;
+
+      params.color(vec4(1.0f, 0.9f, 0.8f, 1.0f));
+      painter.begin_layer(m_effect, params);
+    }
+
+  brush.color(0.3f, 0.6f, 0.3f, 0.9f);
+  painter.fill_rect(brush, Rect()
+                    .min_point(20.0f * static_cast<float>(depth), 20.0f * static_cast<float>(depth))
+                    .max_point(600.0f, 400.0f));
+  painter.save();
+  painter.scale(0.5f);
+  painter.fill_path(brush, m_fill_path, Painter::nonzero_fill_rule, true);
+  painter.restore();
+
+  draw_layers(painter, depth - 1);
+  painter.end_layer();
+}
+
+painter_bench::result
+painter_bench::
+run_scene(const scene &S)
+{
+  result R;
+  std::vector<double> times;
+
+  for (unsigned int i = 0; i < m_warmup_frames.value(); ++i)
+    {
+      m_painter->begin(m_surface, Painter::y_increases_downwards);
+      S.m_draw(*m_painter);
+      m_painter->end();
+    }
+
+  /* the counters (and checksum) are for a single frame so
+   * that they do not depend on the number of frames drawn.
+   */
+  m_engine->reset_counters();
+  for (unsigned int i = 0; i < m_frames.value(); ++i)
+    {
+      simple_time timer;
+
+      m_painter->begin(m_surface, Painter::y_increases_downwards);
+      S.m_draw(*m_painter);
+      m_painter->end();
+      times.push_back(static_cast<double>(timer.elapsed_us()) / 1000.0);
+
+      if (i == 0)
+        {
+          R.m_stats.resize(Painter::number_stats());
+          m_painter->query_stats(c_array<unsigned int>(R.m_stats.data(), R.m_stats.size()));
+
+          R.m_counters.resize(null::PainterEngineNull::number_counters);
+          m_engine->counters(c_array<uint64_t>(R.m_counters.data(), R.m_counters.size()));
+          R.m_checksum = m_engine->checksum();
+        }
+    }
+
+  R.m_name = S.m_name;
+  R.m_mean_ms = 0.0;
+  for (double t : times)
+    {
+      R.m_mean_ms += t;
+    }
+  R.m_mean_ms /= static_cast<double>(std::max(std::size_t(1), times.size()));
+
+  std::sort(times.begin(), times.end());
+  R.m_min_ms = times.empty() ? 0.0 : times.front();
+  R.m_median_ms = times.empty() ? 0.0 : times[times.size() / 2];
+
+  return R;
+}
+
+std::string
+painter_bench::
+json_line(const result &R)
+{
+  std::ostringstream str;
+
+  str << "{\"name\": \"" << R.m_name << "\""
+      << std::fixed << std::setprecision(4)
+      << ", \"ms_per_frame_mean\": " << R.m_mean_ms
+      << ", \"ms_per_frame_median\": " << R.m_median_ms
+      << ", \"ms_per_frame_min\": " << R.m_min_ms
+      << ", \"query_stats\": {";
+
+  for (unsigned int i = 0; i < R.m_stats.size(); ++i)
+    {
+      str << (i != 0 ? ", " : "")
+          << "\"" << PainterEnums::label(static_cast<enum PainterEnums::query_stats_t>(i))
+          << "\": " << R.m_stats[i];
+    }
+
+  str << "}, \"backend_counters\": {";
+  for (unsigned int i = 0; i < R.m_counters.size(); ++i)
+    {
+      str << (i != 0 ? ", " : "")
+          << "\"" << null::PainterEngineNull::counter_label(static_cast<enum null::PainterEngineNull::counter_t>(i))
+          << "\": " << R.m_counters[i];
+    }
+  str << "}";
+
+  if (R.m_checksum != 0u)
+    {
+      str << ", \"checksum\": \"" << std::hex << R.m_checksum << "\"";
+    }
+  str << "}";
+
+  return str.str();
+}
+
+void
+painter_bench::
+write_json(std::ostream &dst, const std::vector<result> &results)
+{
+  dst << "{\n"
+      << "\"frames\": " << m_frames.value() << ",\n"
+      << "\"width\": " << m_width.value() << ",\n"
+      << "\"height\": " << m_height.value() << ",\n"
+      << "\"scenarios\": [\n";
+  for (unsigned int i = 0; i < results.size(); ++i)
+    {
+      dst << json_line(results[i])
+          << ((i + 1 != results.size()) ? ",\n" : "\n");
+    }
+  dst << "]\n}\n";
+}
+
+namespace
+{
+  /* The reports are written with one scene per line, so a
+   * baseline is read by looking for the fields of a scene
+   * within a single line instead of a real JSON parser.
+   */
+  bool
+  json_field(const std::string &line, const std::string &key, std::string *out_value)
+  {
+    std::string::size_type p, e;
+
+    p = line.find("\"" + key + "\": ");
+    if (p == std::string::npos)
+      {
+        return false;
+      }
+
+    p += key.length() + 4;
+    if (p < line.length() && line[p] == '"')
+      {
+        ++p;
+        e = line.find('"', p);
+      }
+    else
+      {
+        e = line.find_first_of(",}", p);
+      }
+
+    if (e == std::string::npos)
+      {
+        return false;
+      }
+    *out_value = line.substr(p, e - p);
+    return true;
+  }
+}
+
+int
+painter_bench::
+compare_against_baseline(const std::vector<result> &results)
+{
+  std::ifstream file(m_baseline.value().c_str());
+  std::map<std::string, std::string> baseline;
+  std::string line;
+  int return_value(0);
+
+  if (!file)
+    {
+      std::cerr << "Unable to open baseline \"" << m_baseline.value() << "\"\n";
+      return -1;
+    }
+
+  while (std::getline(file, line))
+    {
+      std::string name;
+      if (json_field(line, "name", &name))
+        {
+          baseline[name] = line;
+        }
+    }
+
+  std::cout << "\n" << std::setw(28) << "scenario"
+            << std::setw(14) << "baseline(ms)"
+            << std::setw(14) << "current(ms)"
+            << std::setw(10) << "ratio"
+            << "  status\n";
+
+  for (const result &R : results)
+    {
+      std::map<std::string, std::string>::const_iterator iter;
+      std::string value, notes;
+      double baseline_ms, ratio;
+
+      iter = baseline.find(R.m_name);
+      if (iter == baseline.end() || !json_field(iter->second, "ms_per_frame_min", &value))
+        {
+          std::cout << std::setw(28) << R.m_name << std::setw(14) << "-"
+                    << std::setw(14) << R.m_min_ms << std::setw(10) << "-"
+                    << "  new\n";
+          continue;
+        }
+
+      baseline_ms = std::atof(value.c_str());
+      ratio = R.m_min_ms / std::max(baseline_ms, 1e-6);
+
+      for (unsigned int i = 0; i < R.m_stats.size(); ++i)
+        {
+          c_string label(PainterEnums::label(static_cast<enum PainterEnums::query_stats_t>(i)));
+          if (json_field(iter->second, label, &value)
+              && std::strtoul(value.c_str(), nullptr, 10) != R.m_stats[i])
+            {
+              notes += std::string(" ") + label + ":" + value + "->" + std::to_string(R.m_stats[i]);
+            }
+        }
+
+      if (R.m_checksum != 0u && json_field(iter->second, "checksum", &value)
+          && std::strtoull(value.c_str(), nullptr, 16) != R.m_checksum)
+        {
+          notes += " checksum changed";
+        }
+
+      std::cout << std::setw(28) << R.m_name
+                << std::fixed << std::setprecision(3)
+                << std::setw(14) << baseline_ms
+                << std::setw(14) << R.m_min_ms
+                << std::setw(10) << ratio;
+
+      if (ratio > 1.0 + m_tolerance.value())
+        {
+          std::cout << "  REGRESSION";
+          return_value = 1;
+        }
+      else if (ratio < 1.0 - m_tolerance.value())
+        {
+          std::cout << "  faster";
+        }
+      else
+        {
+          std::cout << "  ok";
+        }
+      std::cout << notes << "\n";
+    }
+
+  return return_value;
+}
+
+int
+painter_bench::
+run_cases(void)
+{
+  null::PainterEngineNull::Configuration config;
+  std::vector<scene> scenes;
+  std::vector<result> results;
+
+  config.compute_checksum(m_checksum.value());
+  m_engine = null::PainterEngineNull::create(config);
+  m_painter = FASTUIDRAWnew Painter(m_engine);
+  m_surface = m_engine->create_surface(ivec2(m_width.value(), m_height.value()),
+                                       PainterSurface::color_buffer_type);
+  m_effect = FASTUIDRAWnew PainterEffectBrush();
+  create_paths();
+
+  scenes.push_back({"rects", [this](Painter &p) { draw_rects(p); }});
+
+  record_rects();
+  scenes.push_back({"rects_command_list", [this](Painter &p) { p.draw_command_list(*m_rects_list); }});
+  scenes.push_back({"rects_display_list", [this](Painter &p) { draw_rects_display_list(p); }});
+  scenes.push_back({"blend_interleaved", [this](Painter &p) { draw_blend_interleaved(p, 0); }});
+  scenes.push_back({"blend_interleaved_reordered", [this](Painter &p) { draw_blend_interleaved(p, 64); }});
+  scenes.push_back({"path_fill_zoom_0.25", [this](Painter &p) { draw_path_fill(p, 0.25f); }});
+  scenes.push_back({"path_fill_zoom_1", [this](Painter &p) { draw_path_fill(p, 1.0f); }});
+  scenes.push_back({"path_fill_zoom_4", [this](Painter &p) { draw_path_fill(p, 4.0f); }});
+  scenes.push_back({"dashed_stroke", [this](Painter &p) { draw_dashed_stroke(p); }});
+
+  if (create_glyph_sequence())
+    {
+      scenes.push_back({"glyphs_coverage", [this](Painter &p) { draw_glyphs(p, GlyphRenderer(16)); }});
+      scenes.push_back({"glyphs_distance_field", [this](Painter &p) { draw_glyphs(p, GlyphRenderer(distance_field_glyph)); }});
+      scenes.push_back({"glyphs_restricted_rays", [this](Painter &p) { draw_glyphs(p, GlyphRenderer(restricted_rays_glyph)); }});
+      scenes.push_back({"glyphs_banded_rays", [this](Painter &p) { draw_glyphs(p, GlyphRenderer(banded_rays_glyph)); }});
+
+      create_labels();
+      scenes.push_back({"glyphs_icons", [this](Painter &p) { draw_glyphs_icons_interleaved(p, 0); }});
+      scenes.push_back({"glyphs_icons_reordered", [this](Painter &p) { draw_glyphs_icons_interleaved(p, 64); }});
+    }
+  else
+    {
+      std::cerr << "Unable to create font from \"" << m_font_file.value()
+                << "\", face index = " << m_face_index.value()
+                << "; skipping glyph scenes\n";
+    }
+
+  scenes.push_back({"clip_stack", [this](Painter &p) { draw_clip_stack(p); }});
+  scenes.push_back({"layers", [this](Painter &p) { draw_layers(p, layer_depth); }});
+
+  std::cout << std::setw(28) << "scenario"
+            << std::setw(14) << "median(ms)"
+            << std::setw(14) << "min(ms)"
+            << std::setw(12) << "draws"
+            << std::setw(12) << "attributes"
+            << std::setw(12) << "indices"
+            << "\n";
+  for (const scene &S : scenes)
+    {
+      results.push_back(run_scene(S));
+      std::cout << std::setw(28) << S.m_name
+                << std::fixed << std::setprecision(3)
+                << std::setw(14) << results.back().m_median_ms
+                << std::setw(14) << results.back().m_min_ms
+                << std::setw(12) << results.back().m_stats[PainterEnums::num_draws]
+                << std::setw(12) << results.back().m_stats[PainterEnums::num_attributes]
+                << std::setw(12) << results.back().m_stats[PainterEnums::num_indices]
+                << "\n";
+    }
+
+  std::ofstream file(m_json_file.value().c_str());
+  if (!file)
+    {
+      std::cerr << "Unable to open \"" << m_json_file.value() << "\" for writing\n";
+      return -1;
+    }
+  write_json(file, results);
+
+  if (!m_baseline.value().empty())
+    {
+      return compare_against_baseline(results);
+    }
+
+  return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+  painter_bench B;
+  return B.main(argc, argv);
+}
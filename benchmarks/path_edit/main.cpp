@@ -0,0 +1,290 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+#include <fastuidraw/path.hpp>
+#include <fastuidraw/tessellated_path.hpp>
+
+#include "bench_base.hpp"
+#include "simple_time.hpp"
+
+using namespace fastuidraw;
+
+/* Benchmark for editing a Path in the manner of a streaming chart:
+ * each frame a Path of many contours is edited, by appending a
+ * contour, by replacing a contour or by removing the oldest contour
+ * and appending a new one, and then its starting tessellation is
+ * fetched. The time per frame is compared against tessellating a
+ * Path made from scratch with the same contours, which is what
+ * every edit cost before the tessellation of each contour was
+ * kept with the contour. The tessellations of the two must be
+ * the same.
+ */
+class path_edit_bench:public bench_base
+{
+public:
+  path_edit_bench(void);
+
+protected:
+  virtual
+  int
+  run_cases(void);
+
+private:
+  enum edit_t
+    {
+      edit_append,
+      edit_replace,
+      edit_slide,
+
+      number_edits
+    };
+
+  class result
+  {
+  public:
+    double m_edited_ms, m_rebuilt_ms;
+    bool m_same;
+  };
+
+  void
+  add_contour(Path *dst, unsigned int id);
+
+  void
+  make_path(Path *dst, const std::vector<unsigned int> &ids);
+
+  result
+  run(enum edit_t edit);
+
+  static
+  bool
+  same_segments(const TessellatedPath &a, const TessellatedPath &b);
+
+  static
+  c_string
+  label(enum edit_t edit);
+
+  command_line_argument_value<unsigned int> m_num_contours;
+  command_line_argument_value<unsigned int> m_curves_per_contour;
+  command_line_argument_value<unsigned int> m_num_frames;
+};
+
+path_edit_bench::
+path_edit_bench(void):
+  m_num_contours(200, "num_contours", "number of contours of the path", *this),
+  m_curves_per_contour(100, "curves_per_contour",
+                       "number of curves of each contour, alternating "
+                       "between quadratic and cubic curves", *this),
+  m_num_frames(50, "num_frames", "number of frames, i.e. edits, to run", *this)
+{}
+
+c_string
+path_edit_bench::
+label(enum edit_t edit)
+{
+  switch (edit)
+    {
+    case edit_append:
+      return "append";
+    case edit_replace:
+      return "replace";
+    case edit_slide:
+      return "slide";
+    default:
+      return "";
+    }
+}
+
+void
+path_edit_bench::
+add_contour(Path *dst, unsigned int id)
+{
+  /* a deterministic random walk, seeded by the id of the contour,
+   * whose steps turn slowly.
+   */
+  unsigned int seed(12345u + 7919u * id);
+  auto next = [&seed]()
+    {
+      seed = seed * 1664525u + 1013904223u;
+      return static_cast<float>(seed >> 8u) / static_cast<float>(1u << 24u);
+    };
+
+  vec2 p(1000.0f * next(), 1000.0f * next());
+  float angle(2.0f * FASTUIDRAW_PI * next());
+
+  *dst << p;
+  for (unsigned int i = 0; i < m_curves_per_contour.value(); ++i)
+    {
+      vec2 ct[2];
+
+      for (unsigned int k = 0; k < 2; ++k)
+        {
+          angle += 0.8f * (next() - 0.5f);
+          p += (5.0f + 10.0f * next()) * vec2(std::cos(angle), std::sin(angle));
+          ct[k] = p;
+        }
+      angle += 0.8f * (next() - 0.5f);
+      p += (5.0f + 10.0f * next()) * vec2(std::cos(angle), std::sin(angle));
+
+      if (i & 1u)
+        {
+          *dst << Path::control_point(ct[0]) << Path::control_point(ct[1]) << p;
+        }
+      else
+        {
+          *dst << Path::control_point(ct[0]) << p;
+        }
+    }
+  *dst << Path::contour_close();
+}
+
+void
+path_edit_bench::
+make_path(Path *dst, const std::vector<unsigned int> &ids)
+{
+  for (unsigned int id : ids)
+    {
+      add_contour(dst, id);
+    }
+}
+
+bool
+path_edit_bench::
+same_segments(const TessellatedPath &a, const TessellatedPath &b)
+{
+  c_array<const TessellatedPath::segment> sa(a.segment_data());
+  c_array<const TessellatedPath::segment> sb(b.segment_data());
+
+  if (sa.size() != sb.size()
+      || a.max_distance() != b.max_distance()
+      || a.max_recursion() != b.max_recursion())
+    {
+      return false;
+    }
+
+  for (unsigned int i = 0; i < sa.size(); ++i)
+    {
+      if (sa[i].m_type != sb[i].m_type
+          || sa[i].m_start_pt != sb[i].m_start_pt
+          || sa[i].m_end_pt != sb[i].m_end_pt
+          || sa[i].m_center != sb[i].m_center
+          || sa[i].m_radius != sb[i].m_radius
+          || sa[i].m_length != sb[i].m_length
+          || sa[i].m_distance_from_contour_start != sb[i].m_distance_from_contour_start)
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+path_edit_bench::result
+path_edit_bench::
+run(enum edit_t edit)
+{
+  result R;
+  Path live;
+  std::vector<unsigned int> ids;
+  unsigned int next_id;
+
+  R.m_edited_ms = R.m_rebuilt_ms = 0.0;
+  R.m_same = true;
+  for (next_id = 0; next_id < m_num_contours.value(); ++next_id)
+    {
+      ids.push_back(next_id);
+    }
+  make_path(&live, ids);
+  live.tessellation(-1.0f);
+
+  for (unsigned int f = 0; f < m_num_frames.value(); ++f, ++next_id)
+    {
+      double edited_ms, rebuilt_ms;
+
+      switch (edit)
+        {
+        case edit_append:
+          add_contour(&live, next_id);
+          ids.push_back(next_id);
+          break;
+
+        case edit_replace:
+          {
+            Path tmp;
+            unsigned int i(f % ids.size());
+
+            add_contour(&tmp, next_id);
+            live.replace_contour(i, tmp.contour(0));
+            ids[i] = next_id;
+          }
+          break;
+
+        default:
+          live.remove_contour(0);
+          ids.erase(ids.begin());
+          add_contour(&live, next_id);
+          ids.push_back(next_id);
+        }
+
+      simple_time edited_timer;
+      const TessellatedPath &edited(live.tessellation(-1.0f));
+      edited_ms = static_cast<double>(edited_timer.elapsed_us()) / 1000.0;
+
+      Path rebuilt;
+      make_path(&rebuilt, ids);
+
+      simple_time rebuilt_timer;
+      const TessellatedPath &full(rebuilt.tessellation(-1.0f));
+      rebuilt_ms = static_cast<double>(rebuilt_timer.elapsed_us()) / 1000.0;
+
+      R.m_edited_ms += edited_ms;
+      R.m_rebuilt_ms += rebuilt_ms;
+      R.m_same = R.m_same && same_segments(edited, full);
+    }
+
+  R.m_edited_ms /= static_cast<double>(std::max(1u, m_num_frames.value()));
+  R.m_rebuilt_ms /= static_cast<double>(std::max(1u, m_num_frames.value()));
+  return R;
+}
+
+int
+path_edit_bench::
+run_cases(void)
+{
+  std::cout << std::setw(10) << "edit"
+            << std::setw(18) << "rebuilt(ms/frame)"
+            << std::setw(18) << "edited(ms/frame)"
+            << std::setw(10) << "speedup"
+            << "\n";
+
+  for (int e = 0; e < number_edits; ++e)
+    {
+      enum edit_t edit(static_cast<enum edit_t>(e));
+      result R;
+
+      R = run(edit);
+      std::cout << std::setw(10) << label(edit)
+                << std::setw(18) << std::fixed << std::setprecision(3) << R.m_rebuilt_ms
+                << std::setw(18) << R.m_edited_ms
+                << std::setw(10) << std::setprecision(2)
+                << R.m_rebuilt_ms / std::max(R.m_edited_ms, 1e-3)
+                << "\n";
+
+      if (!R.m_same)
+        {
+          std::cout << "MISMATCH: tessellation of edited path differs "
+                    << "from that of the path made from scratch\n";
+        }
+    }
+
+  return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+  path_edit_bench B;
+  return B.main(argc, argv);
+}
@@ -0,0 +1,228 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+#include <fastuidraw/path.hpp>
+#include <fastuidraw/tessellated_path.hpp>
+
+#include "bench_base.hpp"
+#include "simple_time.hpp"
+
+using namespace fastuidraw;
+
+/* Benchmark for the tessellation of Bezier curves: paths made
+ * of many quadratic and cubic curves in the manner of a coastline
+ * are tessellated, once with PathContour::bezier::fast_tessellation()
+ * disabled and once with it enabled. Both the starting tessellation
+ * and the refinement to a tolerance are timed. The starting
+ * tessellations of the two must be the same, the refined ones
+ * only both must meet the tolerance.
+ */
+class path_tessellation_bench:public bench_base
+{
+public:
+  path_tessellation_bench(void);
+
+protected:
+  virtual
+  int
+  run_cases(void);
+
+private:
+  class result
+  {
+  public:
+    double m_start_ms, m_refine_ms;
+    std::vector<TessellatedPath::segment> m_start_segments;
+    unsigned int m_refined_segments;
+    float m_refined_max_distance;
+  };
+
+  void
+  make_path(Path *dst);
+
+  result
+  run(bool fast);
+
+  static
+  bool
+  same_segments(const std::vector<TessellatedPath::segment> &a,
+                const std::vector<TessellatedPath::segment> &b);
+
+  command_line_argument_value<unsigned int> m_num_contours;
+  command_line_argument_value<unsigned int> m_curves_per_contour;
+  command_line_argument_value<float> m_tolerance;
+  repeat_argument m_repeat;
+};
+
+path_tessellation_bench::
+path_tessellation_bench(void):
+  m_num_contours(100, "num_contours", "number of contours of the path", *this),
+  m_curves_per_contour(500, "curves_per_contour",
+                       "number of curves of each contour, alternating "
+                       "between quadratic and cubic curves", *this),
+  m_tolerance(0.01f, "tolerance", "tolerance to which to refine the tessellation", *this),
+  m_repeat(3, *this)
+{}
+
+void
+path_tessellation_bench::
+make_path(Path *dst)
+{
+  /* a deterministic random walk whose steps turn slowly */
+  unsigned int seed(12345u);
+  auto next = [&seed]()
+    {
+      seed = seed * 1664525u + 1013904223u;
+      return static_cast<float>(seed >> 8u) / static_cast<float>(1u << 24u);
+    };
+
+  for (unsigned int c = 0; c < m_num_contours.value(); ++c)
+    {
+      vec2 p(1000.0f * next(), 1000.0f * next());
+      float angle(2.0f * FASTUIDRAW_PI * next());
+
+      *dst << p;
+      for (unsigned int i = 0; i < m_curves_per_contour.value(); ++i)
+        {
+          vec2 ct[2];
+
+          for (unsigned int k = 0; k < 2; ++k)
+            {
+              angle += 0.8f * (next() - 0.5f);
+              p += (5.0f + 10.0f * next()) * vec2(std::cos(angle), std::sin(angle));
+              ct[k] = p;
+            }
+          angle += 0.8f * (next() - 0.5f);
+          p += (5.0f + 10.0f * next()) * vec2(std::cos(angle), std::sin(angle));
+
+          if (i & 1u)
+            {
+              *dst << Path::control_point(ct[0]) << Path::control_point(ct[1]) << p;
+            }
+          else
+            {
+              *dst << Path::control_point(ct[0]) << p;
+            }
+        }
+      *dst << Path::contour_close();
+    }
+}
+
+bool
+path_tessellation_bench::
+same_segments(const std::vector<TessellatedPath::segment> &a,
+              const std::vector<TessellatedPath::segment> &b)
+{
+  if (a.size() != b.size())
+    {
+      return false;
+    }
+
+  for (unsigned int i = 0; i < a.size(); ++i)
+    {
+      if (a[i].m_type != b[i].m_type
+          || a[i].m_start_pt != b[i].m_start_pt
+          || a[i].m_end_pt != b[i].m_end_pt
+          || a[i].m_center != b[i].m_center
+          || a[i].m_radius != b[i].m_radius)
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+path_tessellation_bench::result
+path_tessellation_bench::
+run(bool fast)
+{
+  result R;
+  fastest_time start_time, refine_time;
+
+  PathContour::bezier::fast_tessellation(fast);
+  for (unsigned int r = 0; r < m_repeat.count(); ++r)
+    {
+      /* a Path keeps its tessellations, so each run
+       * needs its own Path.
+       */
+      Path path;
+
+      make_path(&path);
+
+      simple_time start_timer;
+      const TessellatedPath &start(path.tessellation(-1.0f));
+      start_time.record(start_timer);
+
+      simple_time refine_timer;
+      const TessellatedPath &refined(path.tessellation(m_tolerance.value()));
+      refine_time.record(refine_timer);
+
+      R.m_start_segments.assign(start.segment_data().begin(), start.segment_data().end());
+      R.m_refined_segments = refined.segment_data().size();
+      R.m_refined_max_distance = refined.max_distance();
+    }
+  R.m_start_ms = start_time.ms();
+  R.m_refine_ms = refine_time.ms();
+
+  return R;
+}
+
+int
+path_tessellation_bench::
+run_cases(void)
+{
+  result generic, fast;
+
+  generic = run(false);
+  fast = run(true);
+  PathContour::bezier::fast_tessellation(true);
+
+  std::cout << std::setw(10) << "mode"
+            << std::setw(14) << "start(ms)"
+            << std::setw(14) << "refine(ms)"
+            << std::setw(12) << "segments"
+            << std::setw(16) << "max_distance"
+            << "\n";
+
+  std::cout << std::setw(10) << "generic"
+            << std::setw(14) << std::fixed << std::setprecision(2) << generic.m_start_ms
+            << std::setw(14) << generic.m_refine_ms
+            << std::setw(12) << generic.m_refined_segments
+            << std::setw(16) << std::setprecision(6) << generic.m_refined_max_distance
+            << "\n";
+
+  std::cout << std::setw(10) << "fast"
+            << std::setw(14) << std::setprecision(2) << fast.m_start_ms
+            << std::setw(14) << fast.m_refine_ms
+            << std::setw(12) << fast.m_refined_segments
+            << std::setw(16) << std::setprecision(6) << fast.m_refined_max_distance
+            << "\n";
+
+  std::cout << "\nspeedup: start " << std::setprecision(2)
+            << generic.m_start_ms / std::max(fast.m_start_ms, 1e-3)
+            << ", refine " << generic.m_refine_ms / std::max(fast.m_refine_ms, 1e-3)
+            << "\n";
+
+  if (!same_segments(generic.m_start_segments, fast.m_start_segments))
+    {
+      std::cout << "MISMATCH: starting tessellations differ\n";
+    }
+
+  if (fast.m_refined_max_distance > m_tolerance.value())
+    {
+      std::cout << "MISMATCH: refined tessellation does not meet the tolerance\n";
+    }
+
+  return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+  path_tessellation_bench B;
+  return B.main(argc, argv);
+}
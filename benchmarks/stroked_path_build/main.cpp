@@ -0,0 +1,286 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+#include <fastuidraw/path.hpp>
+#include <fastuidraw/tessellated_path.hpp>
+#include <fastuidraw/partitioned_tessellated_path.hpp>
+#include <fastuidraw/painter/attribute_data/stroked_path.hpp>
+#include <fastuidraw/painter/attribute_data/painter_attribute_data.hpp>
+
+#include "bench_base.hpp"
+#include "simple_time.hpp"
+
+using namespace fastuidraw;
+
+/* Benchmark for building the data of a StrokedPath: a path of
+ * many contours is stroked and all of its edge, join and cap data
+ * is made with StrokedPath::prepare(). This is done on a single
+ * thread and then on several threads, with the partitioning of
+ * the path into subsets also done across threads, see
+ * PartitionedTessellatedPath::number_build_threads(). The time of
+ * each and a check that the attribute data made with several
+ * threads is byte-for-byte the same as that made with one thread
+ * is reported.
+ */
+class stroked_path_build_bench:public bench_base
+{
+public:
+  stroked_path_build_bench(void);
+
+protected:
+  virtual
+  int
+  run_cases(void);
+
+private:
+  class result
+  {
+  public:
+    double m_partition_ms, m_prepare_ms;
+    unsigned int m_number_subsets;
+    uint32_t m_checksum;
+  };
+
+  void
+  add_contour(Path *dst, unsigned int id);
+
+  static
+  void
+  add_to_checksum(const PainterAttributeData &data, uint32_t *hash);
+
+  static
+  uint32_t
+  checksum(const StrokedPath &stroked);
+
+  result
+  run(unsigned int num_threads);
+
+  command_line_argument_value<unsigned int> m_num_contours;
+  command_line_argument_value<unsigned int> m_curves_per_contour;
+  command_line_argument_value<unsigned int> m_num_threads;
+  repeat_argument m_repeat;
+};
+
+stroked_path_build_bench::
+stroked_path_build_bench(void):
+  m_num_contours(200, "num_contours", "number of contours of the path", *this),
+  m_curves_per_contour(100, "curves_per_contour",
+                       "number of curves of each contour, alternating "
+                       "between quadratic and cubic curves", *this),
+  m_num_threads(4, "num_threads", "number of threads for the multi-threaded run", *this),
+  m_repeat(3, *this)
+{}
+
+void
+stroked_path_build_bench::
+add_contour(Path *dst, unsigned int id)
+{
+  unsigned int seed(12345u + 7919u * id);
+  auto next = [&seed]()
+    {
+      seed = seed * 1664525u + 1013904223u;
+      return static_cast<float>(seed >> 8u) / static_cast<float>(1u << 24u);
+    };
+
+  vec2 p(2000.0f * next(), 2000.0f * next());
+  float angle(2.0f * FASTUIDRAW_PI * next());
+
+  *dst << p;
+  for (unsigned int i = 0; i < m_curves_per_contour.value(); ++i)
+    {
+      vec2 ct[2];
+
+      for (unsigned int k = 0; k < 2; ++k)
+        {
+          angle += 0.8f * (next() - 0.5f);
+          p += (5.0f + 10.0f * next()) * vec2(std::cos(angle), std::sin(angle));
+          ct[k] = p;
+        }
+      angle += 0.8f * (next() - 0.5f);
+      p += (5.0f + 10.0f * next()) * vec2(std::cos(angle), std::sin(angle));
+
+      if (i & 1u)
+        {
+          *dst << Path::control_point(ct[0]) << Path::control_point(ct[1]) << p;
+        }
+      else
+        {
+          *dst << Path::control_point(ct[0]) << p;
+        }
+    }
+
+  /* leave every third contour open so that there are caps */
+  if (id % 3u != 0u)
+    {
+      *dst << Path::contour_close();
+    }
+}
+
+void
+stroked_path_build_bench::
+add_to_checksum(const PainterAttributeData &data, uint32_t *hash)
+{
+  auto add = [hash](uint32_t v)
+    {
+      *hash = (*hash ^ v) * 16777619u;
+    };
+
+  for (c_array<const PainterAttribute> attribs : data.attribute_data_chunks())
+    {
+      add(attribs.size());
+      for (const PainterAttribute &a : attribs)
+        {
+          for (unsigned int k = 0; k < 4; ++k)
+            {
+              add(a.m_attrib0[k]);
+              add(a.m_attrib1[k]);
+              add(a.m_attrib2[k]);
+            }
+        }
+    }
+  for (c_array<const PainterIndex> indices : data.index_data_chunks())
+    {
+      add(indices.size());
+      for (PainterIndex idx : indices)
+        {
+          add(idx);
+        }
+    }
+  for (const range_type<int> &z : data.z_ranges())
+    {
+      add(z.m_begin);
+      add(z.m_end);
+    }
+}
+
+uint32_t
+stroked_path_build_bench::
+checksum(const StrokedPath &stroked)
+{
+  uint32_t hash(2166136261u);
+  StrokedPath::SubsetSelection selection;
+
+  /* the Subset objects without children and those whose
+   * children could be merged, i.e. those that have data.
+   */
+  for (unsigned int s = 0; s < stroked.number_subsets(); ++s)
+    {
+      StrokedPath::Subset S(stroked.subset(s));
+      if (!S.has_children())
+        {
+          add_to_checksum(S.painter_data(), &hash);
+        }
+    }
+  stroked.select_subsets_no_culling(~0u, ~0u, selection);
+  for (unsigned int id : selection.subset_ids())
+    {
+      add_to_checksum(stroked.subset(id).painter_data(), &hash);
+    }
+
+  add_to_checksum(stroked.bevel_joins(), &hash);
+  add_to_checksum(stroked.miter_clip_joins(), &hash);
+  add_to_checksum(stroked.miter_joins(), &hash);
+  add_to_checksum(stroked.miter_bevel_joins(), &hash);
+  add_to_checksum(stroked.arc_rounded_joins(), &hash);
+  add_to_checksum(stroked.rounded_joins(1.0f), &hash);
+  add_to_checksum(stroked.square_caps(), &hash);
+  add_to_checksum(stroked.adjustable_caps(), &hash);
+  add_to_checksum(stroked.flat_caps(), &hash);
+  add_to_checksum(stroked.arc_rounded_caps(), &hash);
+  add_to_checksum(stroked.rounded_caps(1.0f), &hash);
+
+  return hash;
+}
+
+stroked_path_build_bench::result
+stroked_path_build_bench::
+run(unsigned int num_threads)
+{
+  result R;
+  fastest_time partition_time, prepare_time;
+
+  PartitionedTessellatedPath::number_build_threads(num_threads);
+  for (unsigned int r = 0; r < m_repeat.count(); ++r)
+    {
+      /* the StrokedPath of a TessellatedPath is made only
+       * once, so each run needs its own path.
+       */
+      Path path;
+
+      for (unsigned int c = 0; c < m_num_contours.value(); ++c)
+        {
+          add_contour(&path, c);
+        }
+      const TessellatedPath &tess(path.tessellation(-1.0f));
+
+      simple_time partition_timer;
+      tess.partitioned();
+      partition_time.record(partition_timer);
+
+      simple_time prepare_timer;
+      const StrokedPath &stroked(tess.stroked());
+      stroked.prepare(num_threads);
+      prepare_time.record(prepare_timer);
+
+      R.m_number_subsets = stroked.number_subsets();
+      R.m_checksum = checksum(stroked);
+    }
+  R.m_partition_ms = partition_time.ms();
+  R.m_prepare_ms = prepare_time.ms();
+  PartitionedTessellatedPath::number_build_threads(1);
+
+  return R;
+}
+
+int
+stroked_path_build_bench::
+run_cases(void)
+{
+  std::cout << std::setw(10) << "threads"
+            << std::setw(10) << "subsets"
+            << std::setw(16) << "partition(ms)"
+            << std::setw(14) << "prepare(ms)"
+            << std::setw(14) << "total(ms)"
+            << std::setw(10) << "speedup"
+            << "\n";
+
+  result serial, parallel;
+  serial = run(1);
+  parallel = run(std::max(1u, m_num_threads.value()));
+
+  for (unsigned int i = 0; i < 2; ++i)
+    {
+      const result &R((i == 0) ? serial : parallel);
+      unsigned int threads((i == 0) ? 1u : std::max(1u, m_num_threads.value()));
+      double total(R.m_partition_ms + R.m_prepare_ms);
+      double serial_total(serial.m_partition_ms + serial.m_prepare_ms);
+
+      std::cout << std::setw(10) << threads
+                << std::setw(10) << R.m_number_subsets
+                << std::setw(16) << std::fixed << std::setprecision(2) << R.m_partition_ms
+                << std::setw(14) << R.m_prepare_ms
+                << std::setw(14) << total
+                << std::setw(10) << serial_total / std::max(total, 1e-3)
+                << "\n";
+    }
+
+  if (serial.m_checksum != parallel.m_checksum
+      || serial.m_number_subsets != parallel.m_number_subsets)
+    {
+      std::cout << "MISMATCH: data made with several threads differs "
+                << "from the data made with one thread\n";
+    }
+
+  return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+  stroked_path_build_bench B;
+  return B.main(argc, argv);
+}
@@ -0,0 +1,247 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+#include <fastuidraw/path.hpp>
+#include <fastuidraw/tessellated_path.hpp>
+#include <fastuidraw/painter/attribute_data/filled_path.hpp>
+#include <fastuidraw/painter/attribute_data/painter_attribute_data.hpp>
+
+#include "bench_base.hpp"
+#include "simple_time.hpp"
+
+using namespace fastuidraw;
+
+/* Benchmark for the allocation done by the triangulation of the
+ * Subset objects of a FilledPath with GLU-tess: a set of paths
+ * made of self-intersecting contours is filled, once with GLU-tess
+ * allocating its vertices, faces, edges and sweep line data from
+ * the heap one at a time and once from the arena each thread keeps,
+ * see FilledPath::triangulation_arena(bool). Each is done with
+ * one thread and with several threads. The heap allocations and
+ * the time per FilledPath are reported and the attribute and index
+ * data of the FilledPath objects made each way must be the same.
+ * The number of hardware threads is reported as well since the
+ * runs with several threads only overlap their work when there
+ * is more than one.
+ */
+class triangulation_arena_bench:public bench_base
+{
+public:
+  triangulation_arena_bench(void);
+
+protected:
+  virtual
+  int
+  run_cases(void);
+
+private:
+  class result
+  {
+  public:
+    double m_ms;
+    double m_allocations;
+    std::vector<uint32_t> m_checksums;
+  };
+
+  void
+  add_contour(Path *dst, unsigned int id);
+
+  static
+  uint32_t
+  checksum(const FilledPath &filled);
+
+  result
+  run(bool use_arena, unsigned int num_threads);
+
+  command_line_argument_value<unsigned int> m_num_paths;
+  command_line_argument_value<unsigned int> m_contours_per_path;
+  command_line_argument_value<unsigned int> m_points_per_contour;
+  command_line_argument_value<unsigned int> m_num_threads;
+  repeat_argument m_repeat;
+};
+
+triangulation_arena_bench::
+triangulation_arena_bench(void):
+  m_num_paths(20, "num_paths", "number of paths to fill", *this),
+  m_contours_per_path(4, "contours_per_path", "number of contours of each path", *this),
+  m_points_per_contour(30, "points_per_contour",
+                       "number of points of each contour, the contours "
+                       "are random walks that cross themselves often", *this),
+  m_num_threads(4, "num_threads", "number of threads for the multi-threaded runs", *this),
+  m_repeat(3, *this)
+{}
+
+void
+triangulation_arena_bench::
+add_contour(Path *dst, unsigned int id)
+{
+  unsigned int seed(4242u + 6151u * id);
+  auto next = [&seed]()
+    {
+      seed = seed * 1664525u + 1013904223u;
+      return static_cast<float>(seed >> 8u) / static_cast<float>(1u << 24u);
+    };
+
+  *dst << vec2(1000.0f * next(), 1000.0f * next());
+  for (unsigned int i = 1; i < m_points_per_contour.value(); ++i)
+    {
+      vec2 p(1000.0f * next(), 1000.0f * next());
+
+      if (i & 1u)
+        {
+          *dst << Path::control_point(1000.0f * next(), 1000.0f * next()) << p;
+        }
+      else
+        {
+          *dst << p;
+        }
+    }
+  *dst << Path::contour_close();
+}
+
+uint32_t
+triangulation_arena_bench::
+checksum(const FilledPath &filled)
+{
+  uint32_t hash(2166136261u);
+  auto add = [&hash](uint32_t v)
+    {
+      hash = (hash ^ v) * 16777619u;
+    };
+
+  for (unsigned int s = 0; s < filled.number_subsets(); ++s)
+    {
+      FilledPath::Subset S(filled.subset(s));
+      const PainterAttributeData *datas[2] =
+        {
+          &S.painter_data(),
+          &S.aa_fuzz_painter_data(),
+        };
+
+      for (const PainterAttributeData *data : datas)
+        {
+          for (c_array<const PainterAttribute> attribs : data->attribute_data_chunks())
+            {
+              for (const PainterAttribute &a : attribs)
+                {
+                  for (unsigned int k = 0; k < 4; ++k)
+                    {
+                      add(a.m_attrib0[k]);
+                      add(a.m_attrib1[k]);
+                      add(a.m_attrib2[k]);
+                    }
+                }
+            }
+          for (c_array<const PainterIndex> indices : data->index_data_chunks())
+            {
+              add(indices.size());
+              for (PainterIndex idx : indices)
+                {
+                  add(idx);
+                }
+            }
+        }
+    }
+  return hash;
+}
+
+triangulation_arena_bench::result
+triangulation_arena_bench::
+run(bool use_arena, unsigned int num_threads)
+{
+  result R;
+  fastest_time best;
+
+  /* make sure that GLU-tess does all the triangulation */
+  FilledPath::fast_triangulation(false);
+  FilledPath::triangulation_arena(use_arena);
+
+  for (unsigned int r = 0; r < m_repeat.count(); ++r)
+    {
+      /* the FilledPath of a TessellatedPath is made only once,
+       * so each run needs its own paths.
+       */
+      std::vector<Path> paths(m_num_paths.value());
+      std::vector<const TessellatedPath*> tessellations;
+      uint64_t start_count;
+
+      for (unsigned int i = 0; i < paths.size(); ++i)
+        {
+          for (unsigned int c = 0; c < m_contours_per_path.value(); ++c)
+            {
+              add_contour(&paths[i], i * m_contours_per_path.value() + c);
+            }
+          tessellations.push_back(&paths[i].tessellation(-1.0f));
+        }
+
+      /* only the construction and triangulation is timed */
+      start_count = FilledPath::triangulation_heap_allocation_count();
+      simple_time timer;
+      for (const TessellatedPath *T : tessellations)
+        {
+          T->filled().prepare(num_threads);
+        }
+      best.record(timer);
+      R.m_allocations = static_cast<double>(FilledPath::triangulation_heap_allocation_count() - start_count);
+
+      R.m_checksums.clear();
+      for (const TessellatedPath *T : tessellations)
+        {
+          R.m_checksums.push_back(checksum(T->filled()));
+        }
+    }
+
+  R.m_ms = best.ms() / static_cast<double>(std::max(1u, m_num_paths.value()));
+  R.m_allocations /= static_cast<double>(std::max(1u, m_num_paths.value()));
+  return R;
+}
+
+int
+triangulation_arena_bench::
+run_cases(void)
+{
+  std::cout << std::setw(10) << "threads"
+            << std::setw(16) << "heap(allocs)"
+            << std::setw(16) << "arena(allocs)"
+            << std::setw(14) << "heap(ms)"
+            << std::setw(14) << "arena(ms)"
+            << std::setw(10) << "speedup"
+            << "\n";
+
+  unsigned int thread_counts[2] = { 1u, std::max(1u, m_num_threads.value()) };
+  for (unsigned int num_threads : thread_counts)
+    {
+      result heap, arena;
+
+      heap = run(false, num_threads);
+      arena = run(true, num_threads);
+
+      std::cout << std::setw(10) << num_threads
+                << std::setw(16) << std::fixed << std::setprecision(1) << heap.m_allocations
+                << std::setw(16) << arena.m_allocations
+                << std::setw(14) << std::setprecision(3) << heap.m_ms
+                << std::setw(14) << arena.m_ms
+                << std::setw(10) << std::setprecision(2) << heap.m_ms / std::max(arena.m_ms, 1e-3)
+                << ((heap.m_checksums == arena.m_checksums) ? "" : "  MISMATCH")
+                << "\n";
+    }
+  std::cout << "(allocations and times are per FilledPath; hardware threads: "
+            << std::thread::hardware_concurrency() << ")\n";
+
+  FilledPath::fast_triangulation(true);
+  FilledPath::triangulation_arena(true);
+
+  return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+  triangulation_arena_bench B;
+  return B.main(argc, argv);
+}
@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,97,116,108,97,115,101,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,97,116,108,97,115,101,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,47,42,33,92,97,100,100,116,111,103,114,111,117,112,32,71,76,83,76,86,101,114,116,70,114,97,103,67,111,100,101,10,32,42,32,64,123,10,32,42,47,10,10,35,105,102,100,101,102,32,71,76,83,76,95,68,79,88,89,71,69,78,10,32,32,47,42,33,10,32,32,32,42,32,92,100,101,102,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,70,101,116,99,104,40,120,44,32,76,41,10,32,32,32,42,32,85,115,101,32,116,104,105,115,32,109,97,99,114,111,32,116,111,32,114,101,97,100,32,97,32,99,111,108,111,114,32,118,97,108,117,101,32,102,114,111,109,32,116,104,101,32,99,111,108,111,114,115,116,111,112,32,97,116,108,97,115,10,32,32,32,42,32,40,115,101,101,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,67,111,108,111,114,83,116,111,112,65,116,108,97,115,41,46,32,82,101,99,97,108,108,32,116,104,97,116,32,99,111,108,111,114,115,116,111,112,115,10,32,32,32,42,32,97,114,101,32,115,116,111,114,101,100,32,97,115,32,112,97,114,116,32,111,102,32,97,32,71,76,95,84,69,88,84,85,82,69,95,49,68,95,65,82,82,65,89,32,111,114,32,71,76,95,84,69,88,84,85,82,69,95,50,68,95,65,82,82,65,89,10,32,32,32,42,32,97,110,100,32,116,104,97,116,32,116,104,101,32,105,110,116,101,114,112,111,108,97,116,105,111,110,32,111,102,32,116,104,101,32,99,111,108,111,114,32,105,115,32,116,111,32,98,101,32,104,97,110,100,108,101,100,32,98,121,32,116,104,101,10,32,32,32,42,32,116,104,101,32,115,97,109,112,108,101,114,46,10,32,32,32,42,32,92,112,97,114,97,109,32,120,32,116,101,120,116,117,114,101,32,99,111,111,114,100,105,110,97,116,101,32,40,105,46,101,46,32,110,111,114,109,97,108,105,122,101,100,32,116,111,32,91,48,44,32,49,93,41,32,116,111,32,114,101,97,100,32,102,114,111,109,32,116,104,101,32,97,116,108,97,115,10,32,32,32,42,32,92,112,97,114,97,109,32,76,32,119,104,105,99,104,32,108,97,121,101,114,32,116,111,32,114,101,97,100,32,102,114,111,109,32,116,104,101,32,97,116,108,97,115,10,32,32,32,42,47,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,70,101,116,99,104,40,120,44,32,76,41,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,115,97,109,112,108,101,114,50,68,97,114,114,97,121,32,116,104,97,116,32,98,97,99,107,115,32,116,104,101,32,99,111,108,111,114,32,116,105,108,101,115,32,32,111,102,32,116,104,101,32,105,109,97,103,101,10,32,32,32,42,32,97,116,108,97,115,32,40,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,65,116,108,97,115,41,32,119,104,111,115,101,32,109,97,103,110,105,102,105,99,97,116,105,111,110,32,102,105,108,116,101,114,105,110,103,10,32,32,32,42,32,105,115,32,115,101,116,32,116,111,32,71,76,95,76,73,78,69,65,82,32,97,110,100,32,119,104,111,115,101,32,109,105,110,105,102,105,99,97,116,105,111,110,32,102,105,108,116,101,114,105,110,103,32,105,115,32,115,101,116,32,116,111,10,32,32,32,42,32,71,76,95,76,73,78,69,65,82,95,77,73,80,77,65,80,95,78,69,65,82,69,83,84,46,10,32,32,32,42,47,10,32,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,76,105,110,101,97,114,59,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,115,97,109,112,108,101,114,50,68,97,114,114,97,121,32,116,104,97,116,32,98,97,99,107,115,32,116,104,101,32,99,111,108,111,114,32,116,105,108,101,115,32,111,102,32,116,104,101,32,105,109,97,103,101,10,32,32,32,42,32,97,116,108,97,115,32,40,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,65,116,108,97,115,41,32,119,104,111,115,101,32,109,97,103,110,105,102,105,99,97,116,105,111,110,32,97,110,100,10,32,32,32,42,32,109,105,110,105,102,105,99,97,116,105,111,110,32,102,105,108,116,101,114,105,110,103,32,97,114,101,32,115,101,116,32,116,111,32,71,76,95,78,69,65,82,69,83,84,46,10,32,32,32,42,47,10,32,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,78,101,97,114,101,115,116,59,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,117,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,116,104,97,116,32,98,97,99,107,101,115,32,105,110,100,101,120,32,116,105,108,101,115,32,111,102,32,116,104,101,32,105,109,97,103,101,10,32,32,32,42,32,97,116,108,97,115,32,40,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,65,116,108,97,115,41,46,10,32,32,32,42,47,10,32,32,117,110,105,102,111,114,109,32,117,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,73,110,100,101,120,65,116,108,97,115,59,10,10,32,32,47,42,33,10,32,32,32,42,32,92,100,101,102,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,88,41,10,32,32,32,42,32,85,115,101,32,116,104,105,115,32,109,97,99,114,111,32,116,111,32,114,101,97,100,32,97,32,115,105,110,103,108,101,32,51,50,45,98,105,116,32,118,97,108,117,101,32,102,114,111,109,32,116,104,101,32,103,108,121,112,104,32,97,116,108,97,115,10,32,32,32,42,32,40,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,71,108,121,112,104,65,116,108,97,115,41,46,10,32,32,32,42,32,92,112,97,114,97,109,32,88,32,111,102,102,115,101,116,32,105,110,116,111,32,116,104,101,32,103,108,121,112,104,32,97,116,108,97,115,32,116,111,32,114,101,97,100,10,32,32,32,42,47,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,88,41,10,10,32,32,47,42,33,10,32,32,32,42,32,92,100,101,102,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,95,102,112,49,54,120,50,40,88,41,10,32,32,32,42,32,85,115,101,32,116,104,105,115,32,109,97,99,114,111,32,116,111,32,114,101,97,100,32,97,32,115,105,110,103,108,101,32,51,50,45,98,105,116,32,118,97,108,117,101,32,32,102,114,111,109,32,116,104,101,32,103,108,121,112,104,32,97,116,108,97,115,10,32,32,32,42,32,40,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,71,108,121,112,104,65,116,108,97,115,41,32,105,110,116,101,114,112,114,101,116,101,100,32,97,115,32,97,32,118,101,99,50,32,111,102,32,49,54,45,98,105,116,32,102,108,111,97,116,115,46,10,32,32,32,42,32,92,112,97,114,97,109,32,88,32,111,102,102,115,101,116,32,105,110,116,111,32,116,104,101,32,103,108,121,112,104,32,97,116,108,97,115,32,116,111,32,114,101,97,100,10,32,32,32,42,47,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,95,102,112,49,54,120,50,40,88,41,10,10,35,101,110,100,105,102,10,47,42,33,32,64,125,32,42,47,10,10,47,47,47,64,99,111,110,100,10,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,47,47,32,67,111,108,111,114,32,83,116,111,112,32,65,116,108,97,115,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,67,79,76,79,82,83,84,79,80,95,65,84,76,65,83,95,50,68,95,65,82,82,65,89,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,67,79,76,79,82,83,84,79,80,95,65,84,76,65,83,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,65,116,108,97,115,59,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,70,101,116,99,104,40,120,44,32,76,41,32,116,101,120,116,117,114,101,76,111,100,40,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,65,116,108,97,115,44,32,118,101,99,51,40,102,108,111,97,116,40,120,41,44,32,48,46,48,44,32,102,108,111,97,116,40,76,41,41,44,32,48,46,48,41,10,10,35,101,108,115,101,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,67,79,76,79,82,83,84,79,80,95,65,84,76,65,83,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,49,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,65,116,108,97,115,59,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,70,101,116,99,104,40,120,44,32,76,41,32,116,101,120,116,117,114,101,76,111,100,40,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,65,116,108,97,115,44,32,118,101,99,50,40,102,108,111,97,116,40,120,41,44,32,102,108,111,97,116,40,76,41,41,44,32,48,46,48,41,10,10,35,101,110,100,105,102,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,10,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,47,47,32,73,109,97,103,101,32,65,116,108,97,115,10,35,105,102,110,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,67,79,76,79,82,95,84,73,76,69,95,76,73,78,69,65,82,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,76,105,110,101,97,114,59,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,67,79,76,79,82,95,84,73,76,69,95,78,69,65,82,69,83,84,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,78,101,97,114,101,115,116,59,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,73,78,68,69,88,95,84,73,76,69,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,117,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,73,110,100,101,120,65,116,108,97,115,59,10,35,101,110,100,105,102,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,47,47,32,71,108,121,112,104,32,65,116,108,97,115,32,32,83,116,111,114,101,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,83,84,79,82,69,95,83,83,66,79,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,95,65,82,71,83,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,83,84,79,82,69,95,66,73,78,68,73,78,71,44,32,115,116,100,52,51,48,41,32,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,98,117,102,102,101,114,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,10,32,32,123,10,32,32,32,32,117,105,110,116,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,95,100,97,116,97,91,93,59,10,32,32,125,59,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,88,41,32,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,95,100,97,116,97,91,105,110,116,40,88,41,93,41,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,95,102,112,49,54,120,50,40,88,41,32,102,97,115,116,117,105,100,114,97,119,95,117,110,112,97,99,107,72,97,108,102,50,120,49,54,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,95,100,97,116,97,91,105,110,116,40,88,41,93,41,10,10,35,101,108,105,102,32,100,101,102,105,110,101,100,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,83,84,79,82,69,95,84,69,88,84,85,82,69,95,65,82,82,65,89,41,10,10,32,32,47,42,32,84,104,101,32,119,105,100,116,104,32,97,110,100,32,104,101,105,103,104,116,32,111,102,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,32,97,114,101,10,32,32,32,42,32,112,111,119,101,114,115,32,111,102,32,50,44,32,116,104,101,32,118,97,108,117,101,115,32,103,105,118,101,110,32,98,121,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,87,73,68,84,72,95,76,79,71,50,10,32,32,32,42,32,97,110,100,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,72,69,73,71,72,84,95,76,79,71,50,46,32,87,101,32,119,97,110,116,32,116,111,32,117,115,101,10,32,32,32,42,32,98,105,116,32,115,104,105,102,116,115,32,97,110,100,32,109,97,115,107,105,110,103,32,116,111,32,103,101,116,32,116,104,101,32,99,111,114,114,101,99,116,32,108,97,121,101,114,44,32,104,101,105,103,104,116,32,97,110,100,32,115,111,32,111,110,46,10,32,32,32,42,47,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,83,84,79,82,69,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,117,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,59,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,87,73,68,84,72,95,80,76,85,83,95,72,69,73,71,72,84,95,76,79,71,50,32,117,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,87,73,68,84,72,95,76,79,71,50,32,43,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,72,69,73,71,72,84,95,76,79,71,50,41,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,76,65,89,69,82,40,84,41,32,40,117,105,110,116,40,84,41,32,62,62,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,87,73,68,84,72,95,80,76,85,83,95,72,69,73,71,72,84,95,76,79,71,50,41,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,89,40,84,41,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,87,73,68,84,72,95,76,79,71,50,44,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,72,69,73,71,72,84,95,76,79,71,50,44,32,84,41,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,88,40,84,41,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,48,44,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,87,73,68,84,72,95,76,79,71,50,44,32,84,41,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,67,79,79,82,68,40,118,41,32,105,118,101,99,51,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,88,40,118,41,44,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,89,40,118,41,44,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,76,65,89,69,82,40,118,41,41,10,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,88,41,32,40,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,44,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,67,79,79,82,68,40,88,41,44,32,48,41,46,114,41,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,95,102,112,49,54,120,50,40,88,41,32,102,97,115,116,117,105,100,114,97,119,95,117,110,112,97,99,107,72,97,108,102,50,120,49,54,40,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,88,41,41,10,35,101,108,115,101,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,83,84,79,82,69,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,117,115,97,109,112,108,101,114,66,117,102,102,101,114,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,59,10,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,88,41,32,40,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,44,32,105,110,116,40,88,41,41,46,114,41,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,95,102,112,49,54,120,50,40,88,41,32,102,97,115,116,117,105,100,114,97,119,95,117,110,112,97,99,107,72,97,108,102,50,120,49,54,40,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,88,41,41,10,10,35,101,110,100,105,102,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,10,10,47,47,47,64,101,110,100,99,111,110,100,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_atlases.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
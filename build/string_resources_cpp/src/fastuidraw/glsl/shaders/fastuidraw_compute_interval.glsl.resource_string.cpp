@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,110,116,101,114,118,97,108,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,110,116,101,114,118,97,108,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,47,42,32,77,117,115,116,32,98,101,32,100,101,102,105,110,101,100,58,10,32,42,32,32,45,32,70,65,83,84,85,73,68,82,65,87,95,67,79,77,80,85,84,69,95,73,78,84,69,82,86,65,76,95,78,65,77,69,32,116,111,32,98,101,32,110,97,109,101,32,111,102,32,116,104,101,32,102,117,110,99,116,105,111,110,10,32,42,32,32,45,32,70,65,83,84,85,73,68,82,65,87,95,67,79,77,80,85,84,69,95,73,78,84,69,82,86,65,76,95,70,69,84,67,72,95,68,65,84,65,40,88,41,32,116,111,32,108,111,97,100,115,32,97,32,117,118,101,99,52,32,118,97,108,117,101,32,97,116,32,88,10,32,42,47,10,10,47,42,32,84,104,101,32,100,97,115,104,32,112,97,116,116,101,114,110,32,105,115,32,112,97,99,107,101,100,32,97,115,32,108,101,118,101,108,115,32,111,102,32,97,32,116,114,101,101,32,119,104,101,114,101,32,101,97,99,104,10,32,42,32,117,118,101,99,52,32,105,115,32,97,32,110,111,100,101,32,119,105,116,104,32,102,111,117,114,32,99,104,105,108,100,114,101,110,44,32,115,101,101,32,116,104,101,32,100,101,115,99,114,105,112,116,105,111,110,32,111,102,10,32,42,32,102,97,115,116,117,105,100,114,97,119,58,58,80,97,105,110,116,101,114,68,97,115,104,101,100,83,116,114,111,107,101,80,97,114,97,109,115,46,32,76,101,118,101,108,32,107,32,104,97,115,32,66,32,47,32,52,94,107,10,32,42,32,98,108,111,99,107,115,32,114,111,117,110,100,101,100,32,117,112,44,32,119,104,101,114,101,32,66,32,105,115,32,116,104,101,32,110,117,109,98,101,114,32,111,102,32,98,108,111,99,107,115,32,111,102,32,108,101,118,101,108,32,48,46,10,32,42,47,10,117,105,110,116,10,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,95,112,97,116,116,101,114,110,95,108,101,118,101,108,95,115,105,122,101,40,105,110,32,117,105,110,116,32,108,101,118,101,108,48,95,115,105,122,101,44,32,105,110,32,117,105,110,116,32,108,101,118,101,108,41,10,123,10,32,32,114,101,116,117,114,110,32,40,108,101,118,101,108,48,95,115,105,122,101,32,43,32,40,49,117,32,60,60,32,40,50,117,32,42,32,108,101,118,101,108,41,41,32,45,32,49,117,41,32,62,62,32,40,50,117,32,42,32,108,101,118,101,108,41,59,10,125,10,10,47,42,32,82,101,116,117,114,110,115,32,116,104,101,32,110,117,109,98,101,114,32,111,102,32,117,118,101,99,52,39,115,32,116,104,97,116,32,97,32,112,97,99,107,101,100,32,100,97,115,104,32,112,97,116,116,101,114,110,10,32,42,32,119,105,116,104,32,116,104,101,32,103,105,118,101,110,32,110,117,109,98,101,114,32,111,102,32,105,110,116,101,114,118,97,108,115,32,111,99,99,117,112,105,101,115,46,10,32,42,47,10,117,105,110,116,10,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,95,112,97,116,116,101,114,110,95,100,97,116,97,95,115,105,122,101,40,105,110,32,117,105,110,116,32,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,41,10,123,10,32,32,117,105,110,116,32,115,122,44,32,110,117,109,95,98,108,111,99,107,115,59,10,10,32,32,110,117,109,95,98,108,111,99,107,115,32,61,32,40,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,32,43,32,51,117,41,32,62,62,32,50,117,59,10,32,32,115,122,32,61,32,110,117,109,95,98,108,111,99,107,115,59,10,32,32,119,104,105,108,101,32,40,110,117,109,95,98,108,111,99,107,115,32,62,32,49,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,110,117,109,95,98,108,111,99,107,115,32,61,32,40,110,117,109,95,98,108,111,99,107,115,32,43,32,51,117,41,32,62,62,32,50,117,59,10,32,32,32,32,32,32,115,122,32,43,61,32,110,117,109,95,98,108,111,99,107,115,59,10,32,32,32,32,125,10,32,32,114,101,116,117,114,110,32,115,122,59,10,125,10,10,47,42,32,70,111,114,32,100,97,115,104,32,112,97,116,116,101,114,110,115,32,111,102,32,97,116,32,109,111,115,116,32,116,104,105,115,32,109,97,110,121,32,98,108,111,99,107,115,32,105,110,32,108,101,118,101,108,32,48,44,10,32,42,32,105,46,101,46,32,97,116,32,109,111,115,116,32,51,50,32,68,97,115,104,80,97,116,116,101,114,110,69,108,101,109,101,110,116,32,118,97,108,117,101,115,44,32,97,32,108,105,110,101,97,114,32,115,99,97,110,32,111,102,10,32,42,32,108,101,118,101,108,32,48,32,105,115,32,102,97,115,116,101,114,32,116,104,97,110,32,119,97,108,107,105,110,103,32,116,104,101,32,116,114,101,101,32,98,101,99,97,117,115,101,32,116,104,101,32,115,99,97,110,10,32,42,32,117,115,117,97,108,108,121,32,101,110,100,115,32,97,102,116,101,114,32,97,32,102,101,119,32,114,101,97,100,115,32,116,104,97,116,32,100,111,32,110,111,116,32,100,101,112,101,110,100,32,111,110,32,101,97,99,104,10,32,42,32,111,116,104,101,114,46,10,32,42,47,10,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,68,65,83,72,95,80,65,84,84,69,82,78,95,76,73,78,69,65,82,95,83,69,65,82,67,72,95,77,65,88,95,66,76,79,67,75,83,32,49,54,117,10,10,47,42,32,82,101,116,117,114,110,115,32,119,104,105,99,104,32,111,102,32,116,104,101,32,102,111,117,114,32,118,97,108,117,101,115,32,111,102,32,97,32,98,108,111,99,107,32,105,115,32,116,104,101,32,102,105,114,115,116,10,32,42,32,111,110,101,32,103,114,101,97,116,101,114,32,116,104,97,110,32,100,32,97,110,100,32,115,101,116,115,32,108,111,119,101,114,32,97,110,100,32,117,112,112,101,114,32,116,111,32,116,104,101,32,118,97,108,117,101,115,10,32,42,32,116,104,97,116,32,98,111,117,110,100,32,116,104,97,116,32,105,110,116,101,114,118,97,108,59,32,114,101,116,117,114,110,115,32,52,32,105,102,32,110,111,110,101,32,105,115,46,10,32,42,47,10,117,105,110,116,10,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,95,112,97,116,116,101,114,110,95,115,101,108,101,99,116,40,105,110,32,118,101,99,52,32,102,86,44,32,105,110,32,102,108,111,97,116,32,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,111,117,116,32,102,108,111,97,116,32,108,111,119,101,114,44,32,111,117,116,32,102,108,111,97,116,32,117,112,112,101,114,41,10,123,10,32,32,117,112,112,101,114,32,61,32,102,86,46,119,59,10,32,32,105,102,32,40,100,32,60,32,102,86,46,120,41,10,32,32,32,32,123,10,32,32,32,32,32,32,117,112,112,101,114,32,61,32,102,86,46,120,59,10,32,32,32,32,32,32,114,101,116,117,114,110,32,48,117,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,100,32,60,32,102,86,46,121,41,10,32,32,32,32,123,10,32,32,32,32,32,32,108,111,119,101,114,32,61,32,102,86,46,120,59,10,32,32,32,32,32,32,117,112,112,101,114,32,61,32,102,86,46,121,59,10,32,32,32,32,32,32,114,101,116,117,114,110,32,49,117,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,100,32,60,32,102,86,46,122,41,10,32,32,32,32,123,10,32,32,32,32,32,32,108,111,119,101,114,32,61,32,102,86,46,121,59,10,32,32,32,32,32,32,117,112,112,101,114,32,61,32,102,86,46,122,59,10,32,32,32,32,32,32,114,101,116,117,114,110,32,50,117,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,100,32,60,32,102,86,46,119,41,10,32,32,32,32,123,10,32,32,32,32,32,32,108,111,119,101,114,32,61,32,102,86,46,122,59,10,32,32,32,32,32,32,114,101,116,117,114,110,32,51,117,59,10,32,32,32,32,125,10,10,32,32,108,111,119,101,114,32,61,32,102,86,46,119,59,10,32,32,114,101,116,117,114,110,32,52,117,59,10,125,10,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,110,116,101,114,118,97,108,40,105,110,32,117,105,110,116,32,105,110,116,101,114,118,97,108,115,95,108,111,99,97,116,105,111,110,44,32,105,110,32,102,108,111,97,116,32,116,111,116,97,108,95,100,105,115,116,97,110,99,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,44,32,105,110,32,102,108,111,97,116,32,105,110,95,100,105,115,116,97,110,99,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,105,110,116,32,105,110,116,101,114,118,97,108,95,73,68,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,108,111,97,116,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,44,32,111,117,116,32,102,108,111,97,116,32,105,110,116,101,114,118,97,108,95,101,110,100,41,10,123,10,32,32,117,105,110,116,32,108,101,118,101,108,44,32,108,101,118,101,108,95,111,102,102,115,101,116,44,32,108,101,118,101,108,48,95,115,105,122,101,44,32,110,117,109,95,98,108,111,99,107,115,44,32,98,108,111,99,107,44,32,99,59,10,32,32,102,108,111,97,116,32,100,44,32,102,102,44,32,102,100,44,32,108,111,119,101,114,44,32,117,112,112,101,114,59,10,10,32,32,102,100,32,61,32,102,108,111,111,114,40,105,110,95,100,105,115,116,97,110,99,101,32,47,32,116,111,116,97,108,95,100,105,115,116,97,110,99,101,41,59,10,32,32,102,102,32,61,32,116,111,116,97,108,95,100,105,115,116,97,110,99,101,32,42,32,102,100,59,10,32,32,100,32,61,32,105,110,95,100,105,115,116,97,110,99,101,32,45,32,102,102,59,10,32,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,32,61,32,48,46,48,59,10,32,32,105,110,116,101,114,118,97,108,95,101,110,100,32,61,32,48,46,48,59,10,32,32,105,110,116,101,114,118,97,108,95,73,68,32,61,32,45,49,59,10,10,32,32,108,101,118,101,108,48,95,115,105,122,101,32,61,32,40,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,32,43,32,51,117,41,32,62,62,32,50,117,59,10,32,32,108,111,119,101,114,32,61,32,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,59,10,32,32,117,112,112,101,114,32,61,32,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,59,10,32,32,99,32,61,32,52,117,59,10,10,32,32,105,102,32,40,108,101,118,101,108,48,95,115,105,122,101,32,60,61,32,70,65,83,84,85,73,68,82,65,87,95,68,65,83,72,95,80,65,84,84,69,82,78,95,76,73,78,69,65,82,95,83,69,65,82,67,72,95,77,65,88,95,66,76,79,67,75,83,41,10,32,32,32,32,123,10,32,32,32,32,32,32,47,42,32,115,99,97,110,32,108,101,118,101,108,32,48,32,111,110,108,121,32,42,47,10,32,32,32,32,32,32,102,111,114,32,40,98,108,111,99,107,32,61,32,48,117,59,32,98,108,111,99,107,32,60,32,108,101,118,101,108,48,95,115,105,122,101,32,38,38,32,99,32,61,61,32,52,117,59,32,43,43,98,108,111,99,107,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,117,118,101,99,52,32,86,59,10,10,32,32,32,32,32,32,32,32,32,32,86,32,61,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,40,105,110,116,40,105,110,116,101,114,118,97,108,115,95,108,111,99,97,116,105,111,110,32,43,32,98,108,111,99,107,41,41,46,120,121,122,119,59,10,32,32,32,32,32,32,32,32,32,32,99,32,61,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,95,112,97,116,116,101,114,110,95,115,101,108,101,99,116,40,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,86,41,44,32,100,44,32,108,111,119,101,114,44,32,117,112,112,101,114,41,59,10,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,105,102,32,40,99,32,61,61,32,52,117,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,45,49,46,48,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,98,108,111,99,107,32,61,32,52,117,32,42,32,40,98,108,111,99,107,32,45,32,49,117,41,32,43,32,99,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,47,42,32,102,105,110,100,32,116,104,101,32,108,97,115,116,32,108,101,118,101,108,44,32,119,104,105,99,104,32,105,115,32,97,32,115,105,110,103,108,101,32,98,108,111,99,107,32,42,47,10,32,32,32,32,32,32,110,117,109,95,98,108,111,99,107,115,32,61,32,108,101,118,101,108,48,95,115,105,122,101,59,10,32,32,32,32,32,32,108,101,118,101,108,32,61,32,48,117,59,10,32,32,32,32,32,32,108,101,118,101,108,95,111,102,102,115,101,116,32,61,32,48,117,59,10,32,32,32,32,32,32,119,104,105,108,101,32,40,110,117,109,95,98,108,111,99,107,115,32,62,32,49,117,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,108,101,118,101,108,95,111,102,102,115,101,116,32,43,61,32,110,117,109,95,98,108,111,99,107,115,59,10,32,32,32,32,32,32,32,32,32,32,110,117,109,95,98,108,111,99,107,115,32,61,32,40,110,117,109,95,98,108,111,99,107,115,32,43,32,51,117,41,32,62,62,32,50,117,59,10,32,32,32,32,32,32,32,32,32,32,43,43,108,101,118,101,108,59,10,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,47,42,32,119,97,108,107,32,100,111,119,110,32,116,104,101,32,108,101,118,101,108,115,44,32,97,116,32,101,97,99,104,32,108,101,118,101,108,32,114,101,97,100,105,110,103,32,116,104,101,32,98,108,111,99,107,10,32,32,32,32,32,32,32,42,32,119,104,111,115,101,32,108,97,114,103,101,115,116,32,118,97,108,117,101,32,105,115,32,116,104,101,32,102,105,114,115,116,32,118,97,108,117,101,32,111,102,32,105,116,115,32,112,97,114,101,110,116,10,32,32,32,32,32,32,32,42,32,116,104,97,116,32,105,115,32,103,114,101,97,116,101,114,32,116,104,97,110,32,100,46,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,98,108,111,99,107,32,61,32,48,117,59,10,32,32,32,32,32,32,102,111,114,32,40,59,59,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,117,118,101,99,52,32,86,59,10,10,32,32,32,32,32,32,32,32,32,32,86,32,61,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,40,105,110,116,40,105,110,116,101,114,118,97,108,115,95,108,111,99,97,116,105,111,110,32,43,32,108,101,118,101,108,95,111,102,102,115,101,116,32,43,32,98,108,111,99,107,41,41,46,120,121,122,119,59,10,32,32,32,32,32,32,32,32,32,32,99,32,61,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,95,112,97,116,116,101,114,110,95,115,101,108,101,99,116,40,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,86,41,44,32,100,44,32,108,111,119,101,114,44,32,117,112,112,101,114,41,59,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,99,32,61,61,32,52,117,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,45,49,46,48,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,32,32,32,32,98,108,111,99,107,32,61,32,52,117,32,42,32,98,108,111,99,107,32,43,32,99,59,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,108,101,118,101,108,32,61,61,32,48,117,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,98,114,101,97,107,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,32,32,32,32,45,45,108,101,118,101,108,59,10,32,32,32,32,32,32,32,32,32,32,108,101,118,101,108,95,111,102,102,115,101,116,32,45,61,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,95,112,97,116,116,101,114,110,95,108,101,118,101,108,95,115,105,122,101,40,108,101,118,101,108,48,95,115,105,122,101,44,32,108,101,118,101,108,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,10,32,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,32,61,32,102,102,32,43,32,108,111,119,101,114,59,10,32,32,105,110,116,101,114,118,97,108,95,101,110,100,32,61,32,102,102,32,43,32,117,112,112,101,114,59,10,32,32,105,110,116,101,114,118,97,108,95,73,68,32,61,32,105,110,116,40,98,108,111,99,107,41,32,43,32,105,110,116,40,102,100,41,32,42,32,105,110,116,40,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,41,59,10,10,32,32,47,42,32,101,118,101,110,32,105,110,116,101,114,118,97,108,115,32,97,114,101,32,100,114,97,119,32,105,110,116,101,114,118,97,108,115,44,32,111,100,100,32,97,114,101,32,115,107,105,112,32,105,110,116,101,114,118,97,108,115,32,42,47,10,32,32,114,101,116,117,114,110,32,40,40,98,108,111,99,107,32,38,32,49,117,41,32,61,61,32,48,117,41,32,63,32,49,46,48,32,58,32,45,49,46,48,59,10,125,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_compute_interval.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
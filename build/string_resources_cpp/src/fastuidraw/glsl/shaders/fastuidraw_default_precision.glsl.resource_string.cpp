@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,100,101,102,97,117,108,116,95,112,114,101,99,105,115,105,111,110,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,100,101,102,97,117,108,116,95,112,114,101,99,105,115,105,111,110,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,112,114,101,99,105,115,105,111,110,32,104,105,103,104,112,32,102,108,111,97,116,59,10,112,114,101,99,105,115,105,111,110,32,104,105,103,104,112,32,105,110,116,59,10,112,114,101,99,105,115,105,111,110,32,109,101,100,105,117,109,112,32,115,97,109,112,108,101,114,50,68,65,114,114,97,121,59,10,112,114,101,99,105,115,105,111,110,32,104,105,103,104,112,32,117,115,97,109,112,108,101,114,50,68,65,114,114,97,121,59,10,10,35,105,102,32,100,101,102,105,110,101,100,40,71,76,95,69,88,84,95,116,101,120,116,117,114,101,95,98,117,102,102,101,114,41,32,124,124,32,100,101,102,105,110,101,100,40,71,76,95,79,69,83,95,116,101,120,116,117,114,101,95,98,117,102,102,101,114,41,10,32,32,112,114,101,99,105,115,105,111,110,32,104,105,103,104,112,32,115,97,109,112,108,101,114,66,117,102,102,101,114,59,10,32,32,112,114,101,99,105,115,105,111,110,32,104,105,103,104,112,32,117,115,97,109,112,108,101,114,66,117,102,102,101,114,59,10,32,32,112,114,101,99,105,115,105,111,110,32,104,105,103,104,112,32,105,115,97,109,112,108,101,114,66,117,102,102,101,114,59,10,35,101,110,100,105,102,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_default_precision.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
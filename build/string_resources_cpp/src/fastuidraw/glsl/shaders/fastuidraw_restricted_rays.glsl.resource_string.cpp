@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,47,42,33,92,97,100,100,116,111,103,114,111,117,112,32,71,76,83,76,70,114,97,103,67,111,100,101,10,32,42,32,64,123,10,32,42,47,10,10,47,47,47,64,99,111,110,100,10,10,47,42,32,109,117,115,116,32,104,97,118,101,32,116,104,101,32,109,97,99,114,111,47,102,117,110,99,116,105,111,110,10,32,42,10,32,42,32,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,88,41,10,32,42,10,32,42,32,116,104,97,116,32,114,101,116,117,114,110,115,32,97,32,115,105,110,103,108,101,32,51,50,45,98,105,116,32,117,105,110,116,32,118,97,108,117,101,32,97,116,32,105,110,100,101,120,32,88,32,111,102,10,32,42,32,97,32,108,97,114,103,101,32,97,114,114,97,121,32,111,102,32,51,50,45,98,105,116,32,117,105,110,116,32,118,97,108,117,101,115,32,115,116,111,114,105,110,103,32,116,104,101,32,100,97,116,97,10,32,42,10,32,42,32,97,110,100,32,111,112,116,105,111,110,97,108,108,121,32,100,101,102,105,110,101,32,116,104,101,32,109,97,99,114,111,47,102,117,110,99,116,105,111,110,10,32,42,10,32,42,32,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,95,102,112,49,54,120,50,40,88,41,10,32,42,10,32,42,32,116,104,101,32,114,101,97,100,115,32,97,32,115,105,110,103,108,101,32,51,50,45,98,105,116,32,117,105,110,116,32,118,97,108,117,101,32,116,104,97,116,32,105,115,32,98,105,116,45,99,97,115,116,101,100,10,32,42,32,116,111,32,97,32,40,102,112,49,54,44,32,102,112,49,54,41,32,112,97,105,114,32,114,101,97,108,105,122,101,100,32,97,115,32,97,32,118,101,99,50,46,32,70,111,114,32,101,120,97,109,112,108,101,10,32,42,32,105,116,32,99,97,110,32,98,101,32,100,101,102,105,110,101,100,32,97,115,10,32,42,32,117,110,112,97,99,107,72,97,108,102,50,120,49,54,40,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,88,41,41,10,32,42,47,10,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,10,123,10,32,32,118,101,99,50,32,116,114,97,110,115,108,97,116,105,111,110,59,10,32,32,118,101,99,50,32,116,95,118,101,99,116,111,114,44,32,106,113,95,118,101,99,116,111,114,59,10,32,32,102,108,111,97,116,32,114,101,102,101,114,101,110,99,101,95,108,111,99,97,116,105,111,110,44,32,111,114,105,101,110,116,97,116,105,111,110,59,10,125,59,10,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,117,114,118,101,95,116,121,112,101,10,123,10,32,32,118,101,99,50,32,112,49,44,32,112,50,44,32,112,51,59,10,32,32,98,111,111,108,32,105,115,95,113,117,97,100,114,97,116,105,99,59,10,125,59,10,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,98,111,120,95,116,121,112,101,10,123,10,32,32,118,101,99,50,32,109,105,110,95,112,111,105,110,116,44,32,109,97,120,95,112,111,105,110,116,44,32,99,101,110,116,101,114,95,112,111,105,110,116,44,32,115,105,122,101,59,10,125,59,10,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,100,105,115,116,97,110,99,101,95,116,121,112,101,10,123,10,32,32,102,108,111,97,116,32,100,105,115,116,97,110,99,101,95,105,110,99,114,101,109,101,110,116,59,10,32,32,102,108,111,97,116,32,100,105,115,116,97,110,99,101,95,100,101,99,114,101,109,101,110,116,59,10,125,59,10,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,119,105,110,100,105,110,103,95,115,97,109,112,108,101,95,116,121,112,101,10,123,10,32,32,105,110,116,32,114,101,102,101,114,101,110,99,101,95,119,105,110,100,105,110,103,59,10,32,32,118,101,99,50,32,114,101,102,101,114,101,110,99,101,95,112,111,115,105,116,105,111,110,59,10,125,59,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,105,110,105,116,95,100,105,115,116,97,110,99,101,40,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,100,105,115,116,97,110,99,101,95,116,121,112,101,32,110,118,41,10,123,10,32,32,47,42,32,74,117,115,116,32,105,110,105,116,105,97,108,105,122,101,32,116,111,32,115,111,109,101,32,118,97,108,117,101,32,116,104,97,116,32,105,115,32,108,97,114,103,101,32,40,115,116,114,105,99,116,108,121,32,115,112,101,97,107,105,110,103,10,32,32,32,42,32,119,101,32,111,110,108,121,32,110,101,101,100,32,97,32,118,97,108,117,101,32,103,114,101,97,116,101,114,32,116,104,97,110,32,48,46,53,44,32,98,117,116,32,109,97,107,101,32,105,116,32,108,97,114,103,101,114,10,32,32,32,42,32,102,111,114,32,100,101,98,117,103,32,114,101,110,100,101,114,115,32,116,111,32,98,101,32,117,115,101,102,117,108,41,46,10,32,32,32,42,47,10,32,32,110,118,46,100,105,115,116,97,110,99,101,95,105,110,99,114,101,109,101,110,116,32,61,32,110,118,46,100,105,115,116,97,110,99,101,95,100,101,99,114,101,109,101,110,116,32,61,32,49,50,48,46,48,59,10,125,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,117,112,100,97,116,101,95,100,105,115,116,97,110,99,101,40,105,110,32,102,108,111,97,116,32,100,105,115,116,44,32,105,110,32,98,111,111,108,32,105,115,95,105,110,99,114,101,109,101,110,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,100,105,115,116,97,110,99,101,95,116,121,112,101,32,110,118,41,10,123,10,32,32,47,42,32,87,101,32,97,114,101,32,97,115,115,117,109,105,110,103,32,116,104,97,116,32,116,104,101,114,101,32,97,114,101,32,110,111,32,99,97,110,99,101,108,108,105,110,103,32,99,117,114,118,101,115,32,105,110,32,116,104,101,32,103,108,121,112,104,32,100,97,116,97,46,10,32,32,32,42,32,84,104,101,32,99,108,97,115,115,32,71,108,121,112,104,82,101,110,100,101,114,68,97,116,97,82,101,115,116,114,105,99,116,101,100,82,97,121,115,32,104,97,115,32,99,111,100,101,32,116,111,32,100,101,116,101,99,116,32,109,111,115,116,32,102,111,114,109,115,10,32,32,32,42,32,111,102,32,99,97,110,99,101,108,108,105,110,103,32,99,117,114,118,101,115,32,40,105,116,32,100,101,116,101,99,116,115,32,112,97,114,116,105,97,108,108,121,32,111,118,101,114,108,97,112,112,105,110,103,32,118,101,114,116,105,99,97,108,32,97,110,100,10,32,32,32,42,32,104,111,114,105,122,111,110,116,97,108,32,99,117,114,118,101,115,32,97,108,111,110,103,32,119,105,116,104,32,112,101,114,102,101,99,116,108,121,32,111,118,101,114,108,97,112,112,105,110,103,32,103,101,110,101,114,97,108,32,99,117,114,118,101,115,41,46,10,32,32,32,42,47,10,32,32,105,102,32,40,105,115,95,105,110,99,114,101,109,101,110,116,41,10,32,32,32,32,123,10,32,32,32,32,32,32,110,118,46,100,105,115,116,97,110,99,101,95,105,110,99,114,101,109,101,110,116,32,61,32,109,105,110,40,110,118,46,100,105,115,116,97,110,99,101,95,105,110,99,114,101,109,101,110,116,44,32,100,105,115,116,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,110,118,46,100,105,115,116,97,110,99,101,95,100,101,99,114,101,109,101,110,116,32,61,32,109,105,110,40,110,118,46,100,105,115,116,97,110,99,101,95,100,101,99,114,101,109,101,110,116,44,32,100,105,115,116,41,59,10,32,32,32,32,125,10,125,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,117,112,100,97,116,101,95,100,105,115,116,97,110,99,101,40,105,110,32,118,101,99,50,32,112,44,32,105,110,32,98,111,111,108,32,105,115,95,105,110,99,114,101,109,101,110,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,100,105,115,116,97,110,99,101,95,116,121,112,101,32,110,118,41,10,123,10,32,32,102,108,111,97,116,32,100,59,10,10,32,32,100,32,61,32,97,98,115,40,112,46,120,41,32,43,32,97,98,115,40,112,46,121,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,117,112,100,97,116,101,95,100,105,115,116,97,110,99,101,40,100,44,32,105,115,95,105,110,99,114,101,109,101,110,116,44,32,110,118,41,59,10,125,10,10,98,111,111,108,10,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,105,115,95,105,110,99,114,101,109,101,110,116,40,105,110,32,118,101,99,50,32,112,44,32,105,110,32,118,101,99,50,32,100,112,41,10,123,10,32,32,102,108,111,97,116,32,100,101,116,59,10,10,32,32,47,42,32,84,104,101,32,118,101,99,116,111,114,32,102,114,111,109,32,116,104,101,32,111,114,105,103,105,110,32,116,111,32,116,104,101,32,112,111,105,110,116,32,105,115,32,103,105,118,101,110,32,98,121,32,116,104,101,32,112,111,105,110,116,32,118,97,108,117,101,44,32,112,46,10,32,32,32,42,32,116,104,101,32,100,105,114,101,99,116,105,111,110,32,111,102,32,116,104,101,32,99,117,114,118,101,32,105,115,32,103,105,118,101,110,32,98,121,32,100,112,46,32,87,104,101,110,32,99,114,111,115,115,105,110,103,32,116,104,101,32,99,117,114,118,101,32,105,110,32,116,104,101,10,32,32,32,42,32,100,105,114,101,99,116,105,111,110,32,102,114,111,109,32,116,104,101,32,111,114,105,103,105,110,32,116,111,32,112,44,32,116,104,101,32,119,105,110,100,105,110,103,32,105,115,32,105,110,99,114,101,109,101,110,116,101,100,32,105,102,32,116,104,101,32,112,97,105,114,10,32,32,32,42,32,40,112,44,32,100,112,41,32,102,111,114,109,115,32,97,32,50,120,50,32,109,97,116,114,105,120,32,116,104,97,116,32,104,97,115,32,112,111,115,105,116,105,118,101,32,100,101,116,101,114,109,105,110,97,110,116,32,97,110,100,32,100,101,99,114,101,109,101,110,116,115,10,32,32,32,42,32,111,116,104,101,114,119,105,115,101,46,10,32,32,32,42,47,10,32,32,100,101,116,32,61,32,112,46,120,32,42,32,100,112,46,121,32,45,32,112,46,121,32,42,32,100,112,46,120,59,10,32,32,114,101,116,117,114,110,32,100,101,116,32,62,32,48,46,48,59,10,125,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,117,112,100,97,116,101,95,100,105,115,116,97,110,99,101,40,105,110,32,118,101,99,50,32,112,44,32,105,110,32,118,101,99,50,32,100,112,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,100,105,115,116,97,110,99,101,95,116,121,112,101,32,110,118,41,10,123,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,117,112,100,97,116,101,95,100,105,115,116,97,110,99,101,40,112,44,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,105,115,95,105,110,99,114,101,109,101,110,116,40,112,44,32,100,112,41,44,32,110,118,41,59,10,125,10,10,117,105,110,116,10,102,97,115,116,117,105,100,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,111,109,112,117,116,101,95,98,111,120,40,105,110,32,118,101,99,50,32,112,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,100,97,116,97,95,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,98,111,120,95,116,121,112,101,32,98,111,120,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,117,105,110,116,32,99,117,114,118,101,95,108,105,115,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,117,105,110,116,32,110,117,109,95,99,117,114,118,101,115,41,10,123,10,32,32,117,105,110,116,32,118,44,32,111,102,102,115,101,116,59,10,10,32,32,98,111,120,46,109,105,110,95,112,111,105,110,116,32,61,32,118,101,99,50,40,45,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,103,108,121,112,104,95,99,111,111,114,100,95,118,97,108,117,101,44,32,45,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,103,108,121,112,104,95,99,111,111,114,100,95,118,97,108,117,101,41,59,10,32,32,98,111,120,46,109,97,120,95,112,111,105,110,116,32,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,103,108,121,112,104,95,99,111,111,114,100,95,118,97,108,117,101,44,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,103,108,121,112,104,95,99,111,111,114,100,95,118,97,108,117,101,41,59,10,10,32,32,111,102,102,115,101,116,32,61,32,100,97,116,97,95,108,111,99,97,116,105,111,110,59,10,32,32,118,32,61,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,111,102,102,115,101,116,41,59,10,10,32,32,119,104,105,108,101,40,40,118,32,38,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,104,105,101,114,97,114,99,104,121,95,110,111,100,101,95,109,97,115,107,41,32,33,61,32,48,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,117,105,110,116,32,99,44,32,98,105,116,48,59,10,32,32,32,32,32,32,102,108,111,97,116,32,115,112,108,105,116,95,112,116,59,10,32,32,32,32,32,32,98,111,111,108,32,116,97,107,101,95,109,97,120,95,99,104,111,105,99,101,59,10,10,32,32,32,32,32,32,99,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,104,105,101,114,97,114,99,104,121,95,115,112,108,105,116,95,99,111,111,114,100,95,98,105,116,44,32,49,117,44,32,118,41,59,10,32,32,32,32,32,32,105,102,32,40,99,32,61,61,32,48,117,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,115,112,108,105,116,95,112,116,32,61,32,48,46,53,32,42,32,40,98,111,120,46,109,105,110,95,112,111,105,110,116,46,120,32,43,32,98,111,120,46,109,97,120,95,112,111,105,110,116,46,120,41,59,10,32,32,32,32,32,32,32,32,32,32,116,97,107,101,95,109,97,120,95,99,104,111,105,99,101,32,61,32,40,112,46,120,32,62,32,115,112,108,105,116,95,112,116,41,59,10,32,32,32,32,32,32,32,32,32,32,98,111,120,46,109,105,110,95,112,111,105,110,116,46,120,32,61,32,40,116,97,107,101,95,109,97,120,95,99,104,111,105,99,101,41,32,63,32,115,112,108,105,116,95,112,116,32,58,32,98,111,120,46,109,105,110,95,112,111,105,110,116,46,120,59,10,32,32,32,32,32,32,32,32,32,32,98,111,120,46,109,97,120,95,112,111,105,110,116,46,120,32,61,32,40,116,97,107,101,95,109,97,120,95,99,104,111,105,99,101,41,32,63,32,98,111,120,46,109,97,120,95,112,111,105,110,116,46,120,32,58,32,115,112,108,105,116,95,112,116,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,115,112,108,105,116,95,112,116,32,61,32,48,46,53,32,42,32,40,98,111,120,46,109,105,110,95,112,111,105,110,116,46,121,32,43,32,98,111,120,46,109,97,120,95,112,111,105,110,116,46,121,41,59,10,32,32,32,32,32,32,32,32,32,32,116,97,107,101,95,109,97,120,95,99,104,111,105,99,101,32,61,32,40,112,46,121,32,62,32,115,112,108,105,116,95,112,116,41,59,10,32,32,32,32,32,32,32,32,32,32,98,111,120,46,109,105,110,95,112,111,105,110,116,46,121,32,61,32,40,116,97,107,101,95,109,97,120,95,99,104,111,105,99,101,41,32,63,32,115,112,108,105,116,95,112,116,32,58,32,98,111,120,46,109,105,110,95,112,111,105,110,116,46,121,59,10,32,32,32,32,32,32,32,32,32,32,98,111,120,46,109,97,120,95,112,111,105,110,116,46,121,32,61,32,40,116,97,107,101,95,109,97,120,95,99,104,111,105,99,101,41,32,63,32,98,111,120,46,109,97,120,95,112,111,105,110,116,46,121,32,58,32,115,112,108,105,116,95,112,116,59,10,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,98,105,116,48,32,61,32,40,116,97,107,101,95,109,97,120,95,99,104,111,105,99,101,41,32,63,10,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,104,105,101,114,97,114,99,104,121,95,99,104,105,108,100,49,95,98,105,116,58,10,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,104,105,101,114,97,114,99,104,121,95,99,104,105,108,100,48,95,98,105,116,59,10,32,32,32,32,32,32,111,102,102,115,101,116,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,104,105,101,114,97,114,99,104,121,95,99,104,105,108,100,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,118,41,59,10,32,32,32,32,32,32,111,102,102,115,101,116,32,43,61,32,100,97,116,97,95,108,111,99,97,116,105,111,110,59,10,32,32,32,32,32,32,118,32,61,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,111,102,102,115,101,116,41,59,10,32,32,32,32,125,10,10,32,32,98,111,120,46,115,105,122,101,32,61,32,98,111,120,46,109,97,120,95,112,111,105,110,116,32,45,32,98,111,120,46,109,105,110,95,112,111,105,110,116,59,10,32,32,98,111,120,46,99,101,110,116,101,114,95,112,111,105,110,116,32,61,32,48,46,53,32,42,32,40,98,111,120,46,109,105,110,95,112,111,105,110,116,32,43,32,98,111,120,46,109,97,120,95,112,111,105,110,116,41,59,10,32,32,99,117,114,118,101,95,108,105,115,116,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,104,105,101,114,97,114,99,104,121,95,99,117,114,118,101,95,108,105,115,116,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,104,105,101,114,97,114,99,104,121,95,99,117,114,118,101,95,108,105,115,116,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,118,41,59,10,32,32,110,117,109,95,99,117,114,118,101,115,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,104,105,101,114,97,114,99,104,121,95,99,117,114,118,101,95,108,105,115,116,95,115,105,122,101,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,104,105,101,114,97,114,99,104,121,95,99,117,114,118,101,95,108,105,115,116,95,115,105,122,101,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,118,41,59,10,10,32,32,114,101,116,117,114,110,32,111,102,102,115,101,116,32,43,32,49,117,59,10,125,10,10,118,101,99,50,10,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,117,110,112,97,99,107,95,112,111,105,110,116,40,105,110,32,117,105,110,116,32,112,116,114,41,10,123,10,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,95,102,112,49,54,120,50,40,112,116,114,41,59,10,125,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,111,109,112,117,116,101,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,40,105,110,32,118,101,99,50,32,102,114,97,103,95,112,111,105,110,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,102,114,97,103,95,112,111,105,110,116,95,100,120,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,102,114,97,103,95,112,111,105,110,116,95,100,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,114,101,102,101,114,101,110,99,101,95,112,111,105,110,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,32,116,114,41,10,123,10,32,32,47,42,32,87,101,32,110,101,101,100,32,116,111,32,99,114,101,97,116,101,32,97,32,109,97,116,114,105,120,32,77,32,116,104,97,116,32,104,97,115,32,116,104,101,32,102,111,108,108,111,119,105,110,103,32,112,114,111,112,101,114,116,105,101,115,58,10,32,32,32,42,32,32,32,49,46,32,77,40,113,41,32,61,32,40,86,44,32,48,41,32,119,104,101,114,101,32,113,32,61,32,114,101,102,101,114,101,110,99,101,95,112,111,105,110,116,32,45,32,102,114,97,103,95,112,111,105,110,116,10,32,32,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,110,100,32,86,32,99,97,110,32,98,101,32,97,110,121,32,110,111,110,45,110,101,103,97,116,105,118,101,32,118,97,108,117,101,10,32,32,32,42,32,32,32,50,46,32,77,32,42,32,70,32,105,115,32,97,32,114,111,116,97,116,105,111,110,32,119,104,101,114,101,32,70,32,105,115,32,116,104,101,32,50,120,50,32,109,97,116,114,105,120,32,103,105,118,105,110,103,32,116,104,101,10,32,32,32,42,32,32,32,32,32,32,32,32,32,32,32,32,116,104,101,32,108,111,99,97,108,32,116,114,97,110,115,102,111,114,109,97,116,105,111,110,32,102,114,111,109,32,119,105,110,100,111,119,32,99,111,111,114,100,105,110,97,116,101,115,32,116,111,10,32,32,32,42,32,32,32,32,32,32,32,32,32,32,32,32,103,108,121,112,104,32,99,111,111,114,100,105,110,97,116,101,115,46,10,32,32,32,42,10,32,32,32,42,10,32,32,32,42,32,84,104,101,32,99,111,109,112,117,116,97,116,105,111,110,32,102,111,114,32,77,32,105,115,32,97,115,32,102,111,108,108,111,119,115,58,10,32,32,32,42,32,32,32,76,101,116,32,81,32,98,101,32,115,116,32,70,40,81,41,32,61,32,113,46,10,32,32,32,42,32,32,32,76,101,116,32,84,32,98,101,32,115,116,32,60,84,44,32,81,62,32,61,32,48,44,32,105,46,101,46,32,84,32,61,32,74,40,81,41,32,119,104,101,114,101,32,74,40,120,44,32,121,41,32,61,32,40,45,121,44,32,120,41,10,32,32,32,42,32,32,32,76,101,116,32,116,32,61,32,74,40,70,40,84,41,41,10,32,32,32,42,10,32,32,32,42,32,116,104,117,115,44,10,32,32,32,42,10,32,32,32,42,32,32,32,116,32,61,32,40,74,32,42,32,70,32,42,32,74,32,42,32,70,105,110,118,101,114,115,101,41,40,113,41,10,32,32,32,42,10,32,32,32,42,32,84,104,101,32,109,97,116,114,105,120,32,70,32,105,115,32,103,105,118,101,110,32,98,121,10,32,32,32,42,10,32,32,32,42,32,32,32,124,32,102,114,97,103,95,112,111,105,110,116,95,100,120,46,120,32,102,114,97,103,95,112,111,105,110,116,95,100,121,46,120,32,124,10,32,32,32,42,32,32,32,124,32,102,114,97,103,95,112,111,105,110,116,95,100,120,46,121,32,102,114,97,103,95,112,111,105,110,116,95,100,121,46,121,32,124,10,32,32,32,42,10,32,32,32,42,32,70,111,114,32,97,110,121,32,109,97,116,114,105,120,32,75,10,32,32,32,42,10,32,32,32,42,32,32,124,32,97,32,98,32,124,10,32,32,32,42,32,32,124,32,99,32,100,32,124,10,32,32,32,42,10,32,32,32,42,32,116,104,101,32,109,97,116,114,105,120,32,74,32,42,32,75,32,42,32,74,32,42,32,75,105,110,118,101,114,115,101,32,105,115,32,103,105,118,101,110,32,98,121,10,32,32,32,42,10,32,32,32,42,32,124,32,45,40,99,99,32,43,32,100,100,41,32,47,32,82,32,32,32,40,97,99,32,43,32,98,100,41,32,47,32,82,32,124,10,32,32,32,42,32,124,32,32,40,97,99,32,43,32,98,100,41,32,47,32,82,32,32,45,40,97,97,32,43,32,98,98,41,32,47,32,82,32,124,10,32,32,32,42,10,32,32,32,42,32,119,104,101,114,101,32,82,32,105,115,32,100,101,116,40,75,41,46,32,83,105,110,99,101,32,119,101,32,97,114,101,32,111,110,108,121,32,110,101,101,100,105,110,103,32,116,104,101,10,32,32,32,42,32,100,105,114,101,99,116,105,111,110,32,111,102,32,116,104,101,32,118,101,99,116,111,114,32,116,44,32,119,101,32,99,97,110,32,115,107,105,112,32,116,104,101,32,100,105,118,105,100,101,10,32,32,32,42,32,98,121,32,82,46,32,76,101,116,116,105,110,103,32,76,32,98,101,32,116,104,101,32,97,98,111,118,101,32,109,97,116,114,105,120,44,32,119,101,32,115,101,116,32,78,32,116,111,10,32,32,32,42,32,98,101,32,116,104,101,32,109,97,116,114,105,120,10,32,32,32,42,10,32,32,32,42,32,32,124,32,32,116,46,120,32,32,116,46,121,32,124,10,32,32,32,42,32,32,124,32,106,113,46,120,32,106,113,46,121,32,124,10,32,32,32,42,10,32,32,32,42,32,119,104,101,114,101,32,106,113,32,61,32,40,45,113,46,121,44,32,113,46,120,41,32,97,110,100,32,116,32,61,32,76,32,42,32,113,46,32,70,105,110,97,108,108,121,44,10,32,32,32,42,32,77,32,105,115,32,103,105,118,101,110,32,98,121,32,78,32,115,99,97,108,101,100,32,115,111,32,116,104,97,116,32,70,42,106,113,32,97,110,100,32,70,42,116,32,104,97,118,101,10,32,32,32,42,32,117,110,105,116,32,76,49,45,108,101,110,103,116,104,44,32,77,42,106,113,32,61,32,40,86,44,32,48,41,32,119,105,116,104,32,86,32,62,32,48,32,97,110,100,10,32,32,32,42,32,77,32,105,115,32,111,114,105,101,110,116,97,116,105,111,110,32,112,114,101,115,101,114,118,105,110,103,32,40,116,104,105,115,32,105,115,32,114,101,113,117,105,114,101,100,10,32,32,32,42,32,98,101,99,97,117,115,101,32,105,102,32,77,32,114,101,118,101,114,115,101,115,32,111,114,105,101,110,116,97,116,105,111,110,32,116,104,101,32,119,105,110,100,105,110,103,10,32,32,32,42,32,99,104,97,110,103,101,115,32,116,111,32,116,104,101,32,114,101,102,101,114,110,101,99,101,32,112,111,105,110,116,32,119,111,117,108,100,32,116,104,101,110,32,110,101,101,100,10,32,32,32,42,32,116,111,32,98,101,32,110,101,103,97,116,101,100,41,46,10,32,32,32,42,47,10,10,32,32,118,101,99,50,32,113,44,32,116,111,112,95,114,111,119,44,32,98,111,116,116,111,109,95,114,111,119,44,32,101,109,59,10,32,32,102,108,111,97,116,32,97,44,32,98,44,32,99,44,32,100,59,10,10,32,32,116,114,46,116,114,97,110,115,108,97,116,105,111,110,32,61,32,102,114,97,103,95,112,111,105,110,116,59,10,32,32,113,32,61,32,114,101,102,101,114,101,110,99,101,95,112,111,105,110,116,32,45,32,102,114,97,103,95,112,111,105,110,116,59,10,32,32,116,114,46,106,113,95,118,101,99,116,111,114,46,120,32,61,32,45,113,46,121,59,10,32,32,116,114,46,106,113,95,118,101,99,116,111,114,46,121,32,61,32,113,46,120,59,10,10,32,32,97,32,61,32,102,114,97,103,95,112,111,105,110,116,95,100,120,46,120,59,10,32,32,98,32,61,32,102,114,97,103,95,112,111,105,110,116,95,100,121,46,120,59,10,32,32,99,32,61,32,102,114,97,103,95,112,111,105,110,116,95,100,120,46,121,59,10,32,32,100,32,61,32,102,114,97,103,95,112,111,105,110,116,95,100,121,46,121,59,10,10,32,32,116,111,112,95,114,111,119,46,120,32,61,32,45,40,99,32,42,32,99,32,43,32,100,32,42,32,100,41,59,10,32,32,116,111,112,95,114,111,119,46,121,32,61,32,98,111,116,116,111,109,95,114,111,119,46,120,32,61,32,40,97,32,42,32,99,32,43,32,98,32,42,32,100,41,59,10,32,32,98,111,116,116,111,109,95,114,111,119,46,121,32,61,32,45,40,97,32,42,32,97,32,43,32,98,32,42,32,98,41,59,10,10,32,32,116,114,46,116,95,118,101,99,116,111,114,46,120,32,61,32,100,111,116,40,116,111,112,95,114,111,119,44,32,113,41,59,10,32,32,116,114,46,116,95,118,101,99,116,111,114,46,121,32,61,32,100,111,116,40,98,111,116,116,111,109,95,114,111,119,44,32,113,41,59,10,10,32,32,47,42,32,101,109,32,114,101,112,114,101,115,101,110,116,115,32,116,104,101,32,110,111,114,109,97,108,105,122,97,116,105,111,110,32,115,111,32,116,104,97,116,32,116,104,101,32,112,114,101,45,105,109,97,103,101,32,111,102,32,116,95,118,101,99,116,111,114,10,32,32,32,42,32,97,110,100,32,106,113,95,118,101,99,116,111,114,32,105,110,32,115,99,114,101,101,110,32,99,111,111,114,100,105,110,97,116,101,115,32,104,97,115,32,108,101,110,103,116,104,32,49,46,10,32,32,32,42,47,10,32,32,101,109,46,120,32,61,32,97,98,115,40,100,111,116,40,116,114,46,116,95,118,101,99,116,111,114,44,32,102,114,97,103,95,112,111,105,110,116,95,100,120,41,41,32,43,32,97,98,115,40,100,111,116,40,116,114,46,116,95,118,101,99,116,111,114,44,32,102,114,97,103,95,112,111,105,110,116,95,100,121,41,41,59,10,32,32,101,109,46,121,32,61,32,97,98,115,40,100,111,116,40,116,114,46,106,113,95,118,101,99,116,111,114,44,32,102,114,97,103,95,112,111,105,110,116,95,100,120,41,41,32,43,32,97,98,115,40,100,111,116,40,116,114,46,106,113,95,118,101,99,116,111,114,44,32,102,114,97,103,95,112,111,105,110,116,95,100,121,41,41,59,10,10,32,32,47,42,32,80,114,101,118,101,110,116,32,100,105,118,105,100,101,32,98,121,32,122,101,114,111,46,32,105,102,32,101,109,46,120,32,111,114,32,101,109,46,121,32,105,115,32,118,101,114,121,32,115,109,97,108,108,44,32,116,104,97,116,32,109,101,97,110,115,10,32,32,32,42,32,116,104,97,116,32,111,110,32,115,99,114,101,101,110,32,116,104,101,32,120,32,40,114,101,112,115,101,99,116,105,118,101,108,121,32,121,41,32,108,111,99,97,108,32,99,111,111,114,100,105,110,97,116,101,32,97,120,105,115,32,105,115,10,32,32,32,42,32,115,101,118,101,114,101,108,121,32,115,116,114,101,116,99,104,101,100,46,32,83,105,110,99,101,32,116,104,101,32,115,97,109,112,108,101,32,112,111,105,110,116,32,105,115,32,116,111,32,98,101,32,114,101,97,115,111,110,97,98,108,121,10,32,32,32,42,32,102,97,114,32,102,114,111,109,32,97,110,121,32,99,117,114,118,101,44,32,99,108,97,109,112,105,110,103,32,101,109,46,120,32,97,110,100,32,101,109,46,121,32,97,119,97,121,32,102,114,111,109,32,122,101,114,111,32,119,105,108,108,10,32,32,32,42,32,110,111,116,32,104,97,118,101,32,101,102,102,101,99,116,32,111,110,32,99,111,118,101,114,97,103,101,32,99,111,109,112,117,116,97,116,105,111,110,46,10,32,32,32,42,47,10,32,32,99,111,110,115,116,32,102,108,111,97,116,32,109,105,110,95,101,109,32,61,32,49,101,45,55,59,10,32,32,101,109,46,120,32,61,32,109,97,120,40,101,109,46,120,44,32,109,105,110,95,101,109,41,59,10,32,32,101,109,46,121,32,61,32,109,97,120,40,101,109,46,121,44,32,109,105,110,95,101,109,41,59,10,10,32,32,116,114,46,116,95,118,101,99,116,111,114,32,47,61,32,101,109,46,120,59,10,32,32,116,114,46,106,113,95,118,101,99,116,111,114,32,47,61,32,101,109,46,121,59,10,32,32,116,114,46,114,101,102,101,114,101,110,99,101,95,108,111,99,97,116,105,111,110,32,61,32,100,111,116,40,116,114,46,116,95,118,101,99,116,111,114,44,32,113,41,59,10,10,32,32,105,102,32,40,116,114,46,114,101,102,101,114,101,110,99,101,95,108,111,99,97,116,105,111,110,32,60,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,47,42,32,119,101,32,110,101,101,100,32,116,111,32,115,101,110,100,32,113,32,116,111,32,40,86,44,32,48,41,32,119,104,101,114,101,10,32,32,32,32,32,32,32,42,32,86,32,105,115,32,112,111,115,105,116,105,118,101,46,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,116,114,46,116,95,118,101,99,116,111,114,32,61,32,45,116,114,46,116,95,118,101,99,116,111,114,59,10,32,32,32,32,32,32,116,114,46,114,101,102,101,114,101,110,99,101,95,108,111,99,97,116,105,111,110,32,61,32,45,116,114,46,114,101,102,101,114,101,110,99,101,95,108,111,99,97,116,105,111,110,59,10,32,32,32,32,125,10,10,32,32,102,108,111,97,116,32,100,101,116,59,10,10,32,32,100,101,116,32,61,32,40,116,114,46,116,95,118,101,99,116,111,114,46,120,32,42,32,116,114,46,106,113,95,118,101,99,116,111,114,46,121,32,45,32,116,114,46,116,95,118,101,99,116,111,114,46,121,32,42,32,116,114,46,106,113,95,118,101,99,116,111,114,46,120,41,59,10,32,32,47,42,32,119,101,32,110,101,101,100,32,116,104,101,32,116,114,97,110,115,102,111,114,109,97,116,105,111,110,32,116,111,32,98,101,32,111,114,105,101,110,116,97,116,105,111,110,32,112,114,101,115,101,114,118,105,110,103,46,10,32,32,32,42,32,84,104,101,32,111,110,108,121,32,114,101,113,117,105,114,101,109,101,110,116,32,119,101,32,104,97,118,101,32,111,110,32,106,113,95,118,101,99,116,111,114,32,105,115,32,116,104,97,116,10,32,32,32,42,32,100,111,116,40,106,113,95,118,101,99,116,111,114,44,32,113,41,32,105,115,32,122,101,114,111,44,32,115,111,32,110,101,103,97,116,101,32,106,113,95,118,101,99,116,111,114,32,116,111,32,103,101,116,32,116,104,101,10,32,32,32,42,32,116,114,97,110,115,102,111,114,109,97,116,105,111,110,32,109,97,116,114,105,120,32,116,111,32,98,101,32,111,114,105,101,110,116,97,116,105,111,110,32,112,114,101,115,101,114,118,105,110,103,46,10,32,32,32,42,47,10,32,32,105,102,32,40,100,101,116,32,60,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,116,114,46,106,113,95,118,101,99,116,111,114,32,61,32,45,116,114,46,106,113,95,118,101,99,116,111,114,59,10,32,32,32,32,125,10,125,10,10,118,101,99,50,10,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,97,112,112,108,121,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,40,105,110,32,118,101,99,50,32,112,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,32,116,114,41,10,123,10,32,32,112,32,45,61,32,116,114,46,116,114,97,110,115,108,97,116,105,111,110,59,10,32,32,114,101,116,117,114,110,32,118,101,99,50,40,100,111,116,40,116,114,46,116,95,118,101,99,116,111,114,44,32,112,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,111,116,40,116,114,46,106,113,95,118,101,99,116,111,114,44,32,112,41,41,59,10,125,10,10,105,110,116,10,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,111,109,112,117,116,101,95,119,105,110,100,105,110,103,95,99,111,110,116,114,105,98,117,116,105,111,110,40,105,110,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,117,114,118,101,95,116,121,112,101,32,99,117,114,118,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,32,116,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,100,105,115,116,97,110,99,101,95,116,121,112,101,32,100,115,116,41,10,123,10,32,32,118,101,99,50,32,65,44,32,66,44,32,67,59,10,32,32,105,110,116,32,82,32,61,32,48,59,10,32,32,98,111,111,108,32,117,115,101,95,116,49,44,32,117,115,101,95,116,50,59,10,32,32,102,108,111,97,116,32,116,49,44,32,116,50,44,32,120,49,44,32,120,50,44,32,121,49,44,32,121,50,59,10,32,32,99,111,110,115,116,32,102,108,111,97,116,32,113,117,97,100,95,116,111,108,32,61,32,48,46,48,48,48,49,59,10,10,32,32,99,117,114,118,101,46,112,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,97,112,112,108,121,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,40,99,117,114,118,101,46,112,49,44,32,116,114,41,59,10,32,32,99,117,114,118,101,46,112,50,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,97,112,112,108,121,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,40,99,117,114,118,101,46,112,50,44,32,116,114,41,59,10,32,32,99,117,114,118,101,46,112,51,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,97,112,112,108,121,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,40,99,117,114,118,101,46,112,51,44,32,116,114,41,59,10,10,32,32,65,32,61,32,99,117,114,118,101,46,112,49,32,45,32,50,46,48,32,42,32,99,117,114,118,101,46,112,50,32,43,32,99,117,114,118,101,46,112,51,59,10,32,32,66,32,61,32,99,117,114,118,101,46,112,49,32,45,32,99,117,114,118,101,46,112,50,59,10,32,32,67,32,61,32,99,117,114,118,101,46,112,49,59,10,10,32,32,47,42,10,32,32,32,42,32,76,101,116,10,32,32,32,42,10,32,32,32,42,32,32,102,40,116,41,32,61,32,91,112,49,44,32,112,50,44,32,112,51,93,40,116,41,32,61,32,65,116,94,50,32,45,32,50,66,116,32,43,32,67,10,32,32,32,42,10,32,32,32,42,32,119,104,101,114,101,10,32,32,32,42,10,32,32,32,42,32,32,65,32,61,32,112,49,32,45,32,50,112,50,32,43,32,112,51,10,32,32,32,42,32,32,66,32,61,32,112,49,32,45,32,112,50,10,32,32,32,42,32,32,67,32,61,32,112,49,10,32,32,32,42,10,32,32,32,42,32,119,101,32,119,105,115,104,32,116,111,32,115,111,108,118,101,32,102,111,114,32,116,32,115,111,32,116,104,97,116,32,102,95,121,40,116,41,32,61,32,48,32,98,117,116,32,101,110,102,111,114,99,101,32,116,104,97,116,10,32,32,32,42,32,48,32,60,32,116,32,60,32,49,46,32,68,114,111,112,112,105,110,103,32,116,104,101,32,46,121,32,115,117,102,102,105,120,101,115,44,32,116,104,101,32,113,117,97,100,114,97,116,105,99,32,102,111,114,109,117,108,97,10,32,32,32,42,32,103,105,118,101,115,32,117,115,32,116,104,101,32,116,119,111,32,114,111,111,116,115,58,10,32,32,32,42,10,32,32,32,42,32,32,116,49,32,61,32,40,66,32,45,32,115,113,114,116,40,66,94,50,32,45,32,65,67,41,41,32,47,32,65,10,32,32,32,42,32,32,116,50,32,61,32,40,66,32,43,32,115,113,114,116,40,66,94,50,32,45,32,65,67,41,41,32,47,32,65,10,32,32,32,42,10,32,32,32,42,32,117,115,105,110,103,32,48,32,60,32,116,32,60,32,49,32,100,105,114,101,99,116,108,121,32,105,115,32,110,117,109,101,114,105,99,97,108,108,121,32,117,110,115,116,97,98,108,101,44,32,105,110,115,116,101,97,100,10,32,32,32,42,32,119,101,32,119,105,108,108,32,117,115,101,32,97,108,103,101,98,114,97,32,116,111,32,101,110,102,111,114,99,101,32,116,104,97,116,32,99,111,110,100,105,116,105,111,110,32,102,114,111,109,32,112,49,44,32,112,50,44,32,112,51,46,10,32,32,32,42,32,87,104,101,110,32,65,32,62,32,48,44,32,104,105,103,104,32,115,99,104,111,111,108,32,97,108,103,101,98,114,97,32,121,105,101,108,100,115,10,32,32,32,42,10,32,32,32,42,32,32,48,32,60,32,116,49,32,60,32,49,32,105,102,32,97,110,100,32,111,110,108,121,32,105,102,32,40,112,49,32,62,32,112,50,32,38,38,32,112,49,32,62,32,48,32,38,38,32,40,112,51,32,62,32,112,50,32,124,124,32,112,51,32,60,32,48,41,41,10,32,32,32,42,32,32,48,32,60,32,116,50,32,60,32,49,32,105,102,32,97,110,100,32,111,110,108,121,32,105,102,32,40,112,51,32,62,32,112,50,32,38,38,32,112,51,32,62,32,48,32,38,38,32,40,112,49,32,62,32,112,50,32,124,124,32,112,49,32,60,32,48,41,41,10,32,32,32,42,10,32,32,32,42,32,119,104,105,99,104,44,32,97,103,97,105,110,32,118,105,97,32,104,105,103,104,32,115,99,104,111,111,108,32,97,108,103,101,98,114,97,32,40,117,110,100,101,114,32,116,104,101,32,99,111,110,100,105,116,105,111,110,32,65,32,62,32,48,41,44,10,32,32,32,42,32,98,101,99,111,109,101,115,10,32,32,32,42,10,32,32,32,42,32,32,48,32,60,32,116,49,32,60,32,49,32,105,102,32,97,110,100,32,111,110,108,121,32,105,102,32,40,112,49,32,62,32,48,32,38,38,32,40,112,50,32,60,32,48,32,124,124,32,112,51,32,60,32,48,41,41,10,32,32,32,42,32,32,48,32,60,32,116,50,32,60,32,49,32,105,102,32,97,110,100,32,111,110,108,121,32,105,102,32,40,112,51,32,62,32,48,32,38,38,32,40,112,50,32,60,32,48,32,124,124,32,112,49,32,60,32,48,41,41,10,32,32,32,42,10,32,32,32,42,32,84,104,101,115,101,32,105,110,101,113,117,97,108,105,116,105,101,115,32,97,114,101,32,105,110,99,111,114,114,101,99,116,32,105,102,32,65,32,60,32,48,46,32,70,111,114,32,116,104,101,32,99,97,115,101,32,119,104,101,114,101,10,32,32,32,42,32,65,32,60,32,48,44,32,116,104,101,32,115,97,109,101,32,104,105,103,104,32,115,99,104,111,111,108,32,97,108,103,101,98,114,97,32,116,101,99,104,110,105,113,117,101,115,32,103,105,118,101,10,32,32,32,42,10,32,32,32,42,32,32,48,32,60,32,116,49,32,60,32,49,32,105,102,32,97,110,100,32,111,110,108,121,32,105,102,32,40,112,51,32,60,32,48,32,38,38,32,40,112,50,32,62,32,48,32,124,124,32,112,49,32,62,32,48,41,41,10,32,32,32,42,32,32,48,32,60,32,116,50,32,60,32,49,32,105,102,32,97,110,100,32,111,110,108,121,32,105,102,32,40,112,49,32,60,32,48,32,38,38,32,40,112,50,32,62,32,48,32,124,124,32,112,51,32,62,32,48,41,41,10,32,32,32,42,10,32,32,32,42,32,80,117,116,116,105,110,103,32,116,111,103,101,116,104,101,114,32,103,105,118,101,115,10,32,32,32,42,10,32,32,32,42,32,32,48,32,60,32,116,49,32,60,32,49,32,105,102,32,97,110,100,32,111,110,108,121,32,105,102,32,40,112,51,32,60,32,48,32,38,38,32,40,112,50,32,62,32,48,32,124,124,32,112,49,32,62,32,48,41,32,38,38,32,65,32,60,32,48,41,32,124,124,32,40,112,49,32,62,32,48,32,38,38,32,40,112,50,32,60,32,48,32,124,124,32,112,51,32,60,32,48,41,32,38,38,32,65,32,62,32,48,41,10,32,32,32,42,32,32,48,32,60,32,116,50,32,60,32,49,32,105,102,32,97,110,100,32,111,110,108,121,32,105,102,32,40,112,49,32,60,32,48,32,38,38,32,40,112,50,32,62,32,48,32,124,124,32,112,51,32,62,32,48,41,32,38,38,32,65,32,60,32,48,41,32,124,124,32,40,112,51,32,62,32,48,32,38,38,32,40,112,50,32,60,32,48,32,124,124,32,112,49,32,60,32,48,41,32,38,38,32,65,32,62,32,48,41,10,32,32,32,42,10,32,32,32,42,32,87,101,32,99,97,110,32,115,116,105,108,108,32,115,105,109,112,108,105,102,121,32,109,111,114,101,46,32,73,110,100,101,101,100,44,32,116,104,101,32,118,97,108,117,101,32,111,102,10,32,32,32,42,10,32,32,32,42,32,32,40,112,51,32,60,32,48,32,38,38,32,40,112,50,32,62,32,48,32,124,124,32,112,49,32,62,32,48,41,32,38,38,32,65,32,60,32,48,41,32,124,32,40,112,49,32,62,32,48,32,38,38,32,40,112,50,32,60,32,48,32,124,124,32,112,51,32,60,32,48,41,32,38,38,32,65,32,62,32,48,41,10,32,32,32,42,10,32,32,32,42,32,105,115,32,101,113,117,105,118,97,108,101,110,116,32,116,111,32,118,105,97,32,97,108,103,101,98,114,97,32,40,98,121,32,101,120,97,109,105,110,105,110,103,32,116,104,101,32,116,104,114,101,101,32,99,97,115,101,115,32,40,112,49,32,60,61,32,48,41,44,10,32,32,32,42,32,40,112,51,32,62,61,32,48,41,32,97,110,100,32,40,112,49,32,62,32,48,32,38,38,32,112,51,32,60,32,48,41,32,116,111,58,10,32,32,32,42,10,32,32,32,42,32,32,40,112,51,32,60,32,48,32,38,38,32,40,112,50,32,62,32,48,32,124,124,32,112,49,32,62,32,48,41,41,32,124,124,32,40,112,49,32,62,32,48,32,38,38,32,40,112,50,32,60,32,48,32,124,124,32,112,51,32,60,32,48,41,41,10,32,32,32,42,10,32,32,32,42,32,83,105,109,105,108,97,105,114,32,108,111,103,105,99,32,103,105,118,101,115,32,116,104,97,116,10,32,32,32,42,10,32,32,32,42,32,32,40,112,49,32,60,32,48,32,38,38,32,40,112,50,32,62,32,48,32,124,124,32,112,51,32,62,32,48,41,32,38,38,32,65,32,60,32,48,41,32,124,124,32,40,112,51,32,62,32,48,32,38,38,32,40,112,50,32,60,32,48,32,124,124,32,112,49,32,60,32,48,41,32,38,38,32,65,32,62,32,48,41,10,32,32,32,42,10,32,32,32,42,32,105,115,32,101,113,117,105,118,97,108,101,110,116,32,116,111,10,32,32,32,42,10,32,32,32,42,32,32,40,112,49,32,60,32,48,32,38,38,32,40,112,50,32,62,32,48,32,124,124,32,112,51,32,62,32,48,41,41,32,124,124,32,40,112,51,32,62,32,48,32,38,38,32,40,112,50,32,60,32,48,32,124,124,32,112,49,32,60,32,48,41,41,10,32,32,32,42,10,32,32,32,42,32,87,104,105,99,104,32,105,109,112,108,105,101,115,32,116,104,97,116,32,105,110,115,116,101,97,100,32,111,102,32,104,97,118,105,110,103,32,97,32,99,111,110,100,105,116,105,111,110,97,108,32,98,114,97,110,99,104,32,111,110,32,65,32,60,32,48,44,10,32,32,32,42,32,119,101,32,99,97,110,32,106,117,115,116,32,112,117,116,32,97,32,108,111,103,105,99,97,108,32,111,102,32,116,104,101,109,32,116,111,103,101,116,104,101,114,46,32,84,104,101,114,101,102,111,114,101,44,10,32,32,32,42,10,32,32,32,42,32,32,84,49,32,61,32,40,112,51,32,60,32,48,32,38,38,32,40,112,50,32,62,32,48,32,124,124,32,112,49,32,62,32,48,41,41,32,124,124,32,40,112,49,32,62,32,48,32,38,38,32,40,112,50,32,60,32,48,32,124,124,32,112,51,32,60,32,48,41,41,10,32,32,32,42,32,32,32,32,32,61,32,40,112,51,32,60,32,48,32,38,38,32,112,49,32,62,32,48,41,32,124,124,32,40,112,51,32,60,32,48,32,38,38,32,112,50,32,62,32,48,41,32,124,124,32,40,112,49,32,62,32,48,32,38,38,32,112,50,32,60,32,48,41,32,124,124,32,40,112,49,32,62,32,48,32,38,38,32,112,51,32,60,32,48,41,10,32,32,32,42,32,32,32,32,32,61,32,40,112,51,32,60,32,48,32,38,38,32,112,49,32,62,32,48,41,32,124,124,32,40,112,51,32,60,32,48,32,38,38,32,112,50,32,62,32,48,41,32,124,124,32,40,112,49,32,62,32,48,32,38,38,32,112,50,32,60,32,48,41,10,32,32,32,42,10,32,32,32,42,32,32,84,50,32,61,32,40,112,49,32,60,32,48,32,38,38,32,40,112,50,32,62,32,48,32,124,124,32,112,51,32,62,32,48,41,41,32,124,124,32,40,112,51,32,62,32,48,32,38,38,32,40,112,50,32,60,32,48,32,124,124,32,112,49,32,60,32,48,41,41,10,32,32,32,42,32,32,32,32,32,61,32,40,112,49,32,60,32,48,32,38,38,32,112,50,32,62,32,48,41,32,124,124,32,40,112,49,32,60,32,48,32,38,38,32,112,51,32,62,32,48,41,32,124,124,32,40,112,51,32,62,32,48,32,38,38,32,112,49,32,60,32,48,41,32,124,124,32,40,112,51,32,62,32,48,32,38,38,32,112,50,32,60,32,48,41,10,32,32,32,42,32,32,32,32,32,61,32,40,112,49,32,60,32,48,32,38,38,32,112,50,32,62,32,48,41,32,124,124,32,40,112,49,32,60,32,48,32,38,38,32,112,51,32,62,32,48,41,32,124,124,32,40,112,51,32,62,32,48,32,38,38,32,112,50,32,60,32,48,41,10,32,32,32,42,10,32,32,32,42,32,84,104,101,32,108,97,115,116,32,105,115,115,117,101,32,105,115,32,116,111,32,104,97,110,100,108,101,32,116,104,101,32,101,110,100,45,112,111,105,110,116,115,32,111,102,32,116,104,101,32,99,117,114,118,101,32,99,111,114,114,101,99,116,108,121,46,10,32,32,32,42,32,87,101,32,117,115,101,32,116,104,101,32,114,117,108,101,115,58,10,32,32,32,42,10,32,32,32,42,32,32,40,97,41,32,117,115,101,32,48,32,105,102,32,97,110,100,32,111,110,108,121,32,105,102,32,102,40,48,41,32,61,32,48,32,38,38,32,102,39,40,48,41,32,60,32,48,10,32,32,32,42,32,32,40,98,41,32,117,115,101,32,49,32,105,102,32,97,110,100,32,111,110,108,121,32,105,102,32,102,40,49,41,32,61,32,49,32,38,38,32,102,39,40,49,41,32,62,32,48,10,32,32,32,42,10,32,32,32,42,32,87,104,105,99,104,32,98,101,99,111,109,101,10,32,32,32,42,10,32,32,32,42,32,32,40,97,41,32,117,115,101,32,48,32,105,102,32,97,110,100,32,111,110,108,121,32,105,102,32,112,49,32,61,61,32,48,32,38,38,32,112,50,32,60,32,112,49,10,32,32,32,42,32,32,40,98,41,32,117,115,101,32,49,32,105,102,32,97,110,100,32,111,110,108,121,32,105,102,32,112,51,32,61,61,32,48,32,38,38,32,112,50,32,60,32,112,51,10,32,32,32,42,10,32,32,32,42,32,73,102,32,112,49,46,121,32,105,115,32,122,101,114,111,44,32,116,104,101,110,10,32,32,32,42,10,32,32,32,42,32,32,32,32,32,116,49,32,61,32,40,66,32,45,32,124,66,124,41,32,47,32,65,10,32,32,32,42,32,32,32,32,32,116,50,32,61,32,40,66,32,43,32,124,66,124,41,32,47,32,65,10,32,32,32,42,10,32,32,32,42,32,73,102,32,112,50,32,60,32,48,32,61,32,112,49,44,32,116,104,101,110,32,66,32,62,32,48,32,97,110,100,32,116,104,117,115,32,116,49,32,61,32,48,44,32,105,46,101,46,10,32,32,32,42,32,117,115,101,32,116,49,32,119,104,101,110,101,118,101,114,32,40,97,41,32,105,115,32,116,114,117,101,46,10,32,32,32,42,10,32,32,32,42,32,73,102,32,112,51,46,121,32,105,115,32,122,101,114,111,44,32,116,104,101,110,32,97,108,103,101,98,114,97,32,119,105,108,108,32,103,105,118,101,32,116,104,97,116,10,32,32,32,42,10,32,32,32,42,32,32,32,116,49,32,61,32,40,40,112,49,32,45,32,112,50,41,32,45,32,124,112,50,124,41,32,47,32,40,112,49,32,45,32,50,112,50,41,10,32,32,32,42,32,32,32,116,50,32,61,32,40,40,112,49,32,45,32,112,50,41,32,43,32,124,112,50,124,41,32,47,32,40,112,49,32,45,32,50,112,50,41,10,32,32,32,42,10,32,32,32,42,32,116,104,117,115,32,111,110,32,99,111,110,100,105,116,105,111,110,32,40,98,41,32,103,105,118,101,115,10,32,32,32,42,10,32,32,32,42,32,32,116,49,32,61,32,112,49,32,47,32,40,112,49,32,45,32,50,112,50,41,10,32,32,32,42,32,32,116,50,32,61,32,49,10,32,32,32,42,10,32,32,32,42,32,119,104,105,99,104,32,109,101,97,110,115,32,117,115,101,32,116,50,32,119,104,101,110,32,40,98,41,32,105,115,32,116,114,117,101,46,10,32,32,32,42,10,32,32,32,42,32,84,104,117,115,44,10,32,32,32,42,10,32,32,32,42,32,32,32,117,115,101,95,116,49,32,61,32,84,49,32,124,124,32,40,112,49,32,61,61,32,48,32,38,38,32,112,50,32,60,32,48,41,10,32,32,32,42,32,32,32,32,32,32,32,32,32,32,61,32,40,112,51,32,60,32,48,32,38,38,32,112,49,32,62,32,48,41,32,124,124,32,40,112,51,32,60,32,48,32,38,38,32,112,50,32,62,32,48,41,32,124,124,32,40,112,49,32,62,61,32,48,32,38,38,32,112,50,32,60,32,48,41,10,32,32,32,42,10,32,32,32,42,32,32,32,117,115,101,95,116,50,32,61,32,84,50,32,124,124,32,40,112,51,32,61,61,32,48,32,38,38,32,112,50,32,60,32,48,41,10,32,32,32,42,32,32,32,32,32,32,32,32,32,32,61,32,40,112,49,32,60,32,48,32,38,38,32,112,50,32,62,32,48,41,32,124,124,32,40,112,49,32,60,32,48,32,38,38,32,112,51,32,62,32,48,41,32,124,124,32,40,112,51,32,62,61,32,48,32,38,38,32,112,50,32,60,32,48,41,10,32,32,32,42,47,10,32,32,117,115,101,95,116,49,32,61,32,40,99,117,114,118,101,46,112,51,46,121,32,60,32,48,46,48,32,38,38,32,99,117,114,118,101,46,112,49,46,121,32,62,32,48,46,48,41,10,32,32,32,32,124,124,32,40,99,117,114,118,101,46,112,51,46,121,32,60,32,48,46,48,32,38,38,32,99,117,114,118,101,46,112,50,46,121,32,62,32,48,46,48,41,10,32,32,32,32,124,124,32,40,99,117,114,118,101,46,112,49,46,121,32,62,61,32,48,46,48,32,38,38,32,99,117,114,118,101,46,112,50,46,121,32,60,32,48,46,48,41,59,10,10,32,32,117,115,101,95,116,50,32,61,32,40,99,117,114,118,101,46,112,49,46,121,32,60,32,48,32,38,38,32,99,117,114,118,101,46,112,50,46,121,32,62,32,48,46,48,41,10,32,32,32,32,124,124,32,40,99,117,114,118,101,46,112,49,46,121,32,60,32,48,46,48,32,38,38,32,99,117,114,118,101,46,112,51,46,121,32,62,32,48,46,48,41,10,32,32,32,32,124,124,32,40,99,117,114,118,101,46,112,51,46,121,32,62,61,32,48,46,48,32,38,38,32,99,117,114,118,101,46,112,50,46,121,32,60,32,48,46,48,41,59,10,10,32,32,105,102,32,40,99,117,114,118,101,46,105,115,95,113,117,97,100,114,97,116,105,99,32,38,38,32,97,98,115,40,65,46,121,41,32,62,32,113,117,97,100,95,116,111,108,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,68,44,32,114,65,59,10,10,32,32,32,32,32,32,68,32,61,32,66,46,121,32,42,32,66,46,121,32,45,32,65,46,121,32,42,32,67,46,121,59,10,32,32,32,32,32,32,105,102,32,40,68,32,60,32,48,46,48,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,47,42,32,116,104,101,32,112,97,114,111,98,111,108,97,32,100,111,101,115,32,110,111,116,32,103,111,32,116,104,114,111,117,103,104,32,121,32,61,32,48,44,32,116,104,117,115,32,105,116,32,100,111,101,115,10,32,32,32,32,32,32,32,32,32,32,32,42,32,110,111,116,32,99,111,110,116,114,105,98,117,116,101,32,116,111,32,116,104,101,32,119,105,110,100,105,110,103,32,110,117,109,98,101,114,46,10,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,116,49,32,61,32,116,50,32,61,32,50,46,48,59,10,32,32,32,32,32,32,32,32,32,32,117,115,101,95,116,49,32,61,32,117,115,101,95,116,50,32,61,32,102,97,108,115,101,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,114,65,32,61,32,49,46,48,32,47,32,65,46,121,59,10,32,32,32,32,32,32,32,32,32,32,68,32,61,32,115,113,114,116,40,68,41,59,10,10,32,32,32,32,32,32,32,32,32,32,116,49,32,61,32,40,66,46,121,32,45,32,68,41,32,42,32,114,65,59,10,32,32,32,32,32,32,32,32,32,32,116,50,32,61,32,40,66,46,121,32,43,32,68,41,32,42,32,114,65,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,116,49,32,61,32,116,50,32,61,32,48,46,53,32,42,32,67,46,121,32,47,32,66,46,121,59,10,32,32,32,32,125,10,10,32,32,47,42,32,87,101,32,107,110,111,119,32,116,104,97,116,32,116,49,32,97,108,119,97,121,115,32,105,110,99,114,101,109,101,110,116,115,32,97,110,100,32,116,50,32,97,108,119,97,121,115,32,100,101,99,101,114,101,109,101,110,116,115,10,32,32,32,42,32,116,104,101,32,119,105,110,100,105,110,103,32,110,117,109,98,101,114,32,118,105,97,10,32,32,32,42,10,32,32,32,42,32,102,95,121,40,116,41,32,32,61,32,65,121,32,42,32,40,116,32,45,32,116,49,41,32,42,32,40,116,32,45,32,116,50,41,10,32,32,32,42,32,102,95,121,39,40,116,41,32,61,32,65,121,32,42,32,40,116,32,45,32,116,49,41,32,43,32,65,121,32,42,32,40,116,32,45,32,116,50,41,10,32,32,32,42,10,32,32,32,42,32,116,104,101,110,10,32,32,32,42,32,32,32,105,102,32,65,121,32,60,32,48,44,32,116,104,101,110,32,116,49,32,62,32,116,50,32,97,110,100,32,116,104,117,115,32,102,95,121,39,40,116,49,41,32,60,32,48,32,97,110,100,32,102,95,121,39,40,116,50,41,32,62,32,48,10,32,32,32,42,32,32,32,105,102,32,65,121,32,62,32,48,44,32,116,104,101,110,32,116,49,32,60,32,116,50,32,97,110,100,32,116,104,117,115,32,102,95,121,39,40,116,49,41,32,60,32,48,32,97,110,100,32,102,95,121,39,40,116,50,41,32,62,32,48,10,32,32,32,42,47,10,32,32,105,102,32,40,117,115,101,95,116,49,41,10,32,32,32,32,123,10,32,32,32,32,32,32,120,49,32,61,32,40,65,46,120,32,42,32,116,49,32,45,32,66,46,120,32,42,32,50,46,48,41,32,42,32,116,49,32,43,32,67,46,120,59,10,32,32,32,32,32,32,105,102,32,40,120,49,32,60,61,32,116,114,46,114,101,102,101,114,101,110,99,101,95,108,111,99,97,116,105,111,110,32,38,38,32,120,49,32,62,61,32,48,46,48,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,82,32,43,61,32,49,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,117,112,100,97,116,101,95,100,105,115,116,97,110,99,101,40,97,98,115,40,120,49,41,44,32,120,49,32,60,32,48,46,48,44,32,100,115,116,41,59,10,32,32,32,32,125,10,10,32,32,105,102,32,40,117,115,101,95,116,50,41,10,32,32,32,32,123,10,32,32,32,32,32,32,120,50,32,61,32,40,65,46,120,32,42,32,116,50,32,45,32,66,46,120,32,42,32,50,46,48,41,32,42,32,116,50,32,43,32,67,46,120,59,10,32,32,32,32,32,32,105,102,32,40,120,50,32,60,61,32,116,114,46,114,101,102,101,114,101,110,99,101,95,108,111,99,97,116,105,111,110,32,38,38,32,120,50,32,62,61,32,48,46,48,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,82,32,45,61,32,49,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,117,112,100,97,116,101,95,100,105,115,116,97,110,99,101,40,97,98,115,40,120,50,41,44,32,120,50,32,62,32,48,46,48,44,32,100,115,116,41,59,10,32,32,32,32,125,10,10,32,32,47,42,32,119,101,32,100,111,32,116,104,101,32,120,45,115,111,108,118,101,32,106,117,115,116,32,102,111,114,32,116,104,101,32,100,105,115,116,97,110,99,101,32,102,117,110,99,116,105,111,110,44,10,32,32,32,42,32,115,105,110,99,101,32,119,101,32,97,114,101,32,106,117,115,116,32,97,105,109,105,110,103,32,102,111,114,32,97,32,100,105,115,116,97,110,99,101,44,32,119,101,32,99,97,110,10,32,32,32,42,32,117,115,101,32,116,104,101,32,110,117,109,101,114,105,99,97,108,108,121,32,117,110,115,116,97,98,108,101,32,48,32,60,61,32,116,32,60,61,32,49,32,105,110,115,116,101,97,100,10,32,32,32,42,32,111,102,32,116,104,101,32,110,97,115,116,121,32,99,111,110,100,105,116,105,111,110,32,102,114,111,109,32,116,104,101,32,99,111,110,116,114,111,108,32,112,111,105,110,116,115,10,32,32,32,42,32,100,105,114,101,99,116,108,121,46,10,32,32,32,42,47,10,32,32,105,102,32,40,99,117,114,118,101,46,105,115,95,113,117,97,100,114,97,116,105,99,32,38,38,32,97,98,115,40,65,46,120,41,32,62,32,113,117,97,100,95,116,111,108,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,68,59,10,10,32,32,32,32,32,32,68,32,61,32,66,46,120,32,42,32,66,46,120,32,45,32,65,46,120,32,42,32,67,46,120,59,10,32,32,32,32,32,32,105,102,32,40,68,32,60,32,48,46,48,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,117,115,101,95,116,49,32,61,32,117,115,101,95,116,50,32,61,32,102,97,108,115,101,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,114,65,32,61,32,49,46,48,32,47,32,65,46,120,59,10,10,32,32,32,32,32,32,32,32,32,32,68,32,61,32,115,113,114,116,40,68,41,59,10,32,32,32,32,32,32,32,32,32,32,116,49,32,61,32,40,66,46,120,32,45,32,68,41,32,42,32,114,65,59,10,32,32,32,32,32,32,32,32,32,32,116,50,32,61,32,40,66,46,120,32,43,32,68,41,32,42,32,114,65,59,10,10,32,32,32,32,32,32,32,32,32,32,117,115,101,95,116,49,32,61,32,40,116,49,32,62,61,32,48,46,48,32,38,38,32,116,49,32,60,61,32,49,46,48,41,59,10,32,32,32,32,32,32,32,32,32,32,117,115,101,95,116,50,32,61,32,40,116,50,32,62,61,32,48,46,48,32,38,38,32,116,50,32,60,61,32,49,46,48,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,116,49,32,61,32,116,50,32,61,32,48,46,53,32,42,32,67,46,120,32,47,32,66,46,120,59,10,32,32,32,32,32,32,117,115,101,95,116,49,32,61,32,40,99,117,114,118,101,46,112,49,46,120,32,62,32,48,46,48,32,38,38,32,99,117,114,118,101,46,112,51,46,120,32,60,32,48,46,48,41,59,10,32,32,32,32,32,32,117,115,101,95,116,50,32,61,32,40,99,117,114,118,101,46,112,49,46,120,32,60,32,48,46,48,32,38,38,32,99,117,114,118,101,46,112,51,46,120,32,62,32,48,46,48,41,59,10,32,32,32,32,125,10,10,32,32,47,42,32,70,111,114,32,116,104,101,32,115,97,109,101,32,114,101,115,97,115,111,110,32,116,104,97,116,32,116,49,32,97,108,119,97,121,115,32,105,110,99,114,101,109,101,110,116,115,32,116,104,101,32,119,105,110,100,105,110,103,10,32,32,32,42,32,97,110,100,32,116,50,32,97,108,119,97,121,115,32,100,101,99,114,101,109,101,110,116,115,32,116,104,101,32,119,105,110,100,105,110,103,44,32,119,101,32,107,110,111,119,32,116,104,97,116,32,111,110,108,121,10,32,32,32,42,32,116,104,101,32,115,105,103,110,32,111,102,32,121,49,32,97,110,100,32,121,50,32,101,102,102,101,99,116,32,119,104,105,99,104,32,100,105,115,116,97,110,99,101,32,116,104,101,121,32,115,104,111,117,108,100,10,32,32,32,42,32,117,112,100,97,116,101,46,10,32,32,32,42,47,10,32,32,105,102,32,40,117,115,101,95,116,49,41,10,32,32,32,32,123,10,32,32,32,32,32,32,121,49,32,61,32,40,65,46,121,32,42,32,116,49,32,45,32,66,46,121,32,42,32,50,46,48,41,32,42,32,116,49,32,43,32,67,46,121,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,117,112,100,97,116,101,95,100,105,115,116,97,110,99,101,40,97,98,115,40,121,49,41,44,32,121,49,32,62,32,48,46,48,44,32,100,115,116,41,59,10,32,32,32,32,125,10,10,32,32,105,102,32,40,117,115,101,95,116,50,41,10,32,32,32,32,123,10,32,32,32,32,32,32,121,50,32,61,32,40,65,46,121,32,42,32,116,50,32,45,32,66,46,121,32,42,32,50,46,48,41,32,42,32,116,50,32,43,32,67,46,121,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,117,112,100,97,116,101,95,100,105,115,116,97,110,99,101,40,97,98,115,40,121,50,41,44,32,121,50,32,60,32,48,46,48,44,32,100,115,116,41,59,10,32,32,32,32,125,10,10,32,32,47,42,32,87,101,32,97,114,101,32,106,117,115,116,32,99,111,109,112,117,116,105,110,103,32,97,32,100,105,115,116,97,110,99,101,45,108,105,107,101,32,118,97,108,117,101,32,116,111,32,112,101,114,102,111,114,109,32,97,110,116,105,45,97,108,105,97,115,105,110,103,59,10,32,32,32,42,32,97,115,32,115,117,99,104,32,119,101,32,99,97,110,32,115,107,105,112,32,99,111,109,112,117,116,105,110,103,32,116,104,101,32,111,116,104,101,114,32,99,114,105,116,105,99,97,108,32,112,111,105,110,116,115,32,102,111,114,32,116,104,101,32,76,49,45,100,105,115,116,97,110,99,101,10,32,32,32,42,32,102,117,110,99,116,105,111,110,32,102,40,116,41,32,61,32,124,120,40,116,41,32,45,32,120,124,32,43,32,124,121,40,116,41,32,45,32,121,124,32,119,104,105,99,104,32,97,114,101,32,116,104,101,32,101,110,100,32,112,111,105,110,116,115,32,97,110,100,32,116,104,101,10,32,32,32,42,32,112,111,105,110,116,115,32,112,40,116,41,32,61,32,40,120,40,116,41,44,32,121,40,116,41,41,32,119,104,101,114,101,32,124,120,39,40,116,41,124,32,61,32,124,121,39,40,116,41,124,46,32,84,104,101,32,112,111,105,110,116,115,32,99,111,114,114,101,115,112,111,110,100,10,32,32,32,42,32,116,111,10,32,32,32,42,10,32,32,32,42,32,32,32,32,116,49,32,61,32,40,65,46,120,32,45,32,65,46,121,41,32,47,32,40,66,46,120,32,45,32,66,46,121,41,10,32,32,32,42,32,32,32,32,116,50,32,61,32,40,65,46,120,32,43,32,65,46,121,41,32,47,32,40,66,46,120,32,43,32,66,46,121,41,10,32,32,32,42,10,32,32,32,42,32,73,102,32,119,101,32,97,114,101,32,116,111,32,99,104,101,99,107,32,116,104,101,32,101,110,100,45,112,111,105,110,116,115,44,32,119,101,32,119,111,117,108,100,32,110,101,101,100,32,116,111,32,111,110,108,121,32,99,104,101,99,107,32,116,32,61,32,48,46,10,32,32,32,42,32,84,104,105,115,32,105,115,32,98,101,99,97,117,115,101,32,105,102,32,116,32,61,32,49,32,105,115,32,119,105,116,104,105,110,32,116,104,101,32,99,101,108,108,44,32,116,104,101,110,32,116,104,101,32,99,117,114,118,101,32,116,104,97,116,32,115,116,97,114,116,115,10,32,32,32,42,32,97,116,32,116,32,61,32,49,32,119,111,117,108,100,32,97,108,115,111,32,98,101,32,119,105,116,104,105,110,32,116,104,101,32,99,101,108,108,46,32,67,104,101,99,107,105,110,103,32,116,104,101,32,101,110,100,32,112,111,105,110,116,32,116,32,61,32,48,10,32,32,32,42,32,105,115,32,116,104,101,32,99,111,100,101,58,10,32,32,32,42,10,32,32,32,42,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,117,112,100,97,116,101,95,100,105,115,116,97,110,99,101,40,99,117,114,118,101,46,112,49,44,32,45,66,44,32,100,115,116,41,59,10,32,32,32,42,10,32,32,32,42,32,116,104,105,115,32,105,115,32,98,101,99,97,117,115,101,32,116,104,101,32,99,117,114,118,101,32,105,115,32,112,40,116,41,32,61,32,65,116,94,50,32,45,50,66,116,32,43,32,67,44,32,116,104,117,115,32,105,116,115,10,32,32,32,42,32,100,101,114,105,118,97,116,105,118,101,32,105,115,32,112,39,40,116,41,32,61,32,45,50,65,116,32,45,32,50,66,32,119,104,105,99,104,32,97,116,32,112,39,40,48,41,32,61,32,45,50,66,46,32,87,101,32,111,110,108,121,32,110,101,101,100,10,32,32,32,42,32,116,104,101,32,100,105,114,101,99,116,105,111,110,32,111,102,32,116,104,101,32,100,101,114,105,118,97,116,105,118,101,32,105,110,32,116,104,101,32,50,110,100,32,97,114,103,117,109,101,110,116,44,32,115,111,32,45,66,32,105,115,10,32,32,32,42,32,115,117,102,102,105,99,105,101,110,116,32,97,110,100,32,116,104,101,32,99,117,114,118,101,32,97,116,32,48,32,105,115,32,99,117,114,118,101,46,112,49,46,10,32,32,32,42,10,32,32,32,42,32,84,79,68,79,58,32,100,101,99,105,100,101,32,105,102,32,100,111,105,110,103,32,116,104,101,32,112,114,111,112,101,114,32,76,49,45,100,105,115,116,97,110,99,101,32,105,115,32,110,101,99,101,115,115,97,114,121,46,10,32,32,32,42,47,10,32,32,114,101,116,117,114,110,32,82,59,10,125,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,108,111,97,100,95,99,117,114,118,101,40,105,110,32,117,105,110,116,32,114,97,119,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,117,114,118,101,95,116,121,112,101,32,99,117,114,118,101,41,10,123,10,32,32,117,105,110,116,32,99,117,114,118,101,95,115,114,99,59,10,10,32,32,99,117,114,118,101,95,115,114,99,32,61,32,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,32,43,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,117,114,118,101,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,117,114,118,101,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,97,119,41,59,10,32,32,99,117,114,118,101,46,105,115,95,113,117,97,100,114,97,116,105,99,32,61,32,40,114,97,119,32,38,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,117,114,118,101,95,105,115,95,113,117,97,100,114,97,116,105,99,95,109,97,115,107,41,32,33,61,32,48,117,59,10,10,32,32,99,117,114,118,101,46,112,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,117,110,112,97,99,107,95,112,111,105,110,116,40,99,117,114,118,101,95,115,114,99,41,59,10,32,32,99,117,114,118,101,46,112,50,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,117,110,112,97,99,107,95,112,111,105,110,116,40,99,117,114,118,101,95,115,114,99,32,43,32,49,117,41,59,10,10,32,32,105,102,32,40,99,117,114,118,101,46,105,115,95,113,117,97,100,114,97,116,105,99,41,10,32,32,32,32,123,10,32,32,32,32,32,32,99,117,114,118,101,46,112,51,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,117,110,112,97,99,107,95,112,111,105,110,116,40,99,117,114,118,101,95,115,114,99,32,43,32,50,117,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,99,117,114,118,101,46,112,51,32,61,32,99,117,114,118,101,46,112,50,59,10,32,32,32,32,32,32,99,117,114,118,101,46,112,50,32,61,32,48,46,53,32,42,32,40,99,117,114,118,101,46,112,49,32,43,32,99,117,114,118,101,46,112,51,41,59,10,32,32,32,32,125,10,125,10,10,105,110,116,10,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,108,111,97,100,95,97,110,100,95,112,114,111,99,101,115,115,95,99,117,114,118,101,40,105,110,32,117,105,110,116,32,114,97,119,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,32,116,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,100,105,115,116,97,110,99,101,95,116,121,112,101,32,110,118,41,10,123,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,117,114,118,101,95,116,121,112,101,32,99,117,114,118,101,95,100,97,116,97,59,10,32,32,105,110,116,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,108,111,97,100,95,99,117,114,118,101,40,114,97,119,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,99,117,114,118,101,95,100,97,116,97,41,59,10,10,10,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,10,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,111,109,112,117,116,101,95,119,105,110,100,105,110,103,95,99,111,110,116,114,105,98,117,116,105,111,110,40,99,117,114,118,101,95,100,97,116,97,44,32,116,114,44,32,110,118,41,59,10,32,32,114,101,116,117,114,110,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,125,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,108,111,97,100,95,119,105,110,100,105,110,103,95,114,101,102,101,114,101,110,99,101,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,98,111,120,95,116,121,112,101,32,98,111,120,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,119,105,110,100,105,110,103,95,115,97,109,112,108,101,95,116,121,112,101,32,115,41,10,123,10,32,32,117,105,110,116,32,116,101,120,101,108,44,32,98,105,97,115,101,100,95,119,105,110,100,105,110,103,59,10,32,32,117,118,101,99,50,32,117,105,110,116,95,100,101,108,116,97,59,10,32,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,32,100,101,108,116,97,59,10,10,32,32,112,111,115,105,116,105,111,110,32,61,32,98,111,120,46,109,105,110,95,112,111,105,110,116,59,10,32,32,116,101,120,101,108,32,61,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,108,111,99,97,116,105,111,110,41,59,10,10,32,32,98,105,97,115,101,100,95,119,105,110,100,105,110,103,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,119,105,110,100,105,110,103,95,118,97,108,117,101,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,119,105,110,100,105,110,103,95,118,97,108,117,101,95,110,117,109,95,98,105,116,115,44,32,116,101,120,101,108,41,59,10,32,32,117,105,110,116,95,100,101,108,116,97,46,120,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,112,111,115,105,116,105,111,110,95,100,101,108,116,97,95,120,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,112,111,115,105,116,105,111,110,95,100,101,108,116,97,95,110,117,109,95,98,105,116,115,44,32,116,101,120,101,108,41,59,10,32,32,117,105,110,116,95,100,101,108,116,97,46,121,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,112,111,115,105,116,105,111,110,95,100,101,108,116,97,95,121,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,112,111,115,105,116,105,111,110,95,100,101,108,116,97,95,110,117,109,95,98,105,116,115,44,32,116,101,120,101,108,41,59,10,10,32,32,100,101,108,116,97,32,61,32,118,101,99,50,40,117,105,110,116,95,100,101,108,116,97,41,32,42,32,98,111,120,46,115,105,122,101,59,10,32,32,100,101,108,116,97,32,47,61,32,102,108,111,97,116,40,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,112,111,115,105,116,105,111,110,95,100,101,108,116,97,95,100,105,118,105,100,101,41,59,10,32,32,112,111,115,105,116,105,111,110,32,43,61,32,100,101,108,116,97,59,10,10,32,32,115,46,114,101,102,101,114,101,110,99,101,95,112,111,115,105,116,105,111,110,32,61,32,112,111,115,105,116,105,111,110,59,10,32,32,115,46,114,101,102,101,114,101,110,99,101,95,119,105,110,100,105,110,103,32,61,32,105,110,116,40,98,105,97,115,101,100,95,119,105,110,100,105,110,103,41,32,45,32,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,119,105,110,100,105,110,103,95,118,97,108,117,101,95,98,105,97,115,41,59,10,125,10,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,111,109,112,117,116,101,95,99,111,118,101,114,97,103,101,40,105,110,32,117,105,110,116,32,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,103,108,121,112,104,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,103,108,121,112,104,95,99,111,111,114,100,95,100,120,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,103,108,121,112,104,95,99,111,111,114,100,95,100,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,98,111,111,108,32,117,115,101,95,111,100,100,95,101,118,101,110,95,114,117,108,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,68,69,66,85,71,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,44,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,98,111,120,95,116,121,112,101,32,111,117,116,95,116,101,120,101,108,95,98,111,120,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,119,105,110,100,105,110,103,95,115,97,109,112,108,101,95,116,121,112,101,32,111,117,116,95,83,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,105,110,116,32,111,117,116,95,119,105,110,100,105,110,103,95,110,117,109,98,101,114,44,32,111,117,116,32,117,105,110,116,32,111,117,116,95,110,117,109,95,99,117,114,118,101,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,100,105,115,116,97,110,99,101,95,116,121,112,101,32,111,117,116,95,110,118,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,35,101,110,100,105,102,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,41,10,123,10,32,32,117,105,110,116,32,115,114,99,44,32,99,44,32,99,117,114,118,101,95,108,105,115,116,44,32,119,105,110,100,105,110,103,95,115,97,109,112,108,101,95,100,97,116,97,95,108,111,99,97,116,105,111,110,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,32,116,114,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,98,111,120,95,116,121,112,101,32,116,101,120,101,108,95,98,111,120,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,119,105,110,100,105,110,103,95,115,97,109,112,108,101,95,116,121,112,101,32,83,59,10,32,32,105,110,116,32,119,105,110,100,105,110,103,95,110,117,109,98,101,114,59,10,32,32,117,105,110,116,32,110,117,109,95,99,117,114,118,101,115,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,100,105,115,116,97,110,99,101,95,116,121,112,101,32,110,118,59,10,10,32,32,119,105,110,100,105,110,103,95,115,97,109,112,108,101,95,100,97,116,97,95,108,111,99,97,116,105,111,110,32,61,10,32,32,32,32,102,97,115,116,117,105,100,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,111,109,112,117,116,101,95,98,111,120,40,103,108,121,112,104,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,101,120,101,108,95,98,111,120,44,32,99,117,114,118,101,95,108,105,115,116,44,32,110,117,109,95,99,117,114,118,101,115,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,105,110,105,116,95,100,105,115,116,97,110,99,101,40,110,118,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,108,111,97,100,95,119,105,110,100,105,110,103,95,114,101,102,101,114,101,110,99,101,40,119,105,110,100,105,110,103,95,115,97,109,112,108,101,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,101,120,101,108,95,98,111,120,44,32,83,41,59,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,111,109,112,117,116,101,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,40,103,108,121,112,104,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,103,108,121,112,104,95,99,111,111,114,100,95,100,120,44,32,103,108,121,112,104,95,99,111,111,114,100,95,100,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,83,46,114,101,102,101,114,101,110,99,101,95,112,111,115,105,116,105,111,110,44,32,116,114,41,59,10,32,32,119,105,110,100,105,110,103,95,110,117,109,98,101,114,32,61,32,83,46,114,101,102,101,114,101,110,99,101,95,119,105,110,100,105,110,103,59,10,10,32,32,115,114,99,32,61,32,99,117,114,118,101,95,108,105,115,116,32,43,32,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,59,10,32,32,102,111,114,32,40,99,32,61,32,48,117,59,32,99,32,60,32,110,117,109,95,99,117,114,118,101,115,59,32,99,32,43,61,32,50,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,117,105,110,116,32,99,65,44,32,99,66,44,32,99,117,114,118,101,95,112,97,105,114,59,10,10,32,32,32,32,32,32,99,117,114,118,101,95,112,97,105,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,115,114,99,41,59,10,32,32,32,32,32,32,43,43,115,114,99,59,10,10,32,32,32,32,32,32,99,65,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,117,114,118,101,95,101,110,116,114,121,48,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,117,114,118,101,95,101,110,116,114,121,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,99,117,114,118,101,95,112,97,105,114,41,59,10,32,32,32,32,32,32,119,105,110,100,105,110,103,95,110,117,109,98,101,114,32,43,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,108,111,97,100,95,97,110,100,95,112,114,111,99,101,115,115,95,99,117,114,118,101,40,99,65,44,32,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,32,116,114,44,32,110,118,41,59,10,10,32,32,32,32,32,32,105,102,32,40,99,32,43,32,49,117,32,60,32,110,117,109,95,99,117,114,118,101,115,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,99,66,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,117,114,118,101,95,101,110,116,114,121,49,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,117,114,118,101,95,101,110,116,114,121,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,99,117,114,118,101,95,112,97,105,114,41,59,10,32,32,32,32,32,32,32,32,32,32,119,105,110,100,105,110,103,95,110,117,109,98,101,114,32,43,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,108,111,97,100,95,97,110,100,95,112,114,111,99,101,115,115,95,99,117,114,118,101,40,99,66,44,32,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,32,116,114,44,32,110,118,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,10,32,32,102,108,111,97,116,32,99,118,103,44,32,100,105,115,116,97,110,99,101,59,10,10,32,32,47,42,32,73,102,32,117,115,105,110,103,32,116,104,101,32,111,100,100,45,101,118,101,110,32,102,105,108,108,32,114,117,108,101,32,111,102,32,105,102,32,116,104,101,32,119,105,110,100,105,110,103,32,110,117,109,98,101,114,32,97,116,10,32,32,32,42,32,116,104,101,32,102,114,97,103,109,101,110,116,32,105,115,32,48,44,32,117,115,101,32,116,104,101,32,109,105,110,105,109,117,109,32,111,102,32,116,104,111,115,101,32,116,119,111,59,32,105,102,32,116,104,101,10,32,32,32,42,32,119,105,110,100,105,110,103,32,118,97,108,117,101,32,105,115,32,49,32,117,115,101,32,116,104,101,32,100,101,99,114,101,109,101,110,116,32,118,97,108,117,101,32,97,110,100,32,105,102,32,116,104,101,32,119,105,110,100,105,110,103,10,32,32,32,42,32,105,115,32,45,49,32,117,115,101,32,116,104,101,32,105,110,99,114,101,109,101,110,116,32,119,105,110,100,105,110,103,32,110,117,109,98,101,114,59,32,105,102,32,116,104,101,32,97,98,115,111,108,117,116,101,32,118,97,108,117,101,10,32,32,32,42,32,111,102,32,116,104,101,32,119,105,110,100,105,110,103,32,118,97,108,117,101,32,105,115,32,103,114,101,97,116,101,114,32,116,104,97,110,32,116,119,111,44,32,119,101,32,119,105,108,108,32,102,97,108,108,98,97,99,107,10,32,32,32,42,32,97,110,100,32,115,105,109,112,108,121,32,118,105,101,119,32,116,104,101,32,102,114,97,103,109,101,110,116,32,97,115,32,102,117,108,108,121,32,99,111,118,101,114,101,100,46,10,32,32,32,42,47,10,32,32,105,102,32,40,119,105,110,100,105,110,103,95,110,117,109,98,101,114,32,61,61,32,48,32,124,124,32,117,115,101,95,111,100,100,95,101,118,101,110,95,114,117,108,101,41,10,32,32,32,32,123,10,32,32,32,32,32,32,100,105,115,116,97,110,99,101,32,61,32,109,105,110,40,110,118,46,100,105,115,116,97,110,99,101,95,105,110,99,114,101,109,101,110,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,110,118,46,100,105,115,116,97,110,99,101,95,100,101,99,114,101,109,101,110,116,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,119,105,110,100,105,110,103,95,110,117,109,98,101,114,32,61,61,32,45,49,41,10,32,32,32,32,123,10,32,32,32,32,32,32,100,105,115,116,97,110,99,101,32,61,32,110,118,46,100,105,115,116,97,110,99,101,95,105,110,99,114,101,109,101,110,116,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,119,105,110,100,105,110,103,95,110,117,109,98,101,114,32,61,61,32,49,41,10,32,32,32,32,123,10,32,32,32,32,32,32,100,105,115,116,97,110,99,101,32,61,32,110,118,46,100,105,115,116,97,110,99,101,95,100,101,99,114,101,109,101,110,116,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,100,105,115,116,97,110,99,101,32,61,32,48,46,53,59,10,32,32,32,32,125,10,10,32,32,100,105,115,116,97,110,99,101,32,61,32,109,105,110,40,100,105,115,116,97,110,99,101,44,32,48,46,53,41,59,10,32,32,119,105,110,100,105,110,103,95,110,117,109,98,101,114,32,61,32,40,117,115,101,95,111,100,100,95,101,118,101,110,95,114,117,108,101,32,38,38,32,40,119,105,110,100,105,110,103,95,110,117,109,98,101,114,32,38,32,49,41,32,61,61,32,48,41,32,63,32,48,32,58,32,119,105,110,100,105,110,103,95,110,117,109,98,101,114,59,10,32,32,99,118,103,32,61,32,40,119,105,110,100,105,110,103,95,110,117,109,98,101,114,32,33,61,32,48,41,32,63,10,32,32,32,32,40,48,46,53,32,43,32,100,105,115,116,97,110,99,101,41,32,58,10,32,32,32,32,40,48,46,53,32,45,32,100,105,115,116,97,110,99,101,41,59,10,10,32,32,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,68,69,66,85,71,10,32,32,32,32,123,10,32,32,32,32,32,32,111,117,116,95,116,101,120,101,108,95,98,111,120,32,61,32,116,101,120,101,108,95,98,111,120,59,10,32,32,32,32,32,32,111,117,116,95,83,32,61,32,83,59,10,32,32,32,32,32,32,111,117,116,95,119,105,110,100,105,110,103,95,110,117,109,98,101,114,32,61,32,119,105,110,100,105,110,103,95,110,117,109,98,101,114,59,10,32,32,32,32,32,32,111,117,116,95,110,117,109,95,99,117,114,118,101,115,32,61,32,110,117,109,95,99,117,114,118,101,115,59,10,32,32,32,32,32,32,111,117,116,95,110,118,32,61,32,110,118,59,10,32,32,32,32,125,10,32,32,35,101,110,100,105,102,10,10,32,32,114,101,116,117,114,110,32,99,118,103,59,10,125,10,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,68,69,66,85,71,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,111,109,112,117,116,101,95,99,111,118,101,114,97,103,101,40,105,110,32,117,105,110,116,32,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,103,108,121,112,104,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,103,108,121,112,104,95,99,111,111,114,100,95,100,120,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,103,108,121,112,104,95,99,111,111,114,100,95,100,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,98,111,111,108,32,117,115,101,95,111,100,100,95,101,118,101,110,95,114,117,108,101,41,10,123,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,98,111,120,95,116,121,112,101,32,116,101,120,101,108,95,98,111,120,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,119,105,110,100,105,110,103,95,115,97,109,112,108,101,95,116,121,112,101,32,83,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,100,105,115,116,97,110,99,101,95,116,121,112,101,32,110,118,59,10,32,32,105,110,116,32,119,105,110,100,105,110,103,95,110,117,109,98,101,114,59,10,32,32,117,105,110,116,32,110,117,109,95,99,117,114,118,101,115,59,10,10,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,111,109,112,117,116,101,95,99,111,118,101,114,97,103,101,40,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,103,108,121,112,104,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,103,108,121,112,104,95,99,111,111,114,100,95,100,120,44,32,103,108,121,112,104,95,99,111,111,114,100,95,100,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,117,115,101,95,111,100,100,95,101,118,101,110,95,114,117,108,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,101,120,101,108,95,98,111,120,44,32,83,44,32,119,105,110,100,105,110,103,95,110,117,109,98,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,110,117,109,95,99,117,114,118,101,115,44,32,110,118,41,59,10,125,10,35,101,110,100,105,102,10,47,47,47,64,101,110,100,99,111,110,100,10,10,47,42,33,10,32,42,32,67,111,109,112,117,116,101,32,116,104,101,32,99,111,118,101,114,97,103,101,32,111,102,32,97,32,102,114,97,103,109,101,110,116,32,119,105,116,104,105,110,32,97,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,71,108,121,112,104,82,101,110,100,101,114,68,97,116,97,82,101,115,116,114,105,99,116,101,100,82,97,121,115,32,103,108,121,112,104,46,10,32,42,32,92,112,97,114,97,109,32,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,32,108,111,99,97,116,105,111,110,32,111,102,32,116,104,101,32,103,108,121,112,104,32,100,97,116,97,32,40,115,101,101,32,92,114,101,102,10,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,58,58,71,108,121,112,104,82,101,110,100,101,114,68,97,116,97,82,101,115,116,114,105,99,116,101,100,82,97,121,115,58,58,103,108,121,112,104,95,111,102,102,115,101,116,41,10,32,42,32,92,112,97,114,97,109,32,103,108,121,112,104,95,99,111,111,114,100,32,116,104,101,32,99,111,111,114,100,105,110,97,116,101,32,111,102,32,116,104,101,32,102,114,97,103,109,101,110,116,32,105,110,32,103,108,121,112,104,32,99,111,111,114,100,105,110,97,116,101,115,10,32,42,32,92,112,97,114,97,109,32,103,108,121,112,104,95,99,111,111,114,100,95,100,120,32,116,104,101,32,118,97,108,117,101,32,111,102,32,100,70,100,120,40,103,108,121,112,104,95,99,111,111,114,100,41,10,32,42,32,92,112,97,114,97,109,32,103,108,121,112,104,95,99,111,111,114,100,95,100,121,32,116,104,101,32,118,97,108,117,101,32,111,102,32,100,70,100,121,40,103,108,121,112,104,95,99,111,111,114,100,41,10,32,42,32,92,112,97,114,97,109,32,117,115,101,95,111,100,100,95,101,118,101,110,95,114,117,108,101,32,105,102,32,116,114,117,101,44,32,117,115,101,32,116,104,101,32,111,100,100,45,101,118,101,110,32,102,105,108,108,32,114,117,108,101,44,32,111,116,104,101,114,119,105,115,101,32,117,115,101,32,116,104,101,32,110,111,110,45,122,101,114,111,32,102,105,108,108,32,114,117,108,101,46,10,32,42,47,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,99,111,109,112,117,116,101,95,99,111,118,101,114,97,103,101,40,105,110,32,117,105,110,116,32,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,103,108,121,112,104,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,103,108,121,112,104,95,99,111,111,114,100,95,100,120,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,103,108,121,112,104,95,99,111,111,114,100,95,100,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,98,111,111,108,32,117,115,101,95,111,100,100,95,101,118,101,110,95,114,117,108,101,41,59,10,47,42,33,32,64,125,32,42,47,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_restricted_rays.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,117,110,112,97,99,107,95,102,112,49,54,40,117,105,110,116,32,117,41,10,123,10,32,32,117,105,110,116,32,115,105,103,110,32,61,32,40,117,32,38,32,48,120,56,48,48,48,117,41,32,60,60,32,49,54,117,59,10,32,32,117,105,110,116,32,101,120,112,111,110,101,110,116,32,61,32,40,117,32,38,32,48,120,55,67,48,48,117,41,32,62,62,32,49,48,117,59,10,32,32,117,105,110,116,32,109,97,110,116,105,115,115,97,32,61,32,117,32,38,32,48,120,48,51,70,70,117,59,10,10,32,32,105,102,32,40,101,120,112,111,110,101,110,116,32,61,61,32,51,49,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,115,105,103,110,32,124,32,48,120,55,70,56,48,48,48,48,48,117,32,124,32,109,97,110,116,105,115,115,97,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,101,120,112,111,110,101,110,116,32,61,61,32,48,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,47,42,32,100,101,110,111,114,109,97,108,105,122,101,100,45,110,117,109,98,101,114,44,32,116,104,117,115,32,116,104,101,32,110,117,109,98,101,114,32,115,116,111,114,101,100,32,116,104,101,32,118,97,108,117,101,10,32,32,32,32,32,32,32,42,32,105,110,32,116,104,101,32,109,97,110,116,105,115,115,97,32,47,32,50,94,50,52,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,102,108,111,97,116,32,118,59,10,10,32,32,32,32,32,32,118,32,61,32,102,108,111,97,116,40,109,97,110,116,105,115,115,97,41,32,42,32,53,46,57,54,48,52,54,52,52,56,101,45,56,59,10,32,32,32,32,32,32,114,101,116,117,114,110,32,40,115,105,103,110,32,61,61,32,48,117,41,32,63,32,118,32,58,32,45,118,59,10,32,32,32,32,125,10,10,32,32,47,47,32,114,101,108,121,32,111,110,32,98,105,116,45,109,97,103,105,99,32,116,111,32,103,101,116,32,116,111,32,102,112,51,50,10,10,32,32,47,47,98,105,97,115,32,101,120,112,111,110,101,110,116,32,102,114,111,109,32,102,112,49,54,32,116,111,32,102,112,51,50,10,32,32,101,120,112,111,110,101,110,116,32,43,61,32,40,49,50,55,117,32,45,32,49,53,117,41,59,10,10,32,32,47,47,32,115,104,105,102,116,32,101,120,112,111,110,101,110,116,32,116,111,32,102,112,51,50,10,32,32,101,120,112,111,110,101,110,116,32,61,32,101,120,112,111,110,101,110,116,32,60,60,32,50,51,117,59,10,10,32,32,47,47,115,104,105,102,116,32,109,97,116,105,115,115,97,32,102,114,111,109,32,102,112,49,54,39,115,32,49,48,45,98,105,116,115,32,116,111,32,102,112,51,50,39,115,32,50,51,45,98,105,116,115,10,32,32,109,97,110,116,105,115,115,97,32,61,32,109,97,110,116,105,115,115,97,32,60,60,32,49,51,117,59,10,10,32,32,114,101,116,117,114,110,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,115,105,103,110,32,124,32,101,120,112,111,110,101,110,116,32,124,32,109,97,110,116,105,115,115,97,41,59,32,32,10,125,10,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,71,76,95,72,65,83,95,85,78,80,65,67,75,70,80,49,54,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,117,110,112,97,99,107,72,97,108,102,50,120,49,54,40,117,41,32,117,110,112,97,99,107,72,97,108,102,50,120,49,54,40,117,41,10,35,101,108,115,101,10,32,32,118,101,99,50,10,32,32,102,97,115,116,117,105,100,114,97,119,95,117,110,112,97,99,107,72,97,108,102,50,120,49,54,40,117,105,110,116,32,117,41,10,32,32,123,10,32,32,32,32,117,105,110,116,32,121,32,61,32,40,117,32,62,62,32,49,54,117,41,59,10,32,32,32,32,117,105,110,116,32,120,32,61,32,40,117,32,38,32,48,120,70,70,70,70,117,41,59,10,32,32,32,32,114,101,116,117,114,110,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,117,110,112,97,99,107,95,102,112,49,54,40,120,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,117,110,112,97,99,107,95,102,112,49,54,40,121,41,41,59,10,32,32,125,10,35,101,110,100,105,102,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_unpackHalf2x16.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
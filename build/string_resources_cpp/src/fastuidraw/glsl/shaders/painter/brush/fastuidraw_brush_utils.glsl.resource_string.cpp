@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,117,116,105,108,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,117,116,105,108,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,115,116,114,117,99,116,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,104,101,97,100,101,114,41,10,123,10,32,32,117,105,110,116,32,102,101,97,116,117,114,101,115,59,10,32,32,117,105,110,116,32,114,101,100,95,103,114,101,101,110,59,10,32,32,117,105,110,116,32,98,108,117,101,95,97,108,112,104,97,59,10,125,59,10,10,115,116,114,117,99,116,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,41,10,123,10,32,32,118,101,99,50,32,120,121,59,32,47,47,120,45,121,32,112,111,115,105,116,105,111,110,32,111,102,32,119,105,110,100,111,119,10,32,32,118,101,99,50,32,119,104,59,32,47,47,119,105,100,116,104,32,97,110,100,32,104,101,105,103,104,116,32,111,102,32,119,105,110,100,111,119,10,125,59,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,104,101,97,100,101,114,41,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,104,101,97,100,101,114,41,32,99,111,108,111,114,41,59,10,10,117,105,110,116,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,104,101,97,100,101,114,95,115,105,122,101,41,40,118,111,105,100,41,59,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,95,109,97,116,114,105,120,41,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,32,111,117,116,32,109,97,116,50,32,109,41,59,10,10,117,105,110,116,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,95,109,97,116,114,105,120,95,115,105,122,101,41,40,118,111,105,100,41,59,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,95,116,114,97,110,115,108,97,116,105,111,110,41,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,32,111,117,116,32,118,101,99,50,32,112,41,59,10,10,117,105,110,116,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,95,116,114,97,110,115,108,97,116,105,111,110,95,115,105,122,101,41,40,118,111,105,100,41,59,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,41,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,41,32,119,41,59,10,10,117,105,110,116,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,115,105,122,101,41,40,118,111,105,100,41,59,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_brush_utils.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
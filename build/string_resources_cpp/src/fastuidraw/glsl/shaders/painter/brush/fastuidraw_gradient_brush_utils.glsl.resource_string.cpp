@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,103,114,97,100,105,101,110,116,95,98,114,117,115,104,95,117,116,105,108,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,103,114,97,100,105,110,101,116,95,98,114,117,115,104,95,117,116,105,108,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,115,116,114,117,99,116,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,41,10,123,10,32,32,47,42,32,108,111,99,97,116,105,111,110,32,111,110,32,97,116,108,97,115,32,105,110,32,116,101,120,101,108,115,10,32,32,32,42,47,10,32,32,118,101,99,50,32,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,59,10,10,32,32,47,42,32,106,117,115,116,32,116,104,101,32,108,101,110,103,116,104,32,42,47,10,32,32,102,108,111,97,116,32,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,108,101,110,103,116,104,59,10,10,32,32,47,42,32,115,116,97,114,116,32,97,110,100,32,101,110,100,32,111,102,32,103,114,97,100,105,101,110,116,115,32,112,97,99,107,101,100,32,97,115,32,117,115,117,97,108,32,102,108,111,97,116,115,32,42,47,10,32,32,118,101,99,50,32,112,48,44,32,112,49,59,10,10,32,32,47,42,32,114,97,100,105,97,108,32,103,114,97,100,105,101,110,116,32,118,97,108,117,101,115,32,42,47,10,32,32,102,108,111,97,116,32,114,48,44,32,114,49,59,10,125,59,10,10,115,116,114,117,99,116,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,97,119,41,10,123,10,32,32,47,42,32,115,116,97,114,116,32,97,110,100,32,101,110,100,32,111,102,32,103,114,97,100,105,101,110,116,115,32,112,97,99,107,101,100,32,97,115,32,117,115,117,97,108,32,102,108,111,97,116,115,10,32,32,32,42,47,10,32,32,118,101,99,50,32,112,48,44,32,112,49,59,10,10,32,32,47,42,32,112,97,99,107,101,100,58,10,32,32,32,32,32,45,32,98,105,116,115,32,91,48,32,44,32,49,53,93,32,67,111,108,111,114,83,116,111,112,83,101,113,117,101,110,99,101,58,58,116,101,120,101,108,95,108,111,99,97,116,105,111,110,40,41,46,120,40,41,10,32,32,32,32,32,45,32,98,105,116,115,32,91,49,54,44,32,51,49,93,32,67,111,108,111,114,83,116,111,112,83,101,113,117,101,110,99,101,58,58,116,101,120,101,108,95,108,111,99,97,116,105,111,110,40,41,46,121,10,32,32,32,42,47,10,32,32,117,105,110,116,32,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,59,10,10,32,32,47,42,32,106,117,115,116,32,116,104,101,32,108,101,110,103,116,104,10,32,32,32,42,47,10,32,32,117,105,110,116,32,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,108,101,110,103,116,104,59,10,10,32,32,47,42,32,114,97,100,105,97,108,32,103,114,97,100,105,101,110,116,32,118,97,108,117,101,115,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,114,48,44,32,114,49,59,10,125,59,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,108,105,110,101,97,114,95,111,114,95,115,119,101,101,112,95,103,114,97,100,105,101,110,116,95,100,97,116,97,41,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,97,119,41,32,114,97,119,41,59,10,10,117,105,110,116,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,108,105,110,101,97,114,95,111,114,95,115,119,101,101,112,95,103,114,97,100,105,101,110,116,95,100,97,116,97,95,115,105,122,101,41,40,118,111,105,100,41,59,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,95,100,97,116,97,41,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,97,119,41,32,114,97,119,41,59,10,10,117,105,110,116,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,95,100,97,116,97,95,115,105,122,101,41,40,118,111,105,100,41,59,10,10,117,105,110,116,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,108,105,110,101,97,114,95,111,114,95,115,119,101,101,112,95,103,114,97,100,105,101,110,116,95,100,97,116,97,41,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,41,32,103,114,97,100,41,59,10,10,117,105,110,116,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,95,100,97,116,97,41,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,41,32,103,114,97,100,41,59,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,112,114,111,99,101,115,115,95,103,114,97,100,105,101,110,116,95,100,97,116,97,41,40,105,110,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,97,119,41,32,114,97,119,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,41,32,99,111,111,107,101,100,41,10,123,10,32,32,99,111,111,107,101,100,46,112,48,32,61,32,114,97,119,46,112,48,59,10,32,32,99,111,111,107,101,100,46,112,49,32,61,32,114,97,119,46,112,49,59,10,10,32,32,99,111,111,107,101,100,46,114,48,32,61,32,114,97,119,46,114,48,59,10,32,32,99,111,111,107,101,100,46,114,49,32,61,32,114,97,119,46,114,49,59,10,10,32,32,99,111,111,107,101,100,46,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,108,101,110,103,116,104,32,61,32,102,108,111,97,116,40,114,97,119,46,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,108,101,110,103,116,104,41,59,10,10,32,32,117,118,101,99,50,32,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,59,10,32,32,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,46,120,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,108,111,114,115,116,111,112,95,120,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,108,111,114,115,116,111,112,95,120,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,97,119,46,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,41,59,10,10,32,32,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,46,121,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,108,111,114,115,116,111,112,95,121,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,108,111,114,115,116,111,112,95,121,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,97,119,46,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,41,59,10,10,32,32,99,111,111,107,101,100,46,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,32,61,32,118,101,99,50,40,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,41,59,10,125,10,10,117,105,110,116,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,108,105,110,101,97,114,95,111,114,95,115,119,101,101,112,95,103,114,97,100,105,101,110,116,95,100,97,116,97,41,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,41,32,103,114,97,100,41,10,123,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,97,119,41,32,114,97,119,59,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,108,105,110,101,97,114,95,111,114,95,115,119,101,101,112,95,103,114,97,100,105,101,110,116,95,100,97,116,97,41,40,108,111,99,97,116,105,111,110,44,32,114,97,119,41,59,10,32,32,114,97,119,46,114,48,32,61,32,48,46,48,59,10,32,32,114,97,119,46,114,49,32,61,32,49,46,48,59,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,112,114,111,99,101,115,115,95,103,114,97,100,105,101,110,116,95,100,97,116,97,41,40,114,97,119,44,32,103,114,97,100,41,59,10,32,32,114,101,116,117,114,110,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,108,105,110,101,97,114,95,111,114,95,115,119,101,101,112,95,103,114,97,100,105,101,110,116,95,100,97,116,97,95,115,105,122,101,41,40,41,59,10,125,10,10,117,105,110,116,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,95,100,97,116,97,41,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,41,32,103,114,97,100,41,10,123,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,97,119,41,32,114,97,119,59,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,95,100,97,116,97,41,40,108,111,99,97,116,105,111,110,44,32,114,97,119,41,59,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,112,114,111,99,101,115,115,95,103,114,97,100,105,101,110,116,95,100,97,116,97,41,40,114,97,119,44,32,103,114,97,100,41,59,10,32,32,114,101,116,117,114,110,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,95,100,97,116,97,95,115,105,122,101,41,40,41,59,10,125,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_gradient_brush_utils.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
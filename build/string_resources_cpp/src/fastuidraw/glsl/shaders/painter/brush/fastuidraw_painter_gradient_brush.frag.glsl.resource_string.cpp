@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,103,114,97,100,105,101,110,116,95,98,114,117,115,104,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,103,114,97,100,105,101,110,116,95,98,114,117,115,104,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,102,108,111,97,116,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,98,114,117,115,104,95,99,111,109,112,117,116,101,95,105,110,116,101,114,112,111,108,97,116,101,41,40,105,110,32,118,101,99,50,32,112,44,32,105,110,32,117,105,110,116,32,103,114,97,100,105,101,110,116,95,116,121,112,101,44,32,111,117,116,32,102,108,111,97,116,32,103,111,111,100,41,10,123,10,32,32,102,108,111,97,116,32,116,59,10,10,32,32,116,32,61,32,49,46,48,59,10,32,32,105,102,32,40,103,114,97,100,105,101,110,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,108,105,110,101,97,114,95,103,114,97,100,105,101,110,116,95,116,121,112,101,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,108,105,110,101,97,114,95,103,114,97,100,105,101,110,116,32,103,59,10,10,32,32,32,32,32,32,103,46,112,48,32,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,48,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,48,95,121,41,59,10,32,32,32,32,32,32,103,46,112,49,32,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,49,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,49,95,121,41,59,10,10,32,32,32,32,32,32,103,111,111,100,32,61,32,49,46,48,59,10,32,32,32,32,32,32,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,110,116,101,114,112,111,108,97,116,101,40,112,44,32,103,41,59,10,32,32,32,32,125,10,32,32,35,105,102,100,101,102,32,83,85,80,80,79,82,84,83,95,82,65,68,73,65,76,95,86,65,82,89,73,78,71,83,10,32,32,101,108,115,101,32,105,102,32,40,103,114,97,100,105,101,110,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,95,116,121,112,101,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,32,103,59,10,10,32,32,32,32,32,32,103,46,112,48,32,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,48,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,48,95,121,41,59,10,32,32,32,32,32,32,103,46,112,49,32,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,49,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,49,95,121,41,59,10,32,32,32,32,32,32,103,46,114,48,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,48,59,10,32,32,32,32,32,32,103,46,114,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,49,59,10,10,32,32,32,32,32,32,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,110,116,101,114,112,111,108,97,116,101,40,112,44,32,103,44,32,103,111,111,100,41,59,10,32,32,32,32,125,10,32,32,35,101,110,100,105,102,10,32,32,101,108,115,101,32,105,102,32,40,103,114,97,100,105,101,110,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,119,101,101,112,95,103,114,97,100,105,101,110,116,95,116,121,112,101,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,119,101,101,112,95,103,114,97,100,105,101,110,116,32,103,59,10,10,32,32,32,32,32,32,103,46,112,32,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,115,119,101,101,112,95,112,111,105,110,116,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,115,119,101,101,112,95,112,111,105,110,116,95,121,41,59,10,32,32,32,32,32,32,103,46,115,119,101,101,112,95,97,110,103,108,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,115,119,101,101,112,95,97,110,103,108,101,59,10,32,32,32,32,32,32,103,46,115,105,103,110,101,100,95,102,97,99,116,111,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,115,119,101,101,112,95,115,105,103,110,95,102,97,99,116,111,114,59,10,10,32,32,32,32,32,32,103,111,111,100,32,61,32,49,46,48,59,10,32,32,32,32,32,32,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,110,116,101,114,112,111,108,97,116,101,40,112,44,32,103,41,59,10,32,32,32,32,125,10,10,32,32,114,101,116,117,114,110,32,116,59,10,125,10,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,103,108,95,102,114,97,103,95,98,114,117,115,104,95,109,97,105,110,40,105,110,32,117,105,110,116,32,115,117,98,95,115,104,97,100,101,114,44,32,105,110,111,117,116,32,117,105,110,116,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,41,10,123,10,32,32,118,101,99,52,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,32,32,118,101,99,50,32,112,59,10,32,32,117,105,110,116,32,103,114,97,100,105,101,110,116,95,116,121,112,101,59,10,10,32,32,112,32,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,95,121,41,59,10,10,32,32,47,42,32,72,111,112,101,102,117,108,108,121,44,32,97,32,99,111,109,112,105,108,101,114,32,119,105,108,108,32,111,112,116,105,109,105,122,101,32,111,117,116,32,116,104,101,32,105,102,115,32,98,101,108,111,119,10,32,32,32,42,32,115,105,110,99,101,32,116,104,101,32,118,97,108,117,101,32,111,102,32,103,114,97,100,105,101,110,116,95,116,121,112,101,32,105,115,32,115,116,97,116,105,99,97,108,108,121,32,97,115,115,105,103,110,101,100,10,32,32,32,42,47,10,32,32,35,105,102,110,100,101,102,32,70,73,88,69,68,95,71,82,65,68,73,69,78,84,95,84,89,80,69,10,32,32,32,32,123,10,32,32,32,32,32,32,103,114,97,100,105,101,110,116,95,116,121,112,101,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,116,121,112,101,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,116,121,112,101,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,98,95,115,104,97,100,101,114,41,59,10,32,32,32,32,125,10,32,32,35,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,103,114,97,100,105,101,110,116,95,116,121,112,101,32,61,32,70,73,88,69,68,95,71,82,65,68,73,69,78,84,95,84,89,80,69,59,10,32,32,32,32,125,10,32,32,35,101,110,100,105,102,10,10,32,32,105,102,32,40,103,114,97,100,105,101,110,116,95,116,121,112,101,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,110,111,95,103,114,97,100,105,101,110,116,95,116,121,112,101,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,116,44,32,103,111,111,100,59,10,32,32,32,32,32,32,117,105,110,116,32,115,112,114,101,97,100,95,116,121,112,101,59,10,10,32,32,32,32,32,32,116,32,61,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,98,114,117,115,104,95,99,111,109,112,117,116,101,95,105,110,116,101,114,112,111,108,97,116,101,41,40,112,44,32,103,114,97,100,105,101,110,116,95,116,121,112,101,44,32,103,111,111,100,41,59,10,32,32,32,32,32,32,115,112,114,101,97,100,95,116,121,112,101,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,115,112,114,101,97,100,95,116,121,112,101,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,115,112,114,101,97,100,95,116,121,112,101,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,98,95,115,104,97,100,101,114,41,59,10,10,32,32,32,32,32,32,35,105,102,100,101,102,32,83,85,80,80,79,82,84,83,95,82,65,68,73,65,76,95,86,65,82,89,73,78,71,83,10,32,32,32,32,32,32,105,102,32,40,103,114,97,100,105,101,110,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,95,116,121,112,101,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,32,43,61,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,95,100,97,116,97,95,115,105,122,101,41,40,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,35,101,110,100,105,102,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,32,43,61,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,108,105,110,101,97,114,95,111,114,95,115,119,101,101,112,95,103,114,97,100,105,101,110,116,95,100,97,116,97,95,115,105,122,101,41,40,41,59,10,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,47,42,32,78,79,84,69,58,32,116,104,101,114,101,32,105,115,32,97,32,77,101,115,97,47,105,57,54,53,32,98,117,103,32,119,104,101,114,101,32,105,102,32,119,101,32,99,104,97,110,103,101,32,116,104,101,10,32,32,32,32,32,32,32,42,32,111,114,100,101,114,32,111,102,32,116,104,105,115,32,105,102,47,101,108,115,101,32,99,104,97,105,110,32,116,111,32,115,111,109,101,116,104,105,110,103,32,100,105,102,102,101,114,101,110,116,44,10,32,32,32,32,32,32,32,42,32,105,116,32,109,105,103,104,116,32,110,111,116,32,99,111,114,114,101,99,116,108,121,32,101,118,97,108,117,97,116,101,46,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,105,102,32,40,115,112,114,101,97,100,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,112,114,101,97,100,95,109,105,114,114,111,114,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,109,105,114,114,111,114,95,115,112,114,101,97,100,40,116,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,32,105,102,32,40,115,112,114,101,97,100,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,112,114,101,97,100,95,114,101,112,101,97,116,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,114,101,112,101,97,116,95,115,112,114,101,97,100,40,116,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,32,105,102,32,40,115,112,114,101,97,100,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,112,114,101,97,100,95,109,105,114,114,111,114,95,114,101,112,101,97,116,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,109,105,114,114,111,114,95,114,101,112,101,97,116,95,115,112,114,101,97,100,40,116,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,99,108,97,109,112,95,115,112,114,101,97,100,40,116,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,108,111,114,95,115,116,111,112,95,120,32,43,32,116,32,42,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,108,111,114,95,115,116,111,112,95,108,101,110,103,116,104,59,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,40,103,111,111,100,32,42,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,70,101,116,99,104,40,116,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,108,111,114,95,115,116,111,112,95,121,41,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,118,101,99,52,40,49,46,48,44,32,49,46,48,44,32,49,46,48,44,32,49,46,48,41,59,10,32,32,32,32,125,10,10,32,32,114,101,116,117,114,110,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,125,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_painter_gradient_brush.frag.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
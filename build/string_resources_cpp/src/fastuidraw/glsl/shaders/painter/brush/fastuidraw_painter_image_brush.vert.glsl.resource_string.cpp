@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,105,109,97,103,101,95,98,114,117,115,104,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,105,109,97,103,101,95,98,114,117,115,104,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,103,108,95,118,101,114,116,95,98,114,117,115,104,95,109,97,105,110,40,105,110,32,117,105,110,116,32,115,117,98,95,115,104,97,100,101,114,44,32,105,110,111,117,116,32,117,105,110,116,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,44,32,105,110,32,118,101,99,50,32,105,110,95,112,41,10,123,10,32,32,117,105,110,116,32,105,109,97,103,101,95,116,121,112,101,59,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,100,97,116,97,41,32,105,109,97,103,101,59,10,10,32,32,105,109,97,103,101,95,116,121,112,101,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,116,121,112,101,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,116,121,112,101,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,98,95,115,104,97,100,101,114,41,59,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,105,109,97,103,101,95,100,97,116,97,41,40,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,44,32,105,109,97,103,101,95,116,121,112,101,44,32,105,109,97,103,101,41,59,10,32,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,32,43,61,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,105,109,97,103,101,95,114,97,119,95,100,97,116,97,95,115,105,122,101,41,40,41,59,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,115,105,122,101,95,120,32,61,32,102,108,111,97,116,40,105,109,97,103,101,46,105,109,97,103,101,95,115,105,122,101,46,120,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,115,105,122,101,95,121,32,61,32,102,108,111,97,116,40,105,109,97,103,101,46,105,109,97,103,101,95,115,105,122,101,46,121,41,59,10,32,32,35,105,102,110,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,10,32,32,105,102,32,40,105,109,97,103,101,95,116,121,112,101,32,61,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,116,121,112,101,95,111,110,95,97,116,108,97,115,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,50,32,84,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,105,110,102,111,95,116,121,112,101,32,105,109,97,103,101,95,105,110,102,111,59,10,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,105,110,102,111,40,105,109,97,103,101,46,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,115,44,32,105,109,97,103,101,95,105,110,102,111,41,59,10,10,32,32,32,32,32,32,84,32,61,32,105,109,97,103,101,46,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,120,121,122,46,120,121,32,43,32,118,101,99,50,40,105,109,97,103,101,46,105,109,97,103,101,95,115,116,97,114,116,41,32,42,32,105,109,97,103,101,95,105,110,102,111,46,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,120,32,61,32,84,46,120,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,121,32,61,32,84,46,121,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,108,97,121,101,114,32,61,32,117,105,110,116,40,105,109,97,103,101,46,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,120,121,122,46,122,41,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,32,61,32,105,109,97,103,101,95,105,110,102,111,46,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,99,105,112,95,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,32,61,32,105,109,97,103,101,95,105,110,102,111,46,114,101,99,105,112,95,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,115,32,61,32,105,109,97,103,101,46,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,115,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,35,101,110,100,105,102,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,120,32,61,32,102,108,111,97,116,40,105,109,97,103,101,46,105,109,97,103,101,95,115,116,97,114,116,46,120,41,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,121,32,61,32,102,108,111,97,116,40,105,109,97,103,101,46,105,109,97,103,101,95,115,116,97,114,116,46,121,41,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,98,105,110,100,108,101,115,115,95,108,111,119,95,104,97,110,100,108,101,32,61,32,105,109,97,103,101,46,98,105,110,100,108,101,115,115,95,104,97,110,100,108,101,95,108,111,119,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,98,105,110,100,108,101,115,115,95,104,105,103,104,95,104,97,110,100,108,101,32,61,32,105,109,97,103,101,46,98,105,110,100,108,101,115,115,95,104,97,110,100,108,101,95,104,105,59,10,32,32,32,32,125,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,95,120,32,61,32,105,110,95,112,46,120,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,95,121,32,61,32,105,110,95,112,46,121,59,10,125,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_painter_image_brush.vert.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
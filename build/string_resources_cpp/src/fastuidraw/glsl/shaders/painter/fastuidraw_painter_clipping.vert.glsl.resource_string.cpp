@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,99,108,105,112,112,105,110,103,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,99,108,105,112,112,105,110,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,57,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,67,76,73,80,80,73,78,71,95,85,83,69,95,71,76,95,67,76,73,80,95,68,73,83,84,65,67,69,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,48,32,103,108,95,67,108,105,112,68,105,115,116,97,110,99,101,91,48,93,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,49,32,103,108,95,67,108,105,112,68,105,115,116,97,110,99,101,91,49,93,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,50,32,103,108,95,67,108,105,112,68,105,115,116,97,110,99,101,91,50,93,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,51,32,103,108,95,67,108,105,112,68,105,115,116,97,110,99,101,91,51,93,10,35,101,108,115,101,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,48,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,95,112,108,97,110,101,48,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,49,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,95,112,108,97,110,101,49,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,50,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,95,112,108,97,110,101,50,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,51,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,95,112,108,97,110,101,51,10,35,101,110,100,105,102,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,97,112,112,108,121,95,99,108,105,112,112,105,110,103,40,105,110,32,118,101,99,51,32,112,44,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,112,105,110,103,95,100,97,116,97,32,99,41,10,123,10,32,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,48,32,61,32,100,111,116,40,99,46,99,108,105,112,48,44,32,112,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,49,32,61,32,100,111,116,40,99,46,99,108,105,112,49,44,32,112,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,50,32,61,32,100,111,116,40,99,46,99,108,105,112,50,44,32,112,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,51,32,61,32,100,111,116,40,99,46,99,108,105,112,51,44,32,112,41,59,10,125,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_painter_clipping.vert.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
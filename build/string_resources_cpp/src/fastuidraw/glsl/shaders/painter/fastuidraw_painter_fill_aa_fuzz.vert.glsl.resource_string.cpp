@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,102,105,108,108,95,97,97,95,102,117,122,122,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,102,105,108,108,95,97,97,95,102,117,122,122,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,102,108,111,97,116,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,100,105,115,116,41,40,105,110,32,118,101,99,51,32,99,108,105,112,95,112,44,32,105,110,32,118,101,99,51,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,10,123,10,32,32,99,111,110,115,116,32,102,108,111,97,116,32,115,113,114,116,50,32,61,32,49,46,52,49,52,50,49,51,53,54,50,51,55,59,10,32,32,99,111,110,115,116,32,102,108,111,97,116,32,116,119,111,95,109,105,110,117,115,95,115,113,114,116,50,32,61,32,50,46,48,32,45,32,49,46,52,49,52,50,49,51,53,54,50,51,55,59,10,32,32,102,108,111,97,116,32,104,118,44,32,114,59,10,32,32,118,101,99,50,32,110,111,114,109,97,108,105,122,101,100,95,100,105,114,101,99,116,105,111,110,59,10,10,32,32,47,42,32,84,104,101,32,98,97,115,105,99,32,105,100,101,97,58,32,99,111,109,112,117,116,101,32,116,104,101,32,100,105,114,101,99,116,105,111,110,32,105,110,32,115,99,114,101,101,110,32,99,111,111,114,100,105,110,97,116,101,115,44,10,32,32,32,42,32,97,110,100,32,102,114,111,109,32,116,104,97,116,32,118,97,108,117,101,32,99,111,109,112,117,116,101,32,116,104,101,32,100,105,115,116,97,110,99,101,32,105,110,32,112,105,120,101,108,115,32,110,101,101,100,101,100,10,32,32,32,42,32,116,111,32,116,111,117,99,104,32,116,104,101,32,110,101,120,116,32,115,97,109,112,108,101,46,32,70,111,114,32,99,111,109,112,108,101,116,101,108,121,32,118,101,114,116,105,99,97,108,32,111,114,10,32,32,32,42,32,104,111,114,105,122,111,110,116,97,108,32,116,104,101,32,118,97,108,117,101,32,105,115,32,49,59,32,102,111,114,32,52,53,45,100,101,103,114,101,101,115,32,116,104,101,32,118,97,108,117,101,32,105,115,10,32,32,32,42,32,115,113,114,116,50,59,10,32,32,32,42,47,10,32,32,110,111,114,109,97,108,105,122,101,100,95,100,105,114,101,99,116,105,111,110,32,61,32,110,111,114,109,97,108,105,122,101,40,99,108,105,112,95,100,105,114,101,99,116,105,111,110,46,120,121,41,59,10,32,32,104,118,32,61,32,109,105,110,40,97,98,115,40,110,111,114,109,97,108,105,122,101,100,95,100,105,114,101,99,116,105,111,110,46,120,41,44,10,32,32,32,32,32,32,32,32,32,32,32,97,98,115,40,110,111,114,109,97,108,105,122,101,100,95,100,105,114,101,99,116,105,111,110,46,121,41,41,59,10,32,32,114,32,61,32,49,46,48,32,43,32,104,118,32,42,32,116,119,111,95,109,105,110,117,115,95,115,113,114,116,50,59,10,10,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,114,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,125,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,103,108,95,118,101,114,116,95,109,97,105,110,40,105,110,32,117,105,110,116,32,115,117,98,95,115,104,97,100,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,118,101,99,52,32,105,110,95,97,116,116,114,105,98,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,118,101,99,52,32,105,110,95,97,116,116,114,105,98,49,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,118,101,99,52,32,105,110,95,97,116,116,114,105,98,50,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,111,117,116,32,117,105,110,116,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,82,69,78,68,69,82,95,84,79,95,67,79,76,79,82,95,66,85,70,70,69,82,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,105,110,116,32,122,95,97,100,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,117,116,95,98,114,117,115,104,95,112,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,35,101,110,100,105,102,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,51,32,111,117,116,95,99,108,105,112,95,112,41,10,123,10,32,32,118,101,99,50,32,112,111,115,105,116,105,111,110,59,10,32,32,118,101,99,50,32,112,44,32,110,48,44,32,110,49,59,10,32,32,118,101,99,51,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,44,32,99,108,105,112,95,112,59,10,32,32,102,108,111,97,116,32,100,105,115,116,44,32,115,103,110,44,32,104,118,59,10,32,32,117,105,110,116,32,116,121,112,101,59,10,32,32,99,111,110,115,116,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,32,61,32,49,46,48,59,10,10,32,32,112,111,115,105,116,105,111,110,32,61,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,105,110,95,97,116,116,114,105,98,48,46,120,121,41,59,10,32,32,116,121,112,101,32,61,32,105,110,95,97,116,116,114,105,98,48,46,122,59,10,10,32,32,110,48,32,61,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,105,110,95,97,116,116,114,105,98,49,46,120,121,41,59,10,32,32,110,49,32,61,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,105,110,95,97,116,116,114,105,98,49,46,122,119,41,59,10,10,32,32,105,102,32,40,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,97,97,95,102,117,122,122,95,116,121,112,101,95,111,110,95,112,97,116,104,41,10,32,32,32,32,123,10,32,32,32,32,32,32,112,32,61,32,112,111,115,105,116,105,111,110,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,97,97,95,102,117,122,122,95,116,121,112,101,95,111,110,95,98,111,117,110,100,97,114,121,41,10,32,32,32,32,123,10,32,32,32,32,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,44,32,49,46,48,41,59,10,32,32,32,32,32,32,110,48,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,110,111,114,109,97,108,95,116,111,95,115,99,114,101,101,110,40,99,108,105,112,95,112,44,32,110,48,41,59,10,32,32,32,32,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,110,48,44,32,48,46,48,41,59,10,32,32,32,32,32,32,100,105,115,116,32,61,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,100,105,115,116,41,40,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,32,32,32,32,32,32,112,32,61,32,112,111,115,105,116,105,111,110,32,43,32,100,105,115,116,32,42,32,110,48,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,109,44,32,109,109,44,32,114,44,32,114,48,44,32,114,49,44,32,100,101,116,59,10,32,32,32,32,32,32,118,101,99,50,32,118,48,32,61,32,118,101,99,50,40,110,48,46,121,44,32,45,110,48,46,120,41,44,32,118,49,32,61,32,118,101,99,50,40,110,49,46,121,44,32,45,110,49,46,120,41,59,10,32,32,32,32,32,32,118,101,99,50,32,100,48,44,32,100,49,44,32,100,101,108,116,97,95,100,59,10,10,32,32,32,32,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,44,32,49,46,48,41,59,10,10,32,32,32,32,32,32,110,48,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,110,111,114,109,97,108,95,116,111,95,115,99,114,101,101,110,40,99,108,105,112,95,112,44,32,110,48,41,59,10,32,32,32,32,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,110,48,44,32,48,46,48,41,59,10,32,32,32,32,32,32,114,48,32,61,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,100,105,115,116,41,40,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,32,32,32,32,32,32,100,48,32,61,32,114,48,32,42,32,110,48,59,10,10,32,32,32,32,32,32,110,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,110,111,114,109,97,108,95,116,111,95,115,99,114,101,101,110,40,99,108,105,112,95,112,44,32,110,49,41,59,10,32,32,32,32,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,110,49,44,32,48,46,48,41,59,10,32,32,32,32,32,32,114,49,32,61,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,100,105,115,116,41,40,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,32,32,32,32,32,32,100,49,32,61,32,114,49,32,42,32,110,49,59,10,10,32,32,32,32,32,32,100,101,108,116,97,95,100,32,61,32,100,49,32,45,32,100,48,59,10,32,32,32,32,32,32,100,101,116,32,61,32,118,48,46,120,32,42,32,118,49,46,121,32,45,32,118,48,46,121,32,42,32,118,49,46,120,59,10,10,32,32,32,32,32,32,114,32,61,32,40,118,49,46,121,32,42,32,100,101,108,116,97,95,100,46,120,32,45,32,118,49,46,120,32,42,32,100,101,108,116,97,95,100,46,121,41,32,47,32,100,101,116,59,10,32,32,32,32,32,32,114,32,61,32,99,108,97,109,112,40,114,44,32,45,109,105,116,101,114,95,108,105,109,105,116,44,32,109,105,116,101,114,95,108,105,109,105,116,41,59,10,32,32,32,32,32,32,112,32,61,32,112,111,115,105,116,105,111,110,32,43,32,100,48,32,43,32,114,32,42,32,118,48,59,10,32,32,32,32,125,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,97,97,95,102,117,122,122,32,61,32,40,116,121,112,101,32,61,61,32,48,117,41,32,63,32,48,46,48,32,58,32,49,46,48,59,10,32,32,111,117,116,95,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,44,32,49,46,48,41,59,10,10,32,32,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,82,69,78,68,69,82,95,84,79,95,67,79,76,79,82,95,66,85,70,70,69,82,10,32,32,32,32,123,10,32,32,32,32,32,32,111,117,116,95,98,114,117,115,104,95,112,32,61,32,112,59,10,32,32,32,32,32,32,122,95,97,100,100,32,61,32,105,110,116,40,105,110,95,97,116,116,114,105,98,48,46,119,41,59,10,32,32,32,32,125,10,32,32,35,101,110,100,105,102,10,125,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_painter_fill_aa_fuzz.vert.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,109,97,105,110,95,100,101,102,101,114,114,101,100,95,99,111,118,101,114,97,103,101,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,109,97,105,110,95,100,101,102,101,114,114,101,100,95,99,111,118,101,114,97,103,101,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,47,42,32,83,107,101,108,101,116,111,110,32,102,111,114,32,85,98,101,114,45,118,101,114,116,101,120,32,115,104,97,100,101,114,44,32,111,117,116,39,115,32,111,102,32,116,104,101,32,115,104,97,100,101,114,32,119,105,108,108,10,32,32,32,98,101,32,112,108,97,99,101,100,32,45,98,101,102,111,114,101,45,32,116,104,105,115,32,99,111,100,101,46,10,32,42,47,10,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,78,79,82,77,65,76,73,90,69,68,95,90,95,77,73,78,85,83,95,49,95,84,79,95,49,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,68,69,80,84,72,95,67,79,69,70,70,32,40,49,46,48,32,47,32,102,108,111,97,116,40,102,97,115,116,117,105,100,114,97,119,95,104,97,108,102,95,109,97,120,95,122,41,32,41,10,35,101,108,115,101,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,68,69,80,84,72,95,67,79,69,70,70,32,40,49,46,48,32,47,32,102,108,111,97,116,40,102,97,115,116,117,105,100,114,97,119,95,109,97,120,95,122,41,32,41,10,35,101,110,100,105,102,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,118,101,114,116,95,98,114,117,115,104,95,112,114,111,99,101,115,115,105,110,103,40,105,110,32,118,101,99,50,32,105,110,95,112,44,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,104,101,97,100,101,114,32,104,41,10,123,10,125,10,10,118,111,105,100,10,109,97,105,110,40,118,111,105,100,41,10,123,10,32,32,102,97,115,116,117,105,100,114,97,119,95,104,101,97,100,101,114,32,104,59,10,32,32,118,101,99,50,32,110,111,114,109,97,108,105,122,101,100,95,116,114,97,110,115,108,97,116,101,59,10,32,32,118,101,99,51,32,99,108,105,112,95,112,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,112,105,110,103,95,100,97,116,97,32,99,108,105,112,112,105,110,103,59,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,104,101,97,100,101,114,40,102,97,115,116,117,105,100,114,97,119,95,104,101,97,100,101,114,95,97,116,116,114,105,98,117,116,101,44,32,104,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,99,108,105,112,112,105,110,103,40,104,46,99,108,105,112,112,105,110,103,95,108,111,99,97,116,105,111,110,44,32,99,108,105,112,112,105,110,103,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,105,116,101,109,95,109,97,116,114,105,120,40,104,46,105,116,101,109,95,109,97,116,114,105,120,95,108,111,99,97,116,105,111,110,44,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,44,32,110,111,114,109,97,108,105,122,101,100,95,116,114,97,110,115,108,97,116,101,41,59,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,102,114,97,103,95,115,104,97,100,101,114,32,61,32,104,46,105,116,101,109,95,115,104,97,100,101,114,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,102,114,97,103,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,32,61,32,104,46,105,116,101,109,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,59,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,117,110,95,118,101,114,116,95,115,104,97,100,101,114,40,104,44,32,99,108,105,112,95,112,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,97,112,112,108,121,95,99,108,105,112,112,105,110,103,40,99,108,105,112,95,112,44,32,99,108,105,112,112,105,110,103,41,59,10,10,32,32,99,108,105,112,95,112,46,120,121,32,43,61,32,110,111,114,109,97,108,105,122,101,100,95,116,114,97,110,115,108,97,116,101,32,42,32,99,108,105,112,95,112,46,122,59,10,32,32,103,108,95,80,111,115,105,116,105,111,110,32,61,32,118,101,99,52,40,99,108,105,112,95,112,46,120,121,44,32,48,46,48,44,32,99,108,105,112,95,112,46,122,41,59,10,125,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_painter_main_deferred_coverage.vert.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
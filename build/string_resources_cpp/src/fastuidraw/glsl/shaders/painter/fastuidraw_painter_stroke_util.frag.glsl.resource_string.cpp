@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,115,116,114,111,107,101,95,117,116,105,108,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,115,116,114,111,107,101,95,117,116,105,108,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,102,108,111,97,116,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,99,111,109,112,117,116,101,95,100,97,115,104,95,105,110,116,101,114,118,97,108,41,40,105,110,32,117,105,110,116,32,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,116,111,116,97,108,95,100,105,115,116,97,110,99,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,105,110,95,100,105,115,116,97,110,99,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,115,116,97,114,116,44,32,105,110,32,102,108,111,97,116,32,101,110,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,41,10,123,10,32,32,105,102,32,40,105,110,95,100,105,115,116,97,110,99,101,32,60,61,32,115,116,97,114,116,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,105,110,95,100,105,115,116,97,110,99,101,32,45,32,115,116,97,114,116,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,105,110,95,100,105,115,116,97,110,99,101,32,62,61,32,101,110,100,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,101,110,100,32,45,32,105,110,95,100,105,115,116,97,110,99,101,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,105,110,116,32,105,110,116,101,114,118,97,108,95,105,100,59,10,32,32,32,32,32,32,102,108,111,97,116,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,44,32,105,110,116,101,114,118,97,108,95,101,110,100,44,32,115,59,10,10,32,32,32,32,32,32,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,110,116,101,114,118,97,108,40,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,111,116,97,108,95,100,105,115,116,97,110,99,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,95,100,105,115,116,97,110,99,101,44,32,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,105,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,101,110,100,41,59,10,10,32,32,32,32,32,32,114,101,116,117,114,110,32,115,32,42,32,109,105,110,40,105,110,95,100,105,115,116,97,110,99,101,32,45,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,44,32,105,110,116,101,114,118,97,108,95,101,110,100,32,45,32,105,110,95,100,105,115,116,97,110,99,101,41,59,10,32,32,32,32,125,10,125,10,10,102,108,111,97,116,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,99,111,109,112,117,116,101,95,100,97,115,104,95,105,110,116,101,114,118,97,108,41,40,105,110,32,117,105,110,116,32,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,116,111,116,97,108,95,100,105,115,116,97,110,99,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,105,110,95,100,105,115,116,97,110,99,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,41,10,123,10,32,32,105,110,116,32,105,110,116,101,114,118,97,108,95,105,100,59,10,32,32,102,108,111,97,116,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,44,32,105,110,116,101,114,118,97,108,95,101,110,100,44,32,115,59,10,10,32,32,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,110,116,101,114,118,97,108,40,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,111,116,97,108,95,100,105,115,116,97,110,99,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,95,100,105,115,116,97,110,99,101,44,32,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,105,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,101,110,100,41,59,10,10,32,32,114,101,116,117,114,110,32,115,32,42,32,109,105,110,40,105,110,95,100,105,115,116,97,110,99,101,32,45,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,44,32,105,110,116,101,114,118,97,108,95,101,110,100,32,45,32,105,110,95,100,105,115,116,97,110,99,101,41,59,10,125,10,10,10,102,108,111,97,116,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,99,111,109,112,117,116,101,95,100,97,115,104,95,99,111,118,101,114,97,103,101,95,105,109,112,108,101,109,101,110,116,41,40,105,110,32,98,111,111,108,32,97,100,100,95,114,111,117,110,100,101,100,95,99,97,112,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,98,111,111,108,32,97,100,100,95,115,113,117,97,114,101,95,99,97,112,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,113,44,32,105,110,32,102,108,111,97,116,32,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,102,119,105,100,116,104,95,100,105,115,116,97,110,99,101,95,118,97,108,117,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,115,116,114,111,107,105,110,103,95,111,110,95,98,111,117,110,100,97,114,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,102,119,105,100,116,104,95,115,116,114,111,107,105,110,103,95,111,110,95,98,111,117,110,100,97,114,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,98,111,111,108,32,100,105,115,116,97,110,99,101,95,118,97,108,117,101,95,99,111,110,115,116,97,110,116,95,111,110,95,112,114,105,109,105,116,105,118,101,41,10,123,10,32,32,102,108,111,97,116,32,100,44,32,121,44,32,113,113,95,121,121,44,32,102,119,105,100,116,104,95,113,113,95,121,121,44,32,102,119,44,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,10,32,32,121,32,61,32,114,32,42,32,115,116,114,111,107,105,110,103,95,111,110,95,98,111,117,110,100,97,114,121,59,10,32,32,113,113,95,121,121,32,61,32,113,32,42,32,113,32,43,32,121,32,42,32,121,59,10,10,32,32,102,119,32,61,32,102,119,105,100,116,104,95,100,105,115,116,97,110,99,101,95,118,97,108,117,101,59,10,32,32,102,119,105,100,116,104,95,113,113,95,121,121,32,61,32,50,46,48,32,42,32,97,98,115,40,113,41,32,42,32,102,119,32,43,32,50,46,48,32,42,32,97,98,115,40,121,41,32,42,32,114,32,42,32,102,119,105,100,116,104,95,115,116,114,111,107,105,110,103,95,111,110,95,98,111,117,110,100,97,114,121,59,10,32,32,105,102,32,40,97,100,100,95,114,111,117,110,100,101,100,95,99,97,112,115,41,10,32,32,32,32,123,10,32,32,32,32,32,32,47,42,32,102,119,32,114,101,112,114,101,115,101,110,116,115,32,116,104,101,32,116,111,108,101,114,97,110,99,101,32,111,102,32,97,32,112,105,120,101,108,46,32,84,104,101,32,101,120,112,101,99,116,101,100,10,32,32,32,32,32,32,32,42,32,99,111,110,100,105,116,105,111,110,32,105,115,32,105,102,32,40,113,32,60,32,48,46,48,41,44,32,98,117,116,32,116,104,97,116,32,103,105,118,101,115,32,98,108,97,99,107,45,108,105,110,101,10,32,32,32,32,32,32,32,42,32,114,101,110,100,101,114,32,105,115,115,117,101,32,111,110,32,116,104,101,32,98,111,117,110,100,97,114,121,32,98,101,116,119,101,101,110,32,116,104,101,32,99,97,112,32,97,110,100,32,116,104,101,10,32,32,32,32,32,32,32,42,32,100,97,115,104,45,112,97,116,116,101,114,110,32,98,111,117,110,100,97,114,121,46,32,66,121,32,114,101,108,97,120,105,110,103,32,116,104,101,32,99,111,110,100,105,116,105,111,110,32,98,121,10,32,32,32,32,32,32,32,42,32,40,101,115,115,101,110,116,105,97,108,108,121,41,32,49,45,112,105,120,101,108,44,32,119,101,32,99,97,110,32,97,118,111,105,100,32,116,104,97,116,32,114,101,110,100,101,114,105,110,103,10,32,32,32,32,32,32,32,42,32,105,115,115,117,101,46,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,105,102,32,40,113,32,60,32,102,119,32,38,38,32,113,32,62,32,45,102,119,32,45,32,114,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,115,113,59,10,10,32,32,32,32,32,32,32,32,32,32,115,113,32,61,32,115,113,114,116,40,113,113,95,121,121,41,59,10,32,32,32,32,32,32,32,32,32,32,113,32,61,32,114,32,45,32,115,113,59,10,32,32,32,32,32,32,32,32,32,32,102,119,32,61,32,48,46,53,32,42,32,102,119,105,100,116,104,95,113,113,95,121,121,32,47,32,115,113,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,97,100,100,95,115,113,117,97,114,101,95,99,97,112,115,41,10,32,32,32,32,123,10,32,32,32,32,32,32,113,32,43,61,32,114,59,10,32,32,32,32,125,10,10,32,32,105,102,32,40,33,100,105,115,116,97,110,99,101,95,118,97,108,117,101,95,99,111,110,115,116,97,110,116,95,111,110,95,112,114,105,109,105,116,105,118,101,41,10,32,32,32,32,123,10,32,32,32,32,32,32,100,32,61,32,109,97,120,40,97,98,115,40,113,41,44,32,102,119,41,59,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,109,97,120,40,48,46,48,44,32,113,32,47,32,100,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,113,32,62,32,48,46,48,32,63,32,49,46,48,32,58,32,48,46,48,59,10,32,32,32,32,125,10,10,32,32,114,101,116,117,114,110,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,125,10,10,102,108,111,97,116,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,99,111,109,112,117,116,101,95,100,97,115,104,95,99,111,118,101,114,97,103,101,41,40,105,110,32,98,111,111,108,32,97,100,100,95,114,111,117,110,100,101,100,95,99,97,112,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,98,111,111,108,32,97,100,100,95,115,113,117,97,114,101,95,99,97,112,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,111,117,116,32,117,105,110,116,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,100,105,115,116,97,110,99,101,95,118,97,108,117,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,102,119,105,100,116,104,95,100,105,115,116,97,110,99,101,95,118,97,108,117,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,115,116,114,111,107,105,110,103,95,111,110,95,98,111,117,110,100,97,114,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,102,119,105,100,116,104,95,115,116,114,111,107,105,110,103,95,111,110,95,98,111,117,110,100,97,114,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,100,105,115,116,97,110,99,101,95,115,117,98,95,101,100,103,101,95,115,116,97,114,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,100,105,115,116,97,110,99,101,95,115,117,98,95,101,100,103,101,95,101,110,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,98,111,111,108,32,115,107,105,112,95,105,110,116,101,114,118,97,108,95,108,111,111,107,117,112,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,98,111,111,108,32,100,105,115,116,97,110,99,101,95,118,97,108,117,101,95,99,111,110,115,116,97,110,116,95,111,110,95,112,114,105,109,105,116,105,118,101,41,10,123,10,32,32,102,108,111,97,116,32,113,59,10,32,32,117,105,110,116,32,100,97,115,104,95,112,97,116,116,101,114,110,95,97,116,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,32,115,116,114,111,107,101,95,112,97,114,97,109,115,59,10,10,32,32,100,97,115,104,95,112,97,116,116,101,114,110,95,97,116,32,61,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,32,43,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,95,110,117,109,95,98,108,111,99,107,115,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,40,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,44,32,115,116,114,111,107,101,95,112,97,114,97,109,115,41,59,10,10,32,32,105,102,32,40,115,107,105,112,95,105,110,116,101,114,118,97,108,95,108,111,111,107,117,112,41,10,32,32,32,32,123,10,32,32,32,32,32,32,113,32,61,32,100,105,115,116,97,110,99,101,95,118,97,108,117,101,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,102,59,10,32,32,32,32,32,32,102,32,61,32,100,105,115,116,97,110,99,101,95,118,97,108,117,101,32,62,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,116,111,116,97,108,95,108,101,110,103,116,104,32,63,10,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,95,111,110,95,108,111,111,112,105,110,103,32,58,10,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,59,10,10,32,32,32,32,32,32,113,32,61,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,99,111,109,112,117,116,101,95,100,97,115,104,95,105,110,116,101,114,118,97,108,41,40,100,97,115,104,95,112,97,116,116,101,114,110,95,97,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,116,111,116,97,108,95,108,101,110,103,116,104,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,105,115,116,97,110,99,101,95,118,97,108,117,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,105,115,116,97,110,99,101,95,115,117,98,95,101,100,103,101,95,115,116,97,114,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,105,115,116,97,110,99,101,95,115,117,98,95,101,100,103,101,95,101,110,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,41,59,10,32,32,32,32,125,10,10,32,32,114,101,116,117,114,110,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,99,111,109,112,117,116,101,95,100,97,115,104,95,99,111,118,101,114,97,103,101,95,105,109,112,108,101,109,101,110,116,41,40,97,100,100,95,114,111,117,110,100,101,100,95,99,97,112,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,100,100,95,115,113,117,97,114,101,95,99,97,112,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,113,44,32,97,98,115,40,115,116,114,111,107,101,95,112,97,114,97,109,115,46,114,97,100,105,117,115,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,119,105,100,116,104,95,100,105,115,116,97,110,99,101,95,118,97,108,117,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,105,110,103,95,111,110,95,98,111,117,110,100,97,114,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,119,105,100,116,104,95,115,116,114,111,107,105,110,103,95,111,110,95,98,111,117,110,100,97,114,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,105,115,116,97,110,99,101,95,118,97,108,117,101,95,99,111,110,115,116,97,110,116,95,111,110,95,112,114,105,109,105,116,105,118,101,41,59,10,125,10,10,102,108,111,97,116,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,99,111,109,112,117,116,101,95,100,97,115,104,95,99,111,118,101,114,97,103,101,41,40,105,110,111,117,116,32,117,105,110,116,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,100,105,115,116,97,110,99,101,95,118,97,108,117,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,102,119,105,100,116,104,95,100,105,115,116,97,110,99,101,95,118,97,108,117,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,98,111,111,108,32,115,107,105,112,95,105,110,116,101,114,118,97,108,95,108,111,111,107,117,112,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,98,111,111,108,32,100,105,115,116,97,110,99,101,95,118,97,108,117,101,95,99,111,110,115,116,97,110,116,95,111,110,95,112,114,105,109,105,116,105,118,101,41,10,123,10,32,32,102,108,111,97,116,32,100,44,32,113,44,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,32,32,117,105,110,116,32,100,97,115,104,95,112,97,116,116,101,114,110,95,97,116,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,32,115,116,114,111,107,101,95,112,97,114,97,109,115,59,10,10,32,32,100,97,115,104,95,112,97,116,116,101,114,110,95,97,116,32,61,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,32,43,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,95,110,117,109,95,98,108,111,99,107,115,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,40,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,44,32,115,116,114,111,107,101,95,112,97,114,97,109,115,41,59,10,10,32,32,105,102,32,40,115,107,105,112,95,105,110,116,101,114,118,97,108,95,108,111,111,107,117,112,41,10,32,32,32,32,123,10,32,32,32,32,32,32,113,32,61,32,100,105,115,116,97,110,99,101,95,118,97,108,117,101,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,102,59,10,32,32,32,32,32,32,102,32,61,32,100,105,115,116,97,110,99,101,95,118,97,108,117,101,32,62,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,116,111,116,97,108,95,108,101,110,103,116,104,32,63,10,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,95,111,110,95,108,111,111,112,105,110,103,32,58,10,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,59,10,32,32,32,32,32,32,113,32,61,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,99,111,109,112,117,116,101,95,100,97,115,104,95,105,110,116,101,114,118,97,108,41,40,100,97,115,104,95,112,97,116,116,101,114,110,95,97,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,116,111,116,97,108,95,108,101,110,103,116,104,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,105,115,116,97,110,99,101,95,118,97,108,117,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,41,59,10,32,32,32,32,125,10,10,32,32,105,102,32,40,33,100,105,115,116,97,110,99,101,95,118,97,108,117,101,95,99,111,110,115,116,97,110,116,95,111,110,95,112,114,105,109,105,116,105,118,101,41,10,32,32,32,32,123,10,32,32,32,32,32,32,47,42,32,73,83,83,85,69,58,32,105,102,32,116,104,101,32,115,116,97,114,116,32,40,111,114,32,101,110,100,41,32,111,102,32,97,110,32,101,100,103,101,32,99,111,114,114,101,115,112,111,110,100,115,10,32,32,32,32,32,32,32,42,32,101,120,97,99,116,108,121,32,97,116,32,97,32,100,97,115,104,32,98,111,117,110,100,97,114,121,44,32,116,104,101,110,32,116,104,97,116,32,101,100,103,101,32,115,116,97,114,116,32,40,111,114,10,32,32,32,32,32,32,32,42,32,101,110,100,41,32,119,105,108,108,32,103,101,116,32,97,110,116,105,45,97,108,105,97,115,101,100,46,32,72,111,119,101,118,101,114,32,116,104,105,115,32,105,115,32,66,65,68,10,32,32,32,32,32,32,32,42,32,98,101,99,97,117,115,101,32,116,104,101,32,106,111,105,110,32,103,101,116,115,32,100,114,97,119,110,32,97,110,100,32,119,104,101,114,101,32,116,104,101,32,106,111,105,110,32,97,110,100,10,32,32,32,32,32,32,32,42,32,101,100,103,101,32,109,101,101,116,32,119,101,32,119,105,108,108,32,104,97,118,101,32,49,45,112,105,120,101,108,32,102,117,122,122,32,105,110,115,116,101,97,100,32,111,102,10,32,32,32,32,32,32,32,42,32,115,111,108,105,100,32,114,101,115,117,108,116,105,110,103,32,105,110,32,105,99,107,121,32,114,101,110,100,101,114,105,110,103,46,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,100,32,61,32,109,97,120,40,97,98,115,40,113,41,44,32,102,119,105,100,116,104,95,100,105,115,116,97,110,99,101,95,118,97,108,117,101,41,59,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,109,97,120,40,48,46,48,44,32,113,32,47,32,100,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,113,32,62,32,48,46,48,32,63,32,49,46,48,32,58,32,48,46,48,59,10,32,32,32,32,125,10,10,32,32,114,101,116,117,114,110,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,125,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_painter_stroke_util.frag.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,116,121,112,101,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,116,121,112,101,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,47,47,47,64,99,111,110,100,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,104,101,97,100,101,114,10,123,10,32,32,117,105,110,116,32,99,108,105,112,112,105,110,103,95,108,111,99,97,116,105,111,110,59,10,32,32,117,105,110,116,32,105,116,101,109,95,109,97,116,114,105,120,95,108,111,99,97,116,105,111,110,59,10,32,32,117,105,110,116,32,98,114,117,115,104,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,59,10,32,32,117,105,110,116,32,105,116,101,109,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,59,10,32,32,117,105,110,116,32,98,108,101,110,100,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,59,10,32,32,117,105,110,116,32,98,114,117,115,104,95,115,104,97,100,101,114,59,10,32,32,117,105,110,116,32,105,116,101,109,95,115,104,97,100,101,114,59,10,32,32,117,105,110,116,32,98,108,101,110,100,95,115,104,97,100,101,114,59,10,32,32,105,110,116,32,122,59,10,32,32,117,105,110,116,32,98,114,117,115,104,95,97,100,106,117,115,116,95,108,111,99,97,116,105,111,110,59,10,32,32,105,118,101,99,50,32,111,102,102,115,101,116,95,116,111,95,100,101,102,101,114,114,101,100,95,99,111,118,101,114,97,103,101,59,10,32,32,105,118,101,99,50,32,100,101,102,101,114,114,101,100,95,99,111,118,101,114,97,103,101,95,109,105,110,59,10,32,32,105,118,101,99,50,32,100,101,102,101,114,114,101,100,95,99,111,118,101,114,97,103,101,95,109,97,120,59,10,125,59,10,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,112,105,110,103,95,100,97,116,97,10,123,10,32,32,118,101,99,51,32,99,108,105,112,48,44,32,99,108,105,112,49,44,32,99,108,105,112,50,44,32,99,108,105,112,51,59,10,125,59,10,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,97,100,106,117,115,116,95,100,97,116,97,10,123,10,32,32,118,101,99,50,32,115,104,101,97,114,44,32,116,114,97,110,115,108,97,116,101,59,10,125,59,10,47,47,47,64,101,110,100,99,111,110,100,10,10,47,42,33,92,97,100,100,116,111,103,114,111,117,112,32,71,76,83,76,86,101,114,116,70,114,97,103,67,111,100,101,10,32,42,32,64,123,10,32,42,47,10,10,47,42,33,10,32,42,32,84,104,101,32,114,101,97,108,105,122,97,116,105,111,110,32,111,102,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,80,97,105,110,116,101,114,83,116,114,111,107,101,80,97,114,97,109,115,46,10,32,42,32,85,115,101,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,40,41,32,116,111,32,117,110,112,97,99,107,32,102,114,111,109,10,32,42,32,116,104,101,32,100,97,116,97,32,115,116,111,114,101,32,98,117,102,102,101,114,46,10,32,42,47,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,10,123,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,82,65,68,73,85,83,32,111,102,32,115,116,114,111,107,105,110,103,32,40,119,104,105,99,104,32,105,115,32,104,97,108,102,32,116,104,101,32,115,116,114,111,107,105,110,103,32,119,105,100,116,104,41,44,10,32,32,32,42,32,105,46,101,46,32,116,104,101,32,118,97,108,117,101,32,111,102,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,80,97,105,110,116,101,114,83,116,114,111,107,101,80,97,114,97,109,115,58,58,114,97,100,105,117,115,40,41,46,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,114,97,100,105,117,115,59,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,109,105,116,101,114,45,108,105,109,105,116,32,119,104,101,110,32,115,116,114,111,107,105,110,103,32,109,105,116,101,114,45,106,111,105,110,115,44,32,105,46,101,46,32,116,104,101,32,118,97,108,117,101,10,32,32,32,42,32,111,102,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,80,97,105,110,116,101,114,83,116,114,111,107,101,80,97,114,97,109,115,58,58,109,105,116,101,114,95,108,105,109,105,116,40,41,46,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,59,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,115,116,114,111,107,105,110,103,32,117,110,105,116,115,32,111,102,32,116,104,101,32,115,116,114,111,107,44,32,105,46,101,46,32,116,104,101,32,118,97,108,117,101,32,111,102,10,32,32,32,42,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,80,97,105,110,116,101,114,83,116,114,111,107,101,80,97,114,97,109,115,58,58,115,116,114,111,107,105,110,103,95,117,110,105,116,115,40,41,46,10,32,32,32,42,47,10,32,32,117,105,110,116,32,115,116,114,111,107,105,110,103,95,117,110,105,116,115,59,10,125,59,10,10,47,42,33,10,32,42,32,84,104,101,32,114,101,97,108,105,122,97,116,105,111,110,32,111,102,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,80,97,105,110,116,101,114,68,97,115,104,101,100,83,116,114,111,107,101,80,97,114,97,109,115,46,10,32,42,32,85,115,101,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,40,41,32,116,111,32,117,110,112,97,99,107,10,32,42,32,102,114,111,109,32,116,104,101,32,100,97,116,97,32,115,116,111,114,101,32,98,117,102,102,101,114,46,32,84,104,101,32,100,97,115,104,101,100,32,105,110,116,101,114,118,97,108,32,118,97,108,117,101,115,32,102,111,108,108,111,119,10,32,42,32,97,102,116,101,114,32,116,104,101,32,104,101,97,100,101,114,32,112,97,100,100,101,100,32,116,111,32,49,50,56,45,98,105,116,32,98,111,117,110,100,97,114,121,32,105,110,32,116,104,101,32,100,97,116,97,32,115,116,111,114,101,32,98,117,102,102,101,114,46,10,32,42,47,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,10,123,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,82,65,68,73,85,83,32,111,102,32,115,116,114,111,107,105,110,103,32,40,119,104,105,99,104,32,105,115,32,104,97,108,102,32,116,104,101,32,115,116,114,111,107,105,110,103,32,119,105,100,116,104,41,44,10,32,32,32,42,32,105,46,101,46,32,116,104,101,32,118,97,108,117,101,32,111,102,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,80,97,105,110,116,101,114,68,97,115,104,101,100,83,116,114,111,107,101,80,97,114,97,109,115,58,58,114,97,100,105,117,115,40,41,46,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,114,97,100,105,117,115,59,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,109,105,116,101,114,45,108,105,109,105,116,32,119,104,101,110,32,115,116,114,111,107,105,110,103,32,109,105,116,101,114,45,106,111,105,110,115,44,32,105,46,101,46,32,116,104,101,32,118,97,108,117,101,10,32,32,32,42,32,111,102,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,80,97,105,110,116,101,114,68,97,115,104,101,100,83,116,114,111,107,101,80,97,114,97,109,115,58,58,109,105,116,101,114,95,108,105,109,105,116,40,41,46,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,59,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,115,116,114,111,107,105,110,103,32,117,110,105,116,115,32,111,102,32,116,104,101,32,115,116,114,111,107,44,32,105,46,101,46,32,116,104,101,32,118,97,108,117,101,32,111,102,10,32,32,32,42,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,80,97,105,110,116,101,114,68,97,115,104,101,100,83,116,114,111,107,101,80,97,114,97,109,115,58,58,115,116,114,111,107,105,110,103,95,117,110,105,116,115,40,41,46,10,32,32,32,42,47,10,32,32,117,105,110,116,32,115,116,114,111,107,105,110,103,95,117,110,105,116,115,59,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,100,97,115,104,32,111,102,102,115,101,116,44,32,105,46,101,46,32,116,104,101,32,118,97,108,117,101,32,111,102,32,92,114,101,102,10,32,32,32,42,32,102,97,115,116,117,105,100,114,97,119,58,58,80,97,105,110,116,101,114,68,97,115,104,101,100,83,116,114,111,107,101,80,97,114,97,109,115,58,58,100,97,115,104,95,111,102,102,115,101,116,40,41,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,100,97,115,104,95,111,102,102,115,101,116,59,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,108,101,110,103,116,104,32,111,102,32,116,104,101,32,100,97,115,104,32,112,97,116,116,101,114,110,44,32,119,104,101,114,101,32,101,97,99,104,32,101,108,101,109,101,110,116,32,111,102,10,32,32,32,42,32,116,104,101,32,100,97,115,104,32,112,97,116,116,101,114,110,32,111,99,99,117,112,105,101,115,32,54,52,45,98,105,116,115,32,40,116,104,117,115,32,116,104,101,32,110,117,109,98,101,114,32,111,102,10,32,32,32,42,32,117,118,101,99,52,39,115,32,116,111,32,114,101,97,100,32,119,105,116,104,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,32,105,115,32,104,97,108,102,10,32,32,32,42,32,116,104,105,115,32,118,97,108,117,101,46,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,116,111,116,97,108,95,108,101,110,103,116,104,59,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,108,101,110,103,116,104,32,97,108,111,110,103,32,116,104,101,32,112,97,116,104,32,119,104,101,114,101,32,116,104,101,32,102,105,114,115,116,32,100,114,97,119,32,105,110,116,101,114,118,97,108,10,32,32,32,42,32,111,102,32,116,104,101,32,100,97,115,104,32,112,97,116,116,101,114,110,32,111,99,99,117,114,115,46,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,59,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,108,101,110,103,116,104,32,97,108,111,110,103,32,116,104,101,32,112,97,116,104,32,119,104,101,114,101,32,116,104,101,32,102,105,114,115,116,32,100,114,97,119,32,105,110,116,101,114,118,97,108,10,32,32,32,42,32,111,102,32,116,104,101,32,100,97,115,104,32,112,97,116,116,101,114,110,32,111,99,99,117,114,115,32,97,102,116,101,114,32,108,111,111,112,105,110,103,32,111,118,101,114,32,116,104,101,32,100,97,115,104,10,32,32,32,42,32,112,97,116,116,101,114,110,46,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,95,111,110,95,108,111,111,112,105,110,103,59,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,110,117,109,98,101,114,32,111,102,32,105,110,116,101,114,118,97,108,115,32,105,110,32,116,104,101,32,100,97,115,104,45,112,97,116,116,101,114,110,46,32,82,101,99,97,108,108,32,116,104,97,116,10,32,32,32,42,32,116,104,101,32,100,97,115,104,32,112,97,116,116,101,114,110,46,32,69,97,99,104,32,101,108,101,109,101,110,116,32,111,102,32,116,104,101,32,100,97,115,104,45,112,97,116,116,101,114,110,32,105,115,10,32,32,32,42,32,116,119,111,32,102,108,111,97,116,105,110,103,32,112,111,105,110,116,32,118,97,108,117,101,115,58,32,97,32,108,101,110,103,116,104,32,97,108,111,110,103,32,116,104,101,32,112,97,116,104,10,32,32,32,42,32,104,111,119,32,109,117,99,104,32,116,111,32,100,114,97,119,32,97,110,100,32,97,32,108,101,110,103,116,104,32,97,108,111,110,103,32,116,104,101,32,112,97,116,104,32,104,111,119,32,109,117,99,104,10,32,32,32,42,32,116,111,32,115,107,105,112,46,32,84,104,101,32,118,97,108,117,101,115,32,97,114,101,32,112,97,99,107,101,100,32,97,115,32,112,114,101,102,105,120,32,115,117,109,115,44,32,105,46,101,46,32,101,97,99,104,10,32,32,32,42,32,117,118,101,99,52,32,114,101,97,100,32,102,114,111,109,32,116,104,101,32,102,105,114,115,116,32,108,101,118,101,108,32,103,105,118,101,115,32,119,104,101,114,101,32,116,119,111,32,40,100,114,97,119,44,32,115,112,97,99,101,41,10,32,32,32,42,32,112,97,105,114,115,32,101,110,100,32,119,104,101,110,32,98,105,116,45,99,97,115,116,101,100,32,116,111,32,97,32,118,101,99,52,44,32,102,111,108,108,111,119,101,100,32,98,121,32,99,111,97,114,115,101,114,10,32,32,32,42,32,108,101,118,101,108,115,32,116,104,97,116,32,97,108,108,111,119,32,102,111,114,32,97,110,32,79,40,108,111,103,32,78,41,32,115,101,97,114,99,104,46,32,85,115,101,10,32,32,32,42,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,95,112,97,116,116,101,114,110,95,100,97,116,97,95,115,105,122,101,40,41,32,116,111,32,103,101,116,32,116,104,101,32,110,117,109,98,101,114,32,111,102,10,32,32,32,42,32,117,118,101,99,52,39,115,32,116,104,101,32,100,97,115,104,32,112,97,116,116,101,114,110,32,111,99,99,117,112,105,101,115,46,10,32,32,32,42,47,10,32,32,117,105,110,116,32,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,59,10,125,59,10,10,47,42,33,10,32,42,32,85,110,112,97,99,107,32,116,104,101,32,118,97,108,117,101,115,32,111,102,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,32,102,114,111,109,32,116,104,101,32,100,97,116,97,10,32,42,32,115,116,111,114,101,32,98,117,102,102,101,114,46,10,32,42,32,92,112,97,114,97,109,32,108,111,99,97,116,105,111,110,32,111,102,102,115,101,116,32,40,105,110,32,117,110,105,116,115,32,111,102,32,117,118,101,99,52,39,115,41,32,105,110,116,111,32,100,97,116,97,32,115,116,111,114,101,32,98,117,102,102,101,114,10,32,42,32,92,112,97,114,97,109,91,111,117,116,93,32,112,32,117,110,112,97,99,107,32,118,97,108,117,101,32,100,101,115,116,105,110,97,116,105,111,110,10,32,42,47,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,32,112,41,59,10,10,47,42,33,10,32,42,32,85,110,112,97,99,107,32,116,104,101,32,118,97,108,117,101,115,32,111,102,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,10,32,42,32,102,114,111,109,32,116,104,101,32,100,97,116,97,32,115,116,111,114,101,32,98,117,102,102,101,114,46,10,32,42,32,92,112,97,114,97,109,32,108,111,99,97,116,105,111,110,32,111,102,102,115,101,116,32,40,105,110,32,117,110,105,116,115,32,111,102,32,117,118,101,99,52,39,115,41,32,105,110,116,111,32,100,97,116,97,32,115,116,111,114,101,32,98,117,102,102,101,114,10,32,42,32,92,112,97,114,97,109,91,111,117,116,93,32,112,32,117,110,112,97,99,107,32,118,97,108,117,101,32,100,101,115,116,105,110,97,116,105,111,110,10,32,42,47,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,32,112,41,59,10,47,42,33,32,64,125,32,42,47,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_painter_types.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
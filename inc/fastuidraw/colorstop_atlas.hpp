@@ -195,6 +195,16 @@ namespace fastuidraw
     void
     unlock_resources(void);
 
+    /*!
+     * Returns the number of times that intervals of this
+     * ColorStopAtlas were freed or moved. Content that references
+     * locations of the atlas, such as a retained \ref
+     * PainterDisplayList, remains valid as long as the
+     * value does not change.
+     */
+    unsigned int
+    number_times_released(void) const;
+
     /*!
      * Calls ColorStopBackingStore::flush() on
      * the backing store (see backing_store()).
@@ -324,6 +324,16 @@ namespace fastuidraw
     void
     unlock_resources(void);
 
+    /*!
+     * Returns the number of times that tiles or image resources of this
+     * ImageAtlas were freed or moved. Content that references
+     * locations of the atlas, such as a retained \ref
+     * PainterDisplayList, remains valid as long as the
+     * value does not change.
+     */
+    unsigned int
+    number_times_released(void) const;
+
     /*!
      * Queue a ResourceReleaseAction to be executed when resources are
      * not locked down, see lock_resources() and unlock_resources().
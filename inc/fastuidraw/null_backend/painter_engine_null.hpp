@@ -0,0 +1,357 @@
+/*!
+ * \file painter_engine_null.hpp
+ * \brief file painter_engine_null.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#ifndef FASTUIDRAW_PAINTER_ENGINE_NULL_HPP
+#define FASTUIDRAW_PAINTER_ENGINE_NULL_HPP
+
+#include <fastuidraw/painter/backend/painter_engine.hpp>
+#include <fastuidraw/glsl/painter_shader_registrar_glsl.hpp>
+
+namespace fastuidraw
+{
+  namespace null
+  {
+/*!\addtogroup NullBackend
+ * @{
+ */
+    /*!
+     * \brief
+     * A PainterEngineNull implements \ref PainterEngine without
+     * using any GPU API. Each \ref PainterDraw returned by the
+     * \ref PainterBackend objects it makes maps host memory; the
+     * data written to it is counted and optionally check-summed
+     * when it is unmapped and then discarded. The \ref GlyphAtlas,
+     * \ref ImageAtlas and \ref ColorStopAtlas are backed by host
+     * memory as well. The \ref PainterShaderRegistrar object returned
+     * by \ref painter_shader_registrar() derives from \ref
+     * glsl::PainterShaderRegistrarGLSL, so the shaders made for
+     * a GL backend can be registered to it, but no GLSL program
+     * is ever made from them.
+     */
+    class PainterEngineNull:
+      public glsl::PainterShaderRegistrarGLSLTypes,
+      public PainterEngine
+    {
+    public:
+      /*!
+       * \brief
+       * Enumeration of the values that a PainterEngineNull
+       * accumulates from all the \ref PainterBackend objects
+       * it made.
+       */
+      enum counter_t
+        {
+          /*!
+           * Number of times PainterBackend::map_draw() was called
+           */
+          counter_number_draws,
+
+          /*!
+           * Number of attributes written to PainterDraw::m_attributes
+           */
+          counter_number_attributes,
+
+          /*!
+           * Number of indices written to PainterDraw::m_indices
+           */
+          counter_number_indices,
+
+          /*!
+           * Number of headers used, i.e. the number of times the value
+           * written to PainterDraw::m_header_attributes changes from one
+           * attribute to the next (plus one for each PainterDraw with
+           * attributes).
+           */
+          counter_number_headers,
+
+          /*!
+           * Number of uvec4 blocks written to PainterDraw::m_store
+           */
+          counter_number_data_store_blocks,
+
+          /*!
+           * Number of calls to either PainterDraw::draw_break() method
+           */
+          counter_number_draw_break_calls,
+
+          /*!
+           * Number of calls to either PainterDraw::draw_break() method
+           * that returned true, i.e. that would have broken a draw call
+           * of a GPU backend.
+           */
+          counter_number_draw_breaks,
+
+          /*!
+           * Number of draw calls a GPU backend would have issued,
+           * i.e. for each PainterDraw, one plus the number of draw
+           * breaks of the PainterDraw if it has any indices.
+           */
+          counter_number_draw_calls,
+
+          /*!
+           * Number of times PainterBackend::on_pre_draw() was called
+           */
+          counter_number_render_targets,
+
+          number_counters
+        };
+
+      /*!
+       * \brief
+       * A Configuration gives parameters how to construct
+       * a PainterEngineNull.
+       */
+      class Configuration
+      {
+      public:
+        /*!
+         * Ctor.
+         */
+        Configuration(void);
+
+        /*!
+         * Copy ctor.
+         * \param obj value from which to copy
+         */
+        Configuration(const Configuration &obj);
+
+        ~Configuration();
+
+        /*!
+         * Assignment operator
+         * \param rhs value from which to copy
+         */
+        Configuration&
+        operator=(const Configuration &rhs);
+
+        /*!
+         * Swap operation
+         * \param obj object with which to swap
+         */
+        void
+        swap(Configuration &obj);
+
+        /*!
+         * The number of attributes each PainterDraw holds.
+         * Default value is 512 * 512.
+         */
+        unsigned int
+        attributes_per_buffer(void) const;
+
+        /*!
+         * Set the value for attributes_per_buffer(void) const
+         */
+        Configuration&
+        attributes_per_buffer(unsigned int);
+
+        /*!
+         * The number of indices each PainterDraw holds.
+         * Default value is (512 * 512 * 6) / 4.
+         */
+        unsigned int
+        indices_per_buffer(void) const;
+
+        /*!
+         * Set the value for indices_per_buffer(void) const
+         */
+        Configuration&
+        indices_per_buffer(unsigned int);
+
+        /*!
+         * The number of uvec4 blocks of the data store each
+         * PainterDraw holds. Default value is 1024 * 64.
+         */
+        unsigned int
+        data_blocks_per_store_buffer(void) const;
+
+        /*!
+         * Set the value for data_blocks_per_store_buffer(void) const
+         */
+        Configuration&
+        data_blocks_per_store_buffer(unsigned int);
+
+        /*!
+         * If true, a change of item or blend shader is considered to
+         * break a draw call as a GL backend does when its
+         * PainterEngineGL::ConfigurationGL::break_on_shader_change()
+         * is true. Default value is false.
+         */
+        bool
+        break_on_shader_change(void) const;
+
+        /*!
+         * Set the value for break_on_shader_change(void) const
+         */
+        Configuration&
+        break_on_shader_change(bool);
+
+        /*!
+         * The blend shader type preferred by the default
+         * shaders. Default value is \ref
+         * PainterBlendShader::dual_src.
+         */
+        enum PainterBlendShader::shader_type
+        preferred_blend_type(void) const;
+
+        /*!
+         * Set the value for preferred_blend_type(void) const
+         */
+        Configuration&
+        preferred_blend_type(enum PainterBlendShader::shader_type);
+
+        /*!
+         * If true, the data of each PainterDraw is added to the
+         * value returned by PainterEngineNull::checksum() when it
+         * is unmapped. Default value is false.
+         */
+        bool
+        compute_checksum(void) const;
+
+        /*!
+         * Set the value for compute_checksum(void) const
+         */
+        Configuration&
+        compute_checksum(bool);
+
+        /*!
+         * The number of uint32_t values the store of the
+         * GlyphAtlas initially holds. Default value is
+         * 1024 * 1024.
+         */
+        unsigned int
+        glyph_atlas_size(void) const;
+
+        /*!
+         * Set the value for glyph_atlas_size(void) const
+         */
+        Configuration&
+        glyph_atlas_size(unsigned int);
+
+        /*!
+         * The log2 of the width and height of the color
+         * store of the ImageAtlas. Default value is 9.
+         */
+        unsigned int
+        log2_image_atlas_dims(void) const;
+
+        /*!
+         * Set the value for log2_image_atlas_dims(void) const
+         */
+        Configuration&
+        log2_image_atlas_dims(unsigned int);
+
+        /*!
+         * The width of the store of the ColorStopAtlas.
+         * Default value is 1024.
+         */
+        unsigned int
+        colorstop_atlas_width(void) const;
+
+        /*!
+         * Set the value for colorstop_atlas_width(void) const
+         */
+        Configuration&
+        colorstop_atlas_width(unsigned int);
+
+      private:
+        void *m_d;
+      };
+
+      /*!
+       * Create a PainterEngineNull
+       * \param config parameters of the created PainterEngineNull
+       */
+      static
+      reference_counted_ptr<PainterEngineNull>
+      create(const Configuration &config = Configuration());
+
+      ~PainterEngineNull();
+
+      /*!
+       * Returns the Configuration passed to create().
+       */
+      const Configuration&
+      configuration_null(void) const;
+
+      /*!
+       * Returns the value of a counter accumulated since the
+       * creation of this PainterEngineNull or the last call to
+       * reset_counters().
+       * \param c which counter
+       */
+      uint64_t
+      counter(enum counter_t c) const;
+
+      /*!
+       * Write into a c_array<> all the counters, the array
+       * is indexed by \ref counter_t.
+       * \param dst location to which to write the counters
+       */
+      void
+      counters(c_array<uint64_t> dst) const;
+
+      /*!
+       * Returns the label of a counter.
+       * \param c which counter
+       */
+      static
+      c_string
+      counter_label(enum counter_t c);
+
+      /*!
+       * Returns the checksum of the data of each PainterDraw
+       * unmapped since the creation of this PainterEngineNull
+       * or the last call to reset_counters(). The checksum
+       * depends on the order in which the PainterDraw objects
+       * are unmapped, so it is only reproducible if a single
+       * \ref PainterBackend is used at a time; in addition the
+       * data packed from floating point computations can differ
+       * between builds (for example release and debug), so the
+       * checksum is only to be compared against values from the
+       * same build. If Configuration::compute_checksum() is false,
+       * returns 0.
+       */
+      uint64_t
+      checksum(void) const;
+
+      /*!
+       * Reset all counters and the checksum to 0.
+       */
+      void
+      reset_counters(void);
+
+      virtual
+      reference_counted_ptr<PainterBackend>
+      create_backend(void) const override;
+
+      virtual
+      reference_counted_ptr<PainterSurface>
+      create_surface(ivec2 dims,
+                     enum PainterSurface::render_type_t render_type) override;
+
+    private:
+      PainterEngineNull(const Configuration &config,
+                        const PainterShaderSet &shaders);
+
+      void *m_d;
+    };
+/*! @} */
+  }
+}
+
+#endif
@@ -220,6 +220,45 @@ public:
   Subset
   root_subset(void) const;
 
+  /*!
+   * Triangulates all \ref Subset objects of the FilledPath
+   * ahead of time, instead of lazily when they are first
+   * fetched by subset(), root_subset(), select_subsets() or
+   * select_subsets_no_culling(). The triangulation of the
+   * \ref Subset objects without children is done across
+   * threads, afterwards the merged data of the \ref Subset
+   * objects with children is made bottom-up. May be called
+   * from a thread other than the one using the FilledPath,
+   * but must not overlap Path::end_tessellation_frame().
+   * \param num_threads number of threads to use, including
+   *                    the calling thread
+   */
+  void
+  prepare(unsigned int num_threads) const;
+
+  /*!
+   * Triangulates ahead of time only those \ref Subset objects
+   * that select_subsets() would need for the passed arguments,
+   * i.e. warms the region visible through the clip equations.
+   * The triangulation of the \ref Subset objects without children
+   * is done across threads. May be called from a thread other
+   * than the one using the FilledPath, but must not overlap
+   * Path::end_tessellation_frame().
+   * \param clip_equations array of clip equations
+   * \param clip_matrix_local 3x3 transformation from local (x, y, 1)
+   *                          coordinates to clip coordinates.
+   * \param max_attribute_cnt as in select_subsets()
+   * \param max_index_cnt as in select_subsets()
+   * \param num_threads number of threads to use, including
+   *                    the calling thread
+   */
+  void
+  prepare(c_array<const vec3> clip_equations,
+          const float3x3 &clip_matrix_local,
+          unsigned int max_attribute_cnt,
+          unsigned int max_index_cnt,
+          unsigned int num_threads) const;
+
   /*!
    * Fetch those Subset objects that have triangles that
    * intersect a region specified by clip equations.
@@ -263,6 +302,87 @@ public:
   select_subsets_no_culling(unsigned int max_attribute_cnt,
                             unsigned int max_index_cnt,
                             c_array<unsigned int> dst) const;
+
+  /*!
+   * Returns the number of bytes used by the FilledPath to hold
+   * the triangulations of the \ref Subset objects made so far
+   * and the data from which to make those not yet made.
+   */
+  uint64_t
+  memory_usage(void) const;
+
+  /*!
+   * Saves the FilledPath to a file so that it can be restored
+   * by load() without triangulating, for example by a later run
+   * of an application whose paths do not change. All \ref Subset
+   * objects are triangulated before the file is written. The file
+   * is not portable across byte orders or versions of FastUIDraw.
+   * \param filename name of the file to which to write
+   */
+  enum return_code
+  save(c_string filename) const;
+
+  /*!
+   * Restores a FilledPath saved by save(). The attribute and
+   * index data of the \ref Subset objects is copied directly
+   * from the file, which is memory mapped where supported.
+   * Returns nullptr if the file cannot be read or was not
+   * written by save() of this version of FastUIDraw.
+   * \param filename name of the file from which to read
+   */
+  static
+  reference_counted_ptr<FilledPath>
+  load(c_string filename);
+
+  /*!
+   * Set if the triangulation of a \ref Subset whose contour is a
+   * single simple y-monotone contour (this includes convex contours)
+   * is done in linear time without GLU-tess. Such contours are the
+   * common case for UI shapes. The triangles generated differ from
+   * those of GLU-tess, but cover the same regions with the same
+   * winding numbers. Default value is true. Only affects the
+   * \ref Subset objects triangulated after the call.
+   */
+  static
+  void
+  fast_triangulation(bool v);
+
+  /*!
+   * Returns the value set by fast_triangulation(bool).
+   */
+  static
+  bool
+  fast_triangulation(void);
+
+  /*!
+   * Set if the triangulation by GLU-tess allocates its vertices,
+   * faces, edges and sweep line data from an arena that each
+   * thread keeps, instead of from the heap one at a time. The
+   * arena is rewound after each triangulation and reused by the
+   * next triangulation done on the same thread, so that making
+   * the \ref Subset objects of a FilledPath does only a handful
+   * of heap allocations. The triangles generated are the same
+   * either way. Default value is true.
+   */
+  static
+  void
+  triangulation_arena(bool v);
+
+  /*!
+   * Returns the value set by triangulation_arena(bool).
+   */
+  static
+  bool
+  triangulation_arena(void);
+
+  /*!
+   * Returns the number of heap allocations made by triangulation
+   * with GLU-tess, summed over all threads, since the process
+   * started.
+   */
+  static
+  uint64_t
+  triangulation_heap_allocation_count(void);
 private:
   friend class TessellatedPath;
 
@@ -270,6 +390,9 @@ private:
   explicit
   FilledPath(const TessellatedPath &P);
 
+  explicit
+  FilledPath(void *d);
+
   void *m_d;
 };
 
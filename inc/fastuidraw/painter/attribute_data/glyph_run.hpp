@@ -21,6 +21,7 @@
 
 #include <fastuidraw/util/matrix.hpp>
 #include <fastuidraw/util/c_array.hpp>
+#include <fastuidraw/util/rect.hpp>
 #include <fastuidraw/text/font.hpp>
 #include <fastuidraw/text/glyph.hpp>
 #include <fastuidraw/text/glyph_cache.hpp>
@@ -178,9 +179,12 @@ namespace fastuidraw
      * object for rendering a named range of glyphs for
      * a specified \ref GlyphRenderer. The returned object
      * is valid in value until this GlyphRun is destroyed or
-     * one of add_glyph(), add_glyphs(), subsequence() is called.
+     * one of add_glyph(), add_glyphs(), subsequence(),
+     * all_resident() is called.
      * The \ref PainterAttributeWriter will provide indices and
-     * attributes as packed by \ref attribute_packer().
+     * attributes as packed by \ref attribute_packer(). Glyphs
+     * that are not resident (see Glyph::resident()) when the
+     * data is written are skipped, see all_resident().
      * \param renderer how to render the glyphs
      * \param begin index to select which is the first glyph
      * \param count number of glyphs to take starting at begin
@@ -193,7 +197,8 @@ namespace fastuidraw
      * object for rendering all glyphs from a starting point
      * for a specified \ref GlyphRenderer. The returned object
      * is valid in value until this GlyphRun is destroyed or
-     * one of add_glyph(), add_glyphs(), subsequence() is called.
+     * one of add_glyph(), add_glyphs(), subsequence(),
+     * all_resident() is called.
      * The \ref PainterAttributeWriter will provide indices and
      * attributes as packed by \ref attribute_packer().
      * \param renderer how to render the glyphs
@@ -207,7 +212,8 @@ namespace fastuidraw
      * object for rendering the entire range of glyphs for
      * a specified \ref GlyphRenderer. The returned object
      * is valid in value until this GlyphRun is destroyed or
-     * one of add_glyph(), add_glyphs(), subsequence() is called.
+     * one of add_glyph(), add_glyphs(), subsequence(),
+     * all_resident() is called.
      * The \ref PainterAttributeWriter will provide indices and
      * attributes as packed by \ref attribute_packer().
      * \param renderer how to render the glyphs
@@ -215,6 +221,56 @@ namespace fastuidraw
     const PainterAttributeWriter&
     subsequence(GlyphRenderer renderer) const;
 
+    /*!
+     * Returns true if each \ref Glyph of a named range of
+     * glyphs for a specified \ref GlyphRenderer is resident
+     * (see Glyph::resident()). The \ref PainterAttributeWriter
+     * of subsequence() skips the glyphs that are not resident,
+     * which happens when the GlyphAtlas has an upload budget
+     * and the data of a glyph is still queued; a caller can
+     * then draw the range with a different \ref GlyphRenderer
+     * for that frame.
+     * \param renderer how to render the glyphs
+     * \param begin index to select which is the first glyph
+     * \param count number of glyphs to take starting at begin
+     */
+    bool
+    all_resident(GlyphRenderer renderer, unsigned int begin, unsigned int count) const;
+
+    /*!
+     * Equivalent to
+     * \code
+     * all_resident(renderer, 0, number_glyphs())
+     * \endcode
+     * \param renderer how to render the glyphs
+     */
+    bool
+    all_resident(GlyphRenderer renderer) const;
+
+    /*!
+     * Gives the bounding box of a named range of glyphs.
+     * A return value of false indicates that the bounding
+     * box is empty.
+     * \param begin index to select which is the first glyph
+     * \param count number of glyphs to take starting at begin
+     * \param out_bb_box location to which to write the
+     *                   bounding box
+     */
+    bool
+    bounding_box(unsigned int begin, unsigned int count, Rect *out_bb_box) const;
+
+    /*!
+     * Returns the \ref Glyph values of a named range of
+     * glyphs for a specified \ref GlyphRenderer. The returned
+     * array is valid until this GlyphRun is destroyed or
+     * one of add_glyph() or add_glyphs() is called.
+     * \param renderer how to render the glyphs
+     * \param begin index to select which is the first glyph
+     * \param count number of glyphs to take starting at begin
+     */
+    c_array<const Glyph>
+    rendered_glyphs(GlyphRenderer renderer, unsigned int begin, unsigned int count) const;
+
   private:
     void *m_d;
   };
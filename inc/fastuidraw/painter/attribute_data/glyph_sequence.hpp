@@ -67,7 +67,10 @@ namespace fastuidraw
        * value. The attribute data and index is generated by the
        * \ref  GlyphAttributePacker as returned by parents \ref
        * GlyphSequence::attribute_packer(). The data is constructed
-       * lazily on demand.
+       * lazily on demand. The data of glyphs that are not resident
+       * (see Glyph::resident()) is not included, see all_resident();
+       * in that case the arrays are valid until the next call to
+       * attributes_and_indices() for the same \ref GlyphRenderer.
        * \param render GlyphRenderer how to render the glyphs of this
        *               \ref Subset
        * \param out_attributes location to which to write the array
@@ -80,6 +83,28 @@ namespace fastuidraw
                              c_array<const PainterAttribute> *out_attributes,
                              c_array<const PainterIndex> *out_indices);
 
+      /*!
+       * Returns true if each \ref Glyph of this \ref Subset for
+       * a specified \ref GlyphRenderer is resident (see
+       * Glyph::resident()). The data of attributes_and_indices()
+       * skips the glyphs that are not resident, which happens when
+       * the GlyphAtlas has an upload budget and the data of a glyph
+       * is still queued.
+       * \param render GlyphRenderer how to render the glyphs of this
+       *               \ref Subset
+       */
+      bool
+      all_resident(GlyphRenderer render);
+
+      /*!
+       * Returns the \ref Glyph values of this \ref Subset
+       * for a specified \ref GlyphRenderer.
+       * \param render GlyphRenderer how to render the glyphs of this
+       *               \ref Subset
+       */
+      c_array<const Glyph>
+      rendered_glyphs(GlyphRenderer render);
+
       /*!
        * Returns an array of index values to pass to GlyphSequence::add_glyph()
        * of the glyphs of this \ref Subset.
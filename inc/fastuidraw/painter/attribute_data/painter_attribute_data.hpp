@@ -149,6 +149,13 @@ namespace fastuidraw
     range_type<int>
     z_range(unsigned int i) const;
 
+    /*!
+     * Returns the number of bytes used to hold the
+     * attribute, index, chunk and z-range data.
+     */
+    uint64_t
+    memory_usage(void) const;
+
   private:
     void *m_d;
   };
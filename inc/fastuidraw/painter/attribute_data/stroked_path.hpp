@@ -255,6 +255,33 @@ public:
   const PartitionedTessellatedPath&
   partitioned_path(void) const;
 
+  /*!
+   * Returns the number of bytes used by the StrokedPath to hold
+   * the attribute data of edges, joins and caps made so far; the
+   * bytes of partitioned_path() are not included.
+   */
+  uint64_t
+  memory_usage(void) const;
+
+  /*!
+   * Makes ahead of time the attribute data of the edges of all
+   * \ref Subset objects, of the joins and caps other than the
+   * rounded ones and of the rounded joins and caps of the
+   * coarsest threshhold, instead of lazily when first fetched.
+   * The independent pieces, i.e. the edges of each \ref Subset
+   * without children and each of the join and cap styles, are
+   * made across threads, afterwards the merged edge data of the
+   * \ref Subset objects with children is made bottom-up with the
+   * siblings of each level across threads. The data made is the
+   * same as when made lazily. Must not be called while the
+   * StrokedPath is used from another thread or while
+   * Path::end_tessellation_frame() runs.
+   * \param num_threads number of threads to use, including
+   *                    the calling thread
+   */
+  void
+  prepare(unsigned int num_threads) const;
+
   /*!
    * Returns the number of Subset objects of the StrokedPath.
    */
@@ -419,6 +446,33 @@ public:
                             unsigned int max_index_cnt,
                             SubsetSelection &dst) const;
 
+  /*!
+   * Saves the attribute data of the StrokedPath to a file so
+   * that a StrokedPath of the same path, for example in a later
+   * run of an application, can use it with load() instead of
+   * computing it. Before the file is written, all the data is
+   * made: the edges of each \ref Subset without children, each
+   * type of join and cap and the rounded joins and caps for each
+   * threshold already requested, or for 1.0 if none were. The
+   * file is not portable across byte orders or versions of
+   * FastUIDraw.
+   * \param filename name of the file to which to write
+   */
+  enum return_code
+  save(c_string filename) const;
+
+  /*!
+   * Uses the attribute data in a file written by save() for the
+   * attribute data of this StrokedPath that is not yet made; the
+   * attribute and index data is copied directly from the file,
+   * which is memory mapped where supported. Fails, without
+   * changing the StrokedPath, if the file cannot be read or was
+   * written by a StrokedPath whose \ref TessellatedPath differs.
+   * \param filename name of the file from which to read
+   */
+  enum return_code
+  load(c_string filename) const;
+
 private:
   friend class TessellatedPath;
 
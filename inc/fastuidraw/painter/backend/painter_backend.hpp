@@ -96,6 +96,26 @@ namespace fastuidraw
     unsigned int
     indices_per_mapping(void) const = 0;
 
+    /*!
+     * To be implemented by a derived class to return
+     * the number of uvec4 blocks of PainterDraw::m_store
+     * a PainterDraw returned by map_draw() is guaranteed
+     * to hold. A \ref Painter recording to a \ref
+     * PainterCommandList packs to mappings of this size
+     * so that each recorded segment fits into a single
+     * mapping when the list is merged. A return value of
+     * 0 indicates that the size is not known; a \ref Painter
+     * using such a backend fails every recording (see
+     * PainterCommandList::recording_failed()). Default
+     * implementation returns 0.
+     */
+    virtual
+    unsigned int
+    store_blocks_per_mapping(void) const
+    {
+      return 0;
+    }
+
     /*!
      * Called just before calling PainterDraw::draw() on a sequence
      * of PainterDraw objects who have had their PainterDraw::unmap()
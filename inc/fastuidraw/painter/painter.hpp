@@ -51,6 +51,8 @@
 #include <fastuidraw/painter/effects/painter_effect.hpp>
 
 #include <fastuidraw/painter/backend/painter_engine.hpp>
+#include <fastuidraw/painter/painter_command_list.hpp>
+#include <fastuidraw/painter/painter_display_list.hpp>
 
 namespace fastuidraw
 {
@@ -354,6 +356,38 @@ namespace fastuidraw
           enum screen_orientation orientation,
           bool clear_color_buffer = true);
 
+    /*!
+     * Indicate to start recording with methods of this Painter
+     * to a \ref PainterCommandList. The previous content of the
+     * list is cleared. The recording is complete when end() is
+     * called. Different Painter objects, each used from a single
+     * thread, can record to different PainterCommandList objects
+     * concurrently. See \ref PainterCommandList for what is not
+     * supported when recording.
+     * \param list PainterCommandList to which to record
+     * \param initial_transformation value to initialize transformation() which
+     *                               is the matrix from logical coordinates to
+     *                               API 3D clip coordinates.
+     */
+    void
+    begin(const reference_counted_ptr<PainterCommandList> &list,
+          const float3x3 &initial_transformation);
+
+    /*!
+     * Indicate to start recording with methods of this Painter
+     * to a \ref PainterCommandList with the transformation
+     * initialized from a screen_orientation and the dimensions
+     * of the list. Equivalent to begin(const reference_counted_ptr<PainterCommandList>&, const float3x3&)
+     * with the projection matrix that begin(const reference_counted_ptr<PainterSurface>&, enum screen_orientation, bool)
+     * computes.
+     * \param list PainterCommandList to which to record
+     * \param orientation orientation convention with which to initialize the
+     *                    transformation
+     */
+    void
+    begin(const reference_counted_ptr<PainterCommandList> &list,
+          enum screen_orientation orientation);
+
     /*!
      * Indicate to end drawing with methods of this Painter.
      * Drawing commands sent to 3D hardware are buffered and not
@@ -711,6 +745,35 @@ namespace fastuidraw
     float
     curve_flatness(void);
 
+    /*!
+     * Set the number of draws that are buffered in order to
+     * reorder them so that draws using the same shaders and
+     * blending are adjacent, reducing the number of draw breaks
+     * (see PainterEnums::num_draw_breaks_avoided). A draw is
+     * only moved in front of draws that it cannot change the
+     * result of: those whose bounding box, as computed by the
+     * Painter from the clipping and, for convex polygons and
+     * rects, the polygon itself, does not intersect its own, or,
+     * when neither blends, those whose z-values differ from its
+     * own so that the depth test decides what is visible. Draws
+     * are not reordered across queue_action(), image binds,
+     * occluders of clipping or content from draw_command_list()
+     * and draw_display_list(). Only the draws to the surface passed
+     * to begin() are reordered, not draws within layers (see
+     * begin_layer()). A value of 0, the default, disables
+     * reordering; the value takes effect immediately, or, when
+     * recording to a \ref PainterCommandList, when the recording
+     * ends.
+     */
+    void
+    draw_reorder_window(unsigned int v);
+
+    /*!
+     * Returns the value set by draw_reorder_window(unsigned int).
+     */
+    unsigned int
+    draw_reorder_window(void) const;
+
     /*!
      * Save the current state of this Painter onto the save state stack.
      * The state is restored (and the stack popped) by called restore().
@@ -1731,6 +1794,37 @@ namespace fastuidraw
     void
     queue_action(const reference_counted_ptr<const PainterDrawBreakAction> &action);
 
+    /*!
+     * Add the content recorded to a \ref PainterCommandList.
+     * The data of the list is copied and its headers relocated;
+     * the current transformation, clipping, brush and blend
+     * state of this Painter do not affect the content, except
+     * that nothing is added when the current clipping culls
+     * all content (as for draw_display_list()). The
+     * content is drawn above everything drawn before and
+     * below everything drawn after. The list must have been
+     * recorded by a Painter of the same \ref PainterEngine.
+     * \param list recorded content to draw
+     */
+    void
+    draw_command_list(const PainterCommandList &list);
+
+    /*!
+     * Draw the content of a \ref PainterDisplayList under the
+     * current transformation and clipping. If the list retains
+     * content that can be drawn under them, the retained data
+     * is copied with only the item matrices and clip equations
+     * it references replaced; otherwise the content is recorded
+     * again first (see \ref PainterDisplayList for when that
+     * happens). As with draw_command_list(), the brush and blend
+     * state of this Painter do not affect the content and the
+     * content is drawn above everything drawn before and below
+     * everything drawn after.
+     * \param list display list to draw
+     */
+    void
+    draw_display_list(const PainterDisplayList &list);
+
     /*!
      * Returns a stat on how much data the Packer has
      * handled in the last begin()/end() pair. Calling
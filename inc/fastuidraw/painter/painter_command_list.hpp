@@ -0,0 +1,168 @@
+/*!
+ * \file painter_command_list.hpp
+ * \brief file painter_command_list.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+
+#ifndef FASTUIDRAW_PAINTER_COMMAND_LIST_HPP
+#define FASTUIDRAW_PAINTER_COMMAND_LIST_HPP
+
+#include <fastuidraw/util/reference_counted.hpp>
+#include <fastuidraw/util/vecN.hpp>
+
+namespace fastuidraw
+{
+///@cond
+  class Painter;
+///@endcond
+
+/*!\addtogroup Painter
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A PainterCommandList holds the attribute, index and data store
+   * content that a \ref Painter packed when recording to it instead
+   * of to a \ref PainterSurface. Because the packing is done when
+   * recording, independent content can be recorded to different
+   * PainterCommandList objects from different threads (each thread
+   * using its own \ref Painter) and then merged in order with
+   * Painter::draw_command_list() on the thread that renders;
+   * merging only copies the data and relocates the offsets within
+   * the headers of the recorded draws.
+   *
+   * Recording to a PainterCommandList has the following limitations:
+   *  - there is no deferred coverage buffer nor offscreen layers;
+   *    requesting shader based anti-aliasing, drawing with a shader
+   *    that needs a deferred coverage buffer or calling begin_layer()
+   *    with an effect that has passes fails the recording, see
+   *    recording_failed().
+   *  - recording fails if the \ref PainterBackend of the recording
+   *    Painter does not report its PainterBackend::store_blocks_per_mapping().
+   *  - the clipping and transformation of the Painter that merges
+   *    the list do not apply to the content of the list; the
+   *    dimensions of the list should match the viewport of the
+   *    surface onto which it is merged.
+   *  - glyphs that are not resident (see Glyph::resident())
+   *    when recorded are skipped, see all_glyphs_resident().
+   *  - objects that cache per-Painter packing state, such as
+   *    \ref PainterPackedValue values from a \ref PainterPackedValuePool,
+   *    must not be used by several threads that record at the
+   *    same time.
+   *
+   * A PainterCommandList does not keep the atlases of the \ref
+   * PainterEngine of the recording Painter locked past Painter::end().
+   * Instead it pins the glyphs it draws (see GlyphCache::pin_glyphs())
+   * and holds a reference to the images and color stops of the
+   * shader data it draws until the list is cleared, re-recorded or
+   * destroyed. Removing a drawn glyph from the \ref GlyphCache with
+   * GlyphCache::delete_glyph(), GlyphCache::clear_atlas() or
+   * GlyphCache::clear_cache() invalidates the content of the list.
+   */
+  class PainterCommandList:
+    public reference_counted<PainterCommandList>::concurrent
+  {
+  public:
+    /*!
+     * Ctor.
+     * \param dimensions dimensions of the viewport content
+     *                   is recorded against
+     */
+    explicit
+    PainterCommandList(ivec2 dimensions);
+
+    ~PainterCommandList();
+
+    /*!
+     * Returns the dimensions passed in the ctor.
+     */
+    ivec2
+    dimensions(void) const;
+
+    /*!
+     * Returns true if there is no recorded content.
+     */
+    bool
+    empty(void) const;
+
+    /*!
+     * Returns the number of PainterDraw objects that the
+     * recording filled; merging the list requires at most
+     * that number of PainterDraw objects.
+     */
+    unsigned int
+    number_segments(void) const;
+
+    /*!
+     * Returns the number of attributes recorded.
+     */
+    unsigned int
+    number_attributes(void) const;
+
+    /*!
+     * Returns the number of indices recorded.
+     */
+    unsigned int
+    number_indices(void) const;
+
+    /*!
+     * Returns the number of uvec4 blocks of data
+     * store recorded.
+     */
+    unsigned int
+    number_store_blocks(void) const;
+
+    /*!
+     * Returns the number of z-values the recorded
+     * content uses.
+     */
+    int
+    z_extent(void) const;
+
+    /*!
+     * Returns false if the recording skipped glyphs because
+     * they were not resident (see Glyph::resident()); such a
+     * list should be recorded again in a later frame.
+     */
+    bool
+    all_glyphs_resident(void) const;
+
+    /*!
+     * Returns true if the recording met content that a
+     * PainterCommandList cannot hold (see the limitations
+     * above); in that case the list holds no content and
+     * the content should be drawn directly to a Painter
+     * instead.
+     */
+    bool
+    recording_failed(void) const;
+
+    /*!
+     * Clear the recorded content, unpin its glyphs and
+     * release the resources it holds.
+     */
+    void
+    clear(void);
+
+  private:
+    friend class Painter;
+    void *m_d;
+  };
+/*! @} */
+}
+
+#endif
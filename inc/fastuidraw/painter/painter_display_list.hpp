@@ -0,0 +1,153 @@
+/*!
+ * \file painter_display_list.hpp
+ * \brief file painter_display_list.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+
+#ifndef FASTUIDRAW_PAINTER_DISPLAY_LIST_HPP
+#define FASTUIDRAW_PAINTER_DISPLAY_LIST_HPP
+
+#include <fastuidraw/util/reference_counted.hpp>
+
+namespace fastuidraw
+{
+///@cond
+  class Painter;
+///@endcond
+
+/*!\addtogroup Painter
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A PainterDisplayList retains the packed attribute, index
+   * and data store content of a sequence of \ref Painter calls
+   * so that content which does not change from frame to frame
+   * is not re-packed each frame. The sequence of calls is given
+   * by implementing draw_content(); Painter::draw_display_list()
+   * records the content the first time it is drawn and from then
+   * on copies the retained data, only rewriting the transformation
+   * and clipping values the headers of the content reference.
+   *
+   * The content is recorded again when it is drawn under:
+   *  - a transformation whose magnification differs from that of
+   *    the transformation under which it was recorded by more
+   *    than magnification_tolerance(), because the level of detail
+   *    Painter chooses for paths and glyphs depends on it,
+   *  - a transformation different from that of the recording when
+   *    either has perspective,
+   *  - a viewport of different dimensions or a \ref Painter of a
+   *    different \ref PainterEngine,
+   *  - any of the glyph, image or colorstop atlases of the \ref
+   *    PainterEngine having freed or moved data since the content
+   *    was recorded (see GlyphAtlas::number_times_released()).
+   *    The retained content does not keep the atlases locked, so
+   *    that they can evict and compact between frames.
+   *  - the previous recording having skipped glyphs that were
+   *    not resident (see PainterCommandList::all_glyphs_resident()).
+   * Unless the transformation has perspective, the content is
+   * recorded without culling against the viewport so that any
+   * part of it can be shown by a later transformation.
+   *
+   * Because the content is recorded to a \ref PainterCommandList,
+   * the limitations listed for PainterCommandList apply to the
+   * content of a PainterDisplayList as well, except that the
+   * transformation and clipping of the Painter that draws a
+   * PainterDisplayList do apply. If the recording fails (see
+   * PainterCommandList::recording_failed()), for example because
+   * draw_content() uses shader anti-aliasing or layers, then
+   * draw_content() is called directly on the Painter that draws
+   * the list every time it is drawn until clear() is called. If draw_content() clips, the
+   * clipping it adds is not intersected against the clipping of
+   * the Painter that draws the list; when a region it clips to is
+   * not within that clipping, draw_content() is called directly
+   * on that Painter instead of using the retained content.
+   */
+  class PainterDisplayList:
+    public reference_counted<PainterDisplayList>::concurrent
+  {
+  public:
+    /*!
+     * Ctor.
+     */
+    PainterDisplayList(void);
+
+    virtual
+    ~PainterDisplayList();
+
+    /*!
+     * To be implemented by a derived class to issue the draws
+     * of the content to a Painter. The painter passed is within
+     * a begin()/end() pair and draw_content() is to leave the
+     * transformation and clipping stack of the Painter as it
+     * was passed. The transformation is the transformation of
+     * the Painter that draws the list at the time the content
+     * is recorded.
+     * \param painter Painter to which to draw the content
+     */
+    virtual
+    void
+    draw_content(Painter &painter) const = 0;
+
+    /*!
+     * Clear the retained content so that the next draw of the
+     * list records it again; call this whenever what draw_content()
+     * draws changes.
+     */
+    void
+    clear(void);
+
+    /*!
+     * Returns the factor by which the magnification of the
+     * transformation under which the list is drawn may differ
+     * from the magnification of the transformation under which
+     * the content was recorded before the content is recorded
+     * again. Default value is 1.25.
+     */
+    float
+    magnification_tolerance(void) const;
+
+    /*!
+     * Set the value returned by magnification_tolerance(const).
+     * Values less than 1.0 are clamped to 1.0 which means that
+     * only a change of transformation that does not change the
+     * magnification uses the retained content.
+     */
+    PainterDisplayList&
+    magnification_tolerance(float v);
+
+    /*!
+     * Returns the number of times the content has been recorded.
+     */
+    unsigned int
+    number_recordings(void) const;
+
+    /*!
+     * Returns the number of times the retained content has
+     * been drawn without recording it.
+     */
+    unsigned int
+    number_replays(void) const;
+
+  private:
+    friend class Painter;
+    void *m_d;
+  };
+/*! @} */
+}
+
+#endif
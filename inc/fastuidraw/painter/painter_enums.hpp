@@ -827,6 +827,13 @@ namespace fastuidraw
          * Number of begin_coverage_buffer()/end_coverage_buffer() pairs called
          */
         num_deferred_coverages,
+
+        /*!
+         * Number of changes of shader group, each of which is
+         * a draw break the backend may need, that were avoided
+         * by reordering draws, see Painter::draw_reorder_window().
+         */
+        num_draw_breaks_avoided,
       };
 
     /*!
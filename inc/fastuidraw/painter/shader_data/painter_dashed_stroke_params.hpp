@@ -33,7 +33,22 @@ namespace fastuidraw
    * \brief
    * Class to specify dashed stroking parameters, data is packed
    * as according to PainterDashedStrokeParams::stroke_data_offset_t.
-   * Data for dashing is packed [TODO describe].
+   * The dash pattern is packed after the static data, starting at
+   * the next block of the data store, as levels of a tree where
+   * each block of the data store is a node with four children:
+   * - level 0 is the prefix sums of the lengths of the dash
+   *   pattern, i.e. for each DashPatternElement the distance
+   *   along the pattern where its draw interval ends and then
+   *   the distance where its space interval ends, padded to a
+   *   multiple of four with a value larger than the length of
+   *   the pattern.
+   * - level k + 1 has, for each block of level k, the last value
+   *   of that block padded to a multiple of four as level 0 is.
+   * The levels are packed one after the other starting with level
+   * 0 and the last level is a single block. If level 0 has B
+   * blocks, then level k has B / 4^k blocks rounded up. This
+   * allows a shader to find the interval of a distance along the
+   * dash pattern by reading one block of each level.
    */
   class PainterDashedStrokeParams:public PainterItemShaderData
   {
@@ -251,6 +251,13 @@ namespace fastuidraw  {
     bool
     has_arcs(void) const;
 
+    /*!
+     * Returns the number of bytes used to hold the segment,
+     * join and cap data of all of the \ref Subset objects.
+     */
+    uint64_t
+    memory_usage(void) const;
+
     /*!
      * Returns the number of Subset objects of the StrokedPath.
      */
@@ -308,6 +315,27 @@ namespace fastuidraw  {
                    c_array<const float> geometry_inflation,
                    bool select_miter_joins,
                    SubsetSelection &dst) const;
+
+    /*!
+     * Set the number of threads, including the calling thread,
+     * that construction of a PartitionedTessellatedPath may use.
+     * When a \ref Subset with many segments is split, its two
+     * children are made on separate threads until the threads
+     * are used up. The \ref Subset objects made, including their
+     * ID's, are the same regardless of the number of threads.
+     * Default value is 1.
+     */
+    static
+    void
+    number_build_threads(unsigned int v);
+
+    /*!
+     * Returns the value set by number_build_threads(unsigned int).
+     */
+    static
+    unsigned int
+    number_build_threads(void);
+
   private:
     friend class TessellatedPath;
 
@@ -32,6 +32,13 @@
 
 namespace fastuidraw  {
 
+///@cond
+namespace detail
+{
+  class ContourTessellationCache;
+}
+///@endcond
+
 /*!\addtogroup Paths
  * @{
  */
@@ -45,9 +52,14 @@ namespace fastuidraw  {
  * close_generic() and close_arc()) means to specify
  * the edge from the last point of the PathContour
  * to the first point.
+ *
+ * The reference counts of a PathContour and of its interpolators
+ * are atomic because a PathContour can be shared by several \ref
+ * Path objects and can be used by the worker thread that refines
+ * a tessellation (see Path::background_refinement(bool)).
  */
 class PathContour:
-    public reference_counted<PathContour>::non_concurrent
+    public reference_counted<PathContour>::concurrent
 {
 public:
   /*!
@@ -56,7 +68,7 @@ public:
    * of a \ref interpolator_base derived object.
    */
   class tessellation_state:
-    public reference_counted<tessellation_state>::non_concurrent
+    public reference_counted<tessellation_state>::concurrent
   {
   public:
     /*!
@@ -92,7 +104,7 @@ public:
    * the shape of an edge.
    */
   class interpolator_base:
-    public reference_counted<interpolator_base>::non_concurrent
+    public reference_counted<interpolator_base>::concurrent
   {
   public:
     /*!
@@ -417,10 +429,44 @@ public:
     unsigned int
     minimum_tessellation_recursion(void) const;
 
+    /*!
+     * For quadratic and cubic curves, performs the same recursion
+     * as interpolator_generic::produce_tessellation() on fixed size
+     * arrays of control points instead of through tessellate(). In
+     * addition, when refining to a positive tolerance, a region whose
+     * arc does not meet the tolerance is drawn as two line segments
+     * instead of being subdivided further if Wang's formula shows that
+     * those line segments meet the tolerance. Curves of higher degree,
+     * or all curves if fast_tessellation() is false, use
+     * interpolator_generic::produce_tessellation().
+     */
+    virtual
+    reference_counted_ptr<tessellation_state>
+    produce_tessellation(const TessellatedPath::TessellationParams &tess_params,
+                         TessellatedPath::SegmentStorage *out_data,
+                         float *out_max_distance) const;
+
     virtual
     enum return_code
     add_to_builder(ShaderFilledPath::Builder *builder, float tol) const;
 
+    /*!
+     * Set if quadratic and cubic curves are tessellated with
+     * the fixed size arrays of produce_tessellation(). Default
+     * value is true. Only affects tessellations made after the
+     * call.
+     */
+    static
+    void
+    fast_tessellation(bool v);
+
+    /*!
+     * Returns the value set by fast_tessellation(bool).
+     */
+    static
+    bool
+    fast_tessellation(void);
+
   private:
     void *m_d;
   };
@@ -657,6 +703,12 @@ public:
   deep_copy(void) const;
 
 private:
+  friend class TessellatedPath;
+  friend class Path;
+
+  detail::ContourTessellationCache&
+  tessellation_cache(void) const;
+
   void *m_d;
 };
 
@@ -1020,7 +1072,8 @@ public:
 
   /*!
    * Adds a PathContour to this Path. The current contour remains
-   * as the current contour though.
+   * as the current contour though. If contour is not ended, then
+   * a copy of it that is ended is added.
    * \param contour PathContour to add to the Path
    */
   Path&
@@ -1033,6 +1086,29 @@ public:
   Path&
   add_contours(const Path &path);
 
+  /*!
+   * Replace a PathContour of this Path. Tessellations of the Path
+   * made after the replacement re-tessellate only the replaced
+   * contour; the tessellation of each ended PathContour is kept
+   * with the PathContour. If contour is not ended, then a copy
+   * of it that is ended is used. If the last contour is replaced,
+   * later edits to the current contour start a new contour.
+   * \param i index of contour to replace (0 <= i < number_contours())
+   * \param contour PathContour to take the place of contour(i)
+   */
+  Path&
+  replace_contour(unsigned int i,
+                  const reference_counted_ptr<const PathContour> &contour);
+
+  /*!
+   * Remove a PathContour from this Path. Tessellations of the Path
+   * made after the removal do not re-tessellate any of the ended
+   * contours that remain.
+   * \param i index of contour to remove (0 <= i < number_contours())
+   */
+  Path&
+  remove_contour(unsigned int i);
+
   /*!
    * Returns the number of contours of the Path.
    */
@@ -1070,11 +1146,28 @@ public:
    * \param thresh the returned tessellated path will be so that
    *               TessellatedPath::max_distance() is no more than
    *               thresh. A non-positive value will return the
-   *               lowest level of detail tessellation.
+   *               lowest level of detail tessellation. If
+   *               background_refinement() is true, the returned
+   *               tessellation may be coarser than thresh, see
+   *               background_refinement(bool).
    */
   const TessellatedPath&
   tessellation(float thresh) const;
 
+  /*!
+   * Equivalent to tessellation(float) const and additionally
+   * reports if the returned tessellation meets the tolerance.
+   * \param thresh requested tolerance as in tessellation(float) const
+   * \param out_meets_tolerance if non-null, location to which to write
+   *                            true if TessellatedPath::max_distance()
+   *                            of the returned tessellation is no more
+   *                            than thresh or if thresh is non-positive.
+   *                            Note that refinement stops at a recursion
+   *                            limit, so a tolerance may never be met.
+   */
+  const TessellatedPath&
+  tessellation(float thresh, bool *out_meets_tolerance) const;
+
   /*!
    * Provided as a conveniance, returns the starting point tessellation.
    * Equivalent to
@@ -1085,6 +1178,85 @@ public:
   const TessellatedPath&
   tessellation(void) const;
 
+  /*!
+   * Set if refining the tessellation to a finer level of detail
+   * is done on a worker thread. When true, tessellation(float) const
+   * does not wait for refinement: it returns the finest tessellation
+   * already available that meets the requested tolerance, or if none
+   * does, the finest one available, and queues refining to a worker
+   * thread. The worker threads are shared by all Path objects and
+   * their number is bounded, so refinement of many Path objects at
+   * once is queued rather than run all at the same time. Later calls
+   * return the finer tessellations as the worker makes them. Changing
+   * the Path cancels its refinement, setting the value back to false
+   * waits for the worker. Default value is false.
+   */
+  void
+  background_refinement(bool v);
+
+  /*!
+   * Returns the value set by background_refinement(bool).
+   */
+  bool
+  background_refinement(void) const;
+
+  /*!
+   * Returns the number of bytes used by the tessellations of this
+   * Path that tessellation(float) const has made, by the objects,
+   * such as \ref FilledPath and \ref StrokedPath, made from them
+   * and by the tessellations of its contours kept so that the Path
+   * is tessellated again faster after it is edited.
+   */
+  uint64_t
+  tessellation_memory_usage(void) const;
+
+  /*!
+   * Returns the sum of tessellation_memory_usage() across all Path
+   * objects; the kept tessellation of a \ref PathContour shared by
+   * several Path objects is counted once.
+   */
+  static
+  uint64_t
+  total_tessellation_memory_usage(void);
+
+  /*!
+   * Set the memory budget, in bytes, for the tessellations of all
+   * Path objects; a value of 0 means there is no budget. Default
+   * value is 0. The budget is applied by end_tessellation_frame().
+   */
+  static
+  void
+  tessellation_memory_budget(uint64_t bytes);
+
+  /*!
+   * Returns the value set by tessellation_memory_budget(uint64_t).
+   */
+  static
+  uint64_t
+  tessellation_memory_budget(void);
+
+  /*!
+   * Ends the current frame. If total_tessellation_memory_usage() exceeds
+   * tessellation_memory_budget(), data is released until the budget
+   * is met, starting with the tessellations least recently returned
+   * by tessellation(float) const. First the \ref FilledPath, \ref
+   * StrokedPath and other objects made from those tessellations are
+   * released, then the tessellations kept by the \ref PathContour
+   * objects for tessellating an edited Path again and then the
+   * tessellations themselves; all are made again when next requested.
+   * Data returned during the frame that is ending and the data of a
+   * Path whose background refinement is still running are not
+   * released. References to released objects are no longer valid
+   * unless a reference_counted_ptr to the object is held. Must not
+   * be called while another thread uses a Path or an object made
+   * from its tessellations; in particular it must not overlap
+   * FilledPath::prepare() or StrokedPath::prepare(), which fill
+   * data that this releases.
+   */
+  static
+  void
+  end_tessellation_frame(void);
+
   /*!
    * Returns the \ref ShaderFilledPath coming from this
    * Path. The returned reference will be null if the
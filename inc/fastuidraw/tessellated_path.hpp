@@ -60,7 +60,7 @@ class PartitionedTessellatedPath;
  * is the last edge.
  */
 class TessellatedPath:
-    public reference_counted<TessellatedPath>::non_concurrent
+    public reference_counted<TessellatedPath>::concurrent
 {
 public:
   /*!
@@ -940,6 +940,30 @@ public:
   const PartitionedTessellatedPath&
   partitioned(void) const;
 
+  /*!
+   * Returns the number of bytes used by this \ref TessellatedPath
+   * together with derived_memory_usage().
+   */
+  uint64_t
+  memory_usage(void) const;
+
+  /*!
+   * Returns the number of bytes used by the objects made so far
+   * by linearization(), stroked(), filled() and partitioned().
+   */
+  uint64_t
+  derived_memory_usage(void) const;
+
+  /*!
+   * Releases the objects made by linearization(), stroked(),
+   * filled() and partitioned(); they are made again when next
+   * requested. References to those objects fetched before are
+   * no longer valid unless a reference_counted_ptr to the
+   * object is held.
+   */
+  void
+  release_derived_data(void) const;
+
 private:
   TessellatedPath(Refiner *p, float threshhold,
                   unsigned int additional_recursion_count);
@@ -186,6 +186,48 @@ namespace fastuidraw
     compute_rendering_data(GlyphRenderer render, GlyphMetrics glyph_metrics,
                            Path &path, vec2 &render_size) const = 0;
 
+    /*!
+     * To be optionally implemented by a derived class to compute
+     * only the Path that compute_rendering_data() writes for the
+     * same arguments, without the glyph rendering data. Used for
+     * glyphs whose rendering data comes from a cache that does not
+     * store the path (see GlyphCache::load_disk_cache()). Default
+     * implementation calls compute_rendering_data() and deletes
+     * the returned data.
+     * \param render as in compute_rendering_data()
+     * \param glyph_metrics as in compute_rendering_data()
+     * \param[out] path location to which to write the Path of the glyph
+     */
+    virtual
+    void
+    compute_path(GlyphRenderer render, GlyphMetrics glyph_metrics,
+                 Path &path) const;
+
+    /*!
+     * To be optionally implemented by a derived class to return
+     * a hash of the data from which the font is sourced (for
+     * example the contents of the font file). Together with
+     * face_index() the value identifies the font across runs
+     * of a program and is used to key glyph rendering data
+     * saved to disk (see GlyphCache::load_disk_cache()). A
+     * return value of 0 indicates that the glyph rendering data
+     * of the font is not to be saved to or loaded from disk.
+     * Default implementation returns 0.
+     */
+    virtual
+    uint64_t
+    content_hash(void) const;
+
+    /*!
+     * To be optionally implemented by a derived class to return
+     * the index of the face within the data from which the font
+     * is sourced, see content_hash(). Default implementation
+     * returns 0.
+     */
+    virtual
+    int
+    face_index(void) const;
+
   private:
     void *m_d;
   };
@@ -44,9 +44,9 @@ namespace fastuidraw
      *                        used by the FontFreeType object.
      * \param plib the FreeTypeLib of the FreeTypeFace created by the FontFreeType,
      *             a null values indicates to use a private FreeTypeLib object
-     * \param num_faces number of underlying faces for the FontFreeType to possess,
-     *                  this is the number of simumtaneous requests the FontFreeType
-     *                  can handle
+     * \param num_faces maximum number of underlying faces for the FontFreeType
+     *                  to possess, this is the number of simumtaneous requests
+     *                  the FontFreeType can handle (see max_number_faces())
      */
     FontFreeType(const reference_counted_ptr<FreeTypeFace::GeneratorBase> &pface_generator,
                  const reference_counted_ptr<FreeTypeLib> &plib = reference_counted_ptr<FreeTypeLib>(),
@@ -59,9 +59,9 @@ namespace fastuidraw
      * \param props FontProperties with which to endow the created FontFreeType object
      * \param plib the FreeTypeLib of the FreeTypeFace created by the FontFreeType,
      *             a null values indicates to use a private FreeTypeLib object
-     * \param num_faces number of underlying faces for the FontFreeType to possess,
-     *                  this is the number of simumtaneous requests the FontFreeType
-     *                  can handle
+     * \param num_faces maximum number of underlying faces for the FontFreeType
+     *                  to possess, this is the number of simumtaneous requests
+     *                  the FontFreeType can handle (see max_number_faces())
      */
     FontFreeType(const reference_counted_ptr<FreeTypeFace::GeneratorBase> &pface_generator,
                  const FontProperties &props,
@@ -84,6 +84,79 @@ namespace fastuidraw
     const reference_counted_ptr<FreeTypeLib>&
     lib(void) const;
 
+    /*!
+     * Set the maximum number of FT_Face objects of the pool from
+     * which the FontFreeType takes a face for each request (glyph
+     * generation, metrics, glyph code look up). The faces are
+     * created on demand and a request that finds all faces in use
+     * when the pool is at its maximum blocks until one is released.
+     * Lowering the value does not release faces already created.
+     * Initial value is the num_faces parameter of the ctor.
+     * \param v maximum number of faces, values of 0 are taken as 1
+     */
+    void
+    max_number_faces(unsigned int v);
+
+    /*!
+     * Returns the value set by max_number_faces(unsigned int).
+     */
+    unsigned int
+    max_number_faces(void) const;
+
+    /*!
+     * Returns the number of FT_Face objects created, including
+     * those made by per_thread_faces(bool).
+     */
+    unsigned int
+    number_faces(void) const;
+
+    /*!
+     * If true, each thread making requests to the FontFreeType
+     * is given its own FT_Face, created on first use and kept
+     * until the FontFreeType is destroyed, so that requests from
+     * different threads never wait on each other. These faces do
+     * not count against max_number_faces(). Default is false.
+     */
+    void
+    per_thread_faces(bool v);
+
+    /*!
+     * Returns the value set by per_thread_faces(bool).
+     */
+    bool
+    per_thread_faces(void) const;
+
+    /*!
+     * Returns the number of requests for a face since creation
+     * or the last call to reset_face_pool_counters().
+     */
+    unsigned int
+    number_face_acquires(void) const;
+
+    /*!
+     * Returns the number of times a request had to wait for a
+     * face to be released since creation or the last call to
+     * reset_face_pool_counters(); if this is a large fraction of
+     * number_face_acquires(), increase max_number_faces().
+     */
+    unsigned int
+    number_face_waits(void) const;
+
+    /*!
+     * Returns the total time, in microseconds, requests spent
+     * waiting for a face to be released since creation or the
+     * last call to reset_face_pool_counters().
+     */
+    uint64_t
+    face_wait_time_us(void) const;
+
+    /*!
+     * Reset number_face_acquires(), number_face_waits() and
+     * face_wait_time_us() to zero.
+     */
+    void
+    reset_face_pool_counters(void);
+
     /*!
      * Fill the field of a FontProperties from the values of an FT_Face.
      * Beware that the foundary name is not assigned!
@@ -155,6 +228,24 @@ namespace fastuidraw
     compute_rendering_data(GlyphRenderer render, GlyphMetrics glyph_metrics,
                            Path &path, vec2 &render_size) const override final;
 
+    virtual
+    void
+    compute_path(GlyphRenderer render, GlyphMetrics glyph_metrics,
+                 Path &path) const override final;
+
+    /*!
+     * Returns a hash of the contents of the font file
+     * for fonts that are TrueType or OpenType; for other
+     * fonts returns 0.
+     */
+    virtual
+    uint64_t
+    content_hash(void) const override final;
+
+    virtual
+    int
+    face_index(void) const override final;
+
   private:
     void *m_d;
   };
@@ -140,6 +140,19 @@ namespace fastuidraw
     bool
     uploaded_to_atlas(void) const;
 
+    /*!
+     * Returns true if and only if the Glyph is uploaded to
+     * a GlyphAtlas and its data is written to the backing
+     * store of the GlyphAtlas, i.e. the Glyph is ready to be
+     * drawn. When the GlyphAtlas has an upload budget (see
+     * GlyphAtlas::upload_byte_budget(unsigned int)), the data
+     * of an uploaded Glyph may still be queued; a caller can
+     * then draw the Glyph with a different \ref GlyphRenderer
+     * (for example a coverage glyph) for that frame.
+     */
+    bool
+    resident(void) const;
+
     /*!
      * Returns the path of the Glyph; the path is in
      * coordinates of the glyph with the convention
@@ -51,7 +51,7 @@ namespace fastuidraw
      * Returns the number of uint32_t backed by the store.
      */
     unsigned int
-    size(void);
+    size(void) const;
 
     /*!
      * To be implemented by a derived class to load
@@ -78,6 +78,29 @@ namespace fastuidraw
     void
     resize(unsigned int new_size);
 
+    /*!
+     * To be optionally implemented by a derived class to
+     * indicate that copy_values() is supported. Default
+     * implementation returns false. GlyphAtlas::compact()
+     * requires that the store can copy values.
+     */
+    virtual
+    bool
+    can_copy_values(void) const;
+
+    /*!
+     * To be implemented by a derived class whose can_copy_values()
+     * returns true to copy values within the store. The source and
+     * destination ranges do not overlap. Default implementation
+     * asserts.
+     * \param dst location to which to copy
+     * \param src location from which to copy
+     * \param count number of uint32_t values to copy
+     */
+    virtual
+    void
+    copy_values(unsigned int dst, unsigned int src, unsigned int count);
+
   protected:
     /*!
      * Ctor.
@@ -107,11 +130,100 @@ namespace fastuidraw
    * an application. Ideally, all glyph data is placed into a
    * single GlyphAtlas. Methods of GlyphAtlas are thread safe,
    * protected behind atomics and a mutex within the GlyphAtlas.
+   *
+   * By default, allocate_data() writes the data to the backing
+   * store immediately. If an upload budget is set (see
+   * upload_byte_budget(unsigned int) and upload_time_budget_us(unsigned int)),
+   * the data is instead queued and written by flush() within
+   * the budget of the current upload frame (see begin_upload_frame()),
+   * spreading the cost of uploading many glyphs across frames.
+   * Whether the data of an allocation is written to the backing
+   * store is queried with upload_resident().
    */
   class GlyphAtlas:
     public reference_counted<GlyphAtlas>::concurrent
   {
   public:
+    /*!
+     * \brief
+     * Enumeration of the statistics of a GlyphAtlas, see
+     * query_stats(). The values up to \ref num_compactions
+     * are counters that are reset by reset_stats(); the
+     * values after are the current state of the GlyphAtlas.
+     */
+    enum stats_t
+      {
+        /*!
+         * Number of regions allocated by allocate_data()
+         */
+        num_allocations,
+
+        /*!
+         * Number of regions deallocated by deallocate_data()
+         */
+        num_deallocations,
+
+        /*!
+         * Number of bytes written to the backing store
+         * by allocate_data()
+         */
+        num_bytes_uploaded,
+
+        /*!
+         * Number of bytes copied within the backing
+         * store by compact()
+         */
+        num_bytes_moved,
+
+        /*!
+         * Number of times the backing store was resized
+         */
+        num_resizes,
+
+        /*!
+         * Number of times the GlyphAtlas was cleared,
+         * see clear()
+         */
+        num_clears,
+
+        /*!
+         * Number of times compact() moved data
+         */
+        num_compactions,
+
+        /*!
+         * Current value of data_allocated()
+         */
+        current_data_allocated,
+
+        /*!
+         * Current size of the backing store
+         */
+        current_store_size,
+
+        /*!
+         * Current free room, i.e. \ref current_store_size
+         * minus \ref current_data_allocated. The atlas is
+         * fragmented when this is much larger than \ref
+         * current_largest_free_interval.
+         */
+        current_free_room,
+
+        /*!
+         * Current value of largest_free_interval()
+         */
+        current_largest_free_interval,
+
+        /*!
+         * Current number of bytes of allocated data that are
+         * queued to be written to the backing store by flush(),
+         * see upload_byte_budget(unsigned int).
+         */
+        current_bytes_pending,
+
+        number_stats
+      };
+
     /*!
      * Ctor.
      * \param pstore GlyphAtlasBackingStoreBase to which to store  data
@@ -123,16 +235,30 @@ namespace fastuidraw
     ~GlyphAtlas();
 
     /*!
-     * Negative return value indicates failure.
+     * Allocate and set data on the GlyphAtlas. Negative return
+     * value indicates failure.
+     * \param pdata data to place on the GlyphAtlas
+     * \param allow_resize if true and there is no free region
+     *                     large enough for pdata, the backing
+     *                     store is resized to make room; if false
+     *                     the allocation fails instead.
      */
     int
-    allocate_data(c_array<const uint32_t> pdata);
+    allocate_data(c_array<const uint32_t> pdata, bool allow_resize = true);
 
     /*!
      * Deallocate data
+     * \param location location of data as returned by allocate_data()
+     * \param count number of uint32_t values allocated
+     * \param allow_delay if true and the resources are locked
+     *                    (see lock_resources()), the deallocation
+     *                    is delayed until the resources are unlocked.
+     *                    If false, the region is freed immediately;
+     *                    the caller must guarantee that no pending
+     *                    draw commands reference the data.
      */
     void
-    deallocate_data(int location, int count);
+    deallocate_data(int location, int count, bool allow_delay = true);
 
     /*!
      * Returns how much  data has been allocated
@@ -140,6 +266,52 @@ namespace fastuidraw
     unsigned int
     data_allocated(void);
 
+    /*!
+     * Returns the size of the largest region that can be
+     * allocated without resizing the backing store. When
+     * this is much smaller than the free room (the size of
+     * store() minus data_allocated()), the atlas is
+     * fragmented and compact() can be used.
+     */
+    unsigned int
+    largest_free_interval(void);
+
+    /*!
+     * Returns the lowest location of the backing store that
+     * is free, or the size of the backing store if all of it
+     * is allocated. compact() never moves a region that is
+     * before this location.
+     */
+    int
+    lowest_free_location(void);
+
+    /*!
+     * Moves a set of allocated regions towards the start of the
+     * backing store so that the free room is in as few regions as
+     * possible. Allocated regions not in the set are kept where
+     * they are. The data of each moved region is copied with
+     * GlyphAtlasBackingStoreBase::copy_values(), the caller is
+     * responsible for updating any values that refer to the moved
+     * locations. Fails if the backing store cannot copy values or
+     * if the resources are locked (see lock_resources()), since
+     * pending draw commands may reference the old locations.
+     * \param regions regions to move, each as returned by
+     *                allocate_data() together with its size;
+     *                regions must not overlap
+     * \param[out] out_locations location to which to write
+     *                           the new location of each region;
+     *                           must be the same size as regions
+     */
+    enum return_code
+    compact(c_array<const range_type<int> > regions,
+            c_array<int> out_locations);
+
+    /*!
+     * Returns the number of times compact() has moved data.
+     */
+    unsigned int
+    number_times_compacted(void) const;
+
     /*!
      * Frees all allocated regions of this GlyphAtlas;
      */
@@ -153,12 +325,116 @@ namespace fastuidraw
     number_times_cleared(void) const;
 
     /*!
-     * Calls GlyphAtlasBackingStoreBase::flush() on
-     * the  backing store (see store()).
+     * Returns the number of times that regions of this
+     * GlyphAtlas were freed or moved. Content that references
+     * locations of the atlas, such as a retained \ref
+     * PainterDisplayList, remains valid as long as the
+     * value does not change.
+     */
+    unsigned int
+    number_times_released(void) const;
+
+    /*!
+     * Returns the value of a statistic of this GlyphAtlas.
+     * \param st statistic to query
+     */
+    uint64_t
+    query_stat(enum stats_t st) const;
+
+    /*!
+     * Write into a c_array<> a snapshot of the statistics of
+     * this GlyphAtlas, indexed by \ref stats_t. The counters
+     * are updated atomically but independently, so a snapshot
+     * taken while other threads use the GlyphAtlas may mix
+     * values from slightly different times.
+     * \param dst location to which to write the values; at
+     *            most \ref number_stats values are written
+     */
+    void
+    query_stats(c_array<uint64_t> dst) const;
+
+    /*!
+     * Reset to zero the statistics that are counters.
+     */
+    void
+    reset_stats(void);
+
+    /*!
+     * Returns a \ref c_string for an enumerated value.
+     * \param st value to get the label-string of.
+     */
+    static
+    c_string
+    label(enum stats_t st);
+
+    /*!
+     * Writes queued data to the backing store within the budget
+     * of the current upload frame and then calls
+     * GlyphAtlasBackingStoreBase::flush() on the backing store
+     * (see store()). At least one queued allocation is written
+     * per upload frame so that uploading always progresses.
      */
     void
     flush(void) const;
 
+    /*!
+     * Set the maximum number of bytes that flush() writes to
+     * the backing store per upload frame (see begin_upload_frame()).
+     * A value of 0 means no byte limit. If both this and
+     * upload_time_budget_us() are 0, allocate_data() writes to
+     * the backing store immediately. Default value is 0.
+     * \param v budget in bytes
+     */
+    void
+    upload_byte_budget(unsigned int v);
+
+    /*!
+     * Returns the value set by upload_byte_budget(unsigned int).
+     */
+    unsigned int
+    upload_byte_budget(void) const;
+
+    /*!
+     * Set the maximum time, in microseconds, that flush() spends
+     * writing to the backing store per upload frame (see
+     * begin_upload_frame()). A value of 0 means no time limit.
+     * Default value is 0.
+     * \param v budget in microseconds
+     */
+    void
+    upload_time_budget_us(unsigned int v);
+
+    /*!
+     * Returns the value set by upload_time_budget_us(unsigned int).
+     */
+    unsigned int
+    upload_time_budget_us(void) const;
+
+    /*!
+     * Start a new upload frame, resetting the amount of the
+     * upload budget that is spent. Called by GlyphCache::begin_frame().
+     */
+    void
+    begin_upload_frame(void);
+
+    /*!
+     * Returns a ticket that is not less than the ticket of each
+     * allocation made by allocate_data() so far; pass the value
+     * to upload_resident() to query if the data of those
+     * allocations is written to the backing store.
+     */
+    uint64_t
+    last_upload_ticket(void) const;
+
+    /*!
+     * Returns true if the data of all allocations whose
+     * ticket is no more than the passed ticket has been
+     * written to the backing store.
+     * \param ticket value as returned by last_upload_ticket()
+     */
+    bool
+    upload_resident(uint64_t ticket) const;
+
     /*!
      * Returns the store for this GlyphAtlas.
      */
@@ -43,6 +43,144 @@ namespace fastuidraw
   class GlyphCache:public reference_counted<GlyphCache>::concurrent
   {
   public:
+    /*!
+     * \brief
+     * Enumeration of the statistics of a GlyphCache, see
+     * query_stats(). All values are counters that are
+     * reset by reset_stats(). The statistics of the atlas
+     * backing the glyphs are given by GlyphAtlas::query_stats().
+     */
+    enum stats_t
+      {
+        /*!
+         * Number of glyphs fetched that were already
+         * in the cache
+         */
+        num_glyph_hits,
+
+        /*!
+         * Number of glyphs fetched that were not yet
+         * in the cache; these are generated or taken
+         * from the disk cache
+         */
+        num_glyph_misses,
+
+        /*!
+         * Number of glyphs whose rendering data was taken
+         * from the disk cache instead of generated
+         */
+        num_disk_cache_hits,
+
+        /*!
+         * Number of glyph metrics fetched that were
+         * already in the cache
+         */
+        num_metrics_hits,
+
+        /*!
+         * Number of glyph metrics fetched that were
+         * not yet in the cache
+         */
+        num_metrics_misses,
+
+        /*!
+         * Number of times the rendering data of a
+         * \ref coverage_glyph was computed
+         */
+        num_coverage_glyphs_generated,
+
+        /*!
+         * Number of times the rendering data of a
+         * \ref distance_field_glyph was computed
+         */
+        num_distance_field_glyphs_generated,
+
+        /*!
+         * Number of times the rendering data of a
+         * \ref restricted_rays_glyph was computed
+         */
+        num_restricted_rays_glyphs_generated,
+
+        /*!
+         * Number of times the rendering data of a
+         * \ref banded_rays_glyph was computed
+         */
+        num_banded_rays_glyphs_generated,
+
+        /*!
+         * Nanoseconds spent in FontBase::compute_rendering_data()
+         * for \ref coverage_glyph glyphs, summed across threads
+         */
+        coverage_generation_ns,
+
+        /*!
+         * Nanoseconds spent in FontBase::compute_rendering_data()
+         * for \ref distance_field_glyph glyphs, summed across threads
+         */
+        distance_field_generation_ns,
+
+        /*!
+         * Nanoseconds spent in FontBase::compute_rendering_data()
+         * for \ref restricted_rays_glyph glyphs, summed across threads
+         */
+        restricted_rays_generation_ns,
+
+        /*!
+         * Nanoseconds spent in FontBase::compute_rendering_data()
+         * for \ref banded_rays_glyph glyphs, summed across threads
+         */
+        banded_rays_generation_ns,
+
+        /*!
+         * Number of times a glyph was uploaded to the atlas
+         */
+        num_glyphs_uploaded,
+
+        /*!
+         * Number of glyphs evicted from the atlas to
+         * make room, see atlas_size_limit(unsigned int)
+         */
+        num_glyphs_evicted,
+
+        /*!
+         * Number of eviction passes, i.e. the number of times
+         * uploading a glyph required evicting other glyphs,
+         * see atlas_size_limit(unsigned int)
+         */
+        num_eviction_passes,
+
+        /*!
+         * Number of uint32_t values of the GlyphAtlas
+         * freed by evicting glyphs
+         */
+        num_data_evicted,
+
+        /*!
+         * Number of times the rendering data of a glyph
+         * evicted from the atlas was generated again to
+         * upload the glyph
+         */
+        num_glyphs_regenerated,
+
+        /*!
+         * Number of times clear_atlas() was called
+         */
+        num_atlas_clears,
+
+        /*!
+         * Number of times clear_cache() was called
+         */
+        num_cache_clears,
+
+        /*!
+         * Number of times the atlas was compacted, either
+         * by compact_atlas() or to avoid growing the atlas
+         */
+        num_atlas_compactions,
+
+        number_stats
+      };
+
     /*!
      * An AllocationHandle represents a handle to data allocated
      * on the underlying GlyphAtlas of a GlyphCache. The handle
@@ -84,6 +222,85 @@ namespace fastuidraw
       unsigned int m_location, m_size;
     };
 
+    class PrefetchTicket;
+
+    /*!
+     * A PrefetchCallback is notified when the glyphs of a call
+     * to prefetch_glyphs() have all been generated.
+     */
+    class PrefetchCallback:
+      public reference_counted<PrefetchCallback>::concurrent
+    {
+    public:
+      virtual
+      ~PrefetchCallback()
+      {}
+
+      /*!
+       * To be implemented by a derived class to react to the
+       * completion of a prefetch. Called from the thread of
+       * the GlyphCache that completed the last glyphs of the
+       * prefetch; that thread holds no lock of the GlyphCache.
+       * \param ticket the ticket of the prefetch that completed
+       */
+      virtual
+      void
+      on_prefetch_complete(const PrefetchTicket &ticket) = 0;
+    };
+
+    /*!
+     * A PrefetchTicket tracks the progress of a call to
+     * prefetch_glyphs().
+     */
+    class PrefetchTicket:
+      public reference_counted<PrefetchTicket>::concurrent
+    {
+    public:
+      ~PrefetchTicket();
+
+      /*!
+       * Returns true if all the glyphs of the prefetch have been
+       * generated, or if the prefetch was cancelled because the
+       * GlyphCache was destroyed.
+       */
+      bool
+      done(void) const;
+
+      /*!
+       * Returns true if the prefetch was cancelled before all
+       * of its glyphs were generated.
+       */
+      bool
+      cancelled(void) const;
+
+      /*!
+       * Blocks until done() returns true.
+       */
+      void
+      wait(void) const;
+
+      /*!
+       * Returns the number of glyphs of the prefetch.
+       */
+      unsigned int
+      number_glyphs(void) const;
+
+      /*!
+       * Returns the number of glyphs of the prefetch
+       * whose rendering data has been generated.
+       */
+      unsigned int
+      number_glyphs_generated(void) const;
+
+    private:
+      friend class GlyphCache;
+
+      explicit
+      PrefetchTicket(void *d);
+
+      void *m_d;
+    };
+
     /*!
      * Ctor
      * \param patlas GlyphAtlas to store glyph data
@@ -147,6 +364,10 @@ namespace fastuidraw
      * \param[out] out_glyphs location to which to write the glyphs;
      *                        the size must be the same as glyph_codes
      * \param upload_to_atlas if true, upload glyphs to atlas
+     *
+     * If another thread removes a glyph from the cache (see
+     * clear_cache() and delete_glyph()) while it is fetched, the
+     * element of out_glyphs for the glyph is an invalid Glyph.
      */
     void
     fetch_glyphs(GlyphRenderer render, const FontBase *font,
@@ -163,6 +384,10 @@ namespace fastuidraw
      * \param[out] out_glyphs location to which to write the glyphs;
      *                        the size must be the same as glyph_codes
      * \param upload_to_atlas if true, upload glyphs to atlas
+     *
+     * If another thread removes a glyph from the cache (see
+     * clear_cache() and delete_glyph()) while it is fetched, the
+     * element of out_glyphs for the glyph is an invalid Glyph.
      */
     void
     fetch_glyphs(GlyphRenderer render,
@@ -179,6 +404,10 @@ namespace fastuidraw
      * \param[out] out_glyphs location to which to write the glyphs;
      *                        the size must be the same as glyph_codes
      * \param upload_to_atlas if true, upload glyphs to atlas
+     *
+     * If another thread removes a glyph from the cache (see
+     * clear_cache() and delete_glyph()) while it is fetched, the
+     * element of out_glyphs for the glyph is an invalid Glyph.
      */
     void
     fetch_glyphs(GlyphRenderer render,
@@ -186,6 +415,45 @@ namespace fastuidraw
                  c_array<Glyph> out_glyphs,
                  bool upload_to_atlas = true);
 
+    /*!
+     * Queue the generation of the rendering data of a sequence
+     * of glyphs onto the prefetch threads of the GlyphCache
+     * (see prefetch_thread_count()) and return immediately.
+     * The glyphs are generated but not uploaded to the GlyphAtlas;
+     * uploading happens when the glyphs are later fetched (for
+     * example on the rendering thread), which then does not need
+     * to wait for compute_rendering_data(). If a glyph is fetched
+     * while a prefetch thread is generating it, the fetch waits for
+     * that generation instead of starting another. The fonts of the
+     * glyphs are referenced until the prefetch completes.
+     * \param render renderer of the glyphs
+     * \param glyph_sources sequence of \ref GlyphSource values
+     * \param callback if non-null, called when the prefetch completes
+     */
+    reference_counted_ptr<PrefetchTicket>
+    prefetch_glyphs(GlyphRenderer render,
+                    c_array<const GlyphSource> glyph_sources,
+                    const reference_counted_ptr<PrefetchCallback> &callback
+                    = reference_counted_ptr<PrefetchCallback>());
+
+    /*!
+     * Set the number of threads used to generate glyphs queued
+     * by prefetch_glyphs(). The threads are created on the first
+     * call to prefetch_glyphs(). Changing the value waits for the
+     * glyphs that the current threads are generating; queued glyphs
+     * are kept and generated by the new threads. Default value is
+     * one less than the number of hardware threads, but at least 1.
+     * \param v number of threads, a value of 0 is treated as 1
+     */
+    void
+    prefetch_thread_count(unsigned int v);
+
+    /*!
+     * Returns the value set by prefetch_thread_count(unsigned int).
+     */
+    unsigned int
+    prefetch_thread_count(void) const;
+
     /*!
      * Add a Glyph created with Glyph::create_glyph() to
      * this GlyphCache. Will fail if a Glyph with the
@@ -223,13 +491,278 @@ namespace fastuidraw
     clear_atlas(void);
 
     /*!
-     * Returns the number of times that this GlyphCache cleared
-     * its GlyphAtlas (i.e. the number of times clear_atlas() or
-     * clear_cache() have been called).
+     * Compact the backing GlyphAtlas by moving the data of glyphs
+     * towards the start of the atlas so that the free room of the
+     * atlas is in as few intervals as possible; the attributes of
+     * the moved glyphs are updated and the value returned by
+     * number_times_atlas_cleared() changes so that objects that
+     * derived data from the attributes know to regenerate it.
+     * Data allocated with allocate_data() and glyphs whose
+     * attributes cannot be relocated stay where they are. Fails
+     * if the GlyphAtlasBackingStoreBase of the atlas cannot copy
+     * values, during a frame (see begin_frame()) or while the
+     * resources of the atlas are locked. When the atlas is at
+     * its size limit (see atlas_size_limit()), compaction is also
+     * tried before evicting glyphs if no frame is active. Which
+     * attribute values of a glyph hold atlas locations is found
+     * the first time a compaction needs to move the glyph, which
+     * generates the rendering data of the glyph again unless the
+     * glyph was recorded to or taken from the disk cache (see
+     * record_to_disk_cache(bool) and load_disk_cache()).
+     */
+    enum return_code
+    compact_atlas(void);
+
+    /*!
+     * Returns the glyphs whose data was moved by the last
+     * compaction of the atlas (see compact_atlas()). The
+     * returned array is valid until the next call to
+     * glyphs_moved_by_last_compaction().
+     */
+    c_array<const Glyph>
+    glyphs_moved_by_last_compaction(void);
+
+    /*!
+     * Returns the number of times that glyphs of this GlyphCache
+     * lost their backing on the GlyphAtlas, i.e. the number of
+     * times clear_atlas() or clear_cache() have been called plus
+     * the number of eviction passes (see atlas_size_limit()) and
+     * the number of compactions that moved glyphs (see
+     * compact_atlas()).
+     * Objects that have derived data from glyph locations in the
+     * atlas use this value to know that their data needs to be
+     * regenerated.
      */
     unsigned int
     number_times_atlas_cleared(void);
 
+    /*!
+     * Set the size limit (in number of uint32_t values) of the
+     * backing store of the GlyphAtlas. When a glyph is uploaded
+     * and there is no room for it and the backing store is already
+     * at least this size, then instead of growing the backing store
+     * the GlyphCache evicts glyphs from the GlyphAtlas in least
+     * recently used order until the upload fits. Glyphs used in
+     * the current frame (see begin_frame()) and pinned glyphs (see
+     * pin_glyphs()) are never evicted; if evicting all other glyphs
+     * is not enough, the backing store is grown. A value of 0,
+     * the default, indicates that there is no limit and glyphs
+     * are never evicted.
+     */
+    void
+    atlas_size_limit(unsigned int v);
+
+    /*!
+     * Returns the value set by atlas_size_limit(unsigned int).
+     */
+    unsigned int
+    atlas_size_limit(void) const;
+
+    /*!
+     * Marks the start of a frame; Painter::begin() calls this
+     * on the GlyphCache of its PainterEngine. Calls may nest
+     * (for example several Painter objects sharing a GlyphCache);
+     * a frame lasts from the first begin_frame() to the matching
+     * end_frame(). Glyphs used during a frame, i.e. fetched,
+     * uploaded or passed to mark_glyphs_used(), are protected
+     * from eviction until the frame ends. Starting a frame
+     * also starts a new upload frame of the GlyphAtlas (see
+     * GlyphAtlas::begin_upload_frame()).
+     */
+    void
+    begin_frame(void);
+
+    /*!
+     * Marks the end of a frame started by begin_frame();
+     * Painter::end() calls this after the draw commands
+     * are sent to the GPU.
+     */
+    void
+    end_frame(void);
+
+    /*!
+     * Marks a sequence of glyphs as used in the current frame
+     * which updates their least-recently-used position and
+     * protects them from eviction until the end of the frame.
+     * This does not lock any mutex.
+     * \param glyphs glyphs to mark, the glyphs must be from
+     *               this GlyphCache
+     */
+    void
+    mark_glyphs_used(c_array<const Glyph> glyphs);
+
+    /*!
+     * Pins a sequence of glyphs: until the returned value is
+     * passed to unpin_glyphs(), the data of the glyphs on the
+     * GlyphAtlas is neither evicted (see atlas_size_limit())
+     * nor moved by compact_atlas(). This is how content that
+     * references the glyph data across frames, such as a
+     * recorded \ref PainterCommandList, keeps it valid without
+     * keeping the GlyphAtlas locked. A glyph may be pinned
+     * several times. The pins do not prevent delete_glyph(),
+     * clear_atlas() or clear_cache() from removing the data.
+     * Returns 0 if glyphs is empty.
+     * \param glyphs glyphs to pin, the glyphs must be from
+     *               this GlyphCache
+     */
+    uint64_t
+    pin_glyphs(c_array<const Glyph> glyphs);
+
+    /*!
+     * Releases the pins made by a call to pin_glyphs().
+     * \param pin value returned by pin_glyphs()
+     */
+    void
+    unpin_glyphs(uint64_t pin);
+
+    /*!
+     * Provided as a conveniance, equivalent to
+     * \code
+     * query_stat(num_eviction_passes)
+     * \endcode
+     */
+    unsigned int
+    number_eviction_passes(void) const
+    {
+      return query_stat(num_eviction_passes);
+    }
+
+    /*!
+     * Provided as a conveniance, equivalent to
+     * \code
+     * query_stat(num_glyphs_evicted)
+     * \endcode
+     */
+    unsigned int
+    number_glyphs_evicted(void) const
+    {
+      return query_stat(num_glyphs_evicted);
+    }
+
+    /*!
+     * Provided as a conveniance, equivalent to
+     * \code
+     * query_stat(num_data_evicted)
+     * \endcode
+     */
+    unsigned int
+    data_evicted(void) const
+    {
+      return query_stat(num_data_evicted);
+    }
+
+    /*!
+     * Load glyph rendering data saved by save_disk_cache(). The file
+     * is memory mapped and its glyphs are used in place of generating
+     * the rendering data of glyphs (and computing their metrics) when
+     * they are fetched. A glyph is keyed by FontBase::content_hash(),
+     * FontBase::face_index(), its glyph code and its GlyphRenderer;
+     * fonts whose FontBase::content_hash() is 0 are never taken from
+     * the disk cache. Glyphs taken from the disk cache do not have
+     * their Glyph::path() computed until it is first called. May be
+     * called several times to load several files; if a glyph is in
+     * several of the files, the first loaded is used. Returns
+     * routine_fail if the file does not exist, is corrupt, or was
+     * written with a different file version or with different
+     * GlyphGenerateParams values.
+     * \param filename file to load
+     */
+    enum return_code
+    load_disk_cache(c_string filename);
+
+    /*!
+     * Save to a file the glyph rendering data loaded with
+     * load_disk_cache() together with the data of glyphs
+     * recorded (see record_to_disk_cache(bool)). The file is
+     * written to a temporary file first which is then renamed
+     * to filename.
+     * \param filename file to which to save
+     */
+    enum return_code
+    save_disk_cache(c_string filename);
+
+    /*!
+     * If true, glyphs that are generated are recorded when they
+     * are uploaded to the GlyphAtlas so that they are saved by
+     * save_disk_cache(). Recording costs uploading the glyph
+     * data twice more to memory. Default value is false.
+     */
+    void
+    record_to_disk_cache(bool v);
+
+    /*!
+     * Returns the value set by record_to_disk_cache(bool).
+     */
+    bool
+    record_to_disk_cache(void) const;
+
+    /*!
+     * Provided as a conveniance, equivalent to
+     * \code
+     * query_stat(num_disk_cache_hits)
+     * \endcode
+     */
+    unsigned int
+    number_disk_cache_hits(void) const
+    {
+      return query_stat(num_disk_cache_hits);
+    }
+
+    /*!
+     * If true, the metrics of the glyphs of each font are also
+     * kept in a table indexed by glyph code with one entry per
+     * glyph of the font (see FontBase::number_glyphs()). Once
+     * the metrics of a glyph are in the table, fetching them
+     * with fetch_glyph_metrics() does not lock. The tables are
+     * freed by clear_cache(), which waits for the fetches that
+     * do not lock and are in progress to finish. Default value
+     * is false.
+     */
+    void
+    dense_glyph_metrics(bool v);
+
+    /*!
+     * Returns the value set by dense_glyph_metrics(bool).
+     */
+    bool
+    dense_glyph_metrics(void) const;
+
+    /*!
+     * Returns the value of a statistic of this GlyphCache.
+     * \param st statistic to query
+     */
+    uint64_t
+    query_stat(enum stats_t st) const;
+
+    /*!
+     * Write into a c_array<> a snapshot of the statistics of
+     * this GlyphCache, indexed by \ref stats_t. The counters
+     * are updated atomically but independently, so a snapshot
+     * taken while other threads use the GlyphCache may mix
+     * values from slightly different times.
+     * \param dst location to which to write the values; at
+     *            most \ref number_stats values are written
+     */
+    void
+    query_stats(c_array<uint64_t> dst) const;
+
+    /*!
+     * Reset all statistics to zero; this includes the values
+     * returned by number_disk_cache_hits(), number_eviction_passes(),
+     * number_glyphs_evicted() and data_evicted(). Does not affect
+     * the value returned by number_times_atlas_cleared().
+     */
+    void
+    reset_stats(void);
+
+    /*!
+     * Returns a \ref c_string for an enumerated value.
+     * \param st value to get the label-string of.
+     */
+    static
+    c_string
+    label(enum stats_t st);
+
     /*!
      * Clear this GlyphCache and the GlyphAtlas backing the glyphs.
      * Thus all previous \ref Glyph and \ref GlyphMetrics values
@@ -254,6 +787,10 @@ namespace fastuidraw
     deallocate_data(AllocationHandle h);
 
   private:
+    static
+    void
+    compute_relocations(void *glyph);
+
     void *m_d;
   };
 /*! @} */
@@ -170,6 +170,67 @@ namespace fastuidraw
      */
     enum return_code
     banded_rays_average_number_curves_thresh(float v);
+
+    /*!
+     * Number of threads across which to split the lines of
+     * texels when generating distance field glyphs (see \ref
+     * GlyphRenderDataTexels). The generated data does not
+     * depend on this value, thus it can be changed even if
+     * there are \ref FontBase derived objects alive.
+     */
+    unsigned int
+    distance_field_generation_threads(void);
+
+    /*!
+     * Set the value returned by
+     * distance_field_generation_threads(void) const,
+     * initial value is 1. Always returns \ref routine_success.
+     * \param v value
+     */
+    enum return_code
+    distance_field_generation_threads(unsigned int v);
+
+    /*!
+     * If true, use SIMD instructions (when the library is
+     * built with them available) when generating distance
+     * field glyphs (see \ref GlyphRenderDataTexels). The
+     * generated data does not depend on this value, thus
+     * it can be changed even if there are \ref FontBase
+     * derived objects alive.
+     */
+    bool
+    distance_field_simd(void);
+
+    /*!
+     * Set the value returned by distance_field_simd(void) const,
+     * initial value is true. Always returns \ref routine_success.
+     * \param v value
+     */
+    enum return_code
+    distance_field_simd(bool v);
+
+    /*!
+     * If true, generate distance field glyphs (see \ref
+     * GlyphRenderDataTexels) with the reference generator
+     * that processes the texels one at a time on a single
+     * thread, ignoring distance_field_generation_threads()
+     * and distance_field_simd(). It is slower and is there
+     * to test and benchmark the default generator against.
+     * The generated data does not depend on this value,
+     * thus it can be changed even if there are \ref
+     * FontBase derived objects alive.
+     */
+    bool
+    distance_field_reference_generator(void);
+
+    /*!
+     * Set the value returned by
+     * distance_field_reference_generator(void) const,
+     * initial value is false. Always returns \ref routine_success.
+     * \param v value
+     */
+    enum return_code
+    distance_field_reference_generator(bool v);
   }
 }
 
@@ -1,6 +1,10 @@
 FASTUIDRAW_DEPS_LIBS += $(shell pkg-config freetype2 --libs)
 FASTUIDRAW_DEPS_STATIC_LIBS += $(shell pkg-config freetype2 --static --libs)
 
+# GlyphCache uses std::thread for prefetching glyphs
+FASTUIDRAW_DEPS_LIBS += -pthread
+FASTUIDRAW_DEPS_STATIC_LIBS += -pthread
+
 FASTUIDRAW_BASE_CFLAGS = -std=c++11
 FASTUIDRAW_debug_BASE_CFLAGS = $(FASTUIDRAW_BASE_CFLAGS) -DFASTUIDRAW_DEBUG
 FASTUIDRAW_release_BASE_CFLAGS = $(FASTUIDRAW_BASE_CFLAGS)
@@ -0,0 +1,81 @@
+BENCH_COMMON_CFLAGS = -Ibenchmarks/common -Idemos/common
+BENCH_COMMON_LIBS = -pthread
+
+BENCH_release_CFLAGS = -O3 -fstrict-aliasing $(BENCH_COMMON_CFLAGS)
+BENCH_debug_CFLAGS = -g $(BENCH_COMMON_CFLAGS)
+
+# $1 --> debug or release
+define benchbuildrules
+$(eval BENCH_$(1)_CFLAGS_ALL = $$(BENCH_$(1)_CFLAGS) $$(shell ./fastuidraw-config.nodir --$(1) --cflags --incdir=inc)
+BENCH_$(1)_LIBS = $$(shell ./fastuidraw-config.nodir --$(1) --libs --libdir=.)
+BENCH_$(1)_NULL_LIBS = $$(shell ./fastuidraw-config.nodir --$(1) --null --libs --libdir=.)
+
+build/bench/$(1)/%.o: %.cpp build/bench/$(1)/%.d fastuidraw-config.nodir
+	@mkdir -p $$(dir $$@)
+	$(CXX) $$(BENCH_$(1)_CFLAGS_ALL) -pthread -MT $$@ -MMD -MP -MF build/bench/$(1)/$$*.d -c $$< -o $$@
+
+build/bench/$(1)/%.d: ;
+.PRECIOUS: build/bench/$(1)/%.d
+)
+endef
+
+# $1 --> benchmark name
+# $2 --> release or debug
+define benchrule
+$(eval THISBENCH_$(1)_$(2)_SOURCES = $$($(1)_SOURCES) $$(COMMON_BENCH_SOURCES)
+THISBENCH_$(1)_$(2)_DEPS = $$(patsubst %.cpp, build/bench/$(2)/%.d, $$(THISBENCH_$(1)_$(2)_SOURCES))
+THISBENCH_$(1)_$(2)_OBJS = $$(patsubst %.cpp, build/bench/$(2)/%.o, $$(THISBENCH_$(1)_$(2)_SOURCES))
+CLEAN_FILES += $$(THISBENCH_$(1)_$(2)_OBJS) $(1)-$(2) $(1)-$(2).exe
+SUPER_CLEAN_FILES += $$(THISBENCH_$(1)_$(2)_DEPS)
+-include $$(THISBENCH_$(1)_$(2)_DEPS)
+benchmarks-$(2): $(1)-$(2)
+.PHONY: benchmarks-$(2)
+$(1): $(1)-$(2)
+.PHONY: $(1)
+ifeq ($$($(1)_NULL_BACKEND),1)
+$(1)-$(2): libFastUIDraw_$(2) libFastUIDrawNull_$(2) $$(THISBENCH_$(1)_$(2)_OBJS)
+	$$(CXX) -o $$@ $$(THISBENCH_$(1)_$(2)_OBJS) $$(BENCH_$(2)_NULL_LIBS) $(BENCH_COMMON_LIBS)
+else
+$(1)-$(2): libFastUIDraw_$(2) $$(THISBENCH_$(1)_$(2)_OBJS)
+	$$(CXX) -o $$@ $$(THISBENCH_$(1)_$(2)_OBJS) $$(BENCH_$(2)_LIBS) $(BENCH_COMMON_LIBS)
+endif
+BENCH_EXES += $(1)-$(2)
+)
+endef
+
+# $1 --> release or debug
+define benchset
+$(eval $(call benchbuildrules,$(1))
+$(foreach benchname,$(BENCHMARKS),$(call benchrule,$(benchname),$(1)))
+)
+endef
+
+define addbenchtarget
+$(eval BENCH_TARGETLIST+=$(1))
+endef
+
+$(foreach benchname,$(BENCHMARKS),$(call addbenchtarget,$(benchname)))
+
+$(call benchset,release)
+$(call benchset,debug)
+
+benchmarks: benchmarks-release
+.PHONY: benchmarks
+TARGETLIST += benchmarks benchmarks-release benchmarks-debug
+
+# The bench target runs the painter scene benchmark on the
+# null backend, writing its report to BENCH_OUTPUT and, if
+# BENCH_BASELINE is set, comparing against that report.
+ifeq ($(BUILD_NULL),1)
+BENCH_OUTPUT ?= painter-bench.json
+BENCH_BASELINE ?=
+BENCH_TOLERANCE ?= 0.1
+bench: painter-bench-release
+	LD_LIBRARY_PATH=.:$$LD_LIBRARY_PATH ./painter-bench-release json_file=$(BENCH_OUTPUT) \
+	$(if $(BENCH_BASELINE),baseline=$(BENCH_BASELINE) tolerance=$(BENCH_TOLERANCE))
+.PHONY: bench
+TARGETLIST += bench
+ENVIRONMENTALDESCRIPTIONS += "BENCH_OUTPUT: file to which make bench writes its report (default painter-bench.json)"
+ENVIRONMENTALDESCRIPTIONS += "BENCH_BASELINE: if set, report from an earlier make bench against which to compare"
+ENVIRONMENTALDESCRIPTIONS += "BENCH_TOLERANCE: fraction a scene may be slower than BENCH_BASELINE before make bench fails (default 0.1)"
+endif
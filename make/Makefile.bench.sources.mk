@@ -0,0 +1,17 @@
+# The Rules.mk file for each benchmark needs to do:
+#  1. Place the "standard header" at the top of the Rules.mk
+#  2. add its name to BENCHMARKS. Lets say the name of the benchmark is foo
+#  3. Set (using := ) foo_SOURCES the sources the benchmark has, using filelist
+#     to get path correct
+#  4. Place the "standard footer" at the end of the Rules.mk
+#  5. Add to benchmarks/Rules.mk your Rules.mk (follow the form in the file)
+#
+# Benchmarks are non-interactive and only link against the core
+# FastUIDraw library; they do not require SDL or a GL context.
+# A benchmark that draws with a Painter sets foo_NULL_BACKEND := 1
+# to also link against the null (headless) backend library.
+
+COMMON_BENCH_SOURCES :=
+
+dir := benchmarks
+include $(dir)/Rules.mk
@@ -0,0 +1,63 @@
+# The sources of the null backend are compiled with the
+# same flags as the sources of libFastUIDraw, so the object
+# rules of make/Makefile.base.lib.mk are used.
+
+# $1 --> debug or release
+# $2 --> (0: skip build target 1: add build target)
+define nullrule
+$(eval FASTUIDRAW_NULL_$(1)_OBJS = $$(patsubst %.cpp, build/$(1)/%.o, $(FASTUIDRAW_NULL_SOURCES))
+FASTUIDRAW_NULL_$(1)_PRIVATE_OBJS = $$(patsubst %.cpp, build/$(1)/private/%.o, $(FASTUIDRAW_PRIVATE_NULL_SOURCES))
+FASTUIDRAW_NULL_$(1)_DEPS = $$(patsubst %.cpp, build/$(1)/%.d, $(FASTUIDRAW_NULL_SOURCES))
+FASTUIDRAW_NULL_$(1)_DEPS += $$(patsubst %.cpp, build/$(1)/private/%.d, $(FASTUIDRAW_PRIVATE_NULL_SOURCES))
+FASTUIDRAW_NULL_$(1)_ALL_OBJS = $$(FASTUIDRAW_NULL_$(1)_OBJS) $$(FASTUIDRAW_NULL_$(1)_PRIVATE_OBJS)
+CLEAN_FILES += $$(FASTUIDRAW_NULL_$(1)_ALL_OBJS)
+SUPER_CLEAN_FILES += $$(FASTUIDRAW_NULL_$(1)_DEPS)
+CLEAN_FILES += libFastUIDrawNull_$(1).dll libFastUIDrawNull_$(1).dll.a libFastUIDrawNull_$(1).so libFastUIDrawNull_$(1).a
+
+ifeq ($(2),1)
+-include $$(FASTUIDRAW_NULL_$(1)_DEPS)
+
+ifeq ($(MINGW_BUILD),1)
+libFastUIDrawNull_$(1): libFastUIDrawNull_$(1).dll
+libFastUIDrawNull_$(1).dll.a: libFastUIDrawNull_$(1).dll
+libFastUIDrawNull_$(1).dll: libFastUIDraw_$(1).dll $$(FASTUIDRAW_NULL_$(1)_ALL_OBJS)
+	$(CXX) -shared -Wl,--out-implib,libFastUIDrawNull_$(1).dll.a -o libFastUIDrawNull_$(1).dll $$(FASTUIDRAW_NULL_$(1)_ALL_OBJS) -L. -lFastUIDraw_$(1)
+INSTALL_LIBS += libFastUIDrawNull_$(1).dll.a
+INSTALL_EXES += libFastUIDrawNull_$(1).dll
+else
+libFastUIDrawNull_$(1): libFastUIDrawNull_$(1).so
+libFastUIDrawNull_$(1).so: libFastUIDraw_$(1).so $$(FASTUIDRAW_NULL_$(1)_ALL_OBJS)
+	$(CXX) -shared -Wl,$$(SONAME),libFastUIDrawNull_$(1).so -o libFastUIDrawNull_$(1).so $$(FASTUIDRAW_NULL_$(1)_ALL_OBJS) -L. -lFastUIDraw_$(1)
+INSTALL_LIBS += libFastUIDrawNull_$(1).so
+endif
+
+libFastUIDrawNull_$(1)-static: libFastUIDrawNull_$(1).a
+.PHONY: libFastUIDrawNull_$(1)-static
+libFastUIDrawNull_$(1).a: $$(FASTUIDRAW_NULL_$(1)_ALL_OBJS)
+	ar rcs $$@ $$(FASTUIDRAW_NULL_$(1)_ALL_OBJS)
+INSTALL_STATIC_LIBS += libFastUIDrawNull_$(1).a
+endif
+)
+endef
+
+# $1 --> (0: skip build target 1: add build target)
+define nullrules
+$(eval $(call nullrule,release,$(1))
+$(call nullrule,debug,$(1))
+ifeq ($(1),1)
+TARGETLIST += libFastUIDrawNull libFastUIDrawNull_release libFastUIDrawNull_debug
+TARGETLIST += libFastUIDrawNull-static libFastUIDrawNull_release-static libFastUIDrawNull_debug-static
+libFastUIDrawNull: libFastUIDrawNull_release libFastUIDrawNull_debug
+libFastUIDrawNull-static: libFastUIDrawNull_release-static libFastUIDrawNull_debug-static
+.PHONY: libFastUIDrawNull libFastUIDrawNull-static
+.PHONY: libFastUIDrawNull_release libFastUIDrawNull_debug
+all: libFastUIDrawNull libFastUIDrawNull-static
+libs-release: libFastUIDrawNull_release
+libs-debug: libFastUIDrawNull_debug
+libs-release-static: libFastUIDrawNull_release-static
+libs-debug-static: libFastUIDrawNull_debug-static
+endif
+)
+endef
+
+$(call nullrules,$(BUILD_NULL))
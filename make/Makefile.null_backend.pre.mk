@@ -0,0 +1,6 @@
+# We need to initialize the variables with :=
+# so that as GNU make walks the directory structure
+# it correctly observes the output of $(call filelist)
+# to get paths correct.
+FASTUIDRAW_NULL_SOURCES :=
+FASTUIDRAW_PRIVATE_NULL_SOURCES :=
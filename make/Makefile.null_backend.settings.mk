@@ -0,0 +1,3 @@
+# if 1, build/install the null (headless) backend libs on install
+BUILD_NULL ?= 1
+ENVIRONMENTALDESCRIPTIONS += "BUILD_NULL: if set to 1 build the null (headless) backend to FastUIDraw (default 1)"
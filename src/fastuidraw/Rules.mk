@@ -27,6 +27,9 @@ include $(dir)/Rules.mk
 dir := $(d)/gl_backend
 include $(dir)/Rules.mk
 
+dir := $(d)/null_backend
+include $(dir)/Rules.mk
+
 # Begin standard footer
 d		:= $(dirstack_$(sp))
 sp		:= $(basename $(sp))
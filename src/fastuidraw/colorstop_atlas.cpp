@@ -76,6 +76,7 @@ namespace
     mutable std::mutex m_mutex;
     int m_delayed_interval_freeing_counter;
     std::vector<delayed_free_entry> m_delayed_freed_intervals;
+    unsigned int m_number_times_released;
 
     fastuidraw::reference_counted_ptr<fastuidraw::ColorStopBackingStore> m_backing_store;
     int m_allocated;
@@ -119,6 +120,7 @@ namespace
 ColorStopAtlasPrivate::
 ColorStopAtlasPrivate(fastuidraw::reference_counted_ptr<fastuidraw::ColorStopBackingStore> pbacking_store):
   m_delayed_interval_freeing_counter(0),
+  m_number_times_released(0),
   m_backing_store(pbacking_store),
   m_allocated(0)
 {
@@ -182,6 +184,7 @@ deallocate_implement(fastuidraw::ivec2 location, int width)
       m_available_layers[new_max].insert(y);
     }
   m_allocated -= width;
+  ++m_number_times_released;
 }
 
 /////////////////////////////////////
@@ -323,6 +326,17 @@ deallocate(ivec2 location, int width)
     }
 }
 
+unsigned int
+fastuidraw::ColorStopAtlas::
+number_times_released(void) const
+{
+  ColorStopAtlasPrivate *d;
+  d = static_cast<ColorStopAtlasPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_mutex);
+  return d->m_number_times_released;
+}
+
 void
 fastuidraw::ColorStopAtlas::
 flush(void) const
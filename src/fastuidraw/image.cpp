@@ -203,6 +203,13 @@ namespace
       return m_num_tiles;
     }
 
+    /* number of tiles returned to the free store */
+    unsigned int
+    number_released(void) const
+    {
+      return m_number_released;
+    }
+
   private:
     void
     delete_tile_implement(fastuidraw::ivec3 v);
@@ -215,6 +222,7 @@ namespace
 
     int m_lock_resources_counter;
     std::vector<fastuidraw::ivec3> m_delayed_free_tiles;
+    unsigned int m_number_released;
 
     #ifdef FASTUIDRAW_DEBUG
     fastuidraw::array3d<inited_bool> m_tile_allocated;
@@ -225,7 +233,8 @@ namespace
   {
   public:
     ResourceReleaseActionList(void):
-      m_lock_resources_counter(0)
+      m_lock_resources_counter(0),
+      m_number_released(0)
     {}
 
     ~ResourceReleaseActionList()
@@ -244,6 +253,7 @@ namespace
       else
         {
           action->action();
+          ++m_number_released;
         }
     }
 
@@ -264,13 +274,22 @@ namespace
             {
               v->action();
             }
+          m_number_released += m_delete_actions.size();
           m_delete_actions.clear();
         }
     }
 
+    /* number of actions executed */
+    unsigned int
+    number_released(void) const
+    {
+      return m_number_released;
+    }
+
   private:
     std::vector<fastuidraw::reference_counted_ptr<fastuidraw::Image::ResourceReleaseAction> > m_delete_actions;
     unsigned int m_lock_resources_counter;
+    unsigned int m_number_released;
   };
 
   template<typename T>
@@ -643,7 +662,8 @@ tile_allocator(int tile_size, fastuidraw::ivec3 store_dimensions):
               tile_size > 0 ? store_dimensions.y() / m_tile_size : 0,
               tile_size > 0 ? store_dimensions.z() : 0),
   m_tile_count(0),
-  m_lock_resources_counter(0)
+  m_lock_resources_counter(0),
+  m_number_released(0)
 #ifdef FASTUIDRAW_DEBUG
   ,
   m_tile_allocated(m_num_tiles.x(), m_num_tiles.y(), m_num_tiles.z())
@@ -755,6 +775,7 @@ delete_tile_implement(fastuidraw::ivec3 v)
   #endif
 
   --m_tile_count;
+  ++m_number_released;
   m_free_tiles.push_back(v);
 }
 
@@ -1138,6 +1159,19 @@ unlock_resources(void)
   d->m_delete_actions.unlock_resources();
 }
 
+unsigned int
+fastuidraw::ImageAtlas::
+number_times_released(void) const
+{
+  ImageAtlasPrivate *d;
+  d = static_cast<ImageAtlasPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> M(d->m_mutex);
+  return d->m_color_tiles.number_released()
+    + d->m_index_tiles.number_released()
+    + d->m_delete_actions.number_released();
+}
+
 int
 fastuidraw::ImageAtlas::
 color_tile_size(void) const
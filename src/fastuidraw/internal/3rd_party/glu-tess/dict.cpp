@@ -40,7 +40,7 @@
 Dict *dictNewDict( void *frame,
                    int (*leq)(void *frame, DictKey key1, DictKey key2) )
 {
-  Dict *dict = (Dict *) memAlloc( sizeof( Dict ));
+  Dict *dict = (Dict *) memAllocCell( sizeof( Dict ));
   DictNode *head;
 
   if (dict == nullptr) return nullptr;
@@ -64,9 +64,9 @@ void dictDeleteDict( Dict *dict )
 
   for( node = dict->head.next; node != &dict->head; node = next ) {
     next = node->next;
-    memFree( node );
+    memFreeCell( node, sizeof( DictNode ));
   }
-  memFree( dict );
+  memFreeCell( dict, sizeof( Dict ));
 }
 
 /* really glu_fastuidraw_gl_dictListInsertBefore */
@@ -78,7 +78,7 @@ DictNode *dictInsertBefore( Dict *dict, DictNode *node, DictKey key )
     node = node->prev;
   } while( node->key != nullptr && ! (*dict->leq)(dict->frame, node->key, key));
 
-  newNode = (DictNode *) memAlloc( sizeof( DictNode ));
+  newNode = (DictNode *) memAllocCell( sizeof( DictNode ));
   if (newNode == nullptr) return nullptr;
 
   newNode->key = key;
@@ -96,7 +96,7 @@ void dictDelete( Dict *dict, DictNode *node ) /*ARGSUSED*/
   (void)dict;
   node->next->prev = node->prev;
   node->prev->next = node->next;
-  memFree( node );
+  memFreeCell( node, sizeof( DictNode ));
 }
 
 /* really glu_fastuidraw_gl_dictListSearch */
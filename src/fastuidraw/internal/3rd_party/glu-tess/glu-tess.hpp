@@ -283,6 +283,22 @@ void fastuidraw_gluTessVertex (fastuidraw_GLUtesselator* tess, double x, double
 void fastuidraw_gluTessCallback (fastuidraw_GLUtesselator* tess, FASTUIDRAW_GLUenum which, FASTUIDRAW_GLUfuncptr CallBackFunc);
 
 
+/*
+  set and fetch if the small objects of tessellation (vertices, faces,
+  edges, sweep line regions) are allocated from an arena that each
+  thread keeps instead of from the heap one by one. Default is true.
+  Changing the value only affects a thread once the polygon it is
+  tessellating is done.
+ */
+void fastuidraw_gluTessUseArena(FASTUIDRAW_GLUboolean v);
+FASTUIDRAW_GLUboolean fastuidraw_gluTessUseArena(void);
+
+/*
+  returns the number of allocations from the heap made by
+  tessellation, across all threads, since the process started
+ */
+unsigned long long fastuidraw_gluTessHeapAllocationCount(void);
+
 /*
   set and fetch the merging tolerance
  */
@@ -33,7 +33,221 @@
 */
 
 #include "memalloc.hpp"
+#include "glu-tess.hpp"
 #include <string.h>
+#include <stdint.h>
+#include <atomic>
+#include <vector>
+#include <fastuidraw/util/util.hpp>
+
+namespace
+{
+  /* cells are rounded up to a multiple of cell_granularity bytes,
+   * cells larger than the largest size class come from the heap.
+   */
+  enum
+    {
+      cell_granularity = 16,
+      number_size_classes = 32,
+      block_size = 64 * 1024,
+
+      /* number of blocks an Arena keeps once rewound */
+      number_retained_blocks = 16
+    };
+
+  class FreeCell
+  {
+  public:
+    FreeCell *m_next;
+  };
+
+  class Arena
+  {
+  public:
+    Arena(void);
+    ~Arena();
+
+    void*
+    allocate(size_t n);
+
+    void
+    deallocate(void *p, size_t n);
+
+    /* called when a tessellator is made on the thread */
+    void
+    acquire(void);
+
+    /* called when a tessellator of the thread is deleted;
+     * once there are none, all cells are reclaimed,
+     * including those leaked by the longjmp() error path
+     * of the sweep.
+     */
+    void
+    release(void);
+
+  private:
+    static
+    unsigned int
+    size_class(size_t n)
+    {
+      return (n + cell_granularity - 1) / cell_granularity;
+    }
+
+    void*
+    allocate_from_block(size_t sz);
+
+    void
+    rewind(void);
+
+    std::vector<uint8_t*> m_blocks;
+    unsigned int m_current_block;
+    uint8_t *m_ptr, *m_end;
+    FreeCell *m_free_lists[number_size_classes + 1];
+
+    /* number of tessellators alive on the thread */
+    unsigned int m_number_tessellators;
+
+    /* value of arena_enabled when the first of the current
+     * tessellators of the thread was made; the value only
+     * changes when there are no tessellators so that a cell
+     * is always freed the same way it was allocated.
+     */
+    bool m_enabled;
+  };
+
+  std::atomic<bool> arena_enabled(true);
+  std::atomic<uint64_t> heap_allocation_count(0);
+  thread_local Arena arena;
+}
+
+////////////////////////////////
+// Arena methods
+Arena::
+Arena(void):
+  m_current_block(0),
+  m_ptr(nullptr),
+  m_end(nullptr),
+  m_number_tessellators(0),
+  m_enabled(true)
+{
+  memset(m_free_lists, 0, sizeof(m_free_lists));
+}
+
+Arena::
+~Arena()
+{
+  for (uint8_t *b : m_blocks)
+    {
+      FASTUIDRAWfree(b);
+    }
+}
+
+void*
+Arena::
+allocate_from_block(size_t sz)
+{
+  if (m_ptr == nullptr || m_ptr + sz > m_end)
+    {
+      if (m_ptr != nullptr && m_current_block + 1 < m_blocks.size())
+        {
+          ++m_current_block;
+        }
+      else
+        {
+          glu_fastuidraw_gl_memCountHeap();
+          m_blocks.push_back(static_cast<uint8_t*>(FASTUIDRAWmalloc(block_size)));
+          m_current_block = m_blocks.size() - 1;
+        }
+      m_ptr = m_blocks[m_current_block];
+      m_end = m_ptr + block_size;
+    }
+
+  void *return_value(m_ptr);
+  m_ptr += sz;
+  return return_value;
+}
+
+void
+Arena::
+rewind(void)
+{
+  while (m_blocks.size() > number_retained_blocks)
+    {
+      FASTUIDRAWfree(m_blocks.back());
+      m_blocks.pop_back();
+    }
+
+  memset(m_free_lists, 0, sizeof(m_free_lists));
+  m_current_block = 0;
+  m_ptr = m_blocks.empty() ? nullptr : m_blocks[0];
+  m_end = m_blocks.empty() ? nullptr : m_ptr + block_size;
+}
+
+void
+Arena::
+acquire(void)
+{
+  if (m_number_tessellators == 0)
+    {
+      m_enabled = arena_enabled;
+    }
+  ++m_number_tessellators;
+}
+
+void
+Arena::
+release(void)
+{
+  FASTUIDRAWassert(m_number_tessellators > 0);
+  --m_number_tessellators;
+  if (m_number_tessellators == 0)
+    {
+      rewind();
+    }
+}
+
+void*
+Arena::
+allocate(size_t n)
+{
+  unsigned int c(size_class(n));
+
+  FASTUIDRAWassert(m_number_tessellators > 0);
+  if (!m_enabled || c > number_size_classes)
+    {
+      glu_fastuidraw_gl_memCountHeap();
+      return FASTUIDRAWmalloc(n);
+    }
+
+  if (m_free_lists[c])
+    {
+      FreeCell *p(m_free_lists[c]);
+      m_free_lists[c] = p->m_next;
+      return p;
+    }
+
+  return allocate_from_block(c * cell_granularity);
+}
+
+void
+Arena::
+deallocate(void *p, size_t n)
+{
+  unsigned int c(size_class(n));
+
+  FASTUIDRAWassert(m_number_tessellators > 0);
+  if (!m_enabled || c > number_size_classes)
+    {
+      FASTUIDRAWfree(p);
+    }
+  else
+    {
+      FreeCell *f(static_cast<FreeCell*>(p));
+      f->m_next = m_free_lists[c];
+      m_free_lists[c] = f;
+    }
+}
+
 
 int glu_fastuidraw_gl_memInit( size_t maxFast )
 {
@@ -50,6 +264,50 @@ int glu_fastuidraw_gl_memInit( size_t maxFast )
 #ifdef MEMORY_DEBUG
 void *glu_fastuidraw_gl_memAlloc( size_t n )
 {
+  glu_fastuidraw_gl_memCountHeap();
   return memset( FASTUIDRAWmalloc( n ), 0xa5, n );
 }
 #endif
+
+void glu_fastuidraw_gl_memCountHeap( void )
+{
+  heap_allocation_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void *glu_fastuidraw_gl_memAllocCell( size_t n )
+{
+  return arena.allocate( n );
+}
+
+void glu_fastuidraw_gl_memFreeCell( void *p, size_t n )
+{
+  arena.deallocate( p, n );
+}
+
+void glu_fastuidraw_gl_memAcquireCells( void )
+{
+  arena.acquire();
+}
+
+void glu_fastuidraw_gl_memReleaseCells( void )
+{
+  arena.release();
+}
+
+void
+fastuidraw_gluTessUseArena(FASTUIDRAW_GLUboolean v)
+{
+  arena_enabled = (v == FASTUIDRAW_GLU_TRUE);
+}
+
+FASTUIDRAW_GLUboolean
+fastuidraw_gluTessUseArena(void)
+{
+  return arena_enabled ? FASTUIDRAW_GLU_TRUE : FASTUIDRAW_GLU_FALSE;
+}
+
+unsigned long long
+fastuidraw_gluTessHeapAllocationCount(void)
+{
+  return heap_allocation_count.load(std::memory_order_relaxed);
+}
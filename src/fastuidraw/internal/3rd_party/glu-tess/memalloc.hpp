@@ -38,18 +38,45 @@
 #include <stdlib.h>
 #include <fastuidraw/util/fastuidraw_memory.hpp>
 
-#define memRealloc      FASTUIDRAWrealloc
+/* Allocations from the heap are counted, see
+ * fastuidraw_gluTessHeapAllocationCount().
+ */
+#define memRealloc(p, n) (glu_fastuidraw_gl_memCountHeap(), FASTUIDRAWrealloc(p, n))
 #define memFree         FASTUIDRAWfree
 
 #define memInit         glu_fastuidraw_gl_memInit
 /*extern void           glu_fastuidraw_gl_memInit( size_t );*/
 extern int              glu_fastuidraw_gl_memInit( size_t );
+extern void             glu_fastuidraw_gl_memCountHeap( void );
 
 #ifndef MEMORY_DEBUG
-#define memAlloc        FASTUIDRAWmalloc
+#define memAlloc(n)     (glu_fastuidraw_gl_memCountHeap(), FASTUIDRAWmalloc(n))
 #else
 #define memAlloc        glu_fastuidraw_gl_memAlloc
 extern void *           glu_fastuidraw_gl_memAlloc( size_t );
 #endif
 
+/* The many small objects of the tessellator (vertices, faces,
+ * half-edge pairs, dictionary nodes, active regions and the
+ * mesh and dictionary themselves) are allocated with memAllocCell
+ * and freed with memFreeCell, which must be passed the same size
+ * as was passed to memAllocCell. Cells come from an arena that
+ * each thread keeps: freed cells are reused by the next cell of
+ * the same size and the arena is rewound when the last tessellator
+ * of the thread is deleted (memAcquireCells and memReleaseCells
+ * are called by gluNewTess and gluDeleteTess), which also reclaims
+ * the cells leaked when the sweep fails with longjmp. Thus
+ * tessellating polygon after polygon on a thread, even with
+ * different tessellator objects, does almost no heap allocation.
+ * A tessellator must be deleted on the thread that made it.
+ */
+#define memAllocCell    glu_fastuidraw_gl_memAllocCell
+#define memFreeCell     glu_fastuidraw_gl_memFreeCell
+#define memAcquireCells glu_fastuidraw_gl_memAcquireCells
+#define memReleaseCells glu_fastuidraw_gl_memReleaseCells
+extern void *           glu_fastuidraw_gl_memAllocCell( size_t );
+extern void             glu_fastuidraw_gl_memFreeCell( void *, size_t );
+extern void             glu_fastuidraw_gl_memAcquireCells( void );
+extern void             glu_fastuidraw_gl_memReleaseCells( void );
+
 #endif
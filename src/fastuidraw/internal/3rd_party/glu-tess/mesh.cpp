@@ -48,12 +48,12 @@
 
 static GLUvertex *allocVertex()
 {
-   return (GLUvertex *)memAlloc( sizeof( GLUvertex ));
+   return (GLUvertex *)memAllocCell( sizeof( GLUvertex ));
 }
 
 static GLUface *allocFace()
 {
-   return (GLUface *)memAlloc( sizeof( GLUface ));
+   return (GLUface *)memAllocCell( sizeof( GLUface ));
 }
 
 /************************ Utility Routines ************************/
@@ -72,7 +72,7 @@ static GLUhalfEdge *MakeEdge( GLUhalfEdge *eNext )
   GLUhalfEdge *e;
   GLUhalfEdge *eSym;
   GLUhalfEdge *ePrev;
-  EdgePair *pair = (EdgePair *)memAlloc( sizeof( EdgePair ));
+  EdgePair *pair = (EdgePair *)memAllocCell( sizeof( EdgePair ));
   if (pair == nullptr) return nullptr;
 
   e = &pair->e;
@@ -216,7 +216,7 @@ static void KillEdge( GLUhalfEdge *eDel )
   eNext->Sym->next = ePrev;
   ePrev->Sym->next = eNext;
 
-  memFree( eDel );
+  memFreeCell( eDel, sizeof( EdgePair ));
 }
 
 
@@ -241,7 +241,7 @@ static void KillVertex( GLUvertex *vDel, GLUvertex *newOrg )
   vNext->prev = vPrev;
   vPrev->next = vNext;
 
-  memFree( vDel );
+  memFreeCell( vDel, sizeof( GLUvertex ));
 }
 
 /* KillFace( fDel ) destroys a face and removes it from the global face
@@ -265,7 +265,7 @@ static void KillFace( GLUface *fDel, GLUface *newLface )
   fNext->prev = fPrev;
   fPrev->next = fNext;
 
-  memFree( fDel );
+  memFreeCell( fDel, sizeof( GLUface ));
 }
 
 
@@ -283,17 +283,17 @@ GLUhalfEdge *glu_fastuidraw_gl_meshMakeEdge( GLUmesh *mesh )
 
   /* if any one is null then all get freed */
   if (newVertex1 == nullptr || newVertex2 == nullptr || newFace == nullptr) {
-     if (newVertex1 != nullptr) memFree(newVertex1);
-     if (newVertex2 != nullptr) memFree(newVertex2);
-     if (newFace != nullptr) memFree(newFace);
+     if (newVertex1 != nullptr) memFreeCell(newVertex1, sizeof(GLUvertex));
+     if (newVertex2 != nullptr) memFreeCell(newVertex2, sizeof(GLUvertex));
+     if (newFace != nullptr) memFreeCell(newFace, sizeof(GLUface));
      return nullptr;
   }
 
   e = MakeEdge( &mesh->eHead );
   if (e == nullptr) {
-     memFree(newVertex1);
-     memFree(newVertex2);
-     memFree(newFace);
+     memFreeCell(newVertex1, sizeof(GLUvertex));
+     memFreeCell(newVertex2, sizeof(GLUvertex));
+     memFreeCell(newFace, sizeof(GLUface));
      return nullptr;
   }
 
@@ -595,7 +595,7 @@ void glu_fastuidraw_gl_meshZapFace( GLUface *fZap )
   fNext->prev = fPrev;
   fPrev->next = fNext;
 
-  memFree( fZap );
+  memFreeCell( fZap, sizeof( GLUface ));
 }
 
 
@@ -608,7 +608,7 @@ GLUmesh *glu_fastuidraw_gl_meshNewMesh( void )
   GLUface *f;
   GLUhalfEdge *e;
   GLUhalfEdge *eSym;
-  GLUmesh *mesh = (GLUmesh *)memAlloc( sizeof( GLUmesh ));
+  GLUmesh *mesh = (GLUmesh *)memAllocCell( sizeof( GLUmesh ));
   if (mesh == nullptr) {
      return nullptr;
   }
@@ -686,7 +686,7 @@ GLUmesh *glu_fastuidraw_gl_meshUnion( GLUmesh *mesh1, GLUmesh *mesh2 )
     e1->Sym->next = e2->Sym->next;
   }
 
-  memFree( mesh2 );
+  memFreeCell( mesh2, sizeof( GLUmesh ));
   return mesh1;
 }
 
@@ -714,7 +714,7 @@ copy_mesh_element(const T *src)
 {
   T *return_value;
 
-  return_value = (T *)memAlloc( sizeof( T ));
+  return_value = (T *)memAllocCell( sizeof( T ));
   *return_value = *src;
   return return_value;
 }
@@ -843,7 +843,7 @@ void glu_fastuidraw_gl_meshDeleteMesh( GLUmesh *mesh )
   }
   FASTUIDRAWassert( mesh->vHead.next == &mesh->vHead );
 
-  memFree( mesh );
+  memFreeCell( mesh, sizeof( GLUmesh ));
 }
 
 #else
@@ -858,21 +858,21 @@ void glu_fastuidraw_gl_meshDeleteMesh( GLUmesh *mesh )
 
   for( f = mesh->fHead.next; f != &mesh->fHead; f = fNext ) {
     fNext = f->next;
-    memFree( f );
+    memFreeCell( f, sizeof( GLUface ));
   }
 
   for( v = mesh->vHead.next; v != &mesh->vHead; v = vNext ) {
     vNext = v->next;
-    memFree( v );
+    memFreeCell( v, sizeof( GLUvertex ));
   }
 
   for( e = mesh->eHead.next; e != &mesh->eHead; e = eNext ) {
     /* One call frees both e and e->Sym (see EdgePair above) */
     eNext = e->next;
-    memFree( e );
+    memFreeCell( e, sizeof( EdgePair ));
   }
 
-  memFree( mesh );
+  memFreeCell( mesh, sizeof( GLUmesh ));
 }
 
 #endif
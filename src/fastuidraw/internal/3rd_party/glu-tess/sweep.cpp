@@ -159,7 +159,7 @@ static void DeleteRegion( fastuidraw_GLUtesselator *tess, ActiveRegion *reg )
   }
   reg->eUp->activeRegion = nullptr;
   dictDelete( tess->dict, reg->nodeUp ); /* glu_fastuidraw_gl_dictListDelete */
-  memFree( reg );
+  memFreeCell( reg, sizeof( ActiveRegion ));
 }
 
 
@@ -220,7 +220,7 @@ static ActiveRegion *AddRegionBelow( fastuidraw_GLUtesselator *tess,
  * Winding number and "inside" flag are not updated.
  */
 {
-  ActiveRegion *regNew = (ActiveRegion *)memAlloc( sizeof( ActiveRegion ));
+  ActiveRegion *regNew = (ActiveRegion *)memAllocCell( sizeof( ActiveRegion ));
   if (regNew == nullptr) longjmp(tess->env,1);
 
   regNew->eUp = eNewUp;
@@ -1114,7 +1114,7 @@ static void AddSentinel( fastuidraw_GLUtesselator *tess, double t )
  */
 {
   GLUhalfEdge *e;
-  ActiveRegion *reg = (ActiveRegion *)memAlloc( sizeof( ActiveRegion ));
+  ActiveRegion *reg = (ActiveRegion *)memAllocCell( sizeof( ActiveRegion ));
   if (reg == nullptr) longjmp(tess->env,1);
 
   e = glu_fastuidraw_gl_meshMakeEdge( tess->mesh );
@@ -215,6 +215,7 @@ fastuidraw_gluNewTess_release( void )
 
   tess->fastuidraw_alloc_tracker = nullptr;
 
+  memAcquireCells();
   return tess;
 }
 
@@ -282,6 +283,7 @@ fastuidraw_gluDeleteTess_release( fastuidraw_GLUtesselator *tess )
 {
   RequireState( tess, T_DORMANT );
   memFree( tess );
+  memReleaseCells();
 }
 
 void REGALFASTUIDRAW_GLU_CALL
@@ -13,12 +13,18 @@ include $(dir)/Rules.mk
 dir := $(d)/gl_backend
 include $(dir)/Rules.mk
 
+dir := $(d)/null_backend
+include $(dir)/Rules.mk
+
 FASTUIDRAW_PRIVATE_SOURCES += $(call filelist, \
 	interval_allocator.cpp \
 	path_util_private.cpp \
 	clip.cpp int_path.cpp \
 	util_private_math.cpp \
-	pack_texels.cpp rect_atlas.cpp)
+	pack_texels.cpp rect_atlas.cpp \
+	glyph_disk_cache.cpp \
+	file_util_private.cpp worker_pool.cpp \
+	attribute_data_file.cpp)
 
 # Begin standard footer
 d		:= $(dirstack_$(sp))
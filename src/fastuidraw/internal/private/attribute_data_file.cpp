@@ -0,0 +1,382 @@
+/*!
+ * \file attribute_data_file.cpp
+ * \brief file attribute_data_file.cpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#include <cstring>
+
+#include <fastuidraw/util/math.hpp>
+#include <fastuidraw/painter/attribute_data/painter_attribute_data_filler.hpp>
+#include <private/util_private.hpp>
+#include <private/attribute_data_file.hpp>
+
+/* The payload of a PainterAttributeData is:
+ *   - N, then N attributes each as 12 words
+ *   - N, then N indices
+ *   - N, then N attribute chunks each as (offset, size)
+ *   - N, then N index chunks each as (offset, size, index adjust)
+ *   - N, then N z-ranges each as (begin, end)
+ */
+
+namespace
+{
+  enum
+    {
+      file_magic0 = 0x44495546u, /* "FUID" */
+      file_magic1 = 0x54414441u, /* "ADAT" */
+      header_size = 5u,
+      words_per_attribute = 12u,
+    };
+
+  class UnpackedAttributeDataFiller:public fastuidraw::PainterAttributeDataFiller
+  {
+  public:
+    virtual
+    void
+    compute_sizes(unsigned int &number_attributes,
+                  unsigned int &number_indices,
+                  unsigned int &number_attribute_chunks,
+                  unsigned int &number_index_chunks,
+                  unsigned int &number_z_ranges) const
+    {
+      number_attributes = m_attributes.size() / words_per_attribute;
+      number_indices = m_indices.size();
+      number_attribute_chunks = m_attribute_chunks.size() / 2;
+      number_index_chunks = m_index_chunks.size() / 3;
+      number_z_ranges = m_z_ranges.size() / 2;
+    }
+
+    virtual
+    void
+    fill_data(fastuidraw::c_array<fastuidraw::PainterAttribute> attributes,
+              fastuidraw::c_array<fastuidraw::PainterIndex> indices,
+              fastuidraw::c_array<fastuidraw::c_array<const fastuidraw::PainterAttribute> > attrib_chunks,
+              fastuidraw::c_array<fastuidraw::c_array<const fastuidraw::PainterIndex> > index_chunks,
+              fastuidraw::c_array<fastuidraw::range_type<int> > zranges,
+              fastuidraw::c_array<int> index_adjusts) const
+    {
+      if (!attributes.empty())
+        {
+          std::memcpy(static_cast<void*>(attributes.c_ptr()), m_attributes.c_ptr(),
+                      sizeof(uint32_t) * m_attributes.size());
+        }
+
+      if (!indices.empty())
+        {
+          std::memcpy(indices.c_ptr(), m_indices.c_ptr(),
+                      sizeof(uint32_t) * m_indices.size());
+        }
+
+      for (unsigned int i = 0; i < attrib_chunks.size(); ++i)
+        {
+          attrib_chunks[i] = attributes.sub_array(m_attribute_chunks[2 * i],
+                                                  m_attribute_chunks[2 * i + 1]);
+        }
+
+      for (unsigned int i = 0; i < index_chunks.size(); ++i)
+        {
+          index_chunks[i] = indices.sub_array(m_index_chunks[3 * i],
+                                              m_index_chunks[3 * i + 1]);
+          index_adjusts[i] = static_cast<int>(m_index_chunks[3 * i + 2]);
+        }
+
+      for (unsigned int i = 0; i < zranges.size(); ++i)
+        {
+          zranges[i].m_begin = static_cast<int>(m_z_ranges[2 * i]);
+          zranges[i].m_end = static_cast<int>(m_z_ranges[2 * i + 1]);
+        }
+    }
+
+    /* returns false if a chunk is not within the attributes or indices */
+    bool
+    valid(void) const
+    {
+      uint64_t num_attributes(m_attributes.size() / words_per_attribute);
+
+      for (unsigned int i = 0; i < m_attribute_chunks.size(); i += 2)
+        {
+          if (uint64_t(m_attribute_chunks[i]) + uint64_t(m_attribute_chunks[i + 1]) > num_attributes)
+            {
+              return false;
+            }
+        }
+
+      for (unsigned int i = 0; i < m_index_chunks.size(); i += 3)
+        {
+          if (uint64_t(m_index_chunks[i]) + uint64_t(m_index_chunks[i + 1]) > m_indices.size())
+            {
+              return false;
+            }
+        }
+      return true;
+    }
+
+    fastuidraw::c_array<const uint32_t> m_attributes;
+    fastuidraw::c_array<const uint32_t> m_indices;
+    fastuidraw::c_array<const uint32_t> m_attribute_chunks;
+    fastuidraw::c_array<const uint32_t> m_index_chunks;
+    fastuidraw::c_array<const uint32_t> m_z_ranges;
+  };
+
+  /* The chunks of a PainterAttributeData are sub-arrays of a single
+   * array; returns the range of that array covered by the chunks.
+   */
+  template<typename T>
+  fastuidraw::c_array<const T>
+  chunks_span(fastuidraw::c_array<const fastuidraw::c_array<const T> > chunks)
+  {
+    const T *begin(nullptr), *end(nullptr);
+
+    for (const auto &c : chunks)
+      {
+        if (!c.empty())
+          {
+            begin = (begin == nullptr) ? c.c_ptr() : fastuidraw::t_min(begin, c.c_ptr());
+            end = (end == nullptr) ? c.c_ptr() + c.size() : fastuidraw::t_max(end, c.c_ptr() + c.size());
+          }
+      }
+    return fastuidraw::c_array<const T>(begin, end - begin);
+  }
+
+  template<typename T>
+  uint32_t
+  chunk_offset(fastuidraw::c_array<const T> span, fastuidraw::c_array<const T> chunk)
+  {
+    return (chunk.empty()) ? 0u : static_cast<uint32_t>(chunk.c_ptr() - span.c_ptr());
+  }
+}
+
+//////////////////////////////////////////////////
+// fastuidraw::detail::AttributeDataFileWriter methods
+void
+fastuidraw::detail::AttributeDataFileWriter::
+add_double(double v)
+{
+  uint64_t u;
+
+  std::memcpy(&u, &v, sizeof(u));
+  add(static_cast<uint32_t>(u & 0xFFFFFFFFu));
+  add(static_cast<uint32_t>(u >> 32u));
+}
+
+void
+fastuidraw::detail::AttributeDataFileWriter::
+add_data(const PainterAttributeData &data)
+{
+  c_array<const PainterAttribute> attributes(chunks_span(data.attribute_data_chunks()));
+  c_array<const PainterIndex> indices(chunks_span(data.index_data_chunks()));
+
+  add(attributes.size());
+  for (const PainterAttribute &a : attributes)
+    {
+      for (unsigned int i = 0; i < 4; ++i)
+        {
+          add(a.m_attrib0[i]);
+        }
+      for (unsigned int i = 0; i < 4; ++i)
+        {
+          add(a.m_attrib1[i]);
+        }
+      for (unsigned int i = 0; i < 4; ++i)
+        {
+          add(a.m_attrib2[i]);
+        }
+    }
+
+  add(indices.size());
+  m_words.insert(m_words.end(), indices.begin(), indices.end());
+
+  add(data.attribute_data_chunks().size());
+  for (const auto &c : data.attribute_data_chunks())
+    {
+      add(chunk_offset(attributes, c));
+      add(c.size());
+    }
+
+  add(data.index_data_chunks().size());
+  for (unsigned int i = 0; i < data.index_data_chunks().size(); ++i)
+    {
+      c_array<const PainterIndex> c(data.index_data_chunks()[i]);
+
+      add(chunk_offset(indices, c));
+      add(c.size());
+      add_int(data.index_adjust_chunk(i));
+    }
+
+  add(data.z_ranges().size());
+  for (const range_type<int> &R : data.z_ranges())
+    {
+      add_int(R.m_begin);
+      add_int(R.m_end);
+    }
+}
+
+enum fastuidraw::return_code
+fastuidraw::detail::AttributeDataFileWriter::
+write(c_string filename, enum attribute_data_file_type_t tp,
+      uint32_t version) const
+{
+  vecN<uint32_t, header_size> header;
+  vecN<c_array<const uint32_t>, 2> chunks;
+
+  header[0] = file_magic0;
+  header[1] = file_magic1;
+  header[2] = tp;
+  header[3] = version;
+  header[4] = m_words.size();
+
+  chunks[0] = header;
+  chunks[1] = make_c_array(m_words);
+  return write_words_to_file(filename, chunks);
+}
+
+//////////////////////////////////////////////////
+// fastuidraw::detail::AttributeDataFileReader methods
+enum fastuidraw::return_code
+fastuidraw::detail::AttributeDataFileReader::
+open(c_string filename, enum attribute_data_file_type_t tp,
+     uint32_t version)
+{
+  c_array<const uint32_t> words;
+
+  if (m_file.open(filename) == routine_fail)
+    {
+      return routine_fail;
+    }
+
+  words = m_file.words();
+  if (words.size() < header_size
+      || words[0] != file_magic0
+      || words[1] != file_magic1
+      || words[2] != static_cast<uint32_t>(tp)
+      || words[3] != version
+      || words[4] != words.size() - header_size)
+    {
+      return routine_fail;
+    }
+
+  m_payload = words.sub_array(header_size);
+  return routine_success;
+}
+
+bool
+fastuidraw::detail::AttributeDataFileReader::
+take(unsigned int count, c_array<const uint32_t> *out)
+{
+  if (m_failed || count > m_payload.size())
+    {
+      m_failed = true;
+      return false;
+    }
+
+  *out = m_payload.sub_array(0, count);
+  m_payload = m_payload.sub_array(count);
+  return true;
+}
+
+bool
+fastuidraw::detail::AttributeDataFileReader::
+read(uint32_t *v)
+{
+  c_array<const uint32_t> w;
+
+  if (!take(1, &w))
+    {
+      return false;
+    }
+  *v = w[0];
+  return true;
+}
+
+bool
+fastuidraw::detail::AttributeDataFileReader::
+read_int(int *v)
+{
+  uint32_t u;
+
+  if (!read(&u))
+    {
+      return false;
+    }
+  *v = static_cast<int>(u);
+  return true;
+}
+
+bool
+fastuidraw::detail::AttributeDataFileReader::
+read_float(float *v)
+{
+  uint32_t u;
+
+  if (!read(&u))
+    {
+      return false;
+    }
+  *v = unpack_float(u);
+  return true;
+}
+
+bool
+fastuidraw::detail::AttributeDataFileReader::
+read_double(double *v)
+{
+  c_array<const uint32_t> w;
+  uint64_t u;
+
+  if (!take(2, &w))
+    {
+      return false;
+    }
+  u = uint64_t(w[0]) | (uint64_t(w[1]) << 32u);
+  std::memcpy(v, &u, sizeof(u));
+  return true;
+}
+
+bool
+fastuidraw::detail::AttributeDataFileReader::
+read_vec2(vec2 *v)
+{
+  return read_float(&v->x()) && read_float(&v->y());
+}
+
+bool
+fastuidraw::detail::AttributeDataFileReader::
+read_data(PainterAttributeData *dst)
+{
+  UnpackedAttributeDataFiller filler;
+  uint32_t count;
+  bool valid;
+
+  valid = read(&count) && count <= m_payload.size() / words_per_attribute
+    && take(count * words_per_attribute, &filler.m_attributes)
+    && read(&count) && take(count, &filler.m_indices)
+    && read(&count) && count <= m_payload.size() / 2
+    && take(2 * count, &filler.m_attribute_chunks)
+    && read(&count) && count <= m_payload.size() / 3
+    && take(3 * count, &filler.m_index_chunks)
+    && read(&count) && count <= m_payload.size() / 2
+    && take(2 * count, &filler.m_z_ranges)
+    && filler.valid();
+
+  if (!valid)
+    {
+      m_failed = true;
+      return false;
+    }
+
+  dst->set_data(filler);
+  return true;
+}
@@ -0,0 +1,159 @@
+/*!
+ * \file attribute_data_file.hpp
+ * \brief file attribute_data_file.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#ifndef FASTUIDRAW_ATTRIBUTE_DATA_FILE_HPP
+#define FASTUIDRAW_ATTRIBUTE_DATA_FILE_HPP
+
+#include <vector>
+#include <stdint.h>
+
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/util/c_array.hpp>
+#include <fastuidraw/util/vecN.hpp>
+#include <fastuidraw/painter/attribute_data/painter_attribute_data.hpp>
+#include <private/file_util_private.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* Files holding PainterAttributeData (for example of FilledPath
+     * and StrokedPath) are a header followed by a payload, all values
+     * are uint32_t in host byte order. The header is two magic values,
+     * the type of file, the version of the type and the number of
+     * words of the payload.
+     */
+    enum attribute_data_file_type_t
+      {
+        filled_path_file = 0x4c4c4946u, /* "FILL" */
+        stroked_path_file = 0x4b525453u, /* "STRK" */
+      };
+
+    /* Builds the payload of a file; values are appended in the
+     * order an AttributeDataFileReader reads them back.
+     */
+    class AttributeDataFileWriter:noncopyable
+    {
+    public:
+      void
+      add(uint32_t v)
+      {
+        m_words.push_back(v);
+      }
+
+      void
+      add_int(int v)
+      {
+        m_words.push_back(static_cast<uint32_t>(v));
+      }
+
+      void
+      add_float(float v)
+      {
+        m_words.push_back(pack_float(v));
+      }
+
+      void
+      add_double(double v);
+
+      void
+      add_vec2(const vec2 &v)
+      {
+        add_float(v.x());
+        add_float(v.y());
+      }
+
+      /* Adds the attributes, indices, chunks, index adjusts
+       * and z-ranges of a PainterAttributeData.
+       */
+      void
+      add_data(const PainterAttributeData &data);
+
+      /* Write the header and payload to a file; the file is first
+       * written to a temporary file which is then renamed.
+       */
+      enum return_code
+      write(c_string filename, enum attribute_data_file_type_t tp,
+            uint32_t version) const;
+
+    private:
+      std::vector<uint32_t> m_words;
+    };
+
+    /* Reads the payload of a file written by AttributeDataFileWriter;
+     * the file is memory mapped where possible. The read methods
+     * return false, and all later reads fail, once the payload does
+     * not have the values requested.
+     */
+    class AttributeDataFileReader:noncopyable
+    {
+    public:
+      AttributeDataFileReader(void):
+        m_failed(false)
+      {}
+
+      /* Fails if the file does not exist or if its header does
+       * not match the passed type and version.
+       */
+      enum return_code
+      open(c_string filename, enum attribute_data_file_type_t tp,
+           uint32_t version);
+
+      bool
+      read(uint32_t *v);
+
+      bool
+      read_int(int *v);
+
+      bool
+      read_float(float *v);
+
+      bool
+      read_double(double *v);
+
+      bool
+      read_vec2(vec2 *v);
+
+      /* Reads data added by AttributeDataFileWriter::add_data(),
+       * the attribute and index values are copied directly from
+       * the file.
+       */
+      bool
+      read_data(PainterAttributeData *dst);
+
+      /* returns true if all of the payload has been read
+       * and no read failed.
+       */
+      bool
+      at_end(void) const
+      {
+        return !m_failed && m_payload.empty();
+      }
+
+    private:
+      bool
+      take(unsigned int count, c_array<const uint32_t> *out);
+
+      MappedFile m_file;
+      bool m_failed;
+      c_array<const uint32_t> m_payload;
+    };
+  }
+}
+
+#endif
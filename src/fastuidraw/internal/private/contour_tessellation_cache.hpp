@@ -0,0 +1,207 @@
+/*!
+ * \file contour_tessellation_cache.hpp
+ * \brief file contour_tessellation_cache.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#ifndef FASTUIDRAW_CONTOUR_TESSELLATION_CACHE_HPP
+#define FASTUIDRAW_CONTOUR_TESSELLATION_CACHE_HPP
+
+#include <vector>
+#include <mutex>
+
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/util/reference_counted.hpp>
+#include <fastuidraw/tessellated_path.hpp>
+#include <private/bounding_box.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* A ContourTessellationCache holds the segments of each edge of
+     * an ended PathContour as made for the starting tessellation of a
+     * TessellatedPath. Since an ended PathContour does not change,
+     * a TessellatedPath of a Path that is made after the Path was
+     * edited copies the segments of those contours the edit did not
+     * touch instead of tessellating them again. Only the segments
+     * for a single choice of TessellationParams are held. Every
+     * ContourTessellationCache is in a list so that the memory
+     * budget of Path::end_tessellation_frame() can count and
+     * release the cached tessellations.
+     */
+    class ContourTessellationCache:noncopyable
+    {
+    public:
+      class Edge
+      {
+      public:
+        Edge(void):
+          m_max_distance(0.0f),
+          m_recursion_depth(0u)
+        {}
+
+        /* segments with the values that depend only on the
+         * contour, such as TessellatedPath::segment::m_length and
+         * TessellatedPath::segment::m_distance_from_contour_start,
+         * computed.
+         */
+        std::vector<TessellatedPath::segment> m_segments;
+        float m_max_distance;
+        unsigned int m_recursion_depth;
+      };
+
+      class Entry:
+        public reference_counted<Entry>::concurrent
+      {
+      public:
+        Entry(const TessellatedPath::TessellationParams &P,
+              bool fast_bezier, unsigned int number_edges):
+          m_max_distance(P.m_max_distance),
+          m_max_recursion(P.m_max_recursion),
+          m_fast_bezier(fast_bezier),
+          m_edges(number_edges),
+          m_has_arcs(false)
+        {}
+
+        bool
+        matches(const TessellatedPath::TessellationParams &P,
+                bool fast_bezier) const
+        {
+          return m_max_distance == P.m_max_distance
+            && m_max_recursion == P.m_max_recursion
+            && m_fast_bezier == fast_bezier;
+        }
+
+        uint64_t
+        memory_usage(void) const
+        {
+          uint64_t return_value(sizeof(Entry));
+
+          for (const Edge &e : m_edges)
+            {
+              return_value += sizeof(Edge)
+                + e.m_segments.capacity() * sizeof(TessellatedPath::segment);
+            }
+          return return_value;
+        }
+
+        float m_max_distance;
+        unsigned int m_max_recursion;
+        bool m_fast_bezier;
+        std::vector<Edge> m_edges;
+
+        /* bounding box of the segments of all edges and
+         * if any of them is an arc.
+         */
+        BoundingBox<float> m_bounding_box;
+        bool m_has_arcs;
+      };
+
+      ContourTessellationCache(void);
+      ~ContourTessellationCache();
+
+      /* Returns the cached tessellation if it was made with the
+       * passed parameters, otherwise returns nullptr.
+       */
+      reference_counted_ptr<const Entry>
+      fetch(const TessellatedPath::TessellationParams &P,
+            bool fast_bezier) const
+      {
+        std::lock_guard<std::mutex> m(m_mutex);
+        if (m_entry && m_entry->matches(P, fast_bezier))
+          {
+            m_last_used = current_frame();
+            return m_entry;
+          }
+        return nullptr;
+      }
+
+      void
+      store(const reference_counted_ptr<const Entry> &E)
+      {
+        std::lock_guard<std::mutex> m(m_mutex);
+        m_entry = E;
+        m_memory_usage = (E) ? E->memory_usage() : 0u;
+        m_last_used = current_frame();
+      }
+
+      /* bytes of the cached tessellation */
+      uint64_t
+      memory_usage(void) const
+      {
+        std::lock_guard<std::mutex> m(m_mutex);
+        return m_memory_usage;
+      }
+
+      /* the frame of Path::end_tessellation_frame() in which the
+       * cached tessellation was last stored or fetched.
+       */
+      unsigned int
+      last_used(void) const
+      {
+        std::lock_guard<std::mutex> m(m_mutex);
+        return m_last_used;
+      }
+
+      /* Removes the cached tessellation and returns it so that the
+       * caller can choose when it is destroyed.
+       */
+      reference_counted_ptr<const Entry>
+      take(void)
+      {
+        std::lock_guard<std::mutex> m(m_mutex);
+        reference_counted_ptr<const Entry> return_value;
+
+        return_value.swap(m_entry);
+        m_memory_usage = 0u;
+        return return_value;
+      }
+
+      /* The list of all ContourTessellationCache objects, the
+       * mutex must be locked while walking the list.
+       */
+      static
+      std::mutex&
+      list_mutex(void);
+
+      static
+      ContourTessellationCache*
+      list_head(void);
+
+      ContourTessellationCache*
+      next_in_list(void) const
+      {
+        return m_next;
+      }
+
+    private:
+      /* the frame counter of Path::end_tessellation_frame() */
+      static
+      unsigned int
+      current_frame(void);
+
+      mutable std::mutex m_mutex;
+      reference_counted_ptr<const Entry> m_entry;
+      uint64_t m_memory_usage;
+      mutable unsigned int m_last_used;
+
+      /* links of the list, protected by list_mutex() */
+      ContourTessellationCache *m_prev, *m_next;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,169 @@
+/*!
+ * \file file_util_private.cpp
+ * \brief file file_util_private.cpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdio>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define FASTUIDRAW_FILE_UTIL_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <private/util_private.hpp>
+#include <private/file_util_private.hpp>
+
+////////////////////////////////////////
+// fastuidraw::detail::MappedFile methods
+fastuidraw::detail::MappedFile::
+~MappedFile()
+{
+  if (m_ptr)
+    {
+      #ifdef FASTUIDRAW_FILE_UTIL_MMAP
+        {
+          munmap(m_ptr, m_size);
+        }
+      #else
+        {
+          std::vector<uint32_t> *p;
+          p = static_cast<std::vector<uint32_t>*>(m_ptr);
+          FASTUIDRAWdelete(p);
+        }
+      #endif
+    }
+}
+
+enum fastuidraw::return_code
+fastuidraw::detail::MappedFile::
+open(c_string filename)
+{
+  FASTUIDRAWassert(m_ptr == nullptr);
+  #ifdef FASTUIDRAW_FILE_UTIL_MMAP
+    {
+      int fd;
+      struct stat st;
+      void *ptr;
+
+      fd = ::open(filename, O_RDONLY);
+      if (fd == -1)
+        {
+          return routine_fail;
+        }
+
+      if (fstat(fd, &st) != 0 || st.st_size <= 0)
+        {
+          close(fd);
+          return routine_fail;
+        }
+
+      ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      close(fd);
+
+      if (ptr == MAP_FAILED)
+        {
+          return routine_fail;
+        }
+      m_ptr = ptr;
+      m_size = st.st_size;
+    }
+  #else
+    {
+      std::ifstream istr(filename, std::ios::binary);
+      std::streamoff sz;
+      std::vector<uint32_t> *p;
+
+      if (!istr)
+        {
+          return routine_fail;
+        }
+
+      istr.seekg(0, std::ios::end);
+      sz = istr.tellg();
+      istr.seekg(0, std::ios::beg);
+      if (!istr || sz <= 0)
+        {
+          return routine_fail;
+        }
+
+      p = FASTUIDRAWnew std::vector<uint32_t>(sz / sizeof(uint32_t));
+      if (!istr.read(reinterpret_cast<char*>(p->data()), p->size() * sizeof(uint32_t)))
+        {
+          FASTUIDRAWdelete(p);
+          return routine_fail;
+        }
+      m_ptr = p;
+      m_size = p->size() * sizeof(uint32_t);
+    }
+  #endif
+
+  return routine_success;
+}
+
+fastuidraw::c_array<const uint32_t>
+fastuidraw::detail::MappedFile::
+words(void) const
+{
+  #ifdef FASTUIDRAW_FILE_UTIL_MMAP
+    {
+      return c_array<const uint32_t>(static_cast<const uint32_t*>(m_ptr),
+                                     m_size / sizeof(uint32_t));
+    }
+  #else
+    {
+      const std::vector<uint32_t> *p;
+
+      p = static_cast<const std::vector<uint32_t>*>(m_ptr);
+      return (p) ? make_c_array(*p) : c_array<const uint32_t>();
+    }
+  #endif
+}
+
+enum fastuidraw::return_code
+fastuidraw::detail::
+write_words_to_file(c_string filename,
+                    c_array<const c_array<const uint32_t> > chunks)
+{
+  std::string tmp_name(filename);
+
+  tmp_name += ".tmp";
+  std::ofstream ostr(tmp_name.c_str(), std::ios::binary | std::ios::trunc);
+  if (!ostr)
+    {
+      return routine_fail;
+    }
+
+  for (c_array<const uint32_t> chunk : chunks)
+    {
+      ostr.write(reinterpret_cast<const char*>(chunk.c_ptr()),
+                 sizeof(uint32_t) * chunk.size());
+    }
+
+  ostr.close();
+  if (!ostr || std::rename(tmp_name.c_str(), filename) != 0)
+    {
+      std::remove(tmp_name.c_str());
+      return routine_fail;
+    }
+
+  return routine_success;
+}
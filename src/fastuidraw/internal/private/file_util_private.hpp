@@ -0,0 +1,75 @@
+/*!
+ * \file file_util_private.hpp
+ * \brief file file_util_private.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#ifndef FASTUIDRAW_FILE_UTIL_PRIVATE_HPP
+#define FASTUIDRAW_FILE_UTIL_PRIVATE_HPP
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/util/c_array.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* The contents of a file of uint32_t values, the file is
+     * memory mapped where possible and otherwise read into
+     * memory. The contents stay valid until the MappedFile
+     * is destroyed.
+     */
+    class MappedFile:noncopyable
+    {
+    public:
+      MappedFile(void):
+        m_ptr(nullptr),
+        m_size(0)
+      {}
+
+      ~MappedFile();
+
+      /* Fails if the file does not exist, is empty or cannot
+       * be mapped or read in full.
+       */
+      enum return_code
+      open(c_string filename);
+
+      /* The contents of the file, empty if open() did not
+       * succeed; a trailing partial uint32_t is not included.
+       */
+      c_array<const uint32_t>
+      words(void) const;
+
+    private:
+      void *m_ptr;
+      size_t m_size;
+    };
+
+    /* Write a sequence of arrays of uint32_t values one after the
+     * other to a file; the file is first written to a temporary
+     * file which is then renamed so that a failed write does not
+     * leave a partial file behind.
+     */
+    enum return_code
+    write_words_to_file(c_string filename,
+                        c_array<const c_array<const uint32_t> > chunks);
+  }
+}
+
+#endif
@@ -28,8 +28,21 @@ namespace fastuidraw { namespace gl { namespace detail {
 class BufferGLEntryLocation
 {
 public:
+  BufferGLEntryLocation(void):
+    m_location(0),
+    m_copy_source(-1),
+    m_copy_size(0)
+  {}
+
   int m_location;
   std::vector<uint8_t> m_data;
+
+  /* if m_copy_source is not -1, the command is to copy
+   * m_copy_size bytes within the buffer from m_copy_source
+   * to m_location instead of setting m_data.
+   */
+  int m_copy_source;
+  int m_copy_size;
 };
 
 /*!\class BufferGL
@@ -110,6 +123,30 @@ public:
       }
   }
 
+  /* Copy bytes within the buffer; the source and
+   * destination ranges must not overlap.
+   */
+  void
+  copy_data(int dst_offset, int src_offset, int size)
+  {
+    FASTUIDRAWassert(size > 0);
+    FASTUIDRAWassert(dst_offset + size <= src_offset || src_offset + size <= dst_offset);
+    if (m_delayed)
+      {
+        m_unflushed_commands.push_back(BufferGLEntryLocation());
+        m_unflushed_commands.back().m_location = dst_offset;
+        m_unflushed_commands.back().m_copy_source = src_offset;
+        m_unflushed_commands.back().m_copy_size = size;
+      }
+    else
+      {
+        flush_size_change();
+        fastuidraw_glBindBuffer(binding_point, m_buffer);
+        fastuidraw_glCopyBufferSubData(binding_point, binding_point,
+                                       src_offset, dst_offset, size);
+      }
+  }
+
   void
   flush(void)
   {
@@ -124,6 +161,13 @@ public:
         fastuidraw_glBindBuffer(binding_point, m_buffer);
         for(BufferGLEntryLocation &B : m_unflushed_commands)
           {
+            if (B.m_copy_source != -1)
+              {
+                fastuidraw_glCopyBufferSubData(binding_point, binding_point,
+                                               B.m_copy_source, B.m_location,
+                                               B.m_copy_size);
+                continue;
+              }
             FASTUIDRAWassert(!B.m_data.empty());
             fastuidraw_glBufferSubData(binding_point, B.m_location, B.m_data.size(), &B.m_data[0]);
           }
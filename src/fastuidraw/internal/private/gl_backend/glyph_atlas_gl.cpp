@@ -68,6 +68,14 @@ namespace
     set_values(unsigned int location,
                fastuidraw::c_array<const uint32_t> pdata);
 
+    virtual
+    bool
+    can_copy_values(void) const;
+
+    virtual
+    void
+    copy_values(unsigned int dst, unsigned int src, unsigned int count);
+
     virtual
     void
     flush(void);
@@ -101,6 +109,14 @@ namespace
     set_values(unsigned int location,
                fastuidraw::c_array<const uint32_t> pdata);
 
+    virtual
+    bool
+    can_copy_values(void) const;
+
+    virtual
+    void
+    copy_values(unsigned int dst, unsigned int src, unsigned int count);
+
     virtual
     void
     flush(void);
@@ -313,6 +329,21 @@ flush(void)
   m_backing_store.flush();
 }
 
+bool
+StoreGL_TextureBuffer::
+can_copy_values(void) const
+{
+  return true;
+}
+
+void
+StoreGL_TextureBuffer::
+copy_values(unsigned int dst, unsigned int src, unsigned int count)
+{
+  m_backing_store.copy_data(dst * sizeof(float), src * sizeof(float),
+                            count * sizeof(float));
+}
+
 void
 StoreGL_TextureBuffer::
 resize_implement(unsigned int new_size)
@@ -372,6 +403,21 @@ flush(void)
   m_backing_store.flush();
 }
 
+bool
+StoreGL_StorageBuffer::
+can_copy_values(void) const
+{
+  return true;
+}
+
+void
+StoreGL_StorageBuffer::
+copy_values(unsigned int dst, unsigned int src, unsigned int count)
+{
+  m_backing_store.copy_data(dst * sizeof(float), src * sizeof(float),
+                            count * sizeof(float));
+}
+
 void
 StoreGL_StorageBuffer::
 resize_implement(unsigned int new_size)
@@ -1161,6 +1161,13 @@ indices_per_mapping(void) const
   return m_reg_gl->params().indices_per_buffer();
 }
 
+unsigned int
+fastuidraw::gl::detail::PainterBackendGL::
+store_blocks_per_mapping(void) const
+{
+  return m_reg_gl->params().data_blocks_per_store_buffer();
+}
+
 void
 fastuidraw::gl::detail::PainterBackendGL::
 on_pre_draw(const reference_counted_ptr<PainterSurface> &surface,
@@ -63,6 +63,10 @@ namespace fastuidraw
         unsigned int
         indices_per_mapping(void) const override final;
 
+        virtual
+        unsigned int
+        store_blocks_per_mapping(void) const override final;
+
         virtual
         void
         on_pre_draw(const reference_counted_ptr<PainterSurface> &surface,
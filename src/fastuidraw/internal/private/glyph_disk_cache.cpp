@@ -0,0 +1,606 @@
+/*!
+ * \file glyph_disk_cache.cpp
+ * \brief file glyph_disk_cache.cpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#include <algorithm>
+
+#include <fastuidraw/text/glyph_generate_params.hpp>
+#include <private/util_private.hpp>
+#include <private/glyph_disk_cache.hpp>
+
+/* The file format is a header followed by a sequence of entries,
+ * all values are uint32_t in host byte order (the magic values
+ * detect a file written on a machine of different endianness).
+ *
+ * Header:
+ *   - file_magic0, file_magic1, file_version
+ *   - signature of GlyphGenerateParams (2 words)
+ *   - number of entries
+ *
+ * Entry:
+ *   - number of words of the entry
+ *   - font content hash (2 words), face index, glyph code
+ *   - GlyphRenderer::m_type, GlyphRenderer::m_pixel_size
+ *   - metrics (9 floats), render size (2 floats)
+ *   - N, then N render costs (floats)
+ *   - N, then 4 * N words of GlyphAttribute values
+ *   - N, then N pairs (attribute word, chunk index)
+ *   - N, then N chunks each as size followed by the data
+ */
+
+namespace
+{
+  enum
+    {
+      file_magic0 = 0x44495546u, /* "FUID" */
+      file_magic1 = 0x48434c47u, /* "GLCH" */
+      file_version = 1u,
+      header_size = 6u,
+
+      entry_size_offset = 0u,
+      entry_font_hash_offset = 1u,
+      entry_face_index_offset = 3u,
+      entry_glyph_code_offset = 4u,
+      entry_render_type_offset = 5u,
+      entry_render_pixel_size_offset = 6u,
+      entry_metrics_offset = 7u,
+      entry_render_size_offset = 16u,
+      entry_fixed_size = 18u,
+
+      /* the fake locations used by GlyphDiskCacheRecorder
+       * in its second pass are (chunk + 1) << location_shift
+       */
+      location_shift = 20u,
+      max_number_chunks = 1023u,
+    };
+
+  uint64_t
+  fnv1a(uint64_t h, uint32_t v)
+  {
+    for (unsigned int i = 0; i < 4; ++i, v >>= 8u)
+      {
+        h ^= (v & 0xFFu);
+        h *= 1099511628211ull;
+      }
+    return h;
+  }
+
+  uint64_t
+  params_signature(void)
+  {
+    using namespace fastuidraw;
+
+    uint64_t h(14695981039346656037ull);
+
+    h = fnv1a(h, file_version);
+    h = fnv1a(h, GlyphGenerateParams::distance_field_pixel_size());
+    h = fnv1a(h, pack_float(GlyphGenerateParams::distance_field_max_distance()));
+    h = fnv1a(h, pack_float(GlyphGenerateParams::restricted_rays_minimum_render_size()));
+    h = fnv1a(h, GlyphGenerateParams::restricted_rays_split_thresh());
+    h = fnv1a(h, GlyphGenerateParams::restricted_rays_max_recursion());
+    h = fnv1a(h, GlyphGenerateParams::banded_rays_max_recursion());
+    h = fnv1a(h, pack_float(GlyphGenerateParams::banded_rays_average_number_curves_thresh()));
+    return h;
+  }
+
+  void
+  pack_vec2(fastuidraw::vec2 v, std::vector<uint32_t> *dst)
+  {
+    dst->push_back(fastuidraw::pack_float(v.x()));
+    dst->push_back(fastuidraw::pack_float(v.y()));
+  }
+
+  fastuidraw::vec2
+  unpack_vec2(const uint32_t *src)
+  {
+    return fastuidraw::vec2(fastuidraw::unpack_float(src[0]),
+                            fastuidraw::unpack_float(src[1]));
+  }
+
+  /* Reads a count followed by count * words_per_element words;
+   * returns false if there are not enough words.
+   */
+  bool
+  read_array(fastuidraw::c_array<const uint32_t> *words,
+             unsigned int words_per_element,
+             fastuidraw::c_array<const uint32_t> *out)
+  {
+    uint32_t count;
+
+    if (words->empty())
+      {
+        return false;
+      }
+    count = (*words)[0];
+    *words = words->sub_array(1);
+
+    /* guard against overflow in count * words_per_element */
+    if (count > words->size() / words_per_element)
+      {
+        return false;
+      }
+    *out = words->sub_array(0, count * words_per_element);
+    *words = words->sub_array(count * words_per_element);
+    return true;
+  }
+}
+
+///////////////////////////////////////////////
+// fastuidraw::detail::GlyphDiskCacheEntry methods
+enum fastuidraw::return_code
+fastuidraw::detail::GlyphDiskCacheEntry::
+unpack(c_array<const uint32_t> words)
+{
+  if (words.size() < entry_fixed_size
+      || words[entry_size_offset] != words.size())
+    {
+      return routine_fail;
+    }
+
+  const uint32_t *p(words.c_ptr());
+
+  m_words = words;
+  m_key.m_font_hash = uint64_t(p[entry_font_hash_offset])
+    | (uint64_t(p[entry_font_hash_offset + 1]) << 32u);
+  m_key.m_face_index = static_cast<int>(p[entry_face_index_offset]);
+  m_key.m_glyph_code = p[entry_glyph_code_offset];
+  m_key.m_render.m_type = static_cast<enum glyph_type>(p[entry_render_type_offset]);
+  m_key.m_render.m_pixel_size = static_cast<int>(p[entry_render_pixel_size_offset]);
+  if (!m_key.m_render.valid())
+    {
+      return routine_fail;
+    }
+
+  p += entry_metrics_offset;
+  m_metrics.m_horizontal_layout_offset = unpack_vec2(p + 0);
+  m_metrics.m_vertical_layout_offset = unpack_vec2(p + 2);
+  m_metrics.m_size = unpack_vec2(p + 4);
+  m_metrics.m_advance = unpack_vec2(p + 6);
+  m_metrics.m_units_per_EM = unpack_float(p[8]);
+  m_render_size = unpack_vec2(words.c_ptr() + entry_render_size_offset);
+
+  words = words.sub_array(entry_fixed_size);
+  if (!read_array(&words, 1, &m_render_costs)
+      || !read_array(&words, 4, &m_attributes)
+      || !read_array(&words, 2, &m_relocations)
+      || words.empty())
+    {
+      return routine_fail;
+    }
+
+  uint32_t num_chunks(words[0]);
+
+  words = words.sub_array(1);
+  m_chunks.clear();
+  for (uint32_t c = 0; c < num_chunks; ++c)
+    {
+      c_array<const uint32_t> chunk;
+
+      if (!read_array(&words, 1, &chunk))
+        {
+          return routine_fail;
+        }
+      m_chunks.push_back(chunk);
+    }
+
+  if (!words.empty())
+    {
+      return routine_fail;
+    }
+
+  for (unsigned int r = 0; r < m_relocations.size(); r += 2)
+    {
+      if (m_relocations[r] >= m_attributes.size()
+          || m_relocations[r + 1] >= m_chunks.size())
+        {
+          return routine_fail;
+        }
+    }
+
+  return routine_success;
+}
+
+void
+fastuidraw::detail::GlyphDiskCacheEntry::
+relocated_attributes(c_array<const int> locations,
+                     c_array<GlyphAttribute> dst) const
+{
+  FASTUIDRAWassert(locations.size() == m_chunks.size());
+  FASTUIDRAWassert(dst.size() == number_attributes());
+
+  for (unsigned int a = 0, w = 0; a < dst.size(); ++a)
+    {
+      for (unsigned int c = 0; c < 4; ++c, ++w)
+        {
+          dst[a].m_data[c] = m_attributes[w];
+        }
+    }
+
+  for (unsigned int r = 0; r < m_relocations.size(); r += 2)
+    {
+      uint32_t w(m_relocations[r]), chunk(m_relocations[r + 1]);
+      dst[w / 4].m_data[w % 4] += static_cast<uint32_t>(locations[chunk]);
+    }
+}
+
+///////////////////////////////////////////////
+// fastuidraw::detail::GlyphDiskCacheRecorder methods
+int
+fastuidraw::detail::GlyphDiskCacheRecorder::
+allocate_data(c_array<const uint32_t> pdata)
+{
+  unsigned int chunk;
+
+  FASTUIDRAWassert(m_pass < 2);
+  if (m_pass == 0)
+    {
+      chunk = m_chunks.size();
+      if (chunk >= max_number_chunks)
+        {
+          return -1;
+        }
+      m_chunks.push_back(std::vector<uint32_t>());
+      m_chunk_sizes.push_back(pdata.size());
+      if (m_record_data)
+        {
+          m_chunks.back().assign(pdata.begin(), pdata.end());
+        }
+      return 0;
+    }
+
+  chunk = m_number_chunks_this_pass++;
+  if (chunk >= m_chunks.size())
+    {
+      m_passes_match = false;
+      return -1;
+    }
+
+  /* only the values of the first pass are stored, so the
+   * values must not depend on where they are placed.
+   */
+  if (pdata.size() != m_chunk_sizes[chunk]
+      || (m_record_data && !std::equal(pdata.begin(), pdata.end(), m_chunks[chunk].begin())))
+    {
+      m_passes_match = false;
+    }
+  return (chunk + 1u) << location_shift;
+}
+
+void
+fastuidraw::detail::GlyphDiskCacheRecorder::
+end_pass(c_array<const GlyphAttribute> attributes)
+{
+  FASTUIDRAWassert(m_pass < 2);
+  m_attributes[m_pass].assign(attributes.begin(), attributes.end());
+  if (m_pass == 1 && m_number_chunks_this_pass != m_chunks.size())
+    {
+      m_passes_match = false;
+    }
+  m_number_chunks_this_pass = 0;
+  ++m_pass;
+}
+
+enum fastuidraw::return_code
+fastuidraw::detail::GlyphDiskCacheRecorder::
+compute_relocations(std::vector<uint32_t> *relocations) const
+{
+  const std::vector<GlyphAttribute> &A(m_attributes[0]);
+  const std::vector<GlyphAttribute> &B(m_attributes[1]);
+
+  relocations->clear();
+  if (m_pass != 2 || !m_passes_match || A.size() != B.size())
+    {
+      return routine_fail;
+    }
+
+  /* an attribute word that holds the location of chunk k differs
+   * between the passes by exactly (k + 1) << location_shift.
+   */
+  for (unsigned int a = 0; a < A.size(); ++a)
+    {
+      for (unsigned int c = 0; c < 4; ++c)
+        {
+          uint32_t diff, chunk;
+
+          diff = B[a].m_data[c] - A[a].m_data[c];
+          if (diff == 0u)
+            {
+              continue;
+            }
+
+          chunk = (diff >> location_shift) - 1u;
+          if ((diff & FASTUIDRAW_MASK(0u, location_shift)) != 0u
+              || chunk >= m_chunks.size())
+            {
+              relocations->clear();
+              return routine_fail;
+            }
+          relocations->push_back(4u * a + c);
+          relocations->push_back(chunk);
+        }
+    }
+  return routine_success;
+}
+
+enum fastuidraw::return_code
+fastuidraw::detail::GlyphDiskCacheRecorder::
+pack_entry(const GlyphDiskCacheKey &key,
+           const GlyphDiskCacheMetrics &metrics,
+           vec2 render_size,
+           c_array<const float> render_costs,
+           std::vector<uint32_t> *dst) const
+{
+  const std::vector<GlyphAttribute> &A(m_attributes[0]);
+  std::vector<uint32_t> relocations;
+
+  if (!m_record_data || compute_relocations(&relocations) == routine_fail)
+    {
+      return routine_fail;
+    }
+
+  dst->clear();
+  dst->push_back(0u);
+  dst->push_back(static_cast<uint32_t>(key.m_font_hash & 0xFFFFFFFFu));
+  dst->push_back(static_cast<uint32_t>(key.m_font_hash >> 32u));
+  dst->push_back(static_cast<uint32_t>(key.m_face_index));
+  dst->push_back(key.m_glyph_code);
+  dst->push_back(key.m_render.m_type);
+  dst->push_back(static_cast<uint32_t>(key.m_render.m_pixel_size));
+  pack_vec2(metrics.m_horizontal_layout_offset, dst);
+  pack_vec2(metrics.m_vertical_layout_offset, dst);
+  pack_vec2(metrics.m_size, dst);
+  pack_vec2(metrics.m_advance, dst);
+  dst->push_back(pack_float(metrics.m_units_per_EM));
+  pack_vec2(render_size, dst);
+  FASTUIDRAWassert(dst->size() == entry_fixed_size);
+
+  dst->push_back(render_costs.size());
+  for (float f : render_costs)
+    {
+      dst->push_back(pack_float(f));
+    }
+
+  dst->push_back(A.size());
+  for (const GlyphAttribute &attr : A)
+    {
+      dst->insert(dst->end(), attr.m_data.begin(), attr.m_data.end());
+    }
+
+  dst->push_back(relocations.size() / 2);
+  dst->insert(dst->end(), relocations.begin(), relocations.end());
+
+  dst->push_back(m_chunks.size());
+  for (const std::vector<uint32_t> &chunk : m_chunks)
+    {
+      dst->push_back(chunk.size());
+      dst->insert(dst->end(), chunk.begin(), chunk.end());
+    }
+
+  (*dst)[entry_size_offset] = dst->size();
+  return routine_success;
+}
+
+///////////////////////////////////////////////
+// fastuidraw::detail::GlyphDiskCache methods
+fastuidraw::detail::GlyphDiskCache::
+GlyphDiskCache(void)
+{}
+
+fastuidraw::detail::GlyphDiskCache::
+~GlyphDiskCache()
+{
+  for (GlyphDiskCacheEntry *e : m_entry_list)
+    {
+      FASTUIDRAWdelete(e);
+    }
+
+  for (std::vector<uint32_t> *p : m_recorded)
+    {
+      FASTUIDRAWdelete(p);
+    }
+
+  for (MappedFile *f : m_mapped_files)
+    {
+      FASTUIDRAWdelete(f);
+    }
+}
+
+bool
+fastuidraw::detail::GlyphDiskCache::
+add_entry(GlyphDiskCacheEntry *e)
+{
+  GlyphDiskCacheKey metrics_key(e->m_key);
+
+  if (!m_entries.insert(entry_map::value_type(e->m_key, e)).second)
+    {
+      return false;
+    }
+
+  metrics_key.m_render = GlyphRenderer();
+  m_metrics.insert(entry_map::value_type(metrics_key, e));
+  m_entry_list.push_back(e);
+  return true;
+}
+
+enum fastuidraw::return_code
+fastuidraw::detail::GlyphDiskCache::
+load(c_string filename)
+{
+  MappedFile *file;
+  c_array<const uint32_t> words;
+
+  file = FASTUIDRAWnew MappedFile();
+  if (file->open(filename) == routine_fail)
+    {
+      FASTUIDRAWdelete(file);
+      return routine_fail;
+    }
+  words = file->words();
+
+  uint64_t signature(params_signature());
+  std::vector<GlyphDiskCacheEntry*> entries;
+  bool valid;
+
+  valid = words.size() >= header_size
+    && words[0] == file_magic0
+    && words[1] == file_magic1
+    && words[2] == file_version
+    && words[3] == static_cast<uint32_t>(signature & 0xFFFFFFFFu)
+    && words[4] == static_cast<uint32_t>(signature >> 32u);
+
+  if (valid)
+    {
+      uint32_t num_entries(words[5]);
+
+      words = words.sub_array(header_size);
+      for (uint32_t i = 0; i < num_entries && valid; ++i)
+        {
+          GlyphDiskCacheEntry *e;
+          uint32_t sz;
+
+          valid = !words.empty() && words[0] <= words.size();
+          if (valid)
+            {
+              sz = words[0];
+              e = FASTUIDRAWnew GlyphDiskCacheEntry();
+              entries.push_back(e);
+              valid = (e->unpack(words.sub_array(0, sz)) == routine_success);
+              words = words.sub_array(sz);
+            }
+        }
+    }
+
+  if (!valid)
+    {
+      for (GlyphDiskCacheEntry *e : entries)
+        {
+          FASTUIDRAWdelete(e);
+        }
+
+      FASTUIDRAWdelete(file);
+      return routine_fail;
+    }
+
+  std::lock_guard<std::mutex> M(m_mutex);
+  for (GlyphDiskCacheEntry *e : entries)
+    {
+      if (!add_entry(e))
+        {
+          FASTUIDRAWdelete(e);
+        }
+    }
+  m_mapped_files.push_back(file);
+
+  return routine_success;
+}
+
+enum fastuidraw::return_code
+fastuidraw::detail::GlyphDiskCache::
+save(c_string filename)
+{
+  uint64_t signature(params_signature());
+  vecN<uint32_t, header_size> header;
+  std::vector<c_array<const uint32_t> > chunks;
+
+  std::lock_guard<std::mutex> M(m_mutex);
+
+  header[0] = file_magic0;
+  header[1] = file_magic1;
+  header[2] = file_version;
+  header[3] = static_cast<uint32_t>(signature & 0xFFFFFFFFu);
+  header[4] = static_cast<uint32_t>(signature >> 32u);
+  header[5] = m_entry_list.size();
+
+  chunks.reserve(m_entry_list.size() + 1);
+  chunks.push_back(header);
+  for (const GlyphDiskCacheEntry *e : m_entry_list)
+    {
+      chunks.push_back(e->m_words);
+    }
+
+  return write_words_to_file(filename, make_c_array(chunks));
+}
+
+void
+fastuidraw::detail::GlyphDiskCache::
+add(std::vector<uint32_t> *words)
+{
+  std::vector<uint32_t> *p;
+  GlyphDiskCacheEntry *e;
+
+  p = FASTUIDRAWnew std::vector<uint32_t>();
+  p->swap(*words);
+
+  e = FASTUIDRAWnew GlyphDiskCacheEntry();
+  if (e->unpack(make_c_array(*p)) != routine_success)
+    {
+      FASTUIDRAWassert(!"Bad packed GlyphDiskCacheEntry");
+      FASTUIDRAWdelete(e);
+      FASTUIDRAWdelete(p);
+      return;
+    }
+
+  std::lock_guard<std::mutex> M(m_mutex);
+  if (add_entry(e))
+    {
+      m_recorded.push_back(p);
+    }
+  else
+    {
+      FASTUIDRAWdelete(e);
+      FASTUIDRAWdelete(p);
+    }
+}
+
+const fastuidraw::detail::GlyphDiskCacheEntry*
+fastuidraw::detail::GlyphDiskCache::
+fetch(const GlyphDiskCacheKey &key)
+{
+  entry_map::const_iterator iter;
+
+  std::lock_guard<std::mutex> M(m_mutex);
+  iter = m_entries.find(key);
+  return (iter != m_entries.end()) ? iter->second : nullptr;
+}
+
+const fastuidraw::detail::GlyphDiskCacheEntry*
+fastuidraw::detail::GlyphDiskCache::
+fetch_metrics(uint64_t font_hash, int face_index, uint32_t glyph_code)
+{
+  entry_map::const_iterator iter;
+  GlyphDiskCacheKey key(font_hash, face_index, glyph_code, GlyphRenderer());
+
+  std::lock_guard<std::mutex> M(m_mutex);
+  iter = m_metrics.find(key);
+  return (iter != m_metrics.end()) ? iter->second : nullptr;
+}
+
+bool
+fastuidraw::detail::GlyphDiskCache::
+contains(const GlyphDiskCacheKey &key)
+{
+  std::lock_guard<std::mutex> M(m_mutex);
+  return m_entries.find(key) != m_entries.end();
+}
+
+unsigned int
+fastuidraw::detail::GlyphDiskCache::
+number_entries(void)
+{
+  std::lock_guard<std::mutex> M(m_mutex);
+  return m_entry_list.size();
+}
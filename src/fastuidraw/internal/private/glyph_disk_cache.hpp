@@ -0,0 +1,263 @@
+/*!
+ * \file glyph_disk_cache.hpp
+ * \brief file glyph_disk_cache.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#ifndef FASTUIDRAW_GLYPH_DISK_CACHE_HPP
+#define FASTUIDRAW_GLYPH_DISK_CACHE_HPP
+
+#include <map>
+#include <vector>
+#include <mutex>
+#include <stdint.h>
+
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/util/c_array.hpp>
+#include <fastuidraw/util/vecN.hpp>
+#include <fastuidraw/text/glyph_renderer.hpp>
+#include <fastuidraw/text/glyph_attribute.hpp>
+#include <private/file_util_private.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* Key of a glyph in a GlyphDiskCache; fonts are identified
+     * by FontBase::content_hash() and FontBase::face_index()
+     * so that the key is the same across runs of a program.
+     */
+    class GlyphDiskCacheKey
+    {
+    public:
+      GlyphDiskCacheKey(void):
+        m_font_hash(0),
+        m_face_index(0),
+        m_glyph_code(0)
+      {}
+
+      GlyphDiskCacheKey(uint64_t font_hash, int face_index,
+                        uint32_t glyph_code, GlyphRenderer render):
+        m_font_hash(font_hash),
+        m_face_index(face_index),
+        m_glyph_code(glyph_code),
+        m_render(render)
+      {}
+
+      bool
+      operator<(const GlyphDiskCacheKey &rhs) const
+      {
+        return (m_font_hash != rhs.m_font_hash) ? m_font_hash < rhs.m_font_hash :
+          (m_face_index != rhs.m_face_index) ? m_face_index < rhs.m_face_index :
+          (m_glyph_code != rhs.m_glyph_code) ? m_glyph_code < rhs.m_glyph_code :
+          m_render < rhs.m_render;
+      }
+
+      uint64_t m_font_hash;
+      int m_face_index;
+      uint32_t m_glyph_code;
+      GlyphRenderer m_render;
+    };
+
+    /* Metrics of a glyph as stored in a GlyphDiskCache */
+    class GlyphDiskCacheMetrics
+    {
+    public:
+      vec2 m_horizontal_layout_offset;
+      vec2 m_vertical_layout_offset;
+      vec2 m_size, m_advance;
+      float m_units_per_EM;
+    };
+
+    /* An entry of a GlyphDiskCache; the arrays point into the
+     * memory mapped file (or into memory owned by the
+     * GlyphDiskCache for entries recorded in this run).
+     */
+    class GlyphDiskCacheEntry
+    {
+    public:
+      /* Extract the values of an entry from its packed words;
+       * returns routine_fail if the words are malformed.
+       */
+      enum return_code
+      unpack(c_array<const uint32_t> words);
+
+      /* Replays the atlas data of the entry: writes to
+       * dst the attributes of the glyph where locations
+       * specifies the location in the atlas to which each
+       * of chunks() was uploaded.
+       */
+      void
+      relocated_attributes(c_array<const int> locations,
+                           c_array<GlyphAttribute> dst) const;
+
+      unsigned int
+      number_attributes(void) const
+      {
+        return m_attributes.size() / 4;
+      }
+
+      GlyphDiskCacheKey m_key;
+      GlyphDiskCacheMetrics m_metrics;
+      vec2 m_render_size;
+
+      /* the packed words of the entry as written to disk */
+      c_array<const uint32_t> m_words;
+
+      /* render costs as bit-packed floats */
+      c_array<const uint32_t> m_render_costs;
+
+      /* 4 words per attribute, values of the attributes when
+       * all data is uploaded to location 0.
+       */
+      c_array<const uint32_t> m_attributes;
+
+      /* pairs (word of m_attributes, chunk) of the attribute words
+       * to which the location of a chunk is added.
+       */
+      c_array<const uint32_t> m_relocations;
+
+      /* the data to upload to the atlas, in order of upload */
+      std::vector<c_array<const uint32_t> > m_chunks;
+    };
+
+    /* Records the data that a GlyphRenderData uploads to the atlas
+     * so that it can be written to a GlyphDiskCache; uploading is
+     * done twice, each time with different fake locations, so that
+     * the attribute values holding a location can be identified.
+     */
+    class GlyphDiskCacheRecorder
+    {
+    public:
+      /* if record_data is false, the uploaded values are not
+       * kept which means pack_entry() fails; only the values
+       * of compute_relocations() are then meaningful.
+       */
+      explicit
+      GlyphDiskCacheRecorder(bool record_data = true):
+        m_record_data(record_data),
+        m_pass(0),
+        m_number_chunks_this_pass(0),
+        m_passes_match(true)
+      {}
+
+      /* called in place of allocating on the atlas */
+      int
+      allocate_data(c_array<const uint32_t> pdata);
+
+      /* Call after each pass of uploading, with the attributes
+       * generated by the pass.
+       */
+      void
+      end_pass(c_array<const GlyphAttribute> attributes);
+
+      /* Compute, from the recorded passes, the pairs (word of
+       * attributes, chunk) of the attribute words that hold the
+       * location of a chunk; returns routine_fail if an attribute
+       * depends on the locations in a way that is not an offset
+       * or if the passes did not upload the same chunks, i.e. if
+       * the uploaded data depends on its location.
+       */
+      enum return_code
+      compute_relocations(std::vector<uint32_t> *relocations) const;
+
+      /* Pack an entry of a GlyphDiskCache from the recorded passes;
+       * returns routine_fail if the attributes depend on the atlas
+       * locations in a way that cannot be replayed.
+       */
+      enum return_code
+      pack_entry(const GlyphDiskCacheKey &key,
+                 const GlyphDiskCacheMetrics &metrics,
+                 vec2 render_size,
+                 c_array<const float> render_costs,
+                 std::vector<uint32_t> *dst) const;
+
+    private:
+      bool m_record_data;
+      unsigned int m_pass;
+      unsigned int m_number_chunks_this_pass;
+      std::vector<std::vector<uint32_t> > m_chunks;
+      std::vector<unsigned int> m_chunk_sizes;
+
+      /* false if the second pass uploaded chunks of different
+       * sizes or, when recording data, of different values.
+       */
+      bool m_passes_match;
+      vecN<std::vector<GlyphAttribute>, 2> m_attributes;
+    };
+
+    /* A GlyphDiskCache holds glyph rendering data keyed by
+     * GlyphDiskCacheKey; it is loaded from files with mmap()
+     * and written back with save(). Entries are never removed
+     * and files are never unmapped until the GlyphDiskCache
+     * is destroyed, so pointers to entries stay valid. The
+     * methods are thread safe.
+     */
+    class GlyphDiskCache:noncopyable
+    {
+    public:
+      GlyphDiskCache(void);
+      ~GlyphDiskCache();
+
+      /* Memory map a file and add its entries; entries whose key is
+       * already present are ignored. Fails if the file does not
+       * exist, is malformed, or was written with a different file
+       * version or different GlyphGenerateParams values.
+       */
+      enum return_code
+      load(c_string filename);
+
+      /* Write all entries to a file; the file is first written
+       * to a temporary file which is then renamed.
+       */
+      enum return_code
+      save(c_string filename);
+
+      /* Add an entry packed by GlyphDiskCacheRecorder::pack_entry(),
+       * the words are taken with std::vector::swap().
+       */
+      void
+      add(std::vector<uint32_t> *words);
+
+      const GlyphDiskCacheEntry*
+      fetch(const GlyphDiskCacheKey &key);
+
+      /* fetch any entry for the glyph, used to get metrics */
+      const GlyphDiskCacheEntry*
+      fetch_metrics(uint64_t font_hash, int face_index, uint32_t glyph_code);
+
+      bool
+      contains(const GlyphDiskCacheKey &key);
+
+      unsigned int
+      number_entries(void);
+
+    private:
+      typedef std::map<GlyphDiskCacheKey, GlyphDiskCacheEntry*> entry_map;
+
+      bool
+      add_entry(GlyphDiskCacheEntry *e);
+
+      std::mutex m_mutex;
+      entry_map m_entries;
+      std::map<GlyphDiskCacheKey, GlyphDiskCacheEntry*> m_metrics;
+      std::vector<GlyphDiskCacheEntry*> m_entry_list;
+      std::vector<MappedFile*> m_mapped_files;
+      std::vector<std::vector<uint32_t>*> m_recorded;
+    };
+  }
+}
+
+#endif
@@ -34,9 +34,15 @@
 
 #include <iterator>
 #include <set>
+#include <limits>
 #include <private/int_path.hpp>
 #include <private/bezier_util.hpp>
 #include <private/util_private_ostream.hpp>
+#include <private/worker_pool.hpp>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 namespace
 {
@@ -295,9 +301,14 @@ namespace
                               const IntBezierCurve::transformation<int> &tr,
                               std::vector<solution_pt> *out_value) const;
 
+    /*
+     * Compute the intersections against the lines c * step
+     * for line_begin <= c < line_end, the solutions for
+     * line c are written to (*out_value)[c - line_begin].
+     */
     void
     compute_lines_intersection(enum coordinate_type line_type,
-                               int step, int count,
+                               int step, int line_begin, int line_end,
                                uint32_t solution_types_accepted,
                                const IntBezierCurve::transformation<int> &tr,
                                std::vector<std::vector<solution_pt> > *out_value) const;
@@ -353,6 +364,98 @@ namespace
     const IntBezierCurve &m_curve;
   };
 
+  /* The values computed for the texels of a distance field.
+   * The values are stored as planes where the values along
+   * a line of texels are contiguous so that a line can be
+   * processed with SIMD and different lines can be processed
+   * by different threads: the values coming from the vertical
+   * lines (Solver::x_fixed) are stored column by column and
+   * all other values are stored row by row.
+   */
+  class distance_field_values
+  {
+  public:
+    explicit
+    distance_field_values(const fastuidraw::ivec2 &dims):
+      m_dims(dims),
+      m_row_distance(dims.x() * dims.y(), unassigned_distance()),
+      m_column_distance(dims.x() * dims.y(), unassigned_distance()),
+      m_row_winding(dims.x() * dims.y(), 0),
+      m_column_winding(dims.x() * dims.y(), 0)
+    {}
+
+    /* an unassigned distance is +infinity so that
+     * recording a distance is just taking a min.
+     */
+    static
+    float
+    unassigned_distance(void)
+    {
+      return std::numeric_limits<float>::infinity();
+    }
+
+    void
+    record_distance_value(int x, int y, float v)
+    {
+      FASTUIDRAWassert(v >= 0.0f);
+      float &d(m_row_distance[x + y * m_dims.x()]);
+      d = fastuidraw::t_min(d, v);
+    }
+
+    /* unsigned distance in IntPath coordinates */
+    float
+    distance(int x, int y, float max_distance) const
+    {
+      float d;
+      d = fastuidraw::t_min(m_row_distance[x + y * m_dims.x()],
+                            m_column_distance[y + x * m_dims.y()]);
+      return fastuidraw::t_min(max_distance, d);
+    }
+
+    /* winding number computed from horizontal or vertical lines */
+    int
+    winding_number(enum Solver::coordinate_type tp, int x, int y) const
+    {
+      return (tp == Solver::x_fixed) ?
+        m_column_winding[y + x * m_dims.y()] :
+        m_row_winding[x + y * m_dims.x()];
+    }
+
+    /* length of the lines with the named coordinate fixed */
+    int
+    line_length(enum Solver::coordinate_type tp) const
+    {
+      return m_dims[Solver::varying_coordinate(tp)];
+    }
+
+    float*
+    line_distance(enum Solver::coordinate_type tp, int c)
+    {
+      std::vector<float> &v((tp == Solver::x_fixed) ? m_column_distance : m_row_distance);
+      return &v[c * line_length(tp)];
+    }
+
+    int*
+    line_winding(enum Solver::coordinate_type tp, int c)
+    {
+      std::vector<int> &v((tp == Solver::x_fixed) ? m_column_winding : m_row_winding);
+      return &v[c * line_length(tp)];
+    }
+
+  private:
+    fastuidraw::ivec2 m_dims;
+    std::vector<float> m_row_distance, m_column_distance;
+    std::vector<int> m_row_winding, m_column_winding;
+  };
+
+  /* The values computed for the texels of a distance field by
+   * the reference generator: the generator that walks each line
+   * one texel at a time and stores all the values of a texel
+   * together. It produces the same texels as the generator
+   * using distance_field_values and is kept so that the two
+   * can be compared, see
+   * GlyphGenerateParams::distance_field_reference_generator().
+   */
   class distance_value
   {
   public:
@@ -437,6 +540,42 @@ namespace
     fastuidraw::vecN<int, 2> m_winding_numbers;
   };
 
+  class reference_distance_values
+  {
+  public:
+    explicit
+    reference_distance_values(const fastuidraw::ivec2 &dims):
+      m_values(dims.x(), dims.y())
+    {}
+
+    distance_value&
+    operator()(int x, int y)
+    {
+      return m_values(x, y);
+    }
+
+    void
+    record_distance_value(int x, int y, float v)
+    {
+      m_values(x, y).record_distance_value(v);
+    }
+
+    float
+    distance(int x, int y, float max_distance) const
+    {
+      return m_values(x, y).distance(max_distance);
+    }
+
+    int
+    winding_number(enum Solver::coordinate_type tp, int x, int y) const
+    {
+      return m_values(x, y).winding_number(tp);
+    }
+
+  private:
+    fastuidraw::array2d<distance_value> m_values;
+  };
+
   class DistanceFieldGenerator
   {
   public:
@@ -451,52 +590,100 @@ namespace
     {}
 
     /*
-     * Compute distance_value for the domain
+     * Compute distance_field_values for the domain
      *  D = { (x(i), y(j)) : 0 <= i < count.x(), 0 <= j < count.y() }
      * where
      *  x(i) = step.x() * i
      *  y(j) = step.y() * j
      * One can get translation via using the transformation argument, tr.
+     * The lines of texels are split across num_threads threads.
+     */
+    void
+    compute_distance_values(const ivec2 &step, const ivec2 &count,
+                            const IntBezierCurve::transformation<int> &tr,
+                            int radius, unsigned int num_threads, bool use_simd,
+                            distance_field_values &out_values) const;
+
+    /* Compute the same values as compute_distance_values()
+     * with the reference generator; single threaded and scalar.
      */
     void
     compute_distance_values(const ivec2 &step, const ivec2 &count,
                             const IntBezierCurve::transformation<int> &tr,
-                            int radius,
-                            fastuidraw::array2d<distance_value> &out_values) const;
+                            int radius, reference_distance_values &out_values) const;
+
+    /* Write the texels of a distance field from the values
+     * computed by one of the compute_distance_values().
+     */
+    template<typename DistanceValues>
+    static
+    void
+    write_texels(const DistanceValues &values, const ivec2 &image_sz,
+                 float max_distance,
+                 const fastuidraw::CustomFillRuleBase &fill_rule,
+                 fastuidraw::c_array<uint8_t> texel_data);
 
     static
     uint8_t
     pixel_value_from_distance(float dist, bool outside);
 
   private:
-    template<typename T>
+    template<typename T, typename DistanceValues>
     static
     void
     record_distance_value_from_canidate(const fastuidraw::vecN<T, 2> &p, int radius,
                                         const ivec2 &step,
                                         const ivec2 &count,
-                                        fastuidraw::array2d<distance_value> &dst);
+                                        DistanceValues &dst);
 
+    template<typename DistanceValues>
     void
     compute_outline_point_values(const ivec2 &step, const ivec2 &count,
                                  const IntBezierCurve::transformation<int> &tr,
                                  int radius,
-                                 fastuidraw::array2d<distance_value> &dst) const;
+                                 DistanceValues &dst) const;
+
+    template<typename DistanceValues>
     void
     compute_derivative_cancel_values(const ivec2 &step, const ivec2 &count,
                                      const IntBezierCurve::transformation<int> &tr,
                                      int radius,
-                                     fastuidraw::array2d<distance_value> &dst) const;
+                                     DistanceValues &dst) const;
     void
     compute_fixed_line_values(const ivec2 &step, const ivec2 &count,
                               const IntBezierCurve::transformation<int> &tr,
-                              fastuidraw::array2d<distance_value> &dst) const;
+                              unsigned int num_threads, bool use_simd,
+                              distance_field_values &dst) const;
+
+    /* compute the values for the lines [line_begin, line_end) */
     void
     compute_fixed_line_values(enum Solver::coordinate_type tp,
-                              std::vector<std::vector<Solver::solution_pt> > &work_room,
+                              int line_begin, int line_end,
                               const ivec2 &step, const ivec2 &count,
                               const IntBezierCurve::transformation<int> &tr,
-                              fastuidraw::array2d<distance_value> &dst) const;
+                              fastuidraw::c_array<const float> positions, bool use_simd,
+                              distance_field_values &dst) const;
+
+    /* For the texels of a line at positions[v] for v in [begin, end),
+     * take the min of dst[v] and the distance to the points
+     * s0 and s1 where s0 < positions[v] <= s1.
+     */
+    static
+    void
+    record_line_distances(float s0, float s1, int begin, int end,
+                          const float *positions, float *dst);
+
+    static
+    void
+    record_line_distances_simd(float s0, float s1, int begin, int end,
+                               const float *positions, float *dst);
+
+    /* reference generator version of compute_fixed_line_values() */
+    void
+    compute_fixed_line_values(enum Solver::coordinate_type tp,
+                              const ivec2 &step, const ivec2 &count,
+                              const IntBezierCurve::transformation<int> &tr,
+                              reference_distance_values &dst) const;
 
     const std::vector<fastuidraw::detail::IntContour> &m_contours;
   };
@@ -914,7 +1101,8 @@ compute_line_intersection(int pt, enum coordinate_type line_type,
 
 void
 Solver::
-compute_lines_intersection(enum coordinate_type tp, int step, int count,
+compute_lines_intersection(enum coordinate_type tp, int step,
+                           int line_begin, int line_end,
                            uint32_t solution_types_accepted,
                            const IntBezierCurve::transformation<int> &tr,
                            std::vector<std::vector<solution_pt> > *out_value) const
@@ -922,7 +1110,7 @@ compute_lines_intersection(enum coordinate_type tp, int step, int count,
   int cstart, cend;
   int fixed_coord(fixed_coordinate(tp));
 
-  FASTUIDRAWassert(out_value->size() == static_cast<unsigned int>(count));
+  FASTUIDRAWassert(out_value->size() == static_cast<unsigned int>(line_end - line_begin));
 
   if ((solution_types_accepted & outside_0_1) == 0)
     {
@@ -944,13 +1132,13 @@ compute_lines_intersection(enum coordinate_type tp, int step, int count,
        *    bbmin / step <= c <= bbmax / step
        */
 
-      cstart = fastuidraw::t_max(0, bbmin / step);
-      cend = fastuidraw::t_min(count, 2 + bbmax / step);
+      cstart = fastuidraw::t_max(line_begin, bbmin / step);
+      cend = fastuidraw::t_min(line_end, 2 + bbmax / step);
     }
   else
     {
-      cstart = 0;
-      cend = count;
+      cstart = line_begin;
+      cend = line_end;
     }
 
   for(int c = cstart; c < cend; ++c)
@@ -958,19 +1146,19 @@ compute_lines_intersection(enum coordinate_type tp, int step, int count,
       int v;
 
       v = c * step;
-      compute_line_intersection(v, tp, solution_types_accepted, tr, &(*out_value)[c]);
+      compute_line_intersection(v, tp, solution_types_accepted, tr, &(*out_value)[c - line_begin]);
     }
 }
 
 //////////////////////////////////////////////
 // DistanceFieldGenerator methods
-template<typename T>
+template<typename T, typename DistanceValues>
 void
 DistanceFieldGenerator::
 record_distance_value_from_canidate(const fastuidraw::vecN<T, 2> &p, int radius,
                                     const ivec2 &step,
                                     const ivec2 &count,
-                                    fastuidraw::array2d<distance_value> &dst)
+                                    DistanceValues &dst)
 {
   ivec2 ip(p);
   for(int x = fastuidraw::t_max(0, ip.x() - radius),
@@ -985,7 +1173,47 @@ record_distance_value_from_canidate(const fastuidraw::vecN<T, 2> &p, int radius,
 
           v = fastuidraw::t_abs(T(x * step.x()) - p.x())
             + fastuidraw::t_abs(T(y * step.y()) - p.y());
-          dst(x, y).record_distance_value(static_cast<float>(v));
+          dst.record_distance_value(x, y, static_cast<float>(v));
+        }
+    }
+}
+
+template<typename DistanceValues>
+void
+DistanceFieldGenerator::
+write_texels(const DistanceValues &dist_values, const ivec2 &image_sz,
+             float max_distance,
+             const fastuidraw::CustomFillRuleBase &fill_rule,
+             fastuidraw::c_array<uint8_t> texel_data)
+{
+  std::fill(texel_data.begin(), texel_data.end(), 0);
+  for(int y = 0; y < image_sz.y(); ++y)
+    {
+      for(int x = 0; x < image_sz.x(); ++x)
+        {
+          bool outside1, outside2;
+          float dist;
+          uint8_t v;
+          int w1, w2;
+          unsigned int location;
+
+          w1 = dist_values.winding_number(Solver::x_fixed, x, y);
+          w2 = dist_values.winding_number(Solver::y_fixed, x, y);
+
+          outside1 = !fill_rule(w1);
+          outside2 = !fill_rule(w2);
+
+          dist = dist_values.distance(x, y, max_distance) / max_distance;
+          if (outside1 != outside2)
+            {
+              /* if the fills do not match, then a curve is going through
+               * the test point of the texel, thus make the distance 0
+               */
+              dist = 0.0f;
+            }
+          v = pixel_value_from_distance(dist, outside1);
+          location = x + y * image_sz.x();
+          texel_data[location] = v;
         }
     }
 }
@@ -1011,7 +1239,8 @@ void
 DistanceFieldGenerator::
 compute_distance_values(const ivec2 &step, const ivec2 &count,
                         const IntBezierCurve::transformation<int> &tr,
-                        int radius, fastuidraw::array2d<distance_value> &dst) const
+                        int radius, unsigned int num_threads, bool use_simd,
+                        distance_field_values &dst) const
 {
   /* We are computing the L1-distance from the path. For a given
    * curve C, that value is given by
@@ -1035,14 +1264,27 @@ compute_distance_values(const ivec2 &step, const ivec2 &count,
    */
   compute_outline_point_values(step, count, tr, radius, dst);
   compute_derivative_cancel_values(step, count, tr, radius, dst);
-  compute_fixed_line_values(step, count, tr, dst);
+  compute_fixed_line_values(step, count, tr, num_threads, use_simd, dst);
 }
 
+void
+DistanceFieldGenerator::
+compute_distance_values(const ivec2 &step, const ivec2 &count,
+                        const IntBezierCurve::transformation<int> &tr,
+                        int radius, reference_distance_values &dst) const
+{
+  compute_outline_point_values(step, count, tr, radius, dst);
+  compute_derivative_cancel_values(step, count, tr, radius, dst);
+  compute_fixed_line_values(Solver::x_fixed, step, count, tr, dst);
+  compute_fixed_line_values(Solver::y_fixed, step, count, tr, dst);
+}
+
+template<typename DistanceValues>
 void
 DistanceFieldGenerator::
 compute_outline_point_values(const ivec2 &step, const ivec2 &count,
                              const IntBezierCurve::transformation<int> &tr,
-                             int radius, fastuidraw::array2d<distance_value> &dst) const
+                             int radius, DistanceValues &dst) const
 {
   for(const IntContour &contour: m_contours)
     {
@@ -1055,12 +1297,13 @@ compute_outline_point_values(const ivec2 &step, const ivec2 &count,
     }
 }
 
+template<typename DistanceValues>
 void
 DistanceFieldGenerator::
 compute_derivative_cancel_values(const ivec2 &step, const ivec2 &count,
                                  const IntBezierCurve::transformation<int> &tr,
                                  int radius,
-                                 fastuidraw::array2d<distance_value> &dst) const
+                                 DistanceValues &dst) const
 {
   IntBezierCurve::transformation<float> ftr(tr.cast<float>());
   for(const IntContour &contour: m_contours)
@@ -1081,23 +1324,182 @@ void
 DistanceFieldGenerator::
 compute_fixed_line_values(const ivec2 &step, const ivec2 &count,
                           const IntBezierCurve::transformation<int> &tr,
-                          fastuidraw::array2d<distance_value> &dst) const
+                          unsigned int num_threads, bool use_simd,
+                          distance_field_values &dst) const
 {
-  std::vector<std::vector<Solver::solution_pt> > work_room0;
-  std::vector<std::vector<Solver::solution_pt> > work_room1;
+  /* fewer lines than this are not worth a thread */
+  const int min_lines_per_thread(32);
 
-  compute_fixed_line_values(Solver::x_fixed, work_room0, step, count, tr, dst);
-  compute_fixed_line_values(Solver::y_fixed, work_room1, step, count, tr, dst);
+  for (int fixed_coord = 0; fixed_coord < 2; ++fixed_coord)
+    {
+      enum Solver::coordinate_type tp;
+      int varying_coord, num_lines, num_jobs;
+      std::vector<float> positions;
+      fastuidraw::c_array<const float> positions_array;
+
+      tp = static_cast<enum Solver::coordinate_type>(fixed_coord);
+      varying_coord = Solver::varying_coordinate(tp);
+      num_lines = count[fixed_coord];
+
+      /* position along a line of each texel of the line */
+      positions.resize(count[varying_coord]);
+      for (int v = 0; v < count[varying_coord]; ++v)
+        {
+          positions[v] = static_cast<float>(step[varying_coord] * v);
+        }
+      positions_array = fastuidraw::make_c_array(positions);
+
+      num_jobs = fastuidraw::t_min(fastuidraw::t_max(1, static_cast<int>(num_threads)),
+                                   fastuidraw::t_max(1, num_lines / min_lines_per_thread));
+
+      /* each job handles a contiguous range of lines; the values
+       * of different lines are disjoint in dst, so the jobs do
+       * not need to synchronize.
+       */
+      fastuidraw::detail::WorkerPool::global().run(num_jobs, [&](unsigned int job)
+        {
+          int line_begin((job * num_lines) / num_jobs);
+          int line_end(((job + 1) * num_lines) / num_jobs);
+
+          compute_fixed_line_values(tp, line_begin, line_end,
+                                    step, count, tr, positions_array,
+                                    use_simd, dst);
+        });
+    }
 }
 
+void
+DistanceFieldGenerator::
+record_line_distances(float s0, float s1, int begin, int end,
+                      const float *positions, float *dst)
+{
+  for (int v = begin; v < end; ++v)
+    {
+      float d;
+
+      d = fastuidraw::t_min(positions[v] - s0, s1 - positions[v]);
+      dst[v] = fastuidraw::t_min(dst[v], d);
+    }
+}
+
+void
+DistanceFieldGenerator::
+record_line_distances_simd(float s0, float s1, int begin, int end,
+                           const float *positions, float *dst)
+{
+#ifdef __SSE2__
+  __m128 vs0(_mm_set1_ps(s0)), vs1(_mm_set1_ps(s1));
+
+  for (; begin + 4 <= end; begin += 4)
+    {
+      __m128 p, d;
+
+      p = _mm_loadu_ps(positions + begin);
+      d = _mm_min_ps(_mm_sub_ps(p, vs0), _mm_sub_ps(vs1, p));
+      _mm_storeu_ps(dst + begin, _mm_min_ps(_mm_loadu_ps(dst + begin), d));
+    }
+#endif
+
+  record_line_distances(s0, s1, begin, end, positions, dst);
+}
 
 void
 DistanceFieldGenerator::
 compute_fixed_line_values(enum Solver::coordinate_type tp,
-                          std::vector<std::vector<Solver::solution_pt> > &work_room,
+                          int line_begin, int line_end,
                           const ivec2 &step, const ivec2 &count,
                           const IntBezierCurve::transformation<int> &tr,
-                          fastuidraw::array2d<distance_value> &dst) const
+                          fastuidraw::c_array<const float> positions, bool use_simd,
+                          distance_field_values &dst) const
+{
+  const int fixed_coord(Solver::fixed_coordinate(tp));
+  const int varying_coord(Solver::varying_coordinate(tp));
+  const int winding_sgn((tp == Solver::x_fixed) ? 1 : -1);
+  const int line_length(count[varying_coord]);
+  const float infinity(std::numeric_limits<float>::infinity());
+  std::vector<std::vector<Solver::solution_pt> > work_room(line_end - line_begin);
+
+  FASTUIDRAWassert(line_length == dst.line_length(tp));
+  FASTUIDRAWassert(line_length == static_cast<int>(positions.size()));
+
+  /* record the solutions for each fixed line */
+  for(const IntContour &contour: m_contours)
+    {
+      const std::vector<IntBezierCurve> &curves(contour.curves());
+      for(const IntBezierCurve &curve : curves)
+        {
+          Solver(curve).compute_lines_intersection(tp, step[fixed_coord],
+                                                   line_begin, line_end,
+                                                   Solver::within_0_1,
+                                                   tr, &work_room);
+        }
+    }
+
+  /* now for each line, do the distance computation along the line. */
+  for(int c = line_begin; c < line_end; ++c)
+    {
+      std::vector<Solver::solution_pt> &L(work_room[c - line_begin]);
+      float *line_distance(dst.line_distance(tp, c));
+      int *line_winding(dst.line_winding(tp, c));
+      int v(0), winding(0);
+
+      /* sort by the value in the varying coordinate
+       */
+      std::sort(L.begin(), L.end(), Solver::CompareSolutions(varying_coord));
+
+      /* the texels at p with s0 < p <= s1 for consecutive
+       * solutions s0, s1 along the line all have the same
+       * winding number and their distance along the line
+       * is the distance to the nearer of s0 and s1.
+       */
+      for(unsigned int idx = 0, sz = L.size(); idx <= sz; ++idx)
+        {
+          float s0, s1;
+          int end;
+
+          s0 = (idx > 0) ? L[idx - 1].m_p[varying_coord] : -infinity;
+          s1 = (idx < sz) ? L[idx].m_p[varying_coord] : infinity;
+          for (end = v; end < line_length && positions[end] <= s1; ++end)
+            {}
+
+          if (sz > 0)
+            {
+              if (use_simd)
+                {
+                  record_line_distances_simd(s0, s1, v, end, positions.c_ptr(), line_distance);
+                }
+              else
+                {
+                  record_line_distances(s0, s1, v, end, positions.c_ptr(), line_distance);
+                }
+            }
+          std::fill(line_winding + v, line_winding + end, winding_sgn * winding);
+          v = end;
+
+          if (idx < sz)
+            {
+              FASTUIDRAWassert(L[idx].m_multiplicity > 0);
+              FASTUIDRAWassert(L[idx].m_type != Solver::on_1_boundary);
+              FASTUIDRAWassert(L[idx].m_t < 1.0f && L[idx].m_t >= 0.0f);
+              if (L[idx].m_p_t[fixed_coord] > 0.0f)
+                {
+                  winding += 1;
+                }
+              else if (L[idx].m_p_t[fixed_coord] < 0.0f)
+                {
+                  winding -= 1;
+                }
+            }
+        }
+    }
+}
+
+void
+DistanceFieldGenerator::
+compute_fixed_line_values(enum Solver::coordinate_type tp,
+                          const ivec2 &step, const ivec2 &count,
+                          const IntBezierCurve::transformation<int> &tr,
+                          reference_distance_values &dst) const
 {
   const enum distance_value::winding_ray_t ray_types[2][2] =
     {
@@ -1108,12 +1510,7 @@ compute_fixed_line_values(enum Solver::coordinate_type tp,
   const int fixed_coord(Solver::fixed_coordinate(tp));
   const int varying_coord(Solver::varying_coordinate(tp));
   const int winding_sgn((tp == Solver::x_fixed) ? 1 : -1);
-
-  work_room.resize(count[fixed_coord]);
-  for(int i = 0; i < count[fixed_coord]; ++i)
-    {
-      work_room[i].clear();
-    }
+  std::vector<std::vector<Solver::solution_pt> > work_room(count[fixed_coord]);
 
   /* record the solutions for each fixed line */
   for(const IntContour &contour: m_contours)
@@ -1122,7 +1519,7 @@ compute_fixed_line_values(enum Solver::coordinate_type tp,
       for(const IntBezierCurve &curve : curves)
         {
           Solver(curve).compute_lines_intersection(tp, step[fixed_coord],
-                                                   count[fixed_coord],
+                                                   0, count[fixed_coord],
                                                    Solver::within_0_1,
                                                    tr, &work_room);
         }
@@ -1200,6 +1597,7 @@ compute_fixed_line_values(enum Solver::coordinate_type tp,
     }
 }
 
+
 //////////////////////////////////////////////
 // fastuidraw::detail::IntBezierCurve methods
 fastuidraw::vec2
@@ -1672,10 +2070,11 @@ extract_render_data(const ivec2 &step, const ivec2 &image_sz,
                     float max_distance,
                     IntBezierCurve::transformation<int> tr,
                     const CustomFillRuleBase &fill_rule,
-                    GlyphRenderDataTexels *dst) const
+                    GlyphRenderDataTexels *dst,
+                    unsigned int num_threads, bool use_simd,
+                    bool use_reference) const
 {
   DistanceFieldGenerator compute(m_contours);
-  array2d<distance_value> dist_values(image_sz.x(), image_sz.y());
   int radius(2);
 
   /* change tr to be offset by half a texel, so that the
@@ -1689,39 +2088,22 @@ extract_render_data(const ivec2 &step, const ivec2 &image_sz,
   ivec2 tr_translate(tr.translate() - step / 2 - ivec2(1, 1));
   tr = IntBezierCurve::transformation<int>(tr_scale, tr_translate);
 
-  compute.compute_distance_values(step, image_sz, tr, radius, dist_values);
-
   dst->resize(image_sz);
-  c_array<uint8_t> texel_data(dst->texel_data());
-
-  std::fill(texel_data.begin(), texel_data.end(), 0);
-  for(int y = 0; y < image_sz.y(); ++y)
+  if (use_reference)
     {
-      for(int x = 0; x < image_sz.x(); ++x)
-        {
-          bool outside1, outside2;
-          float dist;
-          uint8_t v;
-          int w1, w2;
-          unsigned int location;
-
-          w1 = dist_values(x, y).winding_number(Solver::x_fixed);
-          w2 = dist_values(x, y).winding_number(Solver::y_fixed);
+      reference_distance_values dist_values(image_sz);
 
-          outside1 = !fill_rule(w1);
-          outside2 = !fill_rule(w2);
+      compute.compute_distance_values(step, image_sz, tr, radius, dist_values);
+      DistanceFieldGenerator::write_texels(dist_values, image_sz, max_distance,
+                                           fill_rule, dst->texel_data());
+    }
+  else
+    {
+      distance_field_values dist_values(image_sz);
 
-          dist = dist_values(x, y).distance(max_distance) / max_distance;
-          if (outside1 != outside2)
-            {
-              /* if the fills do not match, then a curve is going through
-               * the test point of the texel, thus make the distance 0
-               */
-              dist = 0.0f;
-            }
-          v = DistanceFieldGenerator::pixel_value_from_distance(dist, outside1);
-          location = x + y * image_sz.x();
-          texel_data[location] = v;
-        }
+      compute.compute_distance_values(step, image_sz, tr, radius,
+                                      num_threads, use_simd, dist_values);
+      DistanceFieldGenerator::write_texels(dist_values, image_sz, max_distance,
+                                           fill_rule, dst->texel_data());
     }
 }
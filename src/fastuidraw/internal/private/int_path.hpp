@@ -441,13 +441,23 @@ namespace fastuidraw
        *                   AFTER tr is applied
        * \param image_sz size of the distance field to make
        * \param tr transformation to apply to data of path
+       * \param num_threads number of threads across which to
+       *                    split the lines of texels
+       * \param use_simd if true, use SIMD instructions (when
+       *                 available) along the lines of texels
+       * \param use_reference if true, ignore num_threads and
+       *                      use_simd and generate the texels
+       *                      with the reference generator
        */
       void
       extract_render_data(const ivec2 &texel_size, const ivec2 &image_sz,
                           float max_distance,
                           IntBezierCurve::transformation<int> tr,
                           const CustomFillRuleBase &fill_rule,
-                          GlyphRenderDataTexels *dst) const;
+                          GlyphRenderDataTexels *dst,
+                          unsigned int num_threads = 1,
+                          bool use_simd = true,
+                          bool use_reference = false) const;
 
     private:
       IntBezierCurve::ID_t
@@ -229,6 +229,53 @@ free_interval(int location, int size)
   m_sorted[size].insert(R.first);
 }
 
+bool
+fastuidraw::interval_allocator::
+allocate_interval_at(int location, int size)
+{
+  int end(location + size);
+  interval_ref iter;
+
+  if (size <= 0 || location < 0 || end > m_size)
+    {
+      return false;
+    }
+
+  /* the free intervals are keyed by their end, so the first
+   * one whose end is at or after end is the only one that
+   * can contain [location, end).
+   */
+  iter = m_free_intervals.lower_bound(end);
+  if (iter == m_free_intervals.end() || iter->second.m_begin > location)
+    {
+      return false;
+    }
+
+  interval I(iter->second);
+
+  remove_free_interval(iter);
+  if (I.m_begin < location)
+    {
+      free_interval(I.m_begin, location - I.m_begin);
+    }
+  if (end < I.m_end)
+    {
+      free_interval(end, I.m_end - end);
+    }
+  return true;
+}
+
+void
+fastuidraw::interval_allocator::
+free_intervals(std::vector<range_type<int> > *out_intervals) const
+{
+  out_intervals->clear();
+  for (const auto &I : m_free_intervals)
+    {
+      out_intervals->push_back(I.second);
+    }
+}
+
 void
 fastuidraw::interval_allocator::
 remove_free_interval(interval_ref iter)
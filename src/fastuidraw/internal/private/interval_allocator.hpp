@@ -22,6 +22,7 @@
 
 #include <map>
 #include <set>
+#include <vector>
 #include <fastuidraw/util/util.hpp>
 
 namespace fastuidraw
@@ -110,6 +111,22 @@ namespace fastuidraw
     void
     free_interval(int location, int size);
 
+    /*!\fn
+     * Allocate a specific interval; the interval must be
+     * completely free. Returns false if it is not.
+     * \param location start of interval
+     * \param size size of interval
+     */
+    bool
+    allocate_interval_at(int location, int size);
+
+    /*!\fn
+     * Returns the free intervals sorted by location.
+     * \param out_intervals location to which to write the free intervals
+     */
+    void
+    free_intervals(std::vector<range_type<int> > *out_intervals) const;
+
     /*!\fn
      * Returns the largest value that can be passed to allocate_interval()
      * and not fail.
@@ -0,0 +1,15 @@
+# Begin standard header
+sp 		:= $(sp).x
+dirstack_$(sp)	:= $(d)
+d		:= $(dir)
+# End standard header
+
+FASTUIDRAW_PRIVATE_NULL_SOURCES += $(call filelist, \
+	atlas_null.cpp \
+	painter_backend_null.cpp)
+
+
+# Begin standard footer
+d		:= $(dirstack_$(sp))
+sp		:= $(basename $(sp))
+# End standard footer
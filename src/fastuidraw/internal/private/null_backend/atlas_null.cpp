@@ -0,0 +1,268 @@
+/*!
+ * \file atlas_null.cpp
+ * \brief file atlas_null.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#include <algorithm>
+#include <private/util_private.hpp>
+#include <private/null_backend/atlas_null.hpp>
+
+namespace
+{
+  enum
+    {
+      /* match the default values of PainterEngineGL::ImageAtlasParams */
+      log2_color_tile_size = 5,
+      log2_index_tile_size = 2,
+      log2_num_index_tiles_per_row_per_col = 6,
+    };
+
+  int
+  color_store_dims(int log2_dims)
+  {
+    return 1 << std::max(log2_dims, static_cast<int>(log2_color_tile_size) + 1);
+  }
+}
+
+///////////////////////////////////////////////////////////////
+// fastuidraw::null::detail::GlyphAtlasBackingStoreNull methods
+fastuidraw::null::detail::GlyphAtlasBackingStoreNull::
+GlyphAtlasBackingStoreNull(unsigned int number_elements):
+  GlyphAtlasBackingStoreBase(number_elements),
+  m_values(number_elements, 0u)
+{}
+
+void
+fastuidraw::null::detail::GlyphAtlasBackingStoreNull::
+set_values(unsigned int location, c_array<const uint32_t> pdata)
+{
+  FASTUIDRAWassert(location + pdata.size() <= m_values.size());
+  std::copy(pdata.begin(), pdata.end(), m_values.begin() + location);
+}
+
+void
+fastuidraw::null::detail::GlyphAtlasBackingStoreNull::
+copy_values(unsigned int dst, unsigned int src, unsigned int count)
+{
+  FASTUIDRAWassert(dst + count <= m_values.size());
+  FASTUIDRAWassert(src + count <= m_values.size());
+  if (dst < src)
+    {
+      std::copy(m_values.begin() + src, m_values.begin() + src + count,
+                m_values.begin() + dst);
+    }
+  else
+    {
+      std::copy_backward(m_values.begin() + src, m_values.begin() + src + count,
+                         m_values.begin() + dst + count);
+    }
+}
+
+void
+fastuidraw::null::detail::GlyphAtlasBackingStoreNull::
+resize_implement(unsigned int new_size)
+{
+  m_values.resize(new_size, 0u);
+}
+
+//////////////////////////////////////////////////////////////
+// fastuidraw::null::detail::ColorStopBackingStoreNull methods
+fastuidraw::null::detail::ColorStopBackingStoreNull::
+ColorStopBackingStoreNull(int w, int num_layers):
+  ColorStopBackingStore(w, num_layers),
+  m_texels(w * num_layers)
+{}
+
+void
+fastuidraw::null::detail::ColorStopBackingStoreNull::
+set_data(int x, int l, int w, c_array<const u8vec4> data)
+{
+  unsigned int offset(x + l * dimensions().x());
+
+  FASTUIDRAWassert(w >= 0 && static_cast<unsigned int>(w) == data.size());
+  FASTUIDRAWassert(offset + w <= m_texels.size());
+  FASTUIDRAWunused(w);
+  std::copy(data.begin(), data.end(), m_texels.begin() + offset);
+}
+
+void
+fastuidraw::null::detail::ColorStopBackingStoreNull::
+resize_implement(int new_num_layers)
+{
+  m_texels.resize(dimensions().x() * new_num_layers);
+}
+
+//////////////////////////////////////////////////////////
+// fastuidraw::null::detail::ColorBackingStoreNull methods
+fastuidraw::null::detail::ColorBackingStoreNull::
+ColorBackingStoreNull(int w, int h, int num_layers, unsigned int num_levels):
+  AtlasColorBackingStoreBase(w, h, num_layers),
+  m_levels(num_levels)
+{
+  resize_implement(num_layers);
+}
+
+fastuidraw::c_array<fastuidraw::u8vec4>
+fastuidraw::null::detail::ColorBackingStoreNull::
+texels(int mipmap_level, int y, int l, int x, unsigned int count)
+{
+  ivec3 dims(dimensions());
+  int w(std::max(1, dims.x() >> mipmap_level));
+  int h(std::max(1, dims.y() >> mipmap_level));
+  unsigned int offset(x + w * (y + h * l));
+
+  FASTUIDRAWassert(offset + count <= m_levels[mipmap_level].size());
+  return c_array<u8vec4>(&m_levels[mipmap_level][offset], count);
+}
+
+void
+fastuidraw::null::detail::ColorBackingStoreNull::
+set_data(int mipmap_level, ivec2 dst_xy, int dst_l, ivec2 src_xy,
+         unsigned int size, const ImageSourceBase &data)
+{
+  if (mipmap_level < 0 || mipmap_level >= static_cast<int>(m_levels.size()))
+    {
+      return;
+    }
+
+  c_array<u8vec4> src;
+
+  m_scratch.resize(size * size);
+  src = c_array<u8vec4>(m_scratch.data(), m_scratch.size());
+  data.fetch_texels(mipmap_level, src_xy, size, size, src);
+  for (unsigned int y = 0; y < size; ++y)
+    {
+      c_array<const u8vec4> row(src.sub_array(y * size, size));
+      c_array<u8vec4> dst(texels(mipmap_level, dst_xy.y() + y, dst_l, dst_xy.x(), size));
+      std::copy(row.begin(), row.end(), dst.begin());
+    }
+}
+
+void
+fastuidraw::null::detail::ColorBackingStoreNull::
+set_data(int mipmap_level, ivec2 dst_xy, int dst_l,
+         unsigned int size, u8vec4 color_value)
+{
+  if (mipmap_level < 0 || mipmap_level >= static_cast<int>(m_levels.size()))
+    {
+      return;
+    }
+
+  for (unsigned int y = 0; y < size; ++y)
+    {
+      c_array<u8vec4> dst(texels(mipmap_level, dst_xy.y() + y, dst_l, dst_xy.x(), size));
+      std::fill(dst.begin(), dst.end(), color_value);
+    }
+}
+
+void
+fastuidraw::null::detail::ColorBackingStoreNull::
+resize_implement(int new_num_layers)
+{
+  ivec3 dims(dimensions());
+  for (unsigned int m = 0; m < m_levels.size(); ++m)
+    {
+      int w(std::max(1, dims.x() >> m));
+      int h(std::max(1, dims.y() >> m));
+      m_levels[m].resize(w * h * new_num_layers);
+    }
+}
+
+//////////////////////////////////////////////////////////
+// fastuidraw::null::detail::IndexBackingStoreNull methods
+fastuidraw::null::detail::IndexBackingStoreNull::
+IndexBackingStoreNull(int w, int h, int num_layers):
+  AtlasIndexBackingStoreBase(w, h, num_layers),
+  m_values(w * h * num_layers)
+{}
+
+void
+fastuidraw::null::detail::IndexBackingStoreNull::
+set_data(int x, int y, int l, int w, int h,
+         c_array<const ivec3> data)
+{
+  ivec3 dims(dimensions());
+
+  FASTUIDRAWassert(data.size() == static_cast<unsigned int>(w * h));
+  for (int b = 0; b < h; ++b)
+    {
+      c_array<const ivec3> row(data.sub_array(b * w, w));
+      unsigned int offset(x + dims.x() * (y + b + dims.y() * l));
+
+      FASTUIDRAWassert(offset + w <= m_values.size());
+      std::copy(row.begin(), row.end(), m_values.begin() + offset);
+    }
+}
+
+void
+fastuidraw::null::detail::IndexBackingStoreNull::
+resize_implement(int new_num_layers)
+{
+  ivec3 dims(dimensions());
+  m_values.resize(dims.x() * dims.y() * new_num_layers);
+}
+
+/////////////////////////////////////////////
+// fastuidraw::null::detail::ImageNull methods
+fastuidraw::null::detail::ImageNull::
+ImageNull(ImageAtlas &atlas, int w, int h,
+          const ImageSourceBase &image_data):
+  Image(atlas, w, h, image_data.number_levels(),
+        Image::context_texture2d, 0u, image_data.format()),
+  m_levels(image_data.number_levels())
+{
+  for (unsigned int m = 0; m < m_levels.size(); ++m)
+    {
+      unsigned int lw(std::max(1, w >> m)), lh(std::max(1, h >> m));
+
+      m_levels[m].resize(lw * lh);
+      image_data.fetch_texels(m, ivec2(0, 0), lw, lh,
+                              c_array<u8vec4>(m_levels[m].data(), m_levels[m].size()));
+    }
+}
+
+fastuidraw::null::detail::ImageNull::
+ImageNull(ImageAtlas &atlas, int w, int h):
+  Image(atlas, w, h, 1, Image::context_texture2d, 0u, Image::premultipied_rgba_format)
+{}
+
+//////////////////////////////////////////////////
+// fastuidraw::null::detail::ImageAtlasNull methods
+fastuidraw::null::detail::ImageAtlasNull::
+ImageAtlasNull(int log2_dims):
+  ImageAtlas(1 << log2_color_tile_size,
+             1 << log2_index_tile_size,
+             FASTUIDRAWnew ColorBackingStoreNull(color_store_dims(log2_dims),
+                                                 color_store_dims(log2_dims),
+                                                 1, log2_color_tile_size + 1),
+             FASTUIDRAWnew IndexBackingStoreNull(1 << (log2_index_tile_size + log2_num_index_tiles_per_row_per_col),
+                                                 1 << (log2_index_tile_size + log2_num_index_tiles_per_row_per_col),
+                                                 1))
+{}
+
+fastuidraw::reference_counted_ptr<fastuidraw::Image>
+fastuidraw::null::detail::ImageAtlasNull::
+create_image_bindless(int, int, const ImageSourceBase&)
+{
+  return nullptr;
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::Image>
+fastuidraw::null::detail::ImageAtlasNull::
+create_image_context_texture2d(int w, int h, const ImageSourceBase &image_data)
+{
+  return FASTUIDRAWnew ImageNull(*this, w, h, image_data);
+}
@@ -0,0 +1,191 @@
+/*!
+ * \file atlas_null.hpp
+ * \brief file atlas_null.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#ifndef FASTUIDRAW_ATLAS_NULL_HPP
+#define FASTUIDRAW_ATLAS_NULL_HPP
+
+#include <vector>
+#include <fastuidraw/image.hpp>
+#include <fastuidraw/image_atlas.hpp>
+#include <fastuidraw/colorstop_atlas.hpp>
+#include <fastuidraw/text/glyph_atlas.hpp>
+
+namespace fastuidraw
+{
+  namespace null
+  {
+    namespace detail
+    {
+      /* Host memory implementation of GlyphAtlasBackingStoreBase */
+      class GlyphAtlasBackingStoreNull:public GlyphAtlasBackingStoreBase
+      {
+      public:
+        explicit
+        GlyphAtlasBackingStoreNull(unsigned int number_elements);
+
+        virtual
+        void
+        set_values(unsigned int location, c_array<const uint32_t> pdata) override;
+
+        virtual
+        void
+        flush(void) override
+        {}
+
+        virtual
+        bool
+        can_copy_values(void) const override
+        {
+          return true;
+        }
+
+        virtual
+        void
+        copy_values(unsigned int dst, unsigned int src, unsigned int count) override;
+
+      protected:
+        virtual
+        void
+        resize_implement(unsigned int new_size) override;
+
+      private:
+        std::vector<uint32_t> m_values;
+      };
+
+      /* Host memory implementation of ColorStopBackingStore */
+      class ColorStopBackingStoreNull:public ColorStopBackingStore
+      {
+      public:
+        ColorStopBackingStoreNull(int w, int num_layers);
+
+        virtual
+        void
+        set_data(int x, int l, int w,
+                 c_array<const u8vec4> data) override;
+
+      protected:
+        virtual
+        void
+        resize_implement(int new_num_layers) override;
+
+      private:
+        std::vector<u8vec4> m_texels;
+      };
+
+      /* Host memory implementation of AtlasColorBackingStoreBase,
+       * each mipmap level is its own array.
+       */
+      class ColorBackingStoreNull:public AtlasColorBackingStoreBase
+      {
+      public:
+        ColorBackingStoreNull(int w, int h, int num_layers,
+                              unsigned int num_levels);
+
+        virtual
+        void
+        set_data(int mipmap_level, ivec2 dst_xy, int dst_l, ivec2 src_xy,
+                 unsigned int size, const ImageSourceBase &data) override;
+
+        virtual
+        void
+        set_data(int mipmap_level, ivec2 dst_xy, int dst_l,
+                 unsigned int size, u8vec4 color_value) override;
+
+        virtual
+        void
+        flush(void) override
+        {}
+
+      protected:
+        virtual
+        void
+        resize_implement(int new_num_layers) override;
+
+      private:
+        c_array<u8vec4>
+        texels(int mipmap_level, int y, int l, int x, unsigned int count);
+
+        std::vector<std::vector<u8vec4> > m_levels;
+        std::vector<u8vec4> m_scratch;
+      };
+
+      /* Host memory implementation of AtlasIndexBackingStoreBase */
+      class IndexBackingStoreNull:public AtlasIndexBackingStoreBase
+      {
+      public:
+        IndexBackingStoreNull(int w, int h, int num_layers);
+
+        virtual
+        void
+        set_data(int x, int y, int l, int w, int h,
+                 c_array<const ivec3> data) override;
+
+        virtual
+        void
+        flush(void) override
+        {}
+
+      protected:
+        virtual
+        void
+        resize_implement(int new_num_layers) override;
+
+      private:
+        std::vector<ivec3> m_values;
+      };
+
+      /* An Image whose texels are held in host memory; an
+       * ImageNull is also used as the image of a PainterSurface,
+       * in which case it holds no texels.
+       */
+      class ImageNull:public Image
+      {
+      public:
+        ImageNull(ImageAtlas &atlas, int w, int h,
+                  const ImageSourceBase &image_data);
+
+        ImageNull(ImageAtlas &atlas, int w, int h);
+
+      private:
+        std::vector<std::vector<u8vec4> > m_levels;
+      };
+
+      /* Host memory implementation of ImageAtlas; bindless
+       * images are not supported and images of type
+       * Image::context_texture2d are realized by ImageNull.
+       */
+      class ImageAtlasNull:public ImageAtlas
+      {
+      public:
+        explicit
+        ImageAtlasNull(int log2_dims);
+
+      private:
+        virtual
+        reference_counted_ptr<Image>
+        create_image_bindless(int w, int h, const ImageSourceBase &image_data) override;
+
+        virtual
+        reference_counted_ptr<Image>
+        create_image_context_texture2d(int w, int h, const ImageSourceBase &image_data) override;
+      };
+    }
+  }
+}
+
+#endif
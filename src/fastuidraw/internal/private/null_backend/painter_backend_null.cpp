@@ -0,0 +1,526 @@
+/*!
+ * \file painter_backend_null.cpp
+ * \brief file painter_backend_null.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#include <fastuidraw/painter/backend/painter_draw.hpp>
+#include <fastuidraw/glsl/painter_item_shader_glsl.hpp>
+#include <private/util_private.hpp>
+#include <private/null_backend/painter_backend_null.hpp>
+#include <private/null_backend/atlas_null.hpp>
+
+namespace
+{
+  /* 64-bit FNV-1a, fed 32-bits at a time */
+  class Hasher
+  {
+  public:
+    Hasher(void):
+      m_value(14695981039346656037ull)
+    {}
+
+    void
+    add(uint32_t v)
+    {
+      m_value = (m_value ^ v) * 1099511628211ull;
+    }
+
+    template<typename T>
+    void
+    add_array(fastuidraw::c_array<T> values)
+    {
+      fastuidraw::c_array<const uint32_t> raw;
+
+      raw = values.template reinterpret_pointer<const uint32_t>();
+      add(raw.size());
+      for (uint32_t v : raw)
+        {
+          add(v);
+        }
+    }
+
+    uint64_t m_value;
+  };
+}
+
+/* Host memory that a DrawCommand maps; the arrays are kept in
+ * a BufferPool when the DrawCommand is done with them so that
+ * mapping a PainterDraw does not allocate.
+ */
+class fastuidraw::null::detail::PainterBackendNull::HostBuffers
+{
+public:
+  explicit
+  HostBuffers(const PainterEngineNullState &st):
+    m_attributes(st.m_attributes_per_buffer),
+    m_header_attributes(st.m_attributes_per_buffer),
+    m_indices(st.m_indices_per_buffer),
+    m_store(st.m_data_blocks_per_store_buffer)
+  {}
+
+  std::vector<PainterAttribute> m_attributes;
+  std::vector<uint32_t> m_header_attributes;
+  std::vector<PainterIndex> m_indices;
+  std::vector<uvec4> m_store;
+};
+
+class fastuidraw::null::detail::PainterBackendNull::BufferPool:
+  public reference_counted<BufferPool>::concurrent
+{
+public:
+  explicit
+  BufferPool(const reference_counted_ptr<PainterEngineNullState> &st):
+    m_state(st)
+  {}
+
+  ~BufferPool()
+  {
+    for (HostBuffers *p : m_free)
+      {
+        FASTUIDRAWdelete(p);
+      }
+  }
+
+  HostBuffers*
+  acquire(void)
+  {
+    std::lock_guard<std::mutex> M(m_mutex);
+    HostBuffers *p;
+
+    if (m_free.empty())
+      {
+        return FASTUIDRAWnew HostBuffers(*m_state);
+      }
+    p = m_free.back();
+    m_free.pop_back();
+    return p;
+  }
+
+  void
+  release(HostBuffers *p)
+  {
+    std::lock_guard<std::mutex> M(m_mutex);
+    m_free.push_back(p);
+  }
+
+private:
+  reference_counted_ptr<PainterEngineNullState> m_state;
+  std::mutex m_mutex;
+  std::vector<HostBuffers*> m_free;
+};
+
+/* The draw breaks are decided as PainterBackendGL does with an
+ * uber-shader: a change of discard-ness of the item shader, of
+ * the blend shader type or of the BlendMode breaks the draw, as
+ * does any action.
+ */
+class fastuidraw::null::detail::PainterBackendNull::DrawCommand:
+  public PainterDraw
+{
+public:
+  DrawCommand(const reference_counted_ptr<BufferPool> &pool,
+              const reference_counted_ptr<PainterEngineNullState> &state);
+
+  ~DrawCommand();
+
+  virtual
+  bool
+  draw_break(enum PainterSurface::render_type_t render_type,
+             const PainterShaderGroup &old_groups,
+             const PainterShaderGroup &new_groups,
+             unsigned int indices_written) override;
+
+  virtual
+  bool
+  draw_break(const reference_counted_ptr<const PainterDrawBreakAction> &action,
+             unsigned int indices_written) override;
+
+  virtual
+  void
+  draw(void) const override;
+
+protected:
+  virtual
+  void
+  unmap_implement(unsigned int attributes_written,
+                  unsigned int indices_written,
+                  unsigned int data_store_written) override;
+
+private:
+  bool
+  add_break(unsigned int indices_written);
+
+  reference_counted_ptr<BufferPool> m_pool;
+  reference_counted_ptr<PainterEngineNullState> m_state;
+  HostBuffers *m_buffers;
+  std::vector<reference_counted_ptr<const PainterDrawBreakAction> > m_actions;
+  unsigned int m_indices_at_last_break, m_number_breaks;
+};
+
+class fastuidraw::null::detail::PainterBackendNull::BindAction:
+  public PainterDrawBreakAction
+{
+public:
+  explicit
+  BindAction(const reference_counted_ptr<const Image> &im):
+    m_image(im)
+  {}
+
+  virtual
+  gpu_dirty_state
+  execute(PainterBackend*) const override final
+  {
+    return gpu_dirty_state();
+  }
+
+private:
+  reference_counted_ptr<const Image> m_image;
+};
+
+//////////////////////////////////////////////////////////////
+// fastuidraw::null::detail::PainterEngineNullState methods
+fastuidraw::null::detail::PainterEngineNullState::
+PainterEngineNullState(const PainterEngineNull::Configuration &config,
+                       ImageAtlas *image_atlas,
+                       GlyphAtlas *glyph_atlas):
+  m_attributes_per_buffer(config.attributes_per_buffer()),
+  m_indices_per_buffer(config.indices_per_buffer()),
+  m_data_blocks_per_store_buffer(config.data_blocks_per_store_buffer()),
+  m_compute_checksum(config.compute_checksum()),
+  m_image_atlas(image_atlas),
+  m_glyph_atlas(glyph_atlas),
+  m_checksum(0u)
+{
+  for (std::atomic<uint64_t> &c : m_counters)
+    {
+      c.store(0u);
+    }
+}
+
+void
+fastuidraw::null::detail::PainterEngineNullState::
+add_checksum(uint64_t v)
+{
+  std::lock_guard<std::mutex> M(m_checksum_mutex);
+  m_checksum = (m_checksum ^ v) * 1099511628211ull;
+}
+
+uint64_t
+fastuidraw::null::detail::PainterEngineNullState::
+checksum(void) const
+{
+  std::lock_guard<std::mutex> M(m_checksum_mutex);
+  return m_checksum;
+}
+
+void
+fastuidraw::null::detail::PainterEngineNullState::
+reset(void)
+{
+  std::lock_guard<std::mutex> M(m_checksum_mutex);
+  for (std::atomic<uint64_t> &c : m_counters)
+    {
+      c.store(0u);
+    }
+  m_checksum = 0u;
+}
+
+//////////////////////////////////////////////////////////////////
+// fastuidraw::null::detail::PainterShaderRegistrarNull methods
+fastuidraw::null::detail::PainterShaderRegistrarNull::
+PainterShaderRegistrarNull(bool break_on_shader_change):
+  m_break_on_shader_change(break_on_shader_change)
+{}
+
+uint32_t
+fastuidraw::null::detail::PainterShaderRegistrarNull::
+compute_item_shader_group(PainterShader::Tag tag,
+                          const reference_counted_ptr<PainterItemShader> &shader)
+{
+  uint32_t return_value;
+  const glsl::PainterItemShaderGLSL *sh;
+
+  return_value = (m_break_on_shader_change) ? tag.m_ID : 0u;
+  return_value |= (shader_group_discard_mask & tag.m_group);
+
+  sh = dynamic_cast<const glsl::PainterItemShaderGLSL*>(shader.get());
+  if (sh && sh->uses_discard())
+    {
+      return_value |= shader_group_discard_mask;
+    }
+  return return_value;
+}
+
+uint32_t
+fastuidraw::null::detail::PainterShaderRegistrarNull::
+compute_item_coverage_shader_group(PainterShader::Tag tag,
+                                   const reference_counted_ptr<PainterItemCoverageShader> &shader)
+{
+  FASTUIDRAWunused(shader);
+  return (m_break_on_shader_change) ? tag.m_ID : 0u;
+}
+
+uint32_t
+fastuidraw::null::detail::PainterShaderRegistrarNull::
+compute_blend_shader_group(PainterShader::Tag tag,
+                           const reference_counted_ptr<PainterBlendShader> &shader)
+{
+  FASTUIDRAWunused(shader);
+  return (m_break_on_shader_change) ? tag.m_ID : 0u;
+}
+
+//////////////////////////////////////////////////////////
+// fastuidraw::null::detail::PainterSurfaceNull methods
+fastuidraw::null::detail::PainterSurfaceNull::
+PainterSurfaceNull(ivec2 dims, enum render_type_t render_type):
+  m_dimensions(dims),
+  m_render_type(render_type),
+  m_viewport(0, 0, dims.x(), dims.y()),
+  m_clear_color(0.0f, 0.0f, 0.0f, 0.0f)
+{}
+
+fastuidraw::reference_counted_ptr<const fastuidraw::Image>
+fastuidraw::null::detail::PainterSurfaceNull::
+image(ImageAtlas &atlas) const
+{
+  std::lock_guard<std::mutex> M(m_mutex);
+  if (!m_image)
+    {
+      m_image = FASTUIDRAWnew ImageNull(atlas, m_dimensions.x(), m_dimensions.y());
+    }
+  return m_image;
+}
+
+///////////////////////////////////////////////////////////////////////
+// fastuidraw::null::detail::PainterBackendNull::DrawCommand methods
+fastuidraw::null::detail::PainterBackendNull::DrawCommand::
+DrawCommand(const reference_counted_ptr<BufferPool> &pool,
+            const reference_counted_ptr<PainterEngineNullState> &state):
+  m_pool(pool),
+  m_state(state),
+  m_buffers(pool->acquire()),
+  m_indices_at_last_break(0),
+  m_number_breaks(0)
+{
+  m_attributes = make_c_array(m_buffers->m_attributes);
+  m_header_attributes = make_c_array(m_buffers->m_header_attributes);
+  m_indices = make_c_array(m_buffers->m_indices);
+  m_store = make_c_array(m_buffers->m_store);
+}
+
+fastuidraw::null::detail::PainterBackendNull::DrawCommand::
+~DrawCommand()
+{
+  m_pool->release(m_buffers);
+}
+
+bool
+fastuidraw::null::detail::PainterBackendNull::DrawCommand::
+add_break(unsigned int indices_written)
+{
+  /* a break only splits a draw call if there are indices
+   * since the previous break.
+   */
+  FASTUIDRAWassert(indices_written >= m_indices_at_last_break);
+  if (indices_written > m_indices_at_last_break)
+    {
+      m_indices_at_last_break = indices_written;
+      ++m_number_breaks;
+      return true;
+    }
+  return false;
+}
+
+bool
+fastuidraw::null::detail::PainterBackendNull::DrawCommand::
+draw_break(const reference_counted_ptr<const PainterDrawBreakAction> &action,
+           unsigned int indices_written)
+{
+  bool return_value;
+
+  FASTUIDRAWassert(action);
+  m_state->add(PainterEngineNull::counter_number_draw_break_calls, 1u);
+  return_value = add_break(indices_written);
+  m_actions.push_back(action);
+  return return_value;
+}
+
+bool
+fastuidraw::null::detail::PainterBackendNull::DrawCommand::
+draw_break(enum PainterSurface::render_type_t render_type,
+           const PainterShaderGroup &old_groups,
+           const PainterShaderGroup &new_groups,
+           unsigned int indices_written)
+{
+  uint32_t old_disc, new_disc;
+
+  FASTUIDRAWunused(render_type);
+  m_state->add(PainterEngineNull::counter_number_draw_break_calls, 1u);
+
+  old_disc = old_groups.item_group() & PainterShaderRegistrarNull::shader_group_discard_mask;
+  new_disc = new_groups.item_group() & PainterShaderRegistrarNull::shader_group_discard_mask;
+  if (old_disc != new_disc
+      || old_groups.blend_shader_type() != new_groups.blend_shader_type()
+      || old_groups.blend_mode() != new_groups.blend_mode()
+      || old_groups.item_group() != new_groups.item_group()
+      || old_groups.blend_group() != new_groups.blend_group())
+    {
+      return add_break(indices_written);
+    }
+  return false;
+}
+
+void
+fastuidraw::null::detail::PainterBackendNull::DrawCommand::
+draw(void) const
+{
+  for (const auto &action : m_actions)
+    {
+      action->execute(nullptr);
+    }
+}
+
+void
+fastuidraw::null::detail::PainterBackendNull::DrawCommand::
+unmap_implement(unsigned int attributes_written,
+                unsigned int indices_written,
+                unsigned int data_store_written)
+{
+  unsigned int number_headers(0);
+
+  for (unsigned int i = 0; i < attributes_written; ++i)
+    {
+      if (i == 0 || m_header_attributes[i] != m_header_attributes[i - 1])
+        {
+          ++number_headers;
+        }
+    }
+
+  m_state->add(PainterEngineNull::counter_number_attributes, attributes_written);
+  m_state->add(PainterEngineNull::counter_number_indices, indices_written);
+  m_state->add(PainterEngineNull::counter_number_headers, number_headers);
+  m_state->add(PainterEngineNull::counter_number_data_store_blocks, data_store_written);
+  m_state->add(PainterEngineNull::counter_number_draw_breaks, m_number_breaks);
+  if (indices_written > m_indices_at_last_break)
+    {
+      m_state->add(PainterEngineNull::counter_number_draw_calls, m_number_breaks + 1u);
+    }
+  else
+    {
+      m_state->add(PainterEngineNull::counter_number_draw_calls, m_number_breaks);
+    }
+
+  if (m_state->m_compute_checksum)
+    {
+      Hasher H;
+
+      H.add_array(m_attributes.sub_array(0, attributes_written));
+      H.add_array(m_header_attributes.sub_array(0, attributes_written));
+      H.add_array(m_indices.sub_array(0, indices_written));
+      H.add_array(m_store.sub_array(0, data_store_written));
+      m_state->add_checksum(H.m_value);
+    }
+}
+
+////////////////////////////////////////////////////////
+// fastuidraw::null::detail::PainterBackendNull methods
+fastuidraw::null::detail::PainterBackendNull::
+PainterBackendNull(const reference_counted_ptr<PainterEngineNullState> &state):
+  m_state(state)
+{
+  m_pool = FASTUIDRAWnew BufferPool(m_state);
+}
+
+fastuidraw::null::detail::PainterBackendNull::
+~PainterBackendNull()
+{}
+
+unsigned int
+fastuidraw::null::detail::PainterBackendNull::
+attribs_per_mapping(void) const
+{
+  return m_state->m_attributes_per_buffer;
+}
+
+unsigned int
+fastuidraw::null::detail::PainterBackendNull::
+indices_per_mapping(void) const
+{
+  return m_state->m_indices_per_buffer;
+}
+
+unsigned int
+fastuidraw::null::detail::PainterBackendNull::
+store_blocks_per_mapping(void) const
+{
+  return m_state->m_data_blocks_per_store_buffer;
+}
+
+void
+fastuidraw::null::detail::PainterBackendNull::
+on_pre_draw(const reference_counted_ptr<PainterSurface> &surface,
+            bool clear_color_buffer,
+            bool begin_new_target)
+{
+  FASTUIDRAWunused(clear_color_buffer);
+  m_surface = surface;
+
+  /* as the GL backend does when it binds the store of the
+   * GlyphAtlas, write the glyph data queued by an upload
+   * budget so that the glyphs become resident.
+   */
+  m_state->m_glyph_atlas->flush();
+  if (begin_new_target)
+    {
+      m_state->add(PainterEngineNull::counter_number_render_targets, 1u);
+    }
+}
+
+void
+fastuidraw::null::detail::PainterBackendNull::
+on_post_draw(void)
+{
+  m_surface.clear();
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::PainterDrawBreakAction>
+fastuidraw::null::detail::PainterBackendNull::
+bind_image(unsigned int slot,
+           const reference_counted_ptr<const Image> &im)
+{
+  FASTUIDRAWunused(slot);
+  return FASTUIDRAWnew BindAction(im);
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::PainterDrawBreakAction>
+fastuidraw::null::detail::PainterBackendNull::
+bind_coverage_surface(const reference_counted_ptr<PainterSurface> &surface)
+{
+  return FASTUIDRAWnew BindAction(surface->image(*m_state->m_image_atlas));
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::PainterDraw>
+fastuidraw::null::detail::PainterBackendNull::
+map_draw(void)
+{
+  m_state->add(PainterEngineNull::counter_number_draws, 1u);
+  return FASTUIDRAWnew DrawCommand(m_pool, m_state);
+}
+
+void
+fastuidraw::null::detail::PainterBackendNull::
+on_painter_begin(void)
+{}
@@ -0,0 +1,252 @@
+/*!
+ * \file painter_backend_null.hpp
+ * \brief file painter_backend_null.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#ifndef FASTUIDRAW_PAINTER_BACKEND_NULL_HPP
+#define FASTUIDRAW_PAINTER_BACKEND_NULL_HPP
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <fastuidraw/painter/backend/painter_backend.hpp>
+#include <fastuidraw/painter/backend/painter_surface.hpp>
+#include <fastuidraw/glsl/painter_shader_registrar_glsl.hpp>
+#include <fastuidraw/null_backend/painter_engine_null.hpp>
+
+namespace fastuidraw
+{
+  namespace null
+  {
+    namespace detail
+    {
+      /* State shared between a PainterEngineNull and the
+       * PainterBackendNull objects it creates; it is reference
+       * counted so that a PainterBackendNull may outlive the
+       * PainterEngineNull that created it.
+       */
+      class PainterEngineNullState:
+        public reference_counted<PainterEngineNullState>::concurrent
+      {
+      public:
+        PainterEngineNullState(const PainterEngineNull::Configuration &config,
+                               ImageAtlas *image_atlas,
+                               GlyphAtlas *glyph_atlas);
+
+        void
+        add(enum PainterEngineNull::counter_t c, uint64_t v)
+        {
+          m_counters[c].fetch_add(v, std::memory_order_relaxed);
+        }
+
+        uint64_t
+        counter(enum PainterEngineNull::counter_t c) const
+        {
+          return m_counters[c].load(std::memory_order_relaxed);
+        }
+
+        void
+        add_checksum(uint64_t v);
+
+        uint64_t
+        checksum(void) const;
+
+        void
+        reset(void);
+
+        unsigned int m_attributes_per_buffer;
+        unsigned int m_indices_per_buffer;
+        unsigned int m_data_blocks_per_store_buffer;
+        bool m_compute_checksum;
+        reference_counted_ptr<ImageAtlas> m_image_atlas;
+        reference_counted_ptr<GlyphAtlas> m_glyph_atlas;
+
+      private:
+        std::atomic<uint64_t> m_counters[PainterEngineNull::number_counters];
+        mutable std::mutex m_checksum_mutex;
+        uint64_t m_checksum;
+      };
+
+      /* PainterShaderRegistrarGLSL that never makes a GLSL
+       * program; the shader groups are computed as the GL
+       * backend does with an uber-shader.
+       */
+      class PainterShaderRegistrarNull:
+        public glsl::PainterShaderRegistrarGLSL
+      {
+      public:
+        enum
+          {
+            shader_group_discard_bit = 31u,
+            shader_group_discard_mask = (1u << 31u)
+          };
+
+        explicit
+        PainterShaderRegistrarNull(bool break_on_shader_change);
+
+      protected:
+        virtual
+        bool
+        blend_type_supported(enum PainterBlendShader::shader_type) const override
+        {
+          return true;
+        }
+
+        virtual
+        uint32_t
+        compute_item_shader_group(PainterShader::Tag tag,
+                                  const reference_counted_ptr<PainterItemShader> &shader) override;
+
+        virtual
+        uint32_t
+        compute_item_coverage_shader_group(PainterShader::Tag tag,
+                                           const reference_counted_ptr<PainterItemCoverageShader> &shader) override;
+
+        virtual
+        uint32_t
+        compute_blend_shader_group(PainterShader::Tag tag,
+                                   const reference_counted_ptr<PainterBlendShader> &shader) override;
+
+      private:
+        bool m_break_on_shader_change;
+      };
+
+      /* PainterSurface whose contents are never realized */
+      class PainterSurfaceNull:public PainterSurface
+      {
+      public:
+        PainterSurfaceNull(ivec2 dims, enum render_type_t render_type);
+
+        virtual
+        reference_counted_ptr<const Image>
+        image(ImageAtlas &atlas) const override;
+
+        virtual
+        const Viewport&
+        viewport(void) const override
+        {
+          return m_viewport;
+        }
+
+        virtual
+        void
+        viewport(const Viewport &vwp) override
+        {
+          m_viewport = vwp;
+        }
+
+        virtual
+        const vec4&
+        clear_color(void) const override
+        {
+          return m_clear_color;
+        }
+
+        virtual
+        void
+        clear_color(const vec4 &c) override
+        {
+          m_clear_color = c;
+        }
+
+        virtual
+        ivec2
+        dimensions(void) const override
+        {
+          return m_dimensions;
+        }
+
+        virtual
+        enum render_type_t
+        render_type(void) const override
+        {
+          return m_render_type;
+        }
+
+      private:
+        ivec2 m_dimensions;
+        enum render_type_t m_render_type;
+        Viewport m_viewport;
+        vec4 m_clear_color;
+        mutable std::mutex m_mutex;
+        mutable reference_counted_ptr<const Image> m_image;
+      };
+
+      /* PainterBackend whose PainterDraw objects write to host
+       * memory that is only counted and check-summed.
+       */
+      class PainterBackendNull:public PainterBackend
+      {
+      public:
+        explicit
+        PainterBackendNull(const reference_counted_ptr<PainterEngineNullState> &state);
+
+        ~PainterBackendNull();
+
+        virtual
+        unsigned int
+        attribs_per_mapping(void) const override final;
+
+        virtual
+        unsigned int
+        indices_per_mapping(void) const override final;
+
+        virtual
+        unsigned int
+        store_blocks_per_mapping(void) const override final;
+
+        virtual
+        void
+        on_pre_draw(const reference_counted_ptr<PainterSurface> &surface,
+                    bool clear_color_buffer,
+                    bool begin_new_target) override final;
+
+        virtual
+        void
+        on_post_draw(void) override final;
+
+        virtual
+        reference_counted_ptr<PainterDrawBreakAction>
+        bind_image(unsigned int slot,
+                   const reference_counted_ptr<const Image> &im) override final;
+
+        virtual
+        reference_counted_ptr<PainterDrawBreakAction>
+        bind_coverage_surface(const reference_counted_ptr<PainterSurface> &cvg_surface) override final;
+
+        virtual
+        reference_counted_ptr<PainterDraw>
+        map_draw(void) override final;
+
+        virtual
+        void
+        on_painter_begin(void) override final;
+
+      private:
+        class HostBuffers;
+        class BufferPool;
+        class DrawCommand;
+        class BindAction;
+
+        reference_counted_ptr<PainterEngineNullState> m_state;
+        reference_counted_ptr<BufferPool> m_pool;
+        reference_counted_ptr<PainterSurface> m_surface;
+      };
+    }
+  }
+}
+
+#endif
@@ -4,7 +4,9 @@ dirstack_$(sp)	:= $(d)
 d		:= $(dir)
 # End standard header
 
-FASTUIDRAW_PRIVATE_SOURCES += $(call filelist, painter_packer.cpp)
+FASTUIDRAW_PRIVATE_SOURCES += $(call filelist, painter_packer.cpp \
+	painter_command_list_private.cpp \
+	painter_display_list_private.cpp)
 
 # Begin standard footer
 d		:= $(dirstack_$(sp))
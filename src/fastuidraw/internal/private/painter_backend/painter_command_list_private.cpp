@@ -0,0 +1,327 @@
+/*!
+ * \file painter_command_list_private.cpp
+ * \brief file painter_command_list_private.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#include <algorithm>
+#include <private/painter_backend/painter_command_list_private.hpp>
+#include <private/util_private.hpp>
+
+//////////////////////////////////////////////////////////////
+// fastuidraw::detail::PainterBackendRecord::Buffers methods
+class fastuidraw::detail::PainterBackendRecord::Buffers:
+  public reference_counted<Buffers>::non_concurrent
+{
+public:
+  Buffers(unsigned int num_attribs,
+          unsigned int num_indices,
+          unsigned int num_store_blocks):
+    m_attributes(num_attribs),
+    m_header_attributes(num_attribs),
+    m_indices(num_indices),
+    m_store(num_store_blocks)
+  {}
+
+  std::vector<PainterAttribute> m_attributes;
+  std::vector<uint32_t> m_header_attributes;
+  std::vector<PainterIndex> m_indices;
+  std::vector<uvec4> m_store;
+};
+
+///////////////////////////////////////////////////////////////////
+// fastuidraw::detail::PainterBackendRecord::BindImageAction methods
+class fastuidraw::detail::PainterBackendRecord::BindImageAction:
+  public PainterDrawBreakAction
+{
+public:
+  BindImageAction(unsigned int slot,
+                  const reference_counted_ptr<const Image> &im):
+    m_slot(slot),
+    m_image(im)
+  {}
+
+  /* never executed, PainterPacker::draw_command_list() asks
+   * the PainterBackend of the merging Painter to bind m_image.
+   */
+  virtual
+  gpu_dirty_state
+  execute(PainterBackend*) const override
+  {
+    return gpu_dirty_state();
+  }
+
+  unsigned int m_slot;
+  reference_counted_ptr<const Image> m_image;
+};
+
+///////////////////////////////////////////////////////////////
+// fastuidraw::detail::PainterBackendRecord::DrawCommand methods
+class fastuidraw::detail::PainterBackendRecord::DrawCommand:
+  public PainterDraw
+{
+public:
+  DrawCommand(PainterBackendRecord *backend,
+              const reference_counted_ptr<Buffers> &buffers):
+    m_backend(backend),
+    m_target(backend->m_target),
+    m_buffers(buffers)
+  {
+    FASTUIDRAWassert(m_target);
+    m_attributes = make_c_array(m_buffers->m_attributes);
+    m_header_attributes = make_c_array(m_buffers->m_header_attributes);
+    m_indices = make_c_array(m_buffers->m_indices);
+    m_store = make_c_array(m_buffers->m_store);
+  }
+
+  virtual
+  bool
+  draw_break(enum PainterSurface::render_type_t render_type,
+             const PainterShaderGroup &old_groups,
+             const PainterShaderGroup &new_groups,
+             unsigned int indices_written) override
+  {
+    PainterCommandListSegment::Event E(PainterCommandListSegment::Event::group_change,
+                                       indices_written);
+
+    FASTUIDRAWunused(render_type);
+    FASTUIDRAWunused(old_groups);
+    E.m_item_group = new_groups.item_group();
+    E.m_brush_group = new_groups.brush_group();
+    E.m_blend_group = new_groups.blend_group();
+    E.m_blend_mode = new_groups.blend_mode();
+    E.m_blend_shader_type = new_groups.blend_shader_type();
+    m_segment.m_events.push_back(E);
+
+    /* the actual break, if any, is made when the
+     * list is merged, so none is reported here.
+     */
+    return false;
+  }
+
+  virtual
+  bool
+  draw_break(const reference_counted_ptr<const PainterDrawBreakAction> &action,
+             unsigned int indices_written) override
+  {
+    const BindImageAction *bind_image;
+
+    bind_image = dynamic_cast<const BindImageAction*>(action.get());
+    if (bind_image)
+      {
+        PainterCommandListSegment::Event E(PainterCommandListSegment::Event::bind_image,
+                                           indices_written);
+        E.m_slot = bind_image->m_slot;
+        E.m_image = bind_image->m_image;
+        m_segment.m_events.push_back(E);
+      }
+    else
+      {
+        PainterCommandListSegment::Event E(PainterCommandListSegment::Event::break_action,
+                                           indices_written);
+        E.m_action = action;
+        m_segment.m_events.push_back(E);
+      }
+    return false;
+  }
+
+  virtual
+  void
+  draw(void) const override
+  {
+    /* draw() is called in the order the PainterDraw objects
+     * were mapped, which is the order the segments need to
+     * be in the list; the segment is no longer needed by
+     * this object, so move it.
+     */
+    m_target->m_segments.push_back(PainterCommandListSegment());
+    std::swap(m_target->m_segments.back(), m_segment);
+  }
+
+protected:
+  virtual
+  void
+  unmap_implement(unsigned int attributes_written,
+                  unsigned int indices_written,
+                  unsigned int data_store_written) override
+  {
+    m_segment.m_attributes.assign(m_buffers->m_attributes.begin(),
+                                  m_buffers->m_attributes.begin() + attributes_written);
+    m_segment.m_header_attributes.assign(m_buffers->m_header_attributes.begin(),
+                                         m_buffers->m_header_attributes.begin() + attributes_written);
+    m_segment.m_indices.assign(m_buffers->m_indices.begin(),
+                               m_buffers->m_indices.begin() + indices_written);
+    m_segment.m_store.assign(m_buffers->m_store.begin(),
+                             m_buffers->m_store.begin() + data_store_written);
+
+    /* A header only needs to be relocated if an attribute
+     * references it; the attributes of a single header are
+     * written consecutively, so in almost all cases the
+     * std::sort() sees an already sorted array.
+     */
+    m_segment.m_headers.clear();
+    for (uint32_t h : m_segment.m_header_attributes)
+      {
+        if (m_segment.m_headers.empty() || m_segment.m_headers.back() != h)
+          {
+            m_segment.m_headers.push_back(h);
+          }
+      }
+    std::sort(m_segment.m_headers.begin(), m_segment.m_headers.end());
+    m_segment.m_headers.erase(std::unique(m_segment.m_headers.begin(), m_segment.m_headers.end()),
+                              m_segment.m_headers.end());
+
+    m_backend->m_free_buffers.push_back(m_buffers);
+    m_buffers.clear();
+  }
+
+private:
+  PainterBackendRecord *m_backend;
+  PainterCommandListPrivate *m_target;
+  reference_counted_ptr<Buffers> m_buffers;
+  mutable PainterCommandListSegment m_segment;
+};
+
+/////////////////////////////////////////////////////
+// fastuidraw::detail::PainterSurfaceRecord methods
+fastuidraw::detail::PainterSurfaceRecord::
+PainterSurfaceRecord(ivec2 dims):
+  m_dimensions(dims),
+  m_viewport(0, 0, dims.x(), dims.y()),
+  m_clear_color(0.0f, 0.0f, 0.0f, 0.0f)
+{}
+
+fastuidraw::reference_counted_ptr<const fastuidraw::Image>
+fastuidraw::detail::PainterSurfaceRecord::
+image(ImageAtlas&) const
+{
+  /* the content of a PainterCommandList is never
+   * realized to its own surface.
+   */
+  return nullptr;
+}
+
+//////////////////////////////////////////////////////////
+// fastuidraw::detail::PainterCommandListPrivate methods
+fastuidraw::detail::PainterCommandListPrivate::
+PainterCommandListPrivate(ivec2 dims):
+  m_surface(FASTUIDRAWnew PainterSurfaceRecord(dims)),
+  m_z_extent(0),
+  m_skipped_glyphs(false),
+  m_recording_failed(false),
+  m_glyph_pin(0)
+{}
+
+fastuidraw::detail::PainterCommandListPrivate::
+~PainterCommandListPrivate()
+{
+  clear();
+}
+
+void
+fastuidraw::detail::PainterCommandListPrivate::
+clear(void)
+{
+  m_segments.clear();
+  m_z_extent = 0;
+  m_skipped_glyphs = false;
+  m_recording_failed = false;
+  if (m_glyph_pin != 0)
+    {
+      FASTUIDRAWassert(m_engine);
+      m_engine->glyph_cache().unpin_glyphs(m_glyph_pin);
+      m_glyph_pin = 0;
+    }
+  m_glyphs.clear();
+  m_resources.clear();
+  m_engine.clear();
+}
+
+//////////////////////////////////////////////////////
+// fastuidraw::detail::PainterBackendRecord methods
+fastuidraw::detail::PainterBackendRecord::
+PainterBackendRecord(const PainterBackend &src):
+  m_attribs_per_mapping(src.attribs_per_mapping()),
+  m_indices_per_mapping(src.indices_per_mapping()),
+  m_store_blocks_per_mapping(src.store_blocks_per_mapping()),
+  m_store_size_unknown(m_store_blocks_per_mapping == 0),
+  m_target(nullptr)
+{
+  if (m_store_size_unknown)
+    {
+      /* the recorded content is dropped, the size only needs
+       * to be large enough for the packer to make progress.
+       */
+      m_store_blocks_per_mapping = 1024 * 64;
+    }
+}
+
+fastuidraw::detail::PainterBackendRecord::
+~PainterBackendRecord()
+{}
+
+void
+fastuidraw::detail::PainterBackendRecord::
+on_pre_draw(const reference_counted_ptr<PainterSurface>&, bool, bool)
+{}
+
+void
+fastuidraw::detail::PainterBackendRecord::
+on_post_draw(void)
+{}
+
+void
+fastuidraw::detail::PainterBackendRecord::
+on_painter_begin(void)
+{}
+
+fastuidraw::reference_counted_ptr<fastuidraw::PainterDrawBreakAction>
+fastuidraw::detail::PainterBackendRecord::
+bind_image(unsigned int slot,
+           const reference_counted_ptr<const Image> &im)
+{
+  return FASTUIDRAWnew BindImageAction(slot, im);
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::PainterDrawBreakAction>
+fastuidraw::detail::PainterBackendRecord::
+bind_coverage_surface(const reference_counted_ptr<PainterSurface>&)
+{
+  /* a Painter does not use deferred coverage
+   * buffers when recording to a PainterCommandList.
+   */
+  return nullptr;
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::PainterDraw>
+fastuidraw::detail::PainterBackendRecord::
+map_draw(void)
+{
+  reference_counted_ptr<Buffers> buffers;
+
+  if (m_free_buffers.empty())
+    {
+      buffers = FASTUIDRAWnew Buffers(m_attribs_per_mapping,
+                                      m_indices_per_mapping,
+                                      m_store_blocks_per_mapping);
+    }
+  else
+    {
+      buffers = m_free_buffers.back();
+      m_free_buffers.pop_back();
+    }
+
+  return FASTUIDRAWnew DrawCommand(this, buffers);
+}
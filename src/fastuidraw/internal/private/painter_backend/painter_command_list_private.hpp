@@ -0,0 +1,356 @@
+/*!
+ * \file painter_command_list_private.hpp
+ * \brief file painter_command_list_private.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#ifndef FASTUIDRAW_PAINTER_COMMAND_LIST_PRIVATE_HPP
+#define FASTUIDRAW_PAINTER_COMMAND_LIST_PRIVATE_HPP
+
+#include <vector>
+#include <fastuidraw/util/reference_counted.hpp>
+#include <fastuidraw/util/vecN.hpp>
+#include <fastuidraw/util/c_array.hpp>
+#include <fastuidraw/util/blend_mode.hpp>
+#include <fastuidraw/image.hpp>
+#include <fastuidraw/text/glyph.hpp>
+#include <fastuidraw/painter/attribute_data/painter_attribute.hpp>
+#include <fastuidraw/painter/shader/painter_blend_shader.hpp>
+#include <fastuidraw/painter/backend/painter_draw.hpp>
+#include <fastuidraw/painter/backend/painter_backend.hpp>
+#include <fastuidraw/painter/backend/painter_engine.hpp>
+#include <fastuidraw/painter/backend/painter_surface.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* A PainterCommandListSegment holds the data written to a
+     * single PainterDraw by a Painter recording to a
+     * PainterCommandList. Index values, header attribute values
+     * and the locations stored in the headers are all relative
+     * to the start of the segment so that the segment can be
+     * spliced into any PainterDraw that has room for it.
+     */
+    class PainterCommandListSegment
+    {
+    public:
+      /* An Event is a draw-break that the recording PainterPacker
+       * issued; m_indices_written is relative to the segment.
+       */
+      class Event
+      {
+      public:
+        enum type_t
+          {
+            /* the shader groups or blend mode changed */
+            group_change,
+
+            /* an Image of type Image::context_texture2d is bound */
+            bind_image,
+
+            /* a PainterDrawBreakAction from Painter::queue_action() */
+            break_action,
+          };
+
+        Event(enum type_t tp, unsigned int indices_written):
+          m_type(tp),
+          m_indices_written(indices_written),
+          m_item_group(0),
+          m_brush_group(0),
+          m_blend_group(0),
+          m_blend_shader_type(PainterBlendShader::number_types),
+          m_slot(0)
+        {}
+
+        enum type_t m_type;
+        unsigned int m_indices_written;
+
+        /* values for group_change */
+        uint32_t m_item_group;
+        uint32_t m_brush_group;
+        uint32_t m_blend_group;
+        BlendMode m_blend_mode;
+        enum PainterBlendShader::shader_type m_blend_shader_type;
+
+        /* values for bind_image */
+        unsigned int m_slot;
+        reference_counted_ptr<const Image> m_image;
+
+        /* value for break_action */
+        reference_counted_ptr<const PainterDrawBreakAction> m_action;
+      };
+
+      std::vector<PainterAttribute> m_attributes;
+      std::vector<uint32_t> m_header_attributes;
+      std::vector<PainterIndex> m_indices;
+      std::vector<uvec4> m_store;
+
+      /* location within m_store of each PainterHeader
+       * referenced by an attribute of the segment.
+       */
+      std::vector<uint32_t> m_headers;
+      std::vector<Event> m_events;
+    };
+
+    /* A PainterCommandListPatch holds values that replace blocks
+     * of the data store of a PainterCommandListSegment when the
+     * segment is added to a PainterDraw; the locations are
+     * relative to the start of the segment.
+     */
+    class PainterCommandListPatch
+    {
+    public:
+      void
+      clear(void)
+      {
+        m_locations.clear();
+        m_blocks.clear();
+      }
+
+      bool
+      empty(void) const
+      {
+        return m_locations.empty();
+      }
+
+      /* replace the blocks starting at location with the
+       * values of blocks.
+       */
+      void
+      add(uint32_t location, c_array<const uvec4> blocks)
+      {
+        for (const uvec4 &b : blocks)
+          {
+            m_locations.push_back(location++);
+            m_blocks.push_back(b);
+          }
+      }
+
+      std::vector<uint32_t> m_locations;
+      std::vector<uvec4> m_blocks;
+    };
+
+    /* The PainterSurface a Painter records against when
+     * recording to a PainterCommandList; it only gives
+     * the dimensions and viewport.
+     */
+    class PainterSurfaceRecord:public PainterSurface
+    {
+    public:
+      explicit
+      PainterSurfaceRecord(ivec2 dims);
+
+      virtual
+      reference_counted_ptr<const Image>
+      image(ImageAtlas &atlas) const override;
+
+      virtual
+      const Viewport&
+      viewport(void) const override
+      {
+        return m_viewport;
+      }
+
+      virtual
+      void
+      viewport(const Viewport &vwp) override
+      {
+        m_viewport = vwp;
+      }
+
+      virtual
+      const vec4&
+      clear_color(void) const override
+      {
+        return m_clear_color;
+      }
+
+      virtual
+      void
+      clear_color(const vec4 &c) override
+      {
+        m_clear_color = c;
+      }
+
+      virtual
+      ivec2
+      dimensions(void) const override
+      {
+        return m_dimensions;
+      }
+
+      virtual
+      enum render_type_t
+      render_type(void) const override
+      {
+        return color_buffer_type;
+      }
+
+    private:
+      ivec2 m_dimensions;
+      Viewport m_viewport;
+      vec4 m_clear_color;
+    };
+
+    /* Actual data behind a PainterCommandList */
+    class PainterCommandListPrivate
+    {
+    public:
+      explicit
+      PainterCommandListPrivate(ivec2 dims);
+
+      ~PainterCommandListPrivate();
+
+      /* Release the pinned glyphs and the resources held
+       * by this list and clear the segments.
+       */
+      void
+      clear(void);
+
+      reference_counted_ptr<PainterSurfaceRecord> m_surface;
+      std::vector<PainterCommandListSegment> m_segments;
+
+      /* number of z-values used by the recorded content */
+      int m_z_extent;
+
+      /* true if the recording skipped glyphs that were
+       * not resident, see Glyph::resident().
+       */
+      bool m_skipped_glyphs;
+
+      /* true if the recording met content that the list cannot
+       * hold, in which case the recorded content is dropped.
+       */
+      bool m_recording_failed;
+
+      /* the PainterEngine of the Painter that recorded the list */
+      reference_counted_ptr<PainterEngine> m_engine;
+
+      /* the glyphs drawn while recording; at the end of the
+       * recording they are pinned (see GlyphCache::pin_glyphs())
+       * so that their data is neither evicted nor moved while
+       * the list holds content, m_glyph_pin is the value
+       * returned by the pin.
+       */
+      std::vector<Glyph> m_glyphs;
+      uint64_t m_glyph_pin;
+
+      /* resources (images and color stops) referenced by the
+       * shader data of the recorded draws; holding a reference
+       * keeps their data on the atlases.
+       */
+      std::vector<reference_counted_ptr<const resource_base> > m_resources;
+    };
+
+    /* PainterBackend that a Painter uses when recording to a
+     * PainterCommandList; each PainterDraw it maps records its
+     * data into a PainterCommandListSegment that is added to
+     * the target list when PainterDraw::draw() is called. The
+     * sizes of the mappings match a backend of the PainterEngine
+     * so that each segment fits into a freshly mapped PainterDraw
+     * of the Painter that merges the list. If the backend does
+     * not report its store_blocks_per_mapping(), a fixed size is
+     * used and the recording is to be failed (see
+     * PainterCommandListPrivate::m_recording_failed).
+     */
+    class PainterBackendRecord:public PainterBackend
+    {
+    public:
+      explicit
+      PainterBackendRecord(const PainterBackend &src);
+
+      ~PainterBackendRecord();
+
+      /* true if the backend from which the sizes are
+       * taken does not report store_blocks_per_mapping().
+       */
+      bool
+      store_size_unknown(void) const
+      {
+        return m_store_size_unknown;
+      }
+
+      /* set the list to which to add recorded segments */
+      void
+      target(PainterCommandListPrivate *list)
+      {
+        m_target = list;
+      }
+
+      virtual
+      unsigned int
+      attribs_per_mapping(void) const override final
+      {
+        return m_attribs_per_mapping;
+      }
+
+      virtual
+      unsigned int
+      indices_per_mapping(void) const override final
+      {
+        return m_indices_per_mapping;
+      }
+
+      virtual
+      unsigned int
+      store_blocks_per_mapping(void) const override final
+      {
+        return m_store_blocks_per_mapping;
+      }
+
+      virtual
+      void
+      on_pre_draw(const reference_counted_ptr<PainterSurface> &surface,
+                  bool clear_color_buffer,
+                  bool begin_new_target) override final;
+
+      virtual
+      void
+      on_post_draw(void) override final;
+
+      virtual
+      reference_counted_ptr<PainterDrawBreakAction>
+      bind_image(unsigned int slot,
+                 const reference_counted_ptr<const Image> &im) override final;
+
+      virtual
+      reference_counted_ptr<PainterDrawBreakAction>
+      bind_coverage_surface(const reference_counted_ptr<PainterSurface> &cvg_surface) override final;
+
+      virtual
+      reference_counted_ptr<PainterDraw>
+      map_draw(void) override final;
+
+      virtual
+      void
+      on_painter_begin(void) override final;
+
+    private:
+      class Buffers;
+      class DrawCommand;
+      class BindImageAction;
+
+      unsigned int m_attribs_per_mapping;
+      unsigned int m_indices_per_mapping;
+      unsigned int m_store_blocks_per_mapping;
+      bool m_store_size_unknown;
+      PainterCommandListPrivate *m_target;
+      std::vector<reference_counted_ptr<Buffers> > m_free_buffers;
+    };
+  }
+}
+
+#endif
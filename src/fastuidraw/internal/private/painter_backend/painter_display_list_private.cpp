@@ -0,0 +1,379 @@
+/*!
+ * \file painter_display_list_private.cpp
+ * \brief file painter_display_list_private.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#include <algorithm>
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/painter/backend/painter_header.hpp>
+#include <private/painter_backend/painter_display_list_private.hpp>
+#include <private/util_private.hpp>
+#include <private/util_private_math.hpp>
+
+namespace
+{
+  /* the values of a PainterItemMatrix and PainterClipEquations
+   * each take 3 blocks of the data store.
+   */
+  typedef fastuidraw::vecN<fastuidraw::uvec4, 4> PackedBlocks;
+
+  bool
+  matrix_has_perspective(const fastuidraw::float3x3 &matrix)
+  {
+    const float tol(1e-5);
+    return fastuidraw::t_abs(matrix(2, 0)) > tol
+      || fastuidraw::t_abs(matrix(2, 1)) > tol;
+  }
+
+  template<typename T>
+  fastuidraw::c_array<const fastuidraw::uvec4>
+  pack_value(const T &value, PackedBlocks &dst)
+  {
+    fastuidraw::c_array<fastuidraw::uvec4> return_value;
+
+    FASTUIDRAWassert(value.data_size() <= dst.size());
+    return_value = fastuidraw::c_array<fastuidraw::uvec4>(dst.c_ptr(), value.data_size());
+    value.pack_data(return_value);
+    return return_value;
+  }
+
+  void
+  sort_unique(std::vector<uint32_t> &v)
+  {
+    std::sort(v.begin(), v.end());
+    v.erase(std::unique(v.begin(), v.end()), v.end());
+  }
+}
+
+////////////////////////////////////////////////////////////
+// fastuidraw::detail::PainterDisplayListPrivate methods
+fastuidraw::detail::PainterDisplayListPrivate::
+PainterDisplayListPrivate(void):
+  m_magnification_tolerance(1.25f),
+  m_number_recordings(0),
+  m_number_replays(0),
+  m_recorded(false),
+  m_draw_directly(false),
+  m_has_content_clipping(false)
+{}
+
+void
+fastuidraw::detail::PainterDisplayListPrivate::
+clear(void)
+{
+  m_recorded = false;
+  m_draw_directly = false;
+  m_segment_values.clear();
+  m_patches.clear();
+  m_has_content_clipping = false;
+}
+
+void
+fastuidraw::detail::PainterDisplayListPrivate::
+recorded(const PainterCommandListPrivate &list,
+         ivec2 viewport_dimensions,
+         const float3x3 &transformation,
+         const PainterClipEquations &base_clip,
+         uvec3 atlas_releases)
+{
+  PackedBlocks packed_base_clip_storage;
+  c_array<const uvec4> packed_base_clip;
+
+  m_recorded = true;
+  m_draw_directly = list.m_recording_failed;
+  m_viewport_dimensions = viewport_dimensions;
+  m_transformation = transformation;
+  m_transformation.inverse(m_inverse_transformation);
+  m_base_clip = base_clip;
+  m_atlas_releases = atlas_releases;
+  m_has_content_clipping = false;
+  packed_base_clip = pack_value(base_clip, packed_base_clip_storage);
+
+  m_segment_values.resize(list.m_segments.size());
+  for (unsigned int s = 0, ends = list.m_segments.size(); s < ends; ++s)
+    {
+      const PainterCommandListSegment &segment(list.m_segments[s]);
+      SegmentValues &values(m_segment_values[s]);
+      c_array<const uvec4> store(make_c_array(segment.m_store));
+      std::vector<uint32_t> clip_locations;
+
+      values.m_matrix_locations.clear();
+      values.m_matrices.clear();
+      values.m_base_clip_locations.clear();
+      values.m_clip_locations.clear();
+      values.m_clips.clear();
+
+      for (uint32_t h : segment.m_headers)
+        {
+          c_array<const uint32_t> hdr;
+          uint32_t matrix_location;
+
+          hdr = store.sub_array(h, PainterHeader::data_size()).flatten_array();
+
+          /* a location of 0 for the item matrix is the "null" value,
+           * see PainterPacker::per_draw_command::append_segment().
+           */
+          matrix_location = hdr[PainterHeader::item_matrix_location_offset];
+          if (matrix_location != 0u)
+            {
+              values.m_matrix_locations.push_back(matrix_location);
+            }
+          clip_locations.push_back(hdr[PainterHeader::clip_equations_location_offset]);
+        }
+
+      sort_unique(values.m_matrix_locations);
+      for (uint32_t loc : values.m_matrix_locations)
+        {
+          c_array<const uint32_t> data;
+          PainterItemMatrix M;
+
+          data = store.sub_array(loc, M.data_size()).flatten_array();
+          for (int r = 0; r < 3; ++r)
+            {
+              for (int c = 0; c < 3; ++c)
+                {
+                  M.m_item_matrix(r, c) = unpack_float(data[PainterItemMatrix::matrix_row0_col0_offset + 3 * r + c]);
+                }
+            }
+          M.m_normalized_translate.x() = unpack_float(data[PainterItemMatrix::normalized_translate_x]);
+          M.m_normalized_translate.y() = unpack_float(data[PainterItemMatrix::normalized_translate_y]);
+          values.m_matrices.push_back(M);
+        }
+
+      sort_unique(clip_locations);
+      for (uint32_t loc : clip_locations)
+        {
+          c_array<const uvec4> blocks;
+
+          blocks = store.sub_array(loc, packed_base_clip.size());
+          if (std::equal(blocks.begin(), blocks.end(), packed_base_clip.begin()))
+            {
+              values.m_base_clip_locations.push_back(loc);
+            }
+          else
+            {
+              c_array<const uint32_t> data(blocks.flatten_array());
+              PainterClipEquations cl;
+
+              for (int i = 0; i < 4; ++i)
+                {
+                  cl.m_clip_equations[i].x() = unpack_float(data[PainterClipEquations::clip0_coeff_x + 3 * i]);
+                  cl.m_clip_equations[i].y() = unpack_float(data[PainterClipEquations::clip0_coeff_y + 3 * i]);
+                  cl.m_clip_equations[i].z() = unpack_float(data[PainterClipEquations::clip0_coeff_w + 3 * i]);
+                }
+              values.m_clip_locations.push_back(loc);
+              values.m_clips.push_back(cl);
+              m_has_content_clipping = true;
+            }
+        }
+    }
+  ++m_number_recordings;
+}
+
+fastuidraw::uvec3
+fastuidraw::detail::PainterDisplayListPrivate::
+atlas_releases(const PainterEngine &engine)
+{
+  return uvec3(engine.glyph_atlas().number_times_released(),
+               engine.image_atlas().number_times_released(),
+               engine.colorstop_atlas().number_times_released());
+}
+
+bool
+fastuidraw::detail::PainterDisplayListPrivate::
+content_clipping_within(bool identity_delta,
+                        const float3x3 &delta,
+                        const PainterClipEquations &clip) const
+{
+  const float tol(1e-4);
+
+  /* The clip equations made by clipping in the content are
+   * not intersected against the clipping under which the
+   * list is drawn, so they are only correct if the regions
+   * they define are within it. The equations made by Painter
+   * are from a quadrilateral with the i'th equation from the
+   * edge [p_i, p_{i + 1}], thus the corner p_{i + 1} is given
+   * by the cross product of the i'th and (i + 1)'th equations.
+   */
+  for (const SegmentValues &values : m_segment_values)
+    {
+      for (const PainterClipEquations &cl : values.m_clips)
+        {
+          for (int i = 0; i < 4; ++i)
+            {
+              vec3 q;
+
+              q = cross_product(cl.m_clip_equations[i], cl.m_clip_equations[(i + 1) % 4]);
+              if (t_abs(q.z()) <= tol)
+                {
+                  return false;
+                }
+
+              q /= q.z();
+              if (!identity_delta)
+                {
+                  q = delta * q;
+                }
+
+              for (const vec3 &eq : clip.m_clip_equations)
+                {
+                  if (dot(eq, q) < -tol * t_abs(q.z()))
+                    {
+                      return false;
+                    }
+                }
+            }
+        }
+    }
+  return true;
+}
+
+enum fastuidraw::detail::PainterDisplayListPrivate::draw_method_t
+fastuidraw::detail::PainterDisplayListPrivate::
+compute_draw_method(const PainterCommandListPrivate &list,
+                    const PainterEngine *engine,
+                    ivec2 viewport_dimensions,
+                    const float3x3 &transformation,
+                    const PainterClipEquations &clip)
+{
+  bool identity_delta;
+  float3x3 delta, inverse_delta;
+
+  if (m_recorded && m_draw_directly)
+    {
+      return draw_directly;
+    }
+
+  if (!m_recorded
+      || list.m_engine.get() != engine
+      || viewport_dimensions != m_viewport_dimensions
+      || list.m_segments.size() != m_segment_values.size()
+      || atlas_releases(*engine) != m_atlas_releases)
+    {
+      return record_and_draw;
+    }
+
+  /* delta maps the clip-coordinates of the recording
+   * to the current clip-coordinates. Only a recording
+   * without perspective can be drawn under a different
+   * transformation; such a recording is not culled against
+   * its viewport (see Painter::draw_display_list()), so
+   * delta can show any part of it.
+   */
+  identity_delta = (transformation.raw_data() == m_transformation.raw_data());
+  if (!identity_delta)
+    {
+      if (matrix_has_perspective(transformation)
+          || matrix_has_perspective(m_transformation))
+        {
+          return record_and_draw;
+        }
+
+      vec2 svd, pixel_scale(0.5f * vec2(viewport_dimensions));
+      float2x2 M;
+      float tol(t_max(1.0f, m_magnification_tolerance));
+
+      delta = transformation * m_inverse_transformation;
+      delta.inverse(inverse_delta);
+
+      /* Painter chooses the level of detail of paths and glyphs
+       * from the magnification in pixels of the transformation,
+       * so measure how much delta changes that.
+       */
+      for (int r = 0; r < 2; ++r)
+        {
+          for (int c = 0; c < 2; ++c)
+            {
+              M(r, c) = delta(r, c) * pixel_scale[r] / (pixel_scale[c] * t_abs(delta(2, 2)));
+            }
+        }
+      svd = compute_singular_values(M);
+      if (svd[0] > tol || svd[1] * tol < 1.0f)
+        {
+          return record_and_draw;
+        }
+    }
+
+  if (m_has_content_clipping && !content_clipping_within(identity_delta, delta, clip))
+    {
+      return draw_directly;
+    }
+
+  compute_patches(identity_delta, delta, inverse_delta, clip);
+  return draw_retained;
+}
+
+void
+fastuidraw::detail::PainterDisplayListPrivate::
+compute_patches(bool identity_delta,
+                const float3x3 &delta,
+                const float3x3 &inverse_delta,
+                const PainterClipEquations &clip)
+{
+  bool same_clip;
+  PackedBlocks packed_clip_storage, tmp;
+  c_array<const uvec4> packed_clip;
+
+  same_clip = (clip.m_clip_equations == m_base_clip.m_clip_equations);
+  if (identity_delta && same_clip)
+    {
+      m_patches.clear();
+      return;
+    }
+
+  packed_clip = pack_value(clip, packed_clip_storage);
+  m_patches.resize(m_segment_values.size());
+  for (unsigned int s = 0, ends = m_segment_values.size(); s < ends; ++s)
+    {
+      const SegmentValues &values(m_segment_values[s]);
+      PainterCommandListPatch &patch(m_patches[s]);
+
+      patch.clear();
+      for (uint32_t loc : values.m_base_clip_locations)
+        {
+          patch.add(loc, packed_clip);
+        }
+
+      if (identity_delta)
+        {
+          continue;
+        }
+
+      for (unsigned int i = 0, endi = values.m_matrix_locations.size(); i < endi; ++i)
+        {
+          const PainterItemMatrix &src(values.m_matrices[i]);
+          PainterItemMatrix M(delta * src.m_item_matrix, src.m_normalized_translate);
+
+          patch.add(values.m_matrix_locations[i], pack_value(M, tmp));
+        }
+
+      for (unsigned int i = 0, endi = values.m_clip_locations.size(); i < endi; ++i)
+        {
+          PainterClipEquations cl;
+
+          /* a point p of the current clip-coordinates is the point
+           * inverse_delta * p of the clip-coordinates of the
+           * recording, thus the clip equation e becomes
+           * transpose(inverse_delta) * e.
+           */
+          for (int k = 0; k < 4; ++k)
+            {
+              cl.m_clip_equations[k] = values.m_clips[i].m_clip_equations[k] * inverse_delta;
+            }
+          patch.add(values.m_clip_locations[i], pack_value(cl, tmp));
+        }
+    }
+}
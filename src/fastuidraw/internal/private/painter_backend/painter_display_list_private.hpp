@@ -0,0 +1,152 @@
+/*!
+ * \file painter_display_list_private.hpp
+ * \brief file painter_display_list_private.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#ifndef FASTUIDRAW_PAINTER_DISPLAY_LIST_PRIVATE_HPP
+#define FASTUIDRAW_PAINTER_DISPLAY_LIST_PRIVATE_HPP
+
+#include <vector>
+#include <fastuidraw/util/matrix.hpp>
+#include <fastuidraw/util/c_array.hpp>
+#include <fastuidraw/painter/painter_command_list.hpp>
+#include <fastuidraw/painter/backend/painter_item_matrix.hpp>
+#include <fastuidraw/painter/backend/painter_clip_equations.hpp>
+#include <private/painter_backend/painter_command_list_private.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* Actual data behind a PainterDisplayList: the content is
+     * retained in a PainterCommandList together with where in
+     * the data store of each segment the item matrices and clip
+     * equations the headers reference are, so that the content
+     * can be drawn under a different transformation and clipping
+     * by only replacing those values.
+     */
+    class PainterDisplayListPrivate
+    {
+    public:
+      enum draw_method_t
+        {
+          /* copy the retained content, applying m_patches */
+          draw_retained,
+
+          /* record the content and then draw it */
+          record_and_draw,
+
+          /* call PainterDisplayList::draw_content() on the
+           * Painter that draws the list.
+           */
+          draw_directly,
+        };
+
+      PainterDisplayListPrivate(void);
+
+      void
+      clear(void);
+
+      /* To be called after the Painter that records the content
+       * to m_list ended; base_clip are the clip equations of the
+       * recording before any draw, which are replaced by the clip
+       * equations of the Painter that draws the list. The value of
+       * atlas_releases is the value of atlas_releases() from before
+       * the recording began.
+       */
+      void
+      recorded(const PainterCommandListPrivate &list,
+               ivec2 viewport_dimensions,
+               const float3x3 &transformation,
+               const PainterClipEquations &base_clip,
+               uvec3 atlas_releases);
+
+      /* Returns the values of number_times_released() of the
+       * glyph, image and colorstop atlases of an engine. The
+       * retained content does not keep the atlases locked, so
+       * it is only valid while these values do not change.
+       */
+      static
+      uvec3
+      atlas_releases(const PainterEngine &engine);
+
+      /* Decide how to draw the list with the passed state of the
+       * Painter that draws it; if the return value is draw_retained,
+       * the values to pass to PainterPacker::draw_command_list() are
+       * in m_patches.
+       */
+      enum draw_method_t
+      compute_draw_method(const PainterCommandListPrivate &list,
+                          const PainterEngine *engine,
+                          ivec2 viewport_dimensions,
+                          const float3x3 &transformation,
+                          const PainterClipEquations &clip);
+
+      reference_counted_ptr<PainterCommandList> m_list;
+      std::vector<PainterCommandListPatch> m_patches;
+      float m_magnification_tolerance;
+      unsigned int m_number_recordings;
+      unsigned int m_number_replays;
+
+    private:
+      /* the locations within the store of a segment of the
+       * item matrices and clip equations its headers use.
+       */
+      class SegmentValues
+      {
+      public:
+        std::vector<uint32_t> m_matrix_locations;
+        std::vector<PainterItemMatrix> m_matrices;
+
+        /* clip equations that are the clip equations of the
+         * recording before any draw.
+         */
+        std::vector<uint32_t> m_base_clip_locations;
+
+        /* clip equations made by clipping in the content */
+        std::vector<uint32_t> m_clip_locations;
+        std::vector<PainterClipEquations> m_clips;
+      };
+
+      bool
+      content_clipping_within(bool identity_delta,
+                              const float3x3 &delta,
+                              const PainterClipEquations &clip) const;
+
+      void
+      compute_patches(bool identity_delta,
+                      const float3x3 &delta,
+                      const float3x3 &inverse_delta,
+                      const PainterClipEquations &clip);
+
+      bool m_recorded;
+
+      /* the recording failed (see PainterCommandList::recording_failed()),
+       * the content is always drawn directly until clear().
+       */
+      bool m_draw_directly;
+      ivec2 m_viewport_dimensions;
+      float3x3 m_transformation;
+      float3x3 m_inverse_transformation;
+      PainterClipEquations m_base_clip;
+      uvec3 m_atlas_releases;
+      std::vector<SegmentValues> m_segment_values;
+      bool m_has_content_clipping;
+    };
+  }
+}
+
+#endif
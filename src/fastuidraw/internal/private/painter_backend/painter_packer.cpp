@@ -20,9 +20,11 @@
 #include <vector>
 #include <list>
 #include <cstring>
+#include <algorithm>
 
 #include <private/painter_backend/painter_packer.hpp>
 #include <private/painter_backend/painter_packed_value_pool_private.hpp>
+#include <private/painter_backend/painter_command_list_private.hpp>
 #include <private/util_private.hpp>
 
 namespace
@@ -67,6 +69,22 @@ namespace
     }
   };
 
+  /* Returns true if going from the shader groups a to the
+   * shader groups b requires PainterDraw::draw_break().
+   */
+  bool
+  groups_differ(enum fastuidraw::PainterSurface::render_type_t render_type,
+                const PainterShaderGroupPrivate &a,
+                const PainterShaderGroupPrivate &b)
+  {
+    return a.m_item_group != b.m_item_group
+      || a.m_blend_mode != b.m_blend_mode
+      || (render_type == fastuidraw::PainterSurface::color_buffer_type
+          && (a.m_blend_group != b.m_blend_group
+              || a.m_blend_shader_type != b.m_blend_shader_type
+              || a.m_brush_group != b.m_brush_group));
+  }
+
   template<typename T>
   T*
   get_shader(T*, const fastuidraw::PainterAttributeWriter::WriteState&)
@@ -346,7 +364,33 @@ public:
               int z,
               const painter_state_location &loc,
               const std::list<reference_counted_ptr<PainterPacker::DataCallBack> > &call_backs,
-              unsigned int *header_location);
+              unsigned int *header_location,
+              PainterShaderGroupPrivate *deferred_group);
+
+  /* Change the shader groups to current starting at the index
+   * indices_written, returns true if a draw break was needed.
+   */
+  bool
+  change_group(enum PainterSurface::render_type_t render_type,
+               const PainterShaderGroupPrivate &current,
+               unsigned int indices_written)
+  {
+    bool return_value(false);
+
+    if (groups_differ(render_type, m_prev_state, current))
+      {
+        return_value = m_draw_command->draw_break(render_type, m_prev_state,
+                                                  current, indices_written);
+      }
+    m_prev_state = current;
+    return return_value;
+  }
+
+  const PainterShaderGroupPrivate&
+  current_group(void) const
+  {
+    return m_prev_state;
+  }
 
   bool
   draw_break(const reference_counted_ptr<const PainterDrawBreakAction> &action)
@@ -358,6 +402,14 @@ public:
     return false;
   }
 
+  /* returns the number of draw breaks added */
+  unsigned int
+  append_segment(enum PainterSurface::render_type_t render_type,
+                 unsigned int header_size,
+                 const detail::PainterCommandListSegment &segment,
+                 const detail::PainterCommandListPatch *patch,
+                 int z_offset, PainterPacker *p);
+
   reference_counted_ptr<PainterDraw> m_draw_command;
   unsigned int m_attributes_written, m_indices_written;
 
@@ -387,6 +439,88 @@ private:
   PainterShaderRegistrar &m_registrar;
 };
 
+/* A reorder_window holds the draws to a color buffer that are
+ * buffered so that they can be reordered to reduce the number
+ * of changes of shader groups. The indices of buffered draws are
+ * written to m_indices at the same offsets they would have in
+ * PainterDraw::m_indices and are copied, in the new order, to
+ * PainterDraw::m_indices by PainterPacker::flush_reorder_window().
+ * The attributes and data store values are written directly
+ * since reordering does not move them.
+ */
+class fastuidraw::PainterPacker::reorder_window
+{
+public:
+  /* a range of indices sharing the same header */
+  class pending_draw
+  {
+  public:
+    PainterShaderGroupPrivate m_group;
+    unsigned int m_begin, m_end;
+    BoundingBox<float> m_bounds;
+    bool m_opaque;
+    int m_min_z, m_max_z;
+    unsigned int m_batch;
+  };
+
+  /* a set of pending draws using the same shader groups
+   * that are to be drawn consecutively.
+   */
+  class batch
+  {
+  public:
+    explicit
+    batch(const pending_draw &d):
+      m_group(d.m_group),
+      m_bounds(d.m_bounds),
+      m_opaque(d.m_opaque),
+      m_min_z(d.m_min_z),
+      m_max_z(d.m_max_z),
+      m_number_indices(0),
+      m_location(0)
+    {}
+
+    void
+    add(const pending_draw &d)
+    {
+      if (m_bounds.empty() || d.m_bounds.empty())
+        {
+          m_bounds.clear();
+        }
+      else
+        {
+          m_bounds.union_box(d.m_bounds);
+        }
+      m_opaque = m_opaque && d.m_opaque;
+      m_min_z = t_min(m_min_z, d.m_min_z);
+      m_max_z = t_max(m_max_z, d.m_max_z);
+    }
+
+    /* Returns true if drawing d before the draws of this batch
+     * gives the same result as drawing it after them. It is so
+     * if d does not touch what the draws of the batch touch or if
+     * none of them blend and their z-ranges are disjoint because
+     * then the depth test (GEQUAL) decides what is visible.
+     */
+    bool
+    commutes(const pending_draw &d) const
+    {
+      return (!m_bounds.empty() && !d.m_bounds.empty() && !m_bounds.intersects(d.m_bounds))
+        || (m_opaque && d.m_opaque && (d.m_min_z > m_max_z || d.m_max_z < m_min_z));
+    }
+
+    PainterShaderGroupPrivate m_group;
+    BoundingBox<float> m_bounds;
+    bool m_opaque;
+    int m_min_z, m_max_z;
+    unsigned int m_number_indices, m_location;
+  };
+
+  std::vector<pending_draw> m_draws;
+  std::vector<batch> m_batches;
+  std::vector<PainterIndex> m_indices;
+};
+
 //////////////////////////////////////////
 // fastuidraw::PainterPacker::per_draw_command methods
 fastuidraw::PainterPacker::per_draw_command::
@@ -488,7 +622,7 @@ pack_state_data(enum fastuidraw::PainterSurface::render_type_t render_type,
   std::copy(src.begin(), src.end(), dst.begin());
 
   d->m_painter[render_type] = p;
-  d->m_draw_command_id[render_type] = p->m_accumulated_draws.size();
+  d->m_draw_command_id[render_type] = p->m_number_commands;
   d->m_offset[render_type] = location;
 }
 
@@ -529,7 +663,8 @@ pack_header(enum PainterSurface::render_type_t render_type,
             int z,
             const painter_state_location &loc,
             const std::list<reference_counted_ptr<PainterPacker::DataCallBack> > &call_backs,
-            unsigned int *header_location)
+            unsigned int *header_location,
+            PainterShaderGroupPrivate *deferred_group)
 {
   bool return_value(false);
   c_array<uvec4> dst;
@@ -589,19 +724,17 @@ pack_header(enum PainterSurface::render_type_t render_type,
   header.m_deferred_coverage_max = deferred_params.m_deferred_coverage_max;
   header.pack_data(dst);
 
-  if (current.m_item_group != m_prev_state.m_item_group
-      || current.m_blend_mode != m_prev_state.m_blend_mode
-      || (render_type == PainterSurface::color_buffer_type &&
-          (current.m_blend_group != m_prev_state.m_blend_group
-           || current.m_blend_shader_type != m_prev_state.m_blend_shader_type
-           || current.m_brush_group != m_prev_state.m_brush_group) != 0u))
+  /* when draws are reordered, the change of shader groups
+   * is made by PainterPacker::flush_reorder_window().
+   */
+  if (deferred_group)
     {
-      return_value = m_draw_command->draw_break(render_type,
-                                                m_prev_state, current,
-                                                m_indices_written);
+      *deferred_group = current;
+    }
+  else
+    {
+      return_value = change_group(render_type, current, m_indices_written);
     }
-
-  m_prev_state = current;
 
   for (const auto &call_back: call_backs)
     {
@@ -611,6 +744,136 @@ pack_header(enum PainterSurface::render_type_t render_type,
   return return_value;
 }
 
+unsigned int
+fastuidraw::PainterPacker::per_draw_command::
+append_segment(enum PainterSurface::render_type_t render_type,
+               unsigned int header_size,
+               const detail::PainterCommandListSegment &segment,
+               const detail::PainterCommandListPatch *patch,
+               int z_offset, PainterPacker *p)
+{
+  unsigned int attrib_base(m_attributes_written);
+  unsigned int index_base(m_indices_written);
+  unsigned int store_base(store_written());
+  unsigned int return_value(0);
+  c_array<PainterAttribute> dst_attribs;
+  c_array<uint32_t> dst_header_attribs;
+  c_array<PainterIndex> dst_indices;
+  c_array<uvec4> dst_store;
+
+  FASTUIDRAWassert(segment.m_attributes.size() <= attribute_room());
+  FASTUIDRAWassert(segment.m_indices.size() <= index_room());
+  FASTUIDRAWassert(segment.m_store.size() <= store_room());
+
+  dst_attribs = m_draw_command->m_attributes.sub_array(attrib_base, segment.m_attributes.size());
+  std::copy(segment.m_attributes.begin(), segment.m_attributes.end(), dst_attribs.begin());
+
+  dst_header_attribs = m_draw_command->m_header_attributes.sub_array(attrib_base, segment.m_header_attributes.size());
+  for (unsigned int i = 0, endi = segment.m_header_attributes.size(); i < endi; ++i)
+    {
+      dst_header_attribs[i] = segment.m_header_attributes[i] + store_base;
+    }
+
+  dst_indices = m_draw_command->m_indices.sub_array(index_base, segment.m_indices.size());
+  for (unsigned int i = 0, endi = segment.m_indices.size(); i < endi; ++i)
+    {
+      dst_indices[i] = segment.m_indices[i] + attrib_base;
+    }
+
+  dst_store = allocate_store(segment.m_store.size());
+  std::copy(segment.m_store.begin(), segment.m_store.end(), dst_store.begin());
+  if (patch)
+    {
+      for (unsigned int i = 0, endi = patch->m_locations.size(); i < endi; ++i)
+        {
+          dst_store[patch->m_locations[i]] = patch->m_blocks[i];
+        }
+    }
+
+  /* Relocate the headers: the clip equations are always packed
+   * and thus their location is always relocated; the other
+   * locations are 0 when there is no data (and the blend shader
+   * location is PainterHeader::drawing_occluder for occluders).
+   */
+  for (uint32_t h : segment.m_headers)
+    {
+      c_array<uint32_t> hdr;
+
+      hdr = dst_store.sub_array(h, header_size).flatten_array();
+      hdr[PainterHeader::clip_equations_location_offset] += store_base;
+      for (unsigned int offset : { PainterHeader::item_matrix_location_offset,
+                                   PainterHeader::brush_shader_data_location_offset,
+                                   PainterHeader::item_shader_data_location_offset,
+                                   PainterHeader::brush_adjust_location_offset })
+        {
+          if (hdr[offset] != 0u)
+            {
+              hdr[offset] += store_base;
+            }
+        }
+
+      if (hdr[PainterHeader::blend_shader_data_location_offset] != 0u
+          && hdr[PainterHeader::blend_shader_data_location_offset] != PainterHeader::drawing_occluder)
+        {
+          hdr[PainterHeader::blend_shader_data_location_offset] += store_base;
+        }
+
+      hdr[PainterHeader::z_offset] = static_cast<uint32_t>(static_cast<int32_t>(hdr[PainterHeader::z_offset]) + z_offset);
+    }
+
+  /* replay the draw breaks of the segment */
+  for (const detail::PainterCommandListSegment::Event &E : segment.m_events)
+    {
+      unsigned int indices_written(index_base + E.m_indices_written);
+
+      switch (E.m_type)
+        {
+        case detail::PainterCommandListSegment::Event::group_change:
+          {
+            PainterShaderGroupPrivate current;
+
+            current.m_item_group = E.m_item_group;
+            current.m_brush_group = E.m_brush_group;
+            current.m_blend_group = E.m_blend_group;
+            current.m_blend_mode = E.m_blend_mode;
+            current.m_blend_shader_type = E.m_blend_shader_type;
+            if (change_group(render_type, current, indices_written))
+              {
+                ++return_value;
+              }
+          }
+          break;
+
+        case detail::PainterCommandListSegment::Event::bind_image:
+          if (E.m_slot < p->m_binded_images.size()
+              && p->m_binded_images[E.m_slot] != E.m_image.get())
+            {
+              reference_counted_ptr<PainterDrawBreakAction> action;
+
+              p->m_binded_images[E.m_slot] = E.m_image.get();
+              action = p->m_backend->bind_image(E.m_slot, E.m_image);
+              if (action && m_draw_command->draw_break(action, indices_written))
+                {
+                  ++return_value;
+                }
+            }
+          break;
+
+        case detail::PainterCommandListSegment::Event::break_action:
+          if (m_draw_command->draw_break(E.m_action, indices_written))
+            {
+              ++return_value;
+            }
+          break;
+        }
+    }
+
+  m_attributes_written += segment.m_attributes.size();
+  m_indices_written += segment.m_indices.size();
+
+  return return_value;
+}
+
 //////////////////////////////////////////////////
 // fastuidraw::PainterPacker::DataCallBack methods
 fastuidraw::PainterPacker::DataCallBack::
@@ -653,15 +916,143 @@ PainterPacker(PainterBrushShader *default_brush_shader,
   m_blend_shader(nullptr),
   m_number_commands(0),
   m_clear_color_buffer(false),
-  m_stats(stats)
+  m_stats(stats),
+  m_reorder_window_size(0),
+  m_resource_list(nullptr)
 {
   m_header_size = PainterHeader::data_size();
   m_binded_images.resize(config.number_context_textures());
+  m_reorder_window = FASTUIDRAWnew reorder_window();
 }
 
 fastuidraw::PainterPacker::
 ~PainterPacker()
 {
+  FASTUIDRAWdelete(m_reorder_window);
+}
+
+unsigned int
+fastuidraw::PainterPacker::
+draw_reorder_window(void) const
+{
+  return m_reorder_window_size;
+}
+
+void
+fastuidraw::PainterPacker::
+draw_reorder_window(unsigned int v)
+{
+  if (!m_accumulated_draws.empty())
+    {
+      flush_reorder_window();
+      m_reorder_window->m_indices.resize(m_accumulated_draws.back().m_draw_command->m_indices.size());
+    }
+  m_reorder_window_size = v;
+}
+
+void
+fastuidraw::PainterPacker::
+flush_reorder_window(void)
+{
+  std::vector<reorder_window::pending_draw> &draws(m_reorder_window->m_draws);
+  std::vector<reorder_window::batch> &batches(m_reorder_window->m_batches);
+  unsigned int location, breaks_in_order(0), breaks_reordered(0);
+
+  if (draws.empty())
+    {
+      return;
+    }
+
+  per_draw_command &cmd(m_accumulated_draws.back());
+  draws.back().m_end = cmd.m_indices_written;
+
+  /* Each draw is added to the last batch using the same shader
+   * groups that it can be moved in front of; a batch it cannot
+   * be moved in front of ends the search, in which case the draw
+   * starts a new batch. Thus draws are only ever moved earlier and
+   * only in front of draws they commute with.
+   */
+  batches.clear();
+  for (reorder_window::pending_draw &d : draws)
+    {
+      unsigned int dst(batches.size());
+
+      for (unsigned int b = batches.size(); b > 0; --b)
+        {
+          const reorder_window::batch &B(batches[b - 1]);
+          if (!groups_differ(m_render_type, B.m_group, d.m_group))
+            {
+              dst = b - 1;
+              break;
+            }
+
+          if (!B.commutes(d))
+            {
+              break;
+            }
+        }
+
+      if (dst == batches.size())
+        {
+          batches.push_back(reorder_window::batch(d));
+        }
+      else
+        {
+          batches[dst].add(d);
+        }
+      d.m_batch = dst;
+      batches[dst].m_number_indices += d.m_end - d.m_begin;
+    }
+
+  location = draws.front().m_begin;
+  for (reorder_window::batch &B : batches)
+    {
+      B.m_location = location;
+      location += B.m_number_indices;
+    }
+  FASTUIDRAWassert(location == cmd.m_indices_written);
+
+  /* count the changes of groups in submission order before
+   * issuing the ones of the reordered draws.
+   */
+  const PainterShaderGroupPrivate *prev(&cmd.current_group());
+  for (const reorder_window::pending_draw &d : draws)
+    {
+      if (groups_differ(m_render_type, *prev, d.m_group))
+        {
+          ++breaks_in_order;
+        }
+      prev = &d.m_group;
+    }
+
+  for (const reorder_window::pending_draw &d : draws)
+    {
+      reorder_window::batch &B(batches[d.m_batch]);
+      unsigned int count(d.m_end - d.m_begin);
+
+      std::copy(m_reorder_window->m_indices.begin() + d.m_begin,
+                m_reorder_window->m_indices.begin() + d.m_end,
+                cmd.m_draw_command->m_indices.begin() + B.m_location);
+      B.m_location += count;
+    }
+
+  for (const reorder_window::batch &B : batches)
+    {
+      /* B.m_location is now the end of the indices of B */
+      if (groups_differ(m_render_type, cmd.current_group(), B.m_group))
+        {
+          ++breaks_reordered;
+        }
+
+      if (cmd.change_group(m_render_type, B.m_group, B.m_location - B.m_number_indices))
+        {
+          ++m_stats[PainterEnums::num_draws];
+        }
+    }
+
+  FASTUIDRAWassert(breaks_reordered <= breaks_in_order);
+  m_stats[PainterEnums::num_draw_breaks_avoided] += breaks_in_order - breaks_reordered;
+  draws.clear();
 }
 
 void
@@ -670,6 +1061,8 @@ start_new_command(void)
 {
   if (!m_accumulated_draws.empty())
     {
+      flush_reorder_window();
+
       per_draw_command &c(m_accumulated_draws.back());
 
       m_stats[PainterEnums::num_attributes] += c.m_attributes_written;
@@ -683,6 +1076,10 @@ start_new_command(void)
   r = m_backend->map_draw();
   ++m_number_commands;
   m_accumulated_draws.push_back(per_draw_command(m_registrar, r));
+  if (m_reorder_window_size > 0u)
+    {
+      m_reorder_window->m_indices.resize(r->m_indices.size());
+    }
 }
 
 template<typename T>
@@ -737,6 +1134,40 @@ compute_room_needed_for_packing(const PainterPackerData &draw_state)
   return R;
 }
 
+template<typename T>
+void
+fastuidraw::PainterPacker::
+save_resources(const PainterDataValue<T> &obj)
+{
+  c_array<const reference_counted_ptr<const resource_base> > resources;
+  unsigned int sz;
+
+  FASTUIDRAWassert(m_resource_list);
+  if (obj.m_packed_value)
+    {
+      detail::PackedValuePoolBase::ElementBase *d;
+
+      d = static_cast<detail::PackedValuePoolBase::ElementBase*>(obj.m_packed_value.opaque_data());
+      resources = make_c_array(d->m_resources);
+    }
+  else if (obj.m_value != nullptr && obj.m_value->number_resources() > 0u)
+    {
+      sz = m_resource_list->size();
+      m_resource_list->resize(sz + obj.m_value->number_resources());
+      obj.m_value->save_resources(make_c_array(*m_resource_list).sub_array(sz));
+      return;
+    }
+
+  for (const auto &r : resources)
+    {
+      /* consecutive draws typically use the same resources */
+      if (m_resource_list->empty() || m_resource_list->back() != r)
+        {
+          m_resource_list->push_back(r);
+        }
+    }
+}
+
 bool
 fastuidraw::PainterPacker::
 upload_draw_state(const PainterPackerData &draw_state)
@@ -753,6 +1184,15 @@ upload_draw_state(const PainterPackerData &draw_state)
     }
   m_accumulated_draws.back().pack_painter_state(m_render_type, draw_state,
                                                 this, m_painter_state_location);
+  if (m_resource_list)
+    {
+      save_resources(draw_state.m_item_shader_data);
+      if (m_render_type == PainterSurface::color_buffer_type)
+        {
+          save_resources(draw_state.m_blend_shader_data);
+          save_resources(draw_state.m_brush.brush_shader_data());
+        }
+    }
 
   if (m_render_type == PainterSurface::color_buffer_type)
     {
@@ -769,6 +1209,11 @@ upload_draw_state(const PainterPackerData &draw_state)
 
               m_binded_images[i] = images[i].get();
               action = m_backend->bind_image(i, images[i]);
+              if (action)
+                {
+                  /* draws are not reordered across binding an image */
+                  flush_reorder_window();
+                }
               if (m_accumulated_draws.back().draw_break(action))
                 {
                   ++m_stats[PainterEnums::num_draws];
@@ -794,6 +1239,7 @@ draw_generic_implement(const DeferredCoverageReadParams &deferred_params,
   PainterAttributeWriter::WriteState write_state;
   int last_z_begin(0), max_z_end(0);
   ShaderType *shader;
+  bool reorder(reordering_draws());
 
   state_length = src.state_length();
   m_work_room.m_state_values.resize(state_length);
@@ -859,6 +1305,7 @@ draw_generic_implement(const DeferredCoverageReadParams &deferred_params,
         {
           bool draw_break_added;
           const PainterBrushShader *brush_shader;
+          reorder_window::pending_draw pending;
 
           ++m_stats[PainterEnums::num_headers];
           allocate_header = false;
@@ -875,13 +1322,45 @@ draw_generic_implement(const DeferredCoverageReadParams &deferred_params,
                                              z + write_state.m_z_range.m_begin,
                                              m_painter_state_location,
                                              m_callback_list,
-                                             &header_loc);
+                                             &header_loc,
+                                             (reorder) ? &pending.m_group : nullptr);
           last_z_begin = write_state.m_z_range.m_begin;
           max_z_end = t_max(max_z_end, write_state.m_z_range.m_end);
           if (draw_break_added)
             {
               ++m_stats[PainterEnums::num_draws];
             }
+
+          if (reorder)
+            {
+              /* the values of the headers of draws made while a
+               * DataCallBack is active can be changed after the
+               * draw, so do not move them or draws across them.
+               */
+              if (!m_callback_list.empty())
+                {
+                  pending.m_opaque = false;
+                }
+              else
+                {
+                  pending.m_bounds = draw.m_bounds;
+                  pending.m_opaque = !pending.m_group.m_blend_mode.blending_on()
+                    && pending.m_group.m_blend_shader_type != PainterBlendShader::framebuffer_fetch;
+                }
+              pending.m_min_z = z + write_state.m_z_range.m_begin;
+              pending.m_max_z = z + t_max(write_state.m_z_range.m_begin, write_state.m_z_range.m_end);
+              pending.m_begin = cmd.m_indices_written;
+
+              if (m_reorder_window->m_draws.size() >= m_reorder_window_size)
+                {
+                  flush_reorder_window();
+                }
+              else if (!m_reorder_window->m_draws.empty())
+                {
+                  m_reorder_window->m_draws.back().m_end = pending.m_begin;
+                }
+              m_reorder_window->m_draws.push_back(pending);
+            }
         }
 
       /* Note that we allow the arrays to be bigger than what src
@@ -894,7 +1373,9 @@ draw_generic_implement(const DeferredCoverageReadParams &deferred_params,
       c_array<uint32_t> dst_indices, dst_header;
 
       dst_attribs = cmd.m_draw_command->m_attributes.sub_array(cmd.m_attributes_written);
-      dst_indices = cmd.m_draw_command->m_indices.sub_array(cmd.m_indices_written);
+      dst_indices = (reorder) ?
+        make_c_array(m_reorder_window->m_indices).sub_array(cmd.m_indices_written) :
+        cmd.m_draw_command->m_indices.sub_array(cmd.m_indices_written);
 
       data_to_write = src.write_data(dst_attribs, dst_indices,
                                      cmd.m_attributes_written,
@@ -910,6 +1391,12 @@ draw_generic_implement(const DeferredCoverageReadParams &deferred_params,
       cmd.m_attributes_written += num_attribs_written;
       cmd.m_indices_written += num_indices_written;
 
+      if (reorder)
+        {
+          reorder_window::pending_draw &pending(m_reorder_window->m_draws.back());
+          pending.m_max_z = t_max(pending.m_max_z, z + write_state.m_z_range.m_end);
+        }
+
       ShaderType *next_shader;
       next_shader = get_shader<ShaderType>(pshader, write_state);
 
@@ -988,6 +1475,8 @@ flush_implement(void)
 {
   if (!m_accumulated_draws.empty())
     {
+      flush_reorder_window();
+
       per_draw_command &c(m_accumulated_draws.back());
       m_stats[PainterEnums::num_attributes] += c.m_attributes_written;
       m_stats[PainterEnums::num_indices] += c.m_indices_written;
@@ -1044,6 +1533,11 @@ void
 fastuidraw::PainterPacker::
 draw_break(const reference_counted_ptr<const PainterDrawBreakAction> &action)
 {
+  if (action)
+    {
+      flush_reorder_window();
+    }
+
   if (m_accumulated_draws.back().draw_break(action))
     {
       ++m_stats[PainterEnums::num_draws];
@@ -1059,6 +1553,10 @@ set_coverage_surface(const reference_counted_ptr<PainterSurface> &surface)
       reference_counted_ptr<PainterDrawBreakAction> action;
 
       action = m_backend->bind_coverage_surface(surface);
+      if (action)
+        {
+          flush_reorder_window();
+        }
       if (m_accumulated_draws.back().draw_break(action))
         {
           ++m_stats[PainterEnums::num_draws];
@@ -1115,6 +1613,55 @@ draw_generic(PainterItemCoverageShader *shader,
   draw_generic_implement(DeferredCoverageReadParams(), shader, data, src, 0);
 }
 
+void
+fastuidraw::PainterPacker::
+draw_command_list(const detail::PainterCommandListPrivate &list,
+                  int z_offset,
+                  c_array<const detail::PainterCommandListPatch> patches)
+{
+  FASTUIDRAWassert(m_render_type == PainterSurface::color_buffer_type);
+  FASTUIDRAWassert(patches.empty() || patches.size() == list.m_segments.size());
+
+  /* the recorded content is not reordered with the draws before it */
+  flush_reorder_window();
+  for (unsigned int s = 0, ends = list.m_segments.size(); s < ends; ++s)
+    {
+      const detail::PainterCommandListSegment &segment(list.m_segments[s]);
+      const detail::PainterCommandListPatch *patch;
+
+      patch = (patches.empty() || patches[s].empty()) ? nullptr : &patches[s];
+      if (segment.m_indices.empty() && segment.m_events.empty())
+        {
+          continue;
+        }
+
+      if (segment.m_attributes.size() > m_accumulated_draws.back().attribute_room()
+          || segment.m_indices.size() > m_accumulated_draws.back().index_room()
+          || segment.m_store.size() > m_accumulated_draws.back().store_room())
+        {
+          start_new_command();
+          if (segment.m_attributes.size() > m_accumulated_draws.back().attribute_room()
+              || segment.m_indices.size() > m_accumulated_draws.back().index_room()
+              || segment.m_store.size() > m_accumulated_draws.back().store_room())
+            {
+              FASTUIDRAWmessaged_assert(false,
+                                        "Unable to fit recorded segment into freshly "
+                                        "allocated draw command, skipping it");
+              continue;
+            }
+        }
+
+      /* DataCallBack objects are not invoked on the headers of the
+       * list; the only user of them, Painter's occluder drawing, is
+       * never active while a list is merged.
+       */
+      m_stats[PainterEnums::num_headers] += segment.m_headers.size();
+      m_stats[PainterEnums::num_draws] +=
+        m_accumulated_draws.back().append_segment(m_render_type, m_header_size,
+                                                  segment, patch, z_offset, this);
+    }
+}
+
 unsigned int
 fastuidraw::PainterPacker::
 current_indices_written(void) { return m_accumulated_draws.back().m_indices_written; }
@@ -47,6 +47,13 @@
 
 namespace fastuidraw
 {
+  namespace detail
+  {
+    class PainterCommandListPrivate;
+    class PainterCommandListSegment;
+    class PainterCommandListPatch;
+  }
+
 /*!\addtogroup PainterBackend
  * @{
  */
@@ -66,7 +73,7 @@ namespace fastuidraw
          * supported. Sync this with the last enumeration
          * in PainterEnums::query_stats_t
          */
-        num_stats = PainterEnums::num_deferred_coverages + 1
+        num_stats = PainterEnums::num_draw_breaks_avoided + 1
       };
 
     /*!
@@ -175,6 +182,42 @@ namespace fastuidraw
       m_blend_mode = blend_mode;
     }
 
+    /*!
+     * Set the vector to which the resources (see
+     * PainterShaderData::DataBase::save_resources()) of the
+     * item, blend and brush shader data of each draw are
+     * appended; nullptr stops collecting them. This is used
+     * by recording a PainterCommandList so that the list holds
+     * the resources its recorded data references.
+     */
+    void
+    resource_list(std::vector<reference_counted_ptr<const resource_base> > *dst)
+    {
+      m_resource_list = dst;
+    }
+
+    /*!
+     * Returns the value set by draw_reorder_window(unsigned int).
+     */
+    unsigned int
+    draw_reorder_window(void) const;
+
+    /*!
+     * Set the number of draws the PainterPacker buffers when
+     * drawing to a color buffer in order to reorder them so
+     * that draws using the same shader groups are adjacent,
+     * which reduces the number of draw breaks. A draw is only
+     * moved in front of draws that it commutes with: those
+     * whose PainterPackerData::m_bounds do not intersect its
+     * bounds, or, when neither draw blends, those whose z-range
+     * does not intersect its z-range. Draw break actions, image
+     * binds and draws made while a \ref DataCallBack is active
+     * are never reordered across. A value of 0, the default,
+     * disables reordering.
+     */
+    void
+    draw_reorder_window(unsigned int v);
+
     /*!
      * Add a \ref DataCallBack to this PainterPacker. A fixed DataCallBack
      * can only be active on one PainterPacker, but a single PainterPacker
@@ -357,6 +400,22 @@ namespace fastuidraw
                  const PainterPackerData &data,
                  const PainterAttributeWriter &src);
 
+    /*!
+     * Splice the segments recorded in a PainterCommandList
+     * onto the accumulated draws. The content is copied and
+     * the store locations of the headers of the list are
+     * relocated, but no attribute or index is re-generated.
+     * \param list recorded content to add
+     * \param z_offset value to add to the z of each recorded header
+     * \param patches if non-empty, patches[i] gives the data store
+     *                values to replace for the i'th segment of list
+     */
+    void
+    draw_command_list(const detail::PainterCommandListPrivate &list,
+                      int z_offset,
+                      c_array<const detail::PainterCommandListPatch> patches
+                      = c_array<const detail::PainterCommandListPatch>());
+
     /*!
      * Returns the current accumulated draw the PainterPacker is on
      */
@@ -397,6 +456,7 @@ namespace fastuidraw
 
   private:
     class per_draw_command;
+    class reorder_window;
     class painter_state_location
     {
     public:
@@ -417,9 +477,23 @@ namespace fastuidraw
     void
     start_new_command(void);
 
+    bool
+    reordering_draws(void) const
+    {
+      return m_render_type == PainterSurface::color_buffer_type
+        && m_reorder_window_size > 0u;
+    }
+
+    void
+    flush_reorder_window(void);
+
     bool //return true if it started a new command
     upload_draw_state(const PainterPackerData &draw_state);
 
+    template<typename T>
+    void
+    save_resources(const PainterDataValue<T> &obj);
+
     unsigned int
     compute_room_needed_for_packing(const PainterPackerData &draw_state);
 
@@ -462,6 +536,10 @@ namespace fastuidraw
     Workroom m_work_room;
     vecN<unsigned int, num_stats> &m_stats;
 
+    unsigned int m_reorder_window_size;
+    reorder_window *m_reorder_window;
+    std::vector<reference_counted_ptr<const resource_base> > *m_resource_list;
+
     std::list<reference_counted_ptr<PainterPacker::DataCallBack> > m_callback_list;
   };
 /*! @} */
@@ -22,6 +22,7 @@
 #include <fastuidraw/painter/shader_data/painter_data.hpp>
 #include <fastuidraw/painter/backend/painter_brush_adjust.hpp>
 #include <private/painter_backend/painter_packed_value_pool_private.hpp>
+#include <private/bounding_box.hpp>
 
 namespace fastuidraw
 {
@@ -67,6 +68,14 @@ namespace fastuidraw
      * value for the brush adjust
      */
     detail::PackedValuePool<fastuidraw::PainterBrushAdjust>::ElementHandle m_brush_adjust;
+
+    /*!
+     * A bounding box in normalized device coordinates of
+     * what the draw can touch, used by PainterPacker to
+     * decide if draws can be reordered. An empty box
+     * indicates that the draw can touch anything.
+     */
+    BoundingBox<float> m_bounds;
   };
 
 /*! @} */
@@ -0,0 +1,218 @@
+/*!
+ * \file worker_pool.cpp
+ * \brief file worker_pool.cpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#include <fastuidraw/util/math.hpp>
+#include <private/util_private.hpp>
+#include <private/worker_pool.hpp>
+
+////////////////////////////////////////
+// fastuidraw::detail::WorkerPool methods
+fastuidraw::detail::WorkerPool::
+WorkerPool(void):
+  m_max_running_tasks(t_max(1u, std::thread::hardware_concurrency())),
+  m_num_running_tasks(0),
+  m_next_task_id(0),
+  m_stop(false)
+{}
+
+fastuidraw::detail::WorkerPool::
+~WorkerPool()
+{
+  std::vector<std::thread> threads;
+
+  {
+    std::lock_guard<std::mutex> M(m_mutex);
+    FASTUIDRAWassert(m_jobs.empty());
+    m_stop = true;
+    m_tasks.clear();
+    m_condition.notify_all();
+    threads.swap(m_threads);
+  }
+
+  for (std::thread &t : threads)
+    {
+      t.join();
+    }
+}
+
+fastuidraw::detail::WorkerPool&
+fastuidraw::detail::WorkerPool::
+global(void)
+{
+  static WorkerPool R;
+  return R;
+}
+
+void
+fastuidraw::detail::WorkerPool::
+run(unsigned int num_jobs, const std::function<void (unsigned int)> &f)
+{
+  if (num_jobs <= 1u)
+    {
+      if (num_jobs == 1u)
+        {
+          f(0);
+        }
+      return;
+    }
+
+  Batch batch(f, num_jobs - 1u);
+
+  {
+    std::lock_guard<std::mutex> M(m_mutex);
+
+    /* threads running a task from post() are not available
+     * to run jobs, do not count them.
+     */
+    while (m_threads.size() < num_jobs - 1u + m_num_running_tasks)
+      {
+        m_threads.push_back(std::thread(&WorkerPool::thread_main, this));
+      }
+
+    for (unsigned int i = 1; i < num_jobs; ++i)
+      {
+        Job J;
+
+        J.m_batch = &batch;
+        J.m_index = i;
+        m_jobs.push_back(J);
+      }
+    m_condition.notify_all();
+  }
+
+  f(0);
+
+  /* Rather than sleeping until the other jobs of the batch
+   * are done, run queued jobs (of any batch); this way a job
+   * that itself calls run() can never leave the pool with
+   * every thread waiting on jobs that no thread will run.
+   */
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (batch.m_remaining != 0u)
+    {
+      if (!m_jobs.empty())
+        {
+          run_front_job(lock);
+        }
+      else
+        {
+          m_condition.wait(lock);
+        }
+    }
+}
+
+uint64_t
+fastuidraw::detail::WorkerPool::
+post(const std::function<void ()> &f)
+{
+  std::lock_guard<std::mutex> M(m_mutex);
+  Task T;
+
+  T.m_id = m_next_task_id++;
+  T.m_f = f;
+  m_tasks.push_back(T);
+
+  while (m_threads.size() < t_min(m_max_running_tasks,
+                                   m_num_running_tasks + static_cast<unsigned int>(m_tasks.size())))
+    {
+      m_threads.push_back(std::thread(&WorkerPool::thread_main, this));
+    }
+  m_condition.notify_all();
+
+  return T.m_id;
+}
+
+bool
+fastuidraw::detail::WorkerPool::
+cancel(uint64_t id)
+{
+  std::lock_guard<std::mutex> M(m_mutex);
+  for (auto iter = m_tasks.begin(); iter != m_tasks.end(); ++iter)
+    {
+      if (iter->m_id == id)
+        {
+          m_tasks.erase(iter);
+          return true;
+        }
+    }
+  return false;
+}
+
+void
+fastuidraw::detail::WorkerPool::
+run_front_job(std::unique_lock<std::mutex> &lock)
+{
+  Job J;
+
+  FASTUIDRAWassert(!m_jobs.empty());
+  J = m_jobs.front();
+  m_jobs.pop_front();
+  lock.unlock();
+
+  J.m_batch->m_f(J.m_index);
+
+  lock.lock();
+  FASTUIDRAWassert(J.m_batch->m_remaining > 0u);
+  if (--J.m_batch->m_remaining == 0u)
+    {
+      m_condition.notify_all();
+    }
+}
+
+void
+fastuidraw::detail::WorkerPool::
+thread_main(void)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+
+  for (;;)
+    {
+      m_condition.wait(lock, [this]()
+                       {
+                         return m_stop || !m_jobs.empty() || can_start_task();
+                       });
+      if (m_stop)
+        {
+          return;
+        }
+
+      /* jobs of run() have a caller waiting on them,
+       * so they go before tasks of post().
+       */
+      if (!m_jobs.empty())
+        {
+          run_front_job(lock);
+        }
+      else
+        {
+          std::function<void ()> f;
+
+          f.swap(m_tasks.front().m_f);
+          m_tasks.pop_front();
+          ++m_num_running_tasks;
+          lock.unlock();
+
+          f();
+          f = nullptr;
+
+          lock.lock();
+          --m_num_running_tasks;
+          m_condition.notify_all();
+        }
+    }
+}
@@ -0,0 +1,149 @@
+/*!
+ * \file worker_pool.hpp
+ * \brief file worker_pool.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#ifndef FASTUIDRAW_WORKER_POOL_HPP
+#define FASTUIDRAW_WORKER_POOL_HPP
+
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <stdint.h>
+
+#include <fastuidraw/util/util.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* A set of threads that live as long as the pool and run
+     * jobs handed to run() and tasks handed to post(); this
+     * avoids paying for thread creation every time a small
+     * piece of work is split across threads.
+     */
+    class WorkerPool:noncopyable
+    {
+    public:
+      WorkerPool(void);
+
+      ~WorkerPool();
+
+      /* The pool shared by the library */
+      static
+      WorkerPool&
+      global(void);
+
+      /* Run f(0), f(1), ..., f(num_jobs - 1) and return once
+       * all of them have returned. The job f(0) is run on the
+       * calling thread, the other jobs are run by the threads
+       * of the pool; the pool grows to num_jobs - 1 threads
+       * if it has fewer. May be called from several threads
+       * at the same time and from within a job; while waiting,
+       * the calling thread runs queued jobs.
+       */
+      void
+      run(unsigned int num_jobs, const std::function<void (unsigned int)> &f);
+
+      /* Queue f to be run by a thread of the pool and return
+       * without waiting for it; at most max_running_tasks()
+       * of the tasks queued by post() run at the same time.
+       * Returns a value to pass to cancel().
+       */
+      uint64_t
+      post(const std::function<void ()> &f);
+
+      /* Remove a task queued by post() that has not started;
+       * returns true if it was removed, in which case it will
+       * never run, and false if it has already started.
+       */
+      bool
+      cancel(uint64_t id);
+
+      /* The number of tasks queued by post() that may run
+       * at the same time.
+       */
+      unsigned int
+      max_running_tasks(void) const
+      {
+        return m_max_running_tasks;
+      }
+
+    private:
+      class Batch
+      {
+      public:
+        Batch(const std::function<void (unsigned int)> &f,
+              unsigned int num_jobs):
+          m_f(f),
+          m_remaining(num_jobs)
+        {}
+
+        const std::function<void (unsigned int)> &m_f;
+        unsigned int m_remaining;
+      };
+
+      class Job
+      {
+      public:
+        Batch *m_batch;
+        unsigned int m_index;
+      };
+
+      class Task
+      {
+      public:
+        uint64_t m_id;
+        std::function<void ()> m_f;
+      };
+
+      void
+      thread_main(void);
+
+      /* run the job at the front of m_jobs, m_mutex is locked
+       * by lock on entry and on return.
+       */
+      void
+      run_front_job(std::unique_lock<std::mutex> &lock);
+
+      bool
+      can_start_task(void) const
+      {
+        return !m_tasks.empty() && m_num_running_tasks < m_max_running_tasks;
+      }
+
+      unsigned int m_max_running_tasks;
+
+      /* all other fields are protected by m_mutex; m_condition
+       * is signaled whenever a job or task is added and whenever
+       * a job or task finishes.
+       */
+      std::mutex m_mutex;
+      std::condition_variable m_condition;
+      std::deque<Job> m_jobs;
+      std::deque<Task> m_tasks;
+      std::vector<std::thread> m_threads;
+      unsigned int m_num_running_tasks;
+      uint64_t m_next_task_id;
+      bool m_stop;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,262 @@
+/*!
+ * \file painter_engine_null.cpp
+ * \brief file painter_engine_null.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#include <fastuidraw/null_backend/painter_engine_null.hpp>
+#include <private/util_private.hpp>
+#include <private/null_backend/painter_backend_null.hpp>
+#include <private/null_backend/atlas_null.hpp>
+
+namespace
+{
+  class ConfigurationPrivate
+  {
+  public:
+    ConfigurationPrivate(void):
+      m_attributes_per_buffer(512 * 512),
+      m_indices_per_buffer((m_attributes_per_buffer * 6) / 4),
+      m_data_blocks_per_store_buffer(1024 * 64),
+      m_break_on_shader_change(false),
+      m_preferred_blend_type(fastuidraw::PainterBlendShader::dual_src),
+      m_compute_checksum(false),
+      m_glyph_atlas_size(1024 * 1024),
+      m_log2_image_atlas_dims(9),
+      m_colorstop_atlas_width(1024)
+    {}
+
+    unsigned int m_attributes_per_buffer;
+    unsigned int m_indices_per_buffer;
+    unsigned int m_data_blocks_per_store_buffer;
+    bool m_break_on_shader_change;
+    enum fastuidraw::PainterBlendShader::shader_type m_preferred_blend_type;
+    bool m_compute_checksum;
+    unsigned int m_glyph_atlas_size;
+    unsigned int m_log2_image_atlas_dims;
+    unsigned int m_colorstop_atlas_width;
+  };
+
+  class PainterEngineNullPrivate
+  {
+  public:
+    PainterEngineNullPrivate(const fastuidraw::null::PainterEngineNull::Configuration &config,
+                             fastuidraw::ImageAtlas *image_atlas,
+                             fastuidraw::GlyphAtlas *glyph_atlas):
+      m_config(config),
+      m_state(FASTUIDRAWnew fastuidraw::null::detail::PainterEngineNullState(config, image_atlas, glyph_atlas))
+    {}
+
+    static
+    fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlas>
+    create_glyph_atlas(const fastuidraw::null::PainterEngineNull::Configuration &config)
+    {
+      using namespace fastuidraw;
+      reference_counted_ptr<GlyphAtlasBackingStoreBase> store;
+
+      store = FASTUIDRAWnew null::detail::GlyphAtlasBackingStoreNull(config.glyph_atlas_size());
+      return FASTUIDRAWnew GlyphAtlas(store);
+    }
+
+    static
+    fastuidraw::reference_counted_ptr<fastuidraw::ColorStopAtlas>
+    create_colorstop_atlas(const fastuidraw::null::PainterEngineNull::Configuration &config)
+    {
+      using namespace fastuidraw;
+      reference_counted_ptr<ColorStopBackingStore> store;
+
+      store = FASTUIDRAWnew null::detail::ColorStopBackingStoreNull(config.colorstop_atlas_width(), 1);
+      return FASTUIDRAWnew ColorStopAtlas(store);
+    }
+
+    fastuidraw::null::PainterEngineNull::Configuration m_config;
+    fastuidraw::reference_counted_ptr<fastuidraw::null::detail::PainterEngineNullState> m_state;
+  };
+}
+
+/////////////////////////////////////////////////////////////
+// fastuidraw::null::PainterEngineNull::Configuration methods
+fastuidraw::null::PainterEngineNull::Configuration::
+Configuration(void)
+{
+  m_d = FASTUIDRAWnew ConfigurationPrivate();
+}
+
+fastuidraw::null::PainterEngineNull::Configuration::
+Configuration(const Configuration &obj)
+{
+  ConfigurationPrivate *d;
+  d = static_cast<ConfigurationPrivate*>(obj.m_d);
+  m_d = FASTUIDRAWnew ConfigurationPrivate(*d);
+}
+
+fastuidraw::null::PainterEngineNull::Configuration::
+~Configuration()
+{
+  ConfigurationPrivate *d;
+  d = static_cast<ConfigurationPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+assign_swap_implement(fastuidraw::null::PainterEngineNull::Configuration)
+setget_implement(fastuidraw::null::PainterEngineNull::Configuration, ConfigurationPrivate,
+                 unsigned int, attributes_per_buffer)
+setget_implement(fastuidraw::null::PainterEngineNull::Configuration, ConfigurationPrivate,
+                 unsigned int, indices_per_buffer)
+setget_implement(fastuidraw::null::PainterEngineNull::Configuration, ConfigurationPrivate,
+                 unsigned int, data_blocks_per_store_buffer)
+setget_implement(fastuidraw::null::PainterEngineNull::Configuration, ConfigurationPrivate,
+                 bool, break_on_shader_change)
+setget_implement(fastuidraw::null::PainterEngineNull::Configuration, ConfigurationPrivate,
+                 enum fastuidraw::PainterBlendShader::shader_type, preferred_blend_type)
+setget_implement(fastuidraw::null::PainterEngineNull::Configuration, ConfigurationPrivate,
+                 bool, compute_checksum)
+setget_implement(fastuidraw::null::PainterEngineNull::Configuration, ConfigurationPrivate,
+                 unsigned int, glyph_atlas_size)
+setget_implement(fastuidraw::null::PainterEngineNull::Configuration, ConfigurationPrivate,
+                 unsigned int, log2_image_atlas_dims)
+setget_implement(fastuidraw::null::PainterEngineNull::Configuration, ConfigurationPrivate,
+                 unsigned int, colorstop_atlas_width)
+
+///////////////////////////////////////////////
+// fastuidraw::null::PainterEngineNull methods
+fastuidraw::reference_counted_ptr<fastuidraw::null::PainterEngineNull>
+fastuidraw::null::PainterEngineNull::
+create(const Configuration &config)
+{
+  UberShaderParams uber_params;
+
+  uber_params
+    .preferred_blend_type(config.preferred_blend_type())
+    .data_blocks_per_store_buffer(config.data_blocks_per_store_buffer());
+
+  if (config.preferred_blend_type() == PainterBlendShader::framebuffer_fetch)
+    {
+      uber_params.fbf_blending_type(fbf_blending_framebuffer_fetch);
+    }
+
+  return FASTUIDRAWnew PainterEngineNull(config, uber_params.default_shaders());
+}
+
+fastuidraw::null::PainterEngineNull::
+PainterEngineNull(const Configuration &config,
+                  const PainterShaderSet &shaders):
+  PainterEngine(PainterEngineNullPrivate::create_glyph_atlas(config),
+                FASTUIDRAWnew detail::ImageAtlasNull(config.log2_image_atlas_dims()),
+                PainterEngineNullPrivate::create_colorstop_atlas(config),
+                FASTUIDRAWnew detail::PainterShaderRegistrarNull(config.break_on_shader_change()),
+                ConfigurationBase()
+                .supports_bindless_texturing(false),
+                shaders)
+{
+  m_d = FASTUIDRAWnew PainterEngineNullPrivate(config, &image_atlas(), &glyph_atlas());
+}
+
+fastuidraw::null::PainterEngineNull::
+~PainterEngineNull()
+{
+  PainterEngineNullPrivate *d;
+  d = static_cast<PainterEngineNullPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+}
+
+const fastuidraw::null::PainterEngineNull::Configuration&
+fastuidraw::null::PainterEngineNull::
+configuration_null(void) const
+{
+  PainterEngineNullPrivate *d;
+  d = static_cast<PainterEngineNullPrivate*>(m_d);
+  return d->m_config;
+}
+
+uint64_t
+fastuidraw::null::PainterEngineNull::
+counter(enum counter_t c) const
+{
+  PainterEngineNullPrivate *d;
+  d = static_cast<PainterEngineNullPrivate*>(m_d);
+  FASTUIDRAWassert(c < number_counters);
+  return d->m_state->counter(c);
+}
+
+void
+fastuidraw::null::PainterEngineNull::
+counters(c_array<uint64_t> dst) const
+{
+  for (unsigned int i = 0; i < number_counters && i < dst.size(); ++i)
+    {
+      dst[i] = counter(static_cast<enum counter_t>(i));
+    }
+}
+
+fastuidraw::c_string
+fastuidraw::null::PainterEngineNull::
+counter_label(enum counter_t c)
+{
+#define EASY(X) case X: return #X
+
+  switch (c)
+    {
+      EASY(counter_number_draws);
+      EASY(counter_number_attributes);
+      EASY(counter_number_indices);
+      EASY(counter_number_headers);
+      EASY(counter_number_data_store_blocks);
+      EASY(counter_number_draw_break_calls);
+      EASY(counter_number_draw_breaks);
+      EASY(counter_number_draw_calls);
+      EASY(counter_number_render_targets);
+    default:
+      return "invalid counter_t";
+    }
+
+#undef EASY
+}
+
+uint64_t
+fastuidraw::null::PainterEngineNull::
+checksum(void) const
+{
+  PainterEngineNullPrivate *d;
+  d = static_cast<PainterEngineNullPrivate*>(m_d);
+  return d->m_state->checksum();
+}
+
+void
+fastuidraw::null::PainterEngineNull::
+reset_counters(void)
+{
+  PainterEngineNullPrivate *d;
+  d = static_cast<PainterEngineNullPrivate*>(m_d);
+  d->m_state->reset();
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::PainterBackend>
+fastuidraw::null::PainterEngineNull::
+create_backend(void) const
+{
+  PainterEngineNullPrivate *d;
+  d = static_cast<PainterEngineNullPrivate*>(m_d);
+  return FASTUIDRAWnew detail::PainterBackendNull(d->m_state);
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::PainterSurface>
+fastuidraw::null::PainterEngineNull::
+create_surface(ivec2 dims,
+               enum PainterSurface::render_type_t render_type)
+{
+  return FASTUIDRAWnew detail::PainterSurfaceNull(dims, render_type);
+}
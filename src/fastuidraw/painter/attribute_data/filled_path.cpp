@@ -24,6 +24,8 @@
 #include <algorithm>
 #include <ctime>
 #include <set>
+#include <mutex>
+#include <atomic>
 #include <math.h>
 
 #include <fastuidraw/tessellated_path.hpp>
@@ -35,6 +37,8 @@
 #include <private/util_private_ostream.hpp>
 #include <private/bounding_box.hpp>
 #include <private/clip.hpp>
+#include <private/attribute_data_file.hpp>
+#include <private/worker_pool.hpp>
 #include <3rd_party/glu-tess/glu-tess.hpp>
 
 /* Actual triangulation is handled by GLU-tess.
@@ -134,6 +138,14 @@ namespace
 {
   class PointHoard;
 
+  /* value of FilledPath::fast_triangulation() */
+  std::atomic<bool> fast_triangulation_enabled(true);
+
+  /* version of the files of FilledPath::save(), increment
+   * whenever the contents of the files change.
+   */
+  const uint32_t filled_path_file_version = 1u;
+
   unsigned int
   signed_to_unsigned(int w)
   {
@@ -636,6 +648,43 @@ namespace
     edge_hugs_boundary(uint32_t valid_edges,
                        unsigned int a, unsigned int b) const;
 
+    /* returns true if the triangle is not degenerate after
+     * the transformation to the integer bounding box
+     */
+    bool
+    non_degenerate_triangle(unsigned int a, unsigned int b, unsigned int c) const;
+
+    /* returns the area, after the transformation to the integer
+     * bounding box, of the region with the passed boundary
+     */
+    uint64_t
+    region_area(const unsigned int vertex_ids[], unsigned int count) const;
+
+    /* returns twice the signed area of the region */
+    int64_t
+    twice_signed_area(const unsigned int vertex_ids[], unsigned int count) const;
+
+    /* fetch the point with the passed location after
+     * transformation to the integer bounding box.
+     */
+    unsigned int
+    fetch_ipt(const fastuidraw::ivec2 &ipt);
+
+    /* number of points of the hoard; the points fetched
+     * after can be removed again with truncate().
+     */
+    unsigned int
+    number_points(void) const
+    {
+      return m_pts.size();
+    }
+
+    /* remove the points fetched since number_points()
+     * returned the passed value.
+     */
+    void
+    truncate(unsigned int num_points);
+
     bool
     point_is_path_join(unsigned int v)
     {
@@ -705,9 +754,6 @@ namespace
     bool
     temp_verts_non_degenerate_triangle(void);
 
-    uint64_t
-    region_area(const unsigned int vertex_ids[], unsigned int count) const;
-
     static
     void
     begin_callBack(FASTUIDRAW_GLUenum type, int winding_number, void *tess);
@@ -753,11 +799,144 @@ namespace
     PerWindingComponentData &m_hoard;
   };
 
+  /* Triangulates, without GLU-tess, a PointHoard::Path that is
+   * a single simple y-monotone contour (convex contours included),
+   * which is the common case for UI shapes. The region between the
+   * contour and the bounding box of the SubPath (the winding number
+   * zero region) is split by vertical segments at the top and bottom
+   * of the contour into two pieces which are also y-monotone. The
+   * triangles and region boundaries are written to the same
+   * PerWindingComponentData that tesser writes to.
+   */
+  class FastTriangulator:fastuidraw::noncopyable
+  {
+  public:
+    /* returns false and does not modify points or hoard if
+     * the path is not handled, in that case GLU-tess must be
+     * used.
+     */
+    static
+    bool
+    triangulate(uint32_t edge_flags,
+                PointHoard &points,
+                const PointHoard::Path &P,
+                int winding_offset,
+                PerWindingComponentData &hoard);
+
+  private:
+    explicit
+    FastTriangulator(PointHoard &points):
+      m_points(points)
+    {}
+
+    /* returns true if a is above b, ties in y are broken by x */
+    bool
+    above(unsigned int a, unsigned int b) const
+    {
+      const fastuidraw::ivec2 &pa(m_points.ipt(a)), &pb(m_points.ipt(b));
+      return pa.y() > pb.y() || (pa.y() == pb.y() && pa.x() < pb.x());
+    }
+
+    int64_t
+    cross(unsigned int o, unsigned int a, unsigned int b) const
+    {
+      fastuidraw::i64vec2 po(m_points.ipt(o));
+      fastuidraw::i64vec2 va(fastuidraw::i64vec2(m_points.ipt(a)) - po);
+      fastuidraw::i64vec2 vb(fastuidraw::i64vec2(m_points.ipt(b)) - po);
+      return va.x() * vb.y() - va.y() * vb.x();
+    }
+
+    /* Check that the polygon is simple and y-monotone and if
+     * so, triangulate it adding the triangles to dst.
+     */
+    bool
+    triangulate_monotone(const std::vector<unsigned int> &poly,
+                         TriangleList *dst);
+
+    /* returns false if the chains of the polygon touch or cross */
+    bool
+    chains_separated(const std::vector<unsigned int> &left,
+                     const std::vector<unsigned int> &right) const;
+
+    void
+    add_triangle(unsigned int a, unsigned int b, unsigned int c,
+                 TriangleList *dst) const
+    {
+      if (m_points.non_degenerate_triangle(a, b, c))
+        {
+          dst->add_index(a);
+          dst->add_index(b);
+          dst->add_index(c);
+        }
+    }
+
+    /* Triangulate a piece of the region between the contour and
+     * the bounding box; the piece starts and ends on the side
+     * x = box_x of the box and is split where the contour touches
+     * that side.
+     */
+    bool
+    triangulate_outside(const std::vector<unsigned int> &piece, int box_x,
+                        TriangleList *dst);
+
+    static
+    void
+    remove_repeated(std::vector<unsigned int> *poly);
+
+    /* removes the vertices where the boundary doubles back on itself */
+    void
+    remove_spikes(std::vector<unsigned int> *poly) const;
+
+    bool
+    is_spike(unsigned int a, unsigned int b, unsigned int c) const
+    {
+      const fastuidraw::ivec2 &pa(m_points.ipt(a)), &pb(m_points.ipt(b)), &pc(m_points.ipt(c));
+      fastuidraw::i64vec2 u(pa - pb), v(pc - pb);
+
+      return a == c || (cross(b, a, c) == 0 && u.x() * v.x() + u.y() * v.y() > 0);
+    }
+
+    void
+    add_boundary(const std::vector<unsigned int> &poly,
+                 uint32_t edge_flags, AAFuzz *dst) const;
+
+    /* adds the boundaries of the region between the counter-clockwise
+     * contour poly and the bounding box as GLU-tess emits them: the
+     * region is split into a separate component wherever the contour
+     * touches the bounding box.
+     */
+    void
+    add_outside_boundaries(const std::vector<unsigned int> &poly,
+                           uint32_t edge_flags, AAFuzz *dst);
+
+    /* position of a point on the boundary of the box along the
+     * boundary, counter-clockwise from the corner (1, 1); returns
+     * -1 if the point is not on the boundary.
+     */
+    static
+    int64_t
+    box_boundary_position(const fastuidraw::ivec2 &p);
+
+    static
+    unsigned int
+    prev(unsigned int i, unsigned int n)
+    {
+      return (i == 0u) ? n - 1u : i - 1u;
+    }
+
+    PointHoard &m_points;
+
+    /* work room for triangulate_monotone() and triangulate_outside() */
+    std::vector<unsigned int> m_chains[2], m_sorted, m_stack, m_run;
+    std::vector<int> m_sorted_chain;
+  };
+
   class builder:fastuidraw::noncopyable
   {
   public:
     explicit
-    builder(const SubPath &P, std::vector<fastuidraw::dvec2> &pts);
+    builder(const SubPath &P, std::vector<fastuidraw::dvec2> &pts,
+            bool use_fast_triangulation);
 
     ~builder();
 
@@ -1024,9 +1203,38 @@ namespace
                                 unsigned int max_index_cnt,
                                 unsigned int &current);
 
+    /* Must be called with the FilledPathPrivate::m_mutex
+     * of the FilledPath locked if this has children.
+     */
     void
     make_ready(void);
 
+    /* Returns the bytes used by this SubsetPrivate, the data
+     * made so far and the SubPath it has not yet triangulated.
+     * Must be called with the FilledPathPrivate::m_mutex of
+     * the FilledPath locked.
+     */
+    uint64_t
+    memory_usage(void);
+
+    /* Collect the SubsetPrivate objects without children that
+     * intersect the region of scratch.m_adjusted_clip_eqs and
+     * whose triangulation is not yet made; reads only values
+     * that do not change after construction.
+     */
+    void
+    collect_leaves(ScratchSpacePrivate &scratch,
+                   std::vector<SubsetPrivate*> *dst);
+
+    /* Triangulate leaves across threads; the SubsetPrivate
+     * objects must not have children. Does not need the
+     * FilledPathPrivate::m_mutex locked.
+     */
+    static
+    void
+    make_ready_leaves(fastuidraw::c_array<SubsetPrivate* const> leaves,
+                      unsigned int num_threads);
+
     fastuidraw::c_array<const int>
     winding_numbers(void)
     {
@@ -1067,15 +1275,51 @@ namespace
       return bool(m_children[0]);
     }
 
+    static
+    void
+    adjust_clip_equations(ScratchSpacePrivate &scratch,
+                          fastuidraw::c_array<const fastuidraw::vec3> clip_equations,
+                          const fastuidraw::float3x3 &clip_matrix_local);
+
     static
     SubsetPrivate*
     create_root_subset(SubPath *P, std::vector<SubsetPrivate*> &out_values);
 
+    /* Write this and its descendants in pre-order; the
+     * SubsetPrivate objects without children must be ready.
+     * Only the data of those without children is written,
+     * the data of the others is merged when first needed.
+     */
+    void
+    save(fastuidraw::detail::AttributeDataFileWriter &writer) const;
+
+    /* Returns nullptr if the file does not hold a
+     * hierarchy written by save().
+     */
+    static
+    SubsetPrivate*
+    load_root_subset(fastuidraw::detail::AttributeDataFileReader &reader,
+                     std::vector<SubsetPrivate*> &out_values);
+
   private:
 
     SubsetPrivate(SubPath *P, int max_recursion,
                   std::vector<SubsetPrivate*> &out_value);
 
+    SubsetPrivate(const fastuidraw::BoundingBox<double> &bounds,
+                  std::vector<SubsetPrivate*> &out_values);
+
+    static
+    SubsetPrivate*
+    load(fastuidraw::detail::AttributeDataFileReader &reader,
+         int max_recursion, std::vector<SubsetPrivate*> &out_values);
+
+    bool
+    load_data(fastuidraw::detail::AttributeDataFileReader &reader);
+
+    void
+    make_bounding_path(void);
+
     bool //returns true if this was added
     select_subsets_implement(ScratchSpacePrivate &scratch,
                              fastuidraw::c_array<unsigned int> dst,
@@ -1139,6 +1383,15 @@ namespace
      * it.
      */
     SubPath *m_sub_path;
+
+    /* protects making the triangulation from m_sub_path so
+     * that leaves can be triangulated by FilledPath::prepare()
+     * on other threads; if this SubsetPrivate has no children,
+     * the values m_sub_path, m_painter_data, m_sizes_ready
+     * and the size values are only accessed with it locked
+     * until m_sub_path is nullptr.
+     */
+    std::mutex m_leaf_mutex;
     fastuidraw::vecN<SubsetPrivate*, 2> m_children;
     int m_splitting_coordinate;
   };
@@ -1149,11 +1402,24 @@ namespace
     explicit
     FilledPathPrivate(const fastuidraw::TessellatedPath &P);
 
+    FilledPathPrivate(SubsetPrivate *root,
+                      std::vector<SubsetPrivate*> &subsets,
+                      const fastuidraw::Rect &bounding_box);
+
     ~FilledPathPrivate();
 
+    void
+    set_leaves(void);
+
     SubsetPrivate *m_root;
     std::vector<SubsetPrivate*> m_subsets;
+    std::vector<SubsetPrivate*> m_leaves;
     fastuidraw::Rect m_bounding_box;
+
+    /* protects selecting subsets and making the data
+     * of subsets with children.
+     */
+    std::mutex m_mutex;
   };
 }
 
@@ -1796,6 +2062,132 @@ edge_hugs_boundary(uint32_t valid_edges,
   return false;
 }
 
+bool
+PointHoard::
+non_degenerate_triangle(unsigned int a, unsigned int b, unsigned int c) const
+{
+  if (a == b || a == c || b == c)
+    {
+      return false;
+    }
+
+  uint64_t twice_area;
+  fastuidraw::i64vec2 p0(ipt(a));
+  fastuidraw::i64vec2 p1(ipt(b));
+  fastuidraw::i64vec2 p2(ipt(c));
+  fastuidraw::i64vec2 v(p1 - p0), w(p2 - p0);
+
+  twice_area = fastuidraw::t_abs(v.x() * w.y() - v.y() * w.x());
+  if (twice_area == 0)
+    {
+      return false;
+    }
+
+  fastuidraw::i64vec2 u(p2 - p1);
+  double vmag, wmag, umag, two_area(twice_area);
+  const double min_height(CoordinateConverterConstants::min_height);
+
+  vmag = fastuidraw::t_sqrt(static_cast<double>(dot(v, v)));
+  wmag = fastuidraw::t_sqrt(static_cast<double>(dot(w, w)));
+  umag = fastuidraw::t_sqrt(static_cast<double>(dot(u, u)));
+
+  /* the distance from an edge to the 3rd
+   * point is given as twice the area divided
+   * by the length of the edge. We ask that
+   * the distance is atleast 1.
+   */
+  if (two_area < min_height * vmag
+      || two_area < min_height * wmag
+      || two_area < min_height * umag)
+    {
+      twice_area = 0u;
+      return false;
+    }
+
+  return true;
+}
+
+uint64_t
+PointHoard::
+region_area(const unsigned int vertex_ids[], unsigned int count) const
+{
+  return uint64_t(fastuidraw::t_abs(twice_signed_area(vertex_ids, count))) >> 1u;
+}
+
+int64_t
+PointHoard::
+twice_signed_area(const unsigned int vertex_ids[], unsigned int count) const
+{
+  if (count == 0)
+    {
+      return 0;
+    }
+
+  /* Use the Surveyor's formula in integer arithmetic
+   * to decide if the region whose boundar is passed
+   * has area; to keep the numbers smaller center the
+   * computation around the first point of the polygon.
+   */
+  fastuidraw::ivec2 origin(ipt(vertex_ids[0]));
+  int64_t return_value(0);
+  for (unsigned int i = 0; i < count; ++i)
+    {
+      unsigned int next_i;
+
+      next_i = (i + 1u == count) ? 0u: i + 1u;
+
+      fastuidraw::vecN<int64_t, 2> a(ipt(vertex_ids[i]) - origin);
+      fastuidraw::vecN<int64_t, 2> b(ipt(vertex_ids[next_i]) - origin);
+      return_value += a.x() * b.y() - b.x() * a.y();
+    }
+
+  return return_value;
+}
+
+unsigned int
+PointHoard::
+fetch_ipt(const fastuidraw::ivec2 &pt)
+{
+  std::map<fastuidraw::ivec2, unsigned int>::iterator iter;
+  unsigned int return_value;
+
+  iter = m_map.find(pt);
+  if (iter != m_map.end())
+    {
+      return_value = iter->second;
+    }
+  else
+    {
+      return_value = m_pts.size();
+      m_pts.push_back(m_converter.unapply(pt));
+      m_ipts.push_back(pt);
+      m_pt_is_path_join.push_back(false);
+      m_map[pt] = return_value;
+    }
+  return return_value;
+}
+
+void
+PointHoard::
+truncate(unsigned int num_points)
+{
+  FASTUIDRAWassert(num_points <= m_pts.size());
+  for (unsigned int i = num_points, endi = m_ipts.size(); i < endi; ++i)
+    {
+      std::map<fastuidraw::ivec2, unsigned int>::iterator iter;
+
+      /* points from fetch_undiscretized() are not in m_map */
+      iter = m_map.find(m_ipts[i]);
+      if (iter != m_map.end() && iter->second == i)
+        {
+          m_map.erase(iter);
+        }
+    }
+  m_pts.resize(num_points);
+  m_ipts.resize(num_points);
+  m_pt_is_path_join.resize(num_points);
+}
+
 int
 PointHoard::
 generate_path(const SubPath &input, Path &output)
@@ -2048,109 +2440,41 @@ bool
 tesser::
 temp_verts_non_degenerate_triangle(void)
 {
-  if (m_temp_verts[0] == m_temp_verts[1]
-     || m_temp_verts[0] == m_temp_verts[2]
-     || m_temp_verts[1] == m_temp_verts[2])
+  return m_points.non_degenerate_triangle(m_temp_verts[0],
+                                          m_temp_verts[1],
+                                          m_temp_verts[2]);
+}
+
+void
+tesser::
+begin_callBack(FASTUIDRAW_GLUenum type, int glu_tess_winding_number, void *tess)
+{
+  tesser *p;
+  p = static_cast<tesser*>(tess);
+  FASTUIDRAWassert(FASTUIDRAW_GLU_TRIANGLES == type);
+  FASTUIDRAWunused(type);
+
+  p->m_temp_vert_count = 0;
+  p->m_current_winding = glu_tess_winding_number + p->m_winding_offset;
+
+  fastuidraw::reference_counted_ptr<WindingComponentData> &h(p->m_hoard[p->m_current_winding]);
+  if (!h)
     {
-      return false;
+      h = FASTUIDRAWnew WindingComponentData();
     }
+  p->m_current_indices = h;
+}
 
-  uint64_t twice_area;
-  fastuidraw::i64vec2 p0(m_points.ipt(m_temp_verts[0]));
-  fastuidraw::i64vec2 p1(m_points.ipt(m_temp_verts[1]));
-  fastuidraw::i64vec2 p2(m_points.ipt(m_temp_verts[2]));
-  fastuidraw::i64vec2 v(p1 - p0), w(p2 - p0);
+void
+tesser::
+vertex_callBack(unsigned int vertex_id, void *tess)
+{
+  tesser *p;
+  p = static_cast<tesser*>(tess);
 
-  twice_area = fastuidraw::t_abs(v.x() * w.y() - v.y() * w.x());
-  if (twice_area == 0)
+  if (vertex_id == FASTUIDRAW_GLU_nullptr_CLIENT_ID)
     {
-      return false;
-    }
-
-  fastuidraw::i64vec2 u(p2 - p1);
-  double vmag, wmag, umag, two_area(twice_area);
-  const double min_height(CoordinateConverterConstants::min_height);
-
-  vmag = fastuidraw::t_sqrt(static_cast<double>(dot(v, v)));
-  wmag = fastuidraw::t_sqrt(static_cast<double>(dot(w, w)));
-  umag = fastuidraw::t_sqrt(static_cast<double>(dot(u, u)));
-
-  /* the distance from an edge to the 3rd
-   * point is given as twice the area divided
-   * by the length of the edge. We ask that
-   * the distance is atleast 1.
-   */
-  if (two_area < min_height * vmag
-      || two_area < min_height * wmag
-      || two_area < min_height * umag)
-    {
-      twice_area = 0u;
-      return false;
-    }
-
-  return true;
-}
-
-uint64_t
-tesser::
-region_area(const unsigned int vertex_ids[], unsigned int count) const
-{
-  if (count == 0)
-    {
-      return 0u;
-    }
-
-  /* Use the Surveyor's formula in integer arithmetic
-   * to decide if the region whose boundar is passed
-   * has area; to keep the numbers smaller center the
-   * computation around the first point of the polygon.
-   */
-  fastuidraw::ivec2 origin(m_points.ipt(vertex_ids[0]));
-  int64_t twice_signed_area(0);
-  for (unsigned int i = 0; i < count; ++i)
-    {
-      unsigned int next_i;
-
-      next_i = (i + 1u == count) ? 0u: i + 1u;
-
-      fastuidraw::vecN<int64_t, 2> a(m_points.ipt(vertex_ids[i]) - origin);
-      fastuidraw::vecN<int64_t, 2> b(m_points.ipt(vertex_ids[next_i]) - origin);
-      twice_signed_area += a.x() * b.y() - b.x() * a.y();
-    }
-
-  return uint64_t(fastuidraw::t_abs(twice_signed_area)) >> 1u;
-}
-
-void
-tesser::
-begin_callBack(FASTUIDRAW_GLUenum type, int glu_tess_winding_number, void *tess)
-{
-  tesser *p;
-  p = static_cast<tesser*>(tess);
-  FASTUIDRAWassert(FASTUIDRAW_GLU_TRIANGLES == type);
-  FASTUIDRAWunused(type);
-
-  p->m_temp_vert_count = 0;
-  p->m_current_winding = glu_tess_winding_number + p->m_winding_offset;
-
-  fastuidraw::reference_counted_ptr<WindingComponentData> &h(p->m_hoard[p->m_current_winding]);
-  if (!h)
-    {
-      h = FASTUIDRAWnew WindingComponentData();
-    }
-  p->m_current_indices = h;
-}
-
-void
-tesser::
-vertex_callBack(unsigned int vertex_id, void *tess)
-{
-  tesser *p;
-  p = static_cast<tesser*>(tess);
-
-  if (vertex_id == FASTUIDRAW_GLU_nullptr_CLIENT_ID)
-    {
-      p->m_triangulation_failed = true;
+      p->m_triangulation_failed = true;
     }
 
   /* Cache adds vertices in groups of 3 (triangles),
@@ -2278,7 +2602,7 @@ emitboundary_callback(int glu_tess_winding,
   tesser *p(static_cast<tesser*>(tess));
   uint64_t area;
 
-  area = p->region_area(vertex_ids, count);
+  area = p->m_points.region_area(vertex_ids, count);
   if (area == 0u)
     {
       return;
@@ -2310,19 +2634,517 @@ emitboundary_callback(int glu_tess_winding,
   h->m_aa_fuzz.end_boundary();
 }
 
+//////////////////////////////////////////
+// FastTriangulator methods
+bool
+FastTriangulator::
+triangulate(uint32_t edge_flags,
+            PointHoard &points,
+            const PointHoard::Path &P,
+            int winding_offset,
+            PerWindingComponentData &hoard)
+{
+  using namespace fastuidraw;
+
+  if (P.size() != 1 || P.front().size() < 3)
+    {
+      return false;
+    }
+
+  FastTriangulator T(points);
+  std::vector<unsigned int> poly, pieces[2];
+  reference_counted_ptr<WindingComponentData> inside, outside;
+  int64_t twice_area;
+  unsigned int top, bottom;
+
+  for (const PointHoard::ContourPoint &q : P.front())
+    {
+      poly.push_back(q.m_vertex);
+    }
+
+  remove_repeated(&poly);
+  if (poly.size() < 3)
+    {
+      return false;
+    }
+
+  twice_area = points.twice_signed_area(&poly[0], poly.size());
+  if (twice_area == 0)
+    {
+      return false;
+    }
+
+  inside = FASTUIDRAWnew WindingComponentData();
+  if (!T.triangulate_monotone(poly, &inside->m_triangles))
+    {
+      return false;
+    }
+
+  /* Split the region between the contour and the bounding
+   * box with vertical segments from the top of the contour
+   * to the top of the box and from the bottom of the contour
+   * to the bottom of the box; both pieces are bounded on
+   * one side by a chain of the contour, and thus y-monotone
+   * except where the contour touches the side of the box.
+   * triangulate_monotone() filled m_chains[] with the
+   * chains of the contour, the chain m_chains[0] follows the
+   * contour forward from the top which for a counter-clockwise
+   * contour is the left chain.
+   */
+  const std::vector<unsigned int> left(T.m_chains[(twice_area > 0) ? 0 : 1]);
+  const std::vector<unsigned int> right(T.m_chains[(twice_area > 0) ? 1 : 0]);
+  const int box_max(CoordinateConverterConstants::box_dim + 1);
+
+  top = left.front();
+  bottom = left.back();
+
+  /* the points on the box are only known once fetched, so
+   * the failure checks that need them roll the hoard back.
+   */
+  unsigned int num_points(points.number_points());
+  unsigned int box_top(points.fetch_ipt(ivec2(points.ipt(top).x(), box_max)));
+  unsigned int box_bottom(points.fetch_ipt(ivec2(points.ipt(bottom).x(), 1)));
+
+  pieces[0].push_back(points.fetch_corner(false, false));
+  pieces[0].push_back(box_bottom);
+  pieces[0].insert(pieces[0].end(), left.rbegin(), left.rend());
+  pieces[0].push_back(box_top);
+  pieces[0].push_back(points.fetch_corner(false, true));
+
+  pieces[1].push_back(points.fetch_corner(true, true));
+  pieces[1].push_back(box_top);
+  pieces[1].insert(pieces[1].end(), right.begin(), right.end());
+  pieces[1].push_back(box_bottom);
+  pieces[1].push_back(points.fetch_corner(true, false));
+
+  outside = FASTUIDRAWnew WindingComponentData();
+  if (!T.triangulate_outside(pieces[0], 1, &outside->m_triangles)
+      || !T.triangulate_outside(pieces[1], box_max, &outside->m_triangles))
+    {
+      points.truncate(num_points);
+      return false;
+    }
+
+  /* the contour is counter-clockwise if twice_area is positive,
+   * the boundaries are emitted with the contour counter-clockwise.
+   */
+  if (twice_area < 0)
+    {
+      std::reverse(poly.begin(), poly.end());
+    }
+
+  hoard[winding_offset + ((twice_area > 0) ? 1 : -1)] = inside;
+  T.add_boundary(poly, edge_flags, &inside->m_aa_fuzz);
+
+  if (!outside->m_triangles.empty())
+    {
+      hoard[winding_offset] = outside;
+      T.add_outside_boundaries(poly, edge_flags, &outside->m_aa_fuzz);
+    }
+
+  return true;
+}
+
+void
+FastTriangulator::
+remove_repeated(std::vector<unsigned int> *poly)
+{
+  poly->erase(std::unique(poly->begin(), poly->end()), poly->end());
+  while (poly->size() > 1 && poly->front() == poly->back())
+    {
+      poly->pop_back();
+    }
+}
+
+void
+FastTriangulator::
+remove_spikes(std::vector<unsigned int> *poly) const
+{
+  unsigned int n(0);
+
+  /* compact in place, using the front of poly as a stack */
+  for (unsigned int v : *poly)
+    {
+      while (n >= 2 && is_spike((*poly)[n - 2], (*poly)[n - 1], v))
+        {
+          --n;
+        }
+      if (n == 0 || (*poly)[n - 1] != v)
+        {
+          (*poly)[n++] = v;
+        }
+    }
+  poly->resize(n);
+
+  /* spikes across the end and start of the polygon */
+  unsigned int start(0);
+  for (bool changed = true; changed && n - start >= 3; )
+    {
+      changed = false;
+      if (is_spike((*poly)[n - 2], (*poly)[n - 1], (*poly)[start]))
+        {
+          --n;
+          changed = true;
+        }
+      else if (is_spike((*poly)[n - 1], (*poly)[start], (*poly)[start + 1]))
+        {
+          ++start;
+          changed = true;
+        }
+    }
+  poly->resize(n);
+  poly->erase(poly->begin(), poly->begin() + start);
+}
+
+bool
+FastTriangulator::
+triangulate_outside(const std::vector<unsigned int> &piece, int box_x,
+                    TriangleList *dst)
+{
+  /* the side of the box closes each run of the piece between
+   * two vertices on the side; runs where the contour runs
+   * along the side have no area and are skipped.
+   */
+  for (unsigned int start = 0, i = 1, endi = piece.size(); i < endi; ++i)
+    {
+      if (i + 1 != endi && m_points.ipt(piece[i]).x() != box_x)
+        {
+          continue;
+        }
+
+      m_run.assign(piece.begin() + start, piece.begin() + i + 1);
+      start = i;
+
+      remove_repeated(&m_run);
+      remove_spikes(&m_run);
+      if (m_run.size() >= 3
+          && m_points.twice_signed_area(&m_run[0], m_run.size()) != 0
+          && !triangulate_monotone(m_run, dst))
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+void
+FastTriangulator::
+add_boundary(const std::vector<unsigned int> &poly,
+             uint32_t edge_flags, AAFuzz *dst) const
+{
+  dst->begin_boundary();
+  for (unsigned int i = 0, endi = poly.size(); i < endi; ++i)
+    {
+      unsigned int va, vb;
+
+      va = poly[i];
+      vb = poly[(i + 1u == endi) ? 0u : i + 1u];
+      dst->add_edge(va, vb,
+                    !m_points.edge_hugs_boundary(edge_flags, va, vb),
+                    m_points.point_is_path_join(vb));
+    }
+  dst->end_boundary();
+}
+
+int64_t
+FastTriangulator::
+box_boundary_position(const fastuidraw::ivec2 &p)
+{
+  const int64_t box_max(CoordinateConverterConstants::box_dim + 1);
+  const int64_t D(CoordinateConverterConstants::box_dim);
+
+  if (p.y() == 1)
+    {
+      return p.x() - 1;
+    }
+  else if (p.x() == box_max)
+    {
+      return D + p.y() - 1;
+    }
+  else if (p.y() == box_max)
+    {
+      return 2 * D + box_max - p.x();
+    }
+  else if (p.x() == 1)
+    {
+      return 3 * D + box_max - p.y();
+    }
+  return -1;
+}
+
+void
+FastTriangulator::
+add_outside_boundaries(const std::vector<unsigned int> &poly,
+                       uint32_t edge_flags, AAFuzz *dst)
+{
+  const int64_t perimeter(4 * static_cast<int64_t>(CoordinateConverterConstants::box_dim));
+  unsigned int corners[4] =
+    {
+      m_points.fetch_corner(false, false),
+      m_points.fetch_corner(true, false),
+      m_points.fetch_corner(true, true),
+      m_points.fetch_corner(false, true),
+    };
+  std::vector<std::pair<int64_t, unsigned int> > touches;
+  std::vector<unsigned int> loop;
+
+  for (unsigned int i = 0; i < poly.size(); ++i)
+    {
+      int64_t t(box_boundary_position(m_points.ipt(poly[i])));
+      if (t >= 0)
+        {
+          touches.push_back(std::make_pair(t, i));
+        }
+    }
+
+  if (touches.empty())
+    {
+      std::vector<unsigned int> rev(poly.rbegin(), poly.rend());
+
+      loop.assign(corners, corners + 4);
+      add_boundary(loop, edge_flags, dst);
+      add_boundary(rev, edge_flags, dst);
+      return;
+    }
+
+  /* each component is bounded by the boundary of the box from
+   * a point where the contour touches it to the next such point
+   * and by the contour walked backwards between the two points.
+   */
+  std::sort(touches.begin(), touches.end());
+  for (unsigned int k = 0, m = touches.size(); k < m; ++k)
+    {
+      const std::pair<int64_t, unsigned int> &A(touches[k]);
+      const std::pair<int64_t, unsigned int> &B(touches[(k + 1) % m]);
+      int64_t span;
+
+      span = (m == 1) ? perimeter : (B.first - A.first + perimeter) % perimeter;
+
+      loop.clear();
+      loop.push_back(poly[A.second]);
+      for (unsigned int c = 0; c < 4; ++c)
+        {
+          /* the corners come after A in counter-clockwise order */
+          unsigned int cc(c + (A.first / CoordinateConverterConstants::box_dim) + 1);
+          int64_t d;
+
+          cc %= 4;
+          d = (static_cast<int64_t>(cc) * CoordinateConverterConstants::box_dim - A.first + perimeter) % perimeter;
+          if (d > 0 && d < span)
+            {
+              loop.push_back(corners[cc]);
+            }
+        }
+      loop.push_back(poly[B.second]);
+      for (unsigned int j = prev(B.second, poly.size()); j != A.second; j = prev(j, poly.size()))
+        {
+          loop.push_back(poly[j]);
+        }
+
+      remove_repeated(&loop);
+      if (loop.size() >= 3 && m_points.twice_signed_area(&loop[0], loop.size()) != 0)
+        {
+          add_boundary(loop, edge_flags, dst);
+        }
+    }
+}
+
+bool
+FastTriangulator::
+chains_separated(const std::vector<unsigned int> &left,
+                 const std::vector<unsigned int> &right) const
+{
+  /* each vertex of the left chain must be strictly to the left of
+   * the edge of the right chain at its height and vice-versa; the
+   * chains are linear between vertices, so they then do not meet
+   * except at the top and bottom.
+   */
+  for (unsigned int i = 1, k = 0, endi = left.size() - 1; i < endi; ++i)
+    {
+      while (!above(left[i], right[k + 1]))
+        {
+          ++k;
+        }
+      if (cross(right[k], right[k + 1], left[i]) >= 0)
+        {
+          return false;
+        }
+    }
+
+  for (unsigned int i = 1, k = 0, endi = right.size() - 1; i < endi; ++i)
+    {
+      while (!above(right[i], left[k + 1]))
+        {
+          ++k;
+        }
+      if (cross(left[k], left[k + 1], right[i]) <= 0)
+        {
+          return false;
+        }
+    }
+
+  return true;
+}
+
+bool
+FastTriangulator::
+triangulate_monotone(const std::vector<unsigned int> &poly,
+                     TriangleList *dst)
+{
+  unsigned int n(poly.size()), top(0), bottom(0);
+  int64_t twice_area;
+
+  for (unsigned int i = 1; i < n; ++i)
+    {
+      top = above(poly[i], poly[top]) ? i : top;
+      bottom = above(poly[bottom], poly[i]) ? i : bottom;
+    }
+
+  /* m_chains[0] follows the polygon forward from top to bottom,
+   * m_chains[1] backward; both must be strictly descending.
+   */
+  for (int c = 0; c < 2; ++c)
+    {
+      unsigned int step((c == 0) ? 1u : n - 1u);
+
+      m_chains[c].clear();
+      for (unsigned int i = top; i != bottom; i = (i + step) % n)
+        {
+          m_chains[c].push_back(poly[i]);
+        }
+      m_chains[c].push_back(poly[bottom]);
+
+      for (unsigned int i = 1; i < m_chains[c].size(); ++i)
+        {
+          if (!above(m_chains[c][i - 1], m_chains[c][i]))
+            {
+              return false;
+            }
+        }
+    }
+
+  twice_area = m_points.twice_signed_area(&poly[0], n);
+  if (twice_area == 0
+      || !chains_separated(m_chains[(twice_area > 0) ? 0 : 1],
+                           m_chains[(twice_area > 0) ? 1 : 0]))
+    {
+      return false;
+    }
+
+  /* merge the chains into a single list sorted from top to bottom */
+  m_sorted.clear();
+  m_sorted_chain.clear();
+  m_sorted.push_back(poly[top]);
+  m_sorted_chain.push_back(-1);
+  for (unsigned int i = 1, j = 1; i + 1 < m_chains[0].size() || j + 1 < m_chains[1].size(); )
+    {
+      bool take0;
+
+      take0 = (j + 1 == m_chains[1].size())
+        || (i + 1 < m_chains[0].size() && above(m_chains[0][i], m_chains[1][j]));
+      if (take0)
+        {
+          m_sorted.push_back(m_chains[0][i++]);
+          m_sorted_chain.push_back(0);
+        }
+      else
+        {
+          m_sorted.push_back(m_chains[1][j++]);
+          m_sorted_chain.push_back(1);
+        }
+    }
+  m_sorted.push_back(poly[bottom]);
+  m_sorted_chain.push_back(-1);
+  FASTUIDRAWassert(m_sorted.size() == n);
+
+  /* the usual stack based triangulation of a monotone polygon,
+   * m_stack holds indices into m_sorted.
+   */
+  int sgn((twice_area > 0) ? 1 : -1);
+
+  m_stack.clear();
+  m_stack.push_back(0);
+  m_stack.push_back(1);
+  for (unsigned int j = 2; j + 1 < n; ++j)
+    {
+      unsigned int u(m_sorted[j]);
+      int chain(m_sorted_chain[j]);
+
+      if (chain != m_sorted_chain[m_stack.back()])
+        {
+          while (m_stack.size() > 1)
+            {
+              unsigned int v(m_sorted[m_stack.back()]);
+
+              m_stack.pop_back();
+              add_triangle(u, v, m_sorted[m_stack.back()], dst);
+            }
+          m_stack.clear();
+          m_stack.push_back(j - 1);
+          m_stack.push_back(j);
+        }
+      else
+        {
+          unsigned int last(m_stack.back());
+
+          m_stack.pop_back();
+          while (!m_stack.empty())
+            {
+              unsigned int a(m_sorted[m_stack.back()]), b(m_sorted[last]);
+              int64_t turn;
+
+              /* the diagonal from u to a is inside the polygon if
+               * the polygon is convex at b, in polygon order the
+               * vertices are a, b, u on m_chains[0] and u, b, a
+               * on m_chains[1].
+               */
+              turn = (chain == 0) ? cross(a, b, u) : cross(u, b, a);
+              if (sgn * turn <= 0)
+                {
+                  break;
+                }
+
+              add_triangle(u, b, a, dst);
+              last = m_stack.back();
+              m_stack.pop_back();
+            }
+          m_stack.push_back(last);
+          m_stack.push_back(j);
+        }
+    }
+
+  while (m_stack.size() > 1)
+    {
+      unsigned int v(m_sorted[m_stack.back()]);
+
+      m_stack.pop_back();
+      add_triangle(m_sorted[n - 1], v, m_sorted[m_stack.back()], dst);
+    }
+
+  return true;
+}
+
 /////////////////////////////////////////
 // builder methods
 builder::
-builder(const SubPath &P, std::vector<fastuidraw::dvec2> &points):
+builder(const SubPath &P, std::vector<fastuidraw::dvec2> &points,
+        bool use_fast_triangulation):
   m_points(P.bounds(), points)
 {
   PointHoard::Path path;
   int winding_offset;
 
   winding_offset = m_points.generate_path(P, path);
-  tesser T(P.edge_flags(), m_points, path, winding_offset, m_hoard);
-
-  m_failed = T.triangulation_failed();
+  if (use_fast_triangulation
+      && FastTriangulator::triangulate(P.edge_flags(), m_points, path, winding_offset, m_hoard))
+    {
+      m_failed = false;
+    }
+  else
+    {
+      tesser T(P.edge_flags(), m_points, path, winding_offset, m_hoard);
+      m_failed = T.triangulation_failed();
+    }
 
   for (auto iter = m_hoard.begin(); iter != m_hoard.end(); )
     {
@@ -2992,6 +3814,10 @@ SubsetPrivate(SubPath *Q, int max_recursion,
   m_painter_data(nullptr),
   m_fuzz_painter_data(nullptr),
   m_sizes_ready(false),
+  m_num_attributes(0),
+  m_largest_index_block(0),
+  m_aa_largest_attribute_block(0),
+  m_aa_largest_index_block(0),
   m_sub_path(Q),
   m_children(nullptr, nullptr),
   m_splitting_coordinate(-1)
@@ -3017,7 +3843,35 @@ SubsetPrivate(SubPath *Q, int max_recursion,
           FASTUIDRAWdelete(C[1]);
         }
     }
+  make_bounding_path();
+}
+
+SubsetPrivate::
+SubsetPrivate(const fastuidraw::BoundingBox<double> &bounds,
+              std::vector<SubsetPrivate*> &out_values):
+  m_ID(out_values.size()),
+  m_bounds(bounds),
+  m_bounds_f(fastuidraw::vec2(m_bounds.min_point()),
+             fastuidraw::vec2(m_bounds.max_point())),
+  m_painter_data(nullptr),
+  m_fuzz_painter_data(nullptr),
+  m_sizes_ready(false),
+  m_num_attributes(0),
+  m_largest_index_block(0),
+  m_aa_largest_attribute_block(0),
+  m_aa_largest_index_block(0),
+  m_sub_path(nullptr),
+  m_children(nullptr, nullptr),
+  m_splitting_coordinate(-1)
+{
+  out_values.push_back(this);
+  make_bounding_path();
+}
 
+void
+SubsetPrivate::
+make_bounding_path(void)
+{
   const fastuidraw::vec2 &m(m_bounds_f.min_point());
   const fastuidraw::vec2 &M(m_bounds_f.max_point());
 
@@ -3066,6 +3920,145 @@ create_root_subset(SubPath *P, std::vector<SubsetPrivate*> &out_values)
   return root;
 }
 
+void
+SubsetPrivate::
+save(fastuidraw::detail::AttributeDataFileWriter &writer) const
+{
+  writer.add(have_children());
+  writer.add_int(m_splitting_coordinate);
+  writer.add(m_bounds.empty());
+  writer.add_double(m_bounds.min_point().x());
+  writer.add_double(m_bounds.min_point().y());
+  writer.add_double(m_bounds.max_point().x());
+  writer.add_double(m_bounds.max_point().y());
+
+  if (have_children())
+    {
+      m_children[0]->save(writer);
+      m_children[1]->save(writer);
+      return;
+    }
+
+  FASTUIDRAWassert(m_sub_path == nullptr);
+  FASTUIDRAWassert(m_painter_data != nullptr);
+  FASTUIDRAWassert(m_sizes_ready);
+
+  writer.add(m_winding_numbers.size());
+  for (int w : m_winding_numbers)
+    {
+      writer.add_int(w);
+    }
+  writer.add(m_num_attributes);
+  writer.add(m_largest_index_block);
+  writer.add(m_aa_largest_attribute_block);
+  writer.add(m_aa_largest_index_block);
+  writer.add_data(*m_painter_data);
+  writer.add_data(*m_fuzz_painter_data);
+}
+
+SubsetPrivate*
+SubsetPrivate::
+load_root_subset(fastuidraw::detail::AttributeDataFileReader &reader,
+                 std::vector<SubsetPrivate*> &out_values)
+{
+  return load(reader, SubsetConstants::recursion_depth, out_values);
+}
+
+SubsetPrivate*
+SubsetPrivate::
+load(fastuidraw::detail::AttributeDataFileReader &reader,
+     int max_recursion, std::vector<SubsetPrivate*> &out_values)
+{
+  uint32_t has_children, empty_bounds;
+  int splitting_coordinate;
+  fastuidraw::vecN<double, 4> b;
+  fastuidraw::BoundingBox<double> bounds;
+  SubsetPrivate *return_value;
+
+  if (!reader.read(&has_children)
+      || !reader.read_int(&splitting_coordinate)
+      || !reader.read(&empty_bounds)
+      || !reader.read_double(&b[0]) || !reader.read_double(&b[1])
+      || !reader.read_double(&b[2]) || !reader.read_double(&b[3])
+      || (has_children && max_recursion <= 0))
+    {
+      return nullptr;
+    }
+
+  if (!empty_bounds)
+    {
+      bounds.union_point(fastuidraw::vecN<double, 2>(b[0], b[1]));
+      bounds.union_point(fastuidraw::vecN<double, 2>(b[2], b[3]));
+    }
+
+  return_value = FASTUIDRAWnew SubsetPrivate(bounds, out_values);
+  return_value->m_splitting_coordinate = splitting_coordinate;
+  if (has_children)
+    {
+      SubsetPrivate *c0, *c1(nullptr);
+
+      c0 = load(reader, max_recursion - 1, out_values);
+      if (c0)
+        {
+          c1 = load(reader, max_recursion - 1, out_values);
+        }
+
+      if (c1)
+        {
+          return_value->m_children[0] = c0;
+          return_value->m_children[1] = c1;
+        }
+      else
+        {
+          if (c0)
+            {
+              FASTUIDRAWdelete(c0);
+            }
+          FASTUIDRAWdelete(return_value);
+          return_value = nullptr;
+        }
+    }
+  else if (!return_value->load_data(reader))
+    {
+      FASTUIDRAWdelete(return_value);
+      return_value = nullptr;
+    }
+
+  return return_value;
+}
+
+bool
+SubsetPrivate::
+load_data(fastuidraw::detail::AttributeDataFileReader &reader)
+{
+  uint32_t num_windings;
+
+  if (!reader.read(&num_windings))
+    {
+      return false;
+    }
+
+  m_winding_numbers.resize(num_windings);
+  for (int &w : m_winding_numbers)
+    {
+      if (!reader.read_int(&w))
+        {
+          return false;
+        }
+    }
+
+  m_painter_data = FASTUIDRAWnew fastuidraw::PainterAttributeData();
+  m_fuzz_painter_data = FASTUIDRAWnew fastuidraw::PainterAttributeData();
+  m_sizes_ready = true;
+
+  return reader.read(&m_num_attributes)
+    && reader.read(&m_largest_index_block)
+    && reader.read(&m_aa_largest_attribute_block)
+    && reader.read(&m_aa_largest_index_block)
+    && reader.read_data(m_painter_data)
+    && reader.read_data(m_fuzz_painter_data);
+}
+
 unsigned int
 SubsetPrivate::
 select_subsets(ScratchSpacePrivate &scratch,
@@ -3077,6 +4070,17 @@ select_subsets(ScratchSpacePrivate &scratch,
 {
   unsigned int return_value(0u);
 
+  adjust_clip_equations(scratch, clip_equations, clip_matrix_local);
+  select_subsets_implement(scratch, dst, max_attribute_cnt, max_index_cnt, return_value);
+  return return_value;
+}
+
+void
+SubsetPrivate::
+adjust_clip_equations(ScratchSpacePrivate &scratch,
+                      fastuidraw::c_array<const fastuidraw::vec3> clip_equations,
+                      const fastuidraw::float3x3 &clip_matrix_local)
+{
   scratch.m_adjusted_clip_eqs.resize(clip_equations.size());
   for(unsigned int i = 0; i < clip_equations.size(); ++i)
     {
@@ -3085,9 +4089,58 @@ select_subsets(ScratchSpacePrivate &scratch,
        */
       scratch.m_adjusted_clip_eqs[i] = clip_equations[i] * clip_matrix_local;
     }
+}
 
-  select_subsets_implement(scratch, dst, max_attribute_cnt, max_index_cnt, return_value);
-  return return_value;
+void
+SubsetPrivate::
+collect_leaves(ScratchSpacePrivate &scratch,
+               std::vector<SubsetPrivate*> *dst)
+{
+  using namespace fastuidraw;
+  using namespace fastuidraw::detail;
+
+  vecN<vec2, 4> bb;
+
+  m_bounds_f.inflated_polygon(bb, 0.0f);
+  clip_against_planes(make_c_array(scratch.m_adjusted_clip_eqs),
+                      bb, &scratch.m_clipped_rect,
+                      scratch.m_clip_scratch_vec2s);
+
+  if (scratch.m_clipped_rect.empty())
+    {
+      return;
+    }
+
+  if (have_children())
+    {
+      m_children[0]->collect_leaves(scratch, dst);
+      m_children[1]->collect_leaves(scratch, dst);
+    }
+  else
+    {
+      dst->push_back(this);
+    }
+}
+
+void
+SubsetPrivate::
+make_ready_leaves(fastuidraw::c_array<SubsetPrivate* const> leaves,
+                  unsigned int num_threads)
+{
+  std::atomic<unsigned int> next(0);
+
+  num_threads = fastuidraw::t_min(num_threads, static_cast<unsigned int>(leaves.size()));
+  fastuidraw::detail::WorkerPool::global().run(num_threads, [&next, leaves](unsigned int)
+    {
+      /* the cost of triangulating varies a great deal
+       * between leaves, so hand out one leaf at a time.
+       */
+      for (unsigned int i = next++; i < leaves.size(); i = next++)
+        {
+          FASTUIDRAWassert(!leaves[i]->have_children());
+          leaves[i]->make_ready_from_sub_path();
+        }
+    });
 }
 
 bool
@@ -3160,7 +4213,7 @@ select_subsets_all_unculled(fastuidraw::c_array<unsigned int> dst,
                             unsigned int max_index_cnt,
                             unsigned int &current)
 {
-  if (!m_sizes_ready && !have_children() && m_sub_path != nullptr)
+  if (!have_children())
     {
       /* we are going to need the attributes because
        * the element will be selected.
@@ -3223,20 +4276,48 @@ ready_sizes_from_children(void)
     m_children[0]->m_aa_largest_index_block + m_children[1]->m_aa_largest_index_block;
 }
 
+uint64_t
+SubsetPrivate::
+memory_usage(void)
+{
+  std::unique_lock<std::mutex> lock(m_leaf_mutex, std::defer_lock);
+  uint64_t return_value(sizeof(SubsetPrivate));
+
+  if (!have_children())
+    {
+      lock.lock();
+    }
+
+  if (m_painter_data)
+    {
+      return_value += m_painter_data->memory_usage();
+    }
+
+  if (m_fuzz_painter_data)
+    {
+      return_value += m_fuzz_painter_data->memory_usage();
+    }
+
+  if (m_sub_path)
+    {
+      return_value += sizeof(SubPath) + sizeof(SubContourPoint) * m_sub_path->num_points();
+    }
+
+  return_value += sizeof(int) * m_winding_numbers.capacity();
+  return return_value;
+}
+
 void
 SubsetPrivate::
 make_ready(void)
 {
-  if (m_painter_data == nullptr)
+  if (!have_children())
     {
-      if (m_sub_path != nullptr)
-        {
-          make_ready_from_sub_path();
-        }
-      else
-        {
-          make_ready_from_children();
-        }
+      make_ready_from_sub_path();
+    }
+  else if (m_painter_data == nullptr)
+    {
+      make_ready_from_children();
     }
 }
 
@@ -3294,12 +4375,20 @@ make_ready_from_sub_path(void)
 {
   FASTUIDRAWassert(m_children[0] == nullptr);
   FASTUIDRAWassert(m_children[1] == nullptr);
-  FASTUIDRAWassert(m_sub_path != nullptr);
+
+  std::lock_guard<std::mutex> lock(m_leaf_mutex);
+  if (m_sub_path == nullptr)
+    {
+      /* already made, possibly by FilledPath::prepare() */
+      FASTUIDRAWassert(m_painter_data != nullptr);
+      return;
+    }
+
   FASTUIDRAWassert(m_painter_data == nullptr);
   FASTUIDRAWassert(!m_sizes_ready);
 
   FillAttributeDataFiller filler;
-  builder B(*m_sub_path, filler.m_points);
+  builder B(*m_sub_path, filler.m_points, fast_triangulation_enabled);
   unsigned int even_non_zero_start, zero_start;
   unsigned int m1, m2;
 
@@ -3369,6 +4458,31 @@ FilledPathPrivate(const fastuidraw::TessellatedPath &P):
   SubPath *q;
   q = FASTUIDRAWnew SubPath(P);
   m_root = SubsetPrivate::create_root_subset(q, m_subsets);
+  set_leaves();
+}
+
+FilledPathPrivate::
+FilledPathPrivate(SubsetPrivate *root,
+                  std::vector<SubsetPrivate*> &subsets,
+                  const fastuidraw::Rect &bounding_box):
+  m_root(root),
+  m_bounding_box(bounding_box)
+{
+  m_subsets.swap(subsets);
+  set_leaves();
+}
+
+void
+FilledPathPrivate::
+set_leaves(void)
+{
+  for (SubsetPrivate *S : m_subsets)
+    {
+      if (!S->have_children())
+        {
+          m_leaves.push_back(S);
+        }
+    }
 }
 
 FilledPathPrivate::
@@ -3490,6 +4604,12 @@ FilledPath(const TessellatedPath &P)
   m_d = FASTUIDRAWnew FilledPathPrivate(P);
 }
 
+fastuidraw::FilledPath::
+FilledPath(void *d):
+  m_d(d)
+{
+}
+
 fastuidraw::FilledPath::
 ~FilledPath()
 {
@@ -3527,6 +4647,8 @@ subset(unsigned int I) const
   d = static_cast<FilledPathPrivate*>(m_d);
   FASTUIDRAWassert(I < d->m_subsets.size());
   p = d->m_subsets[I];
+
+  std::lock_guard<std::mutex> lock(d->m_mutex);
   p->make_ready();
 
   return Subset(p);
@@ -3538,10 +4660,166 @@ root_subset(void) const
 {
   FilledPathPrivate *d;
   d = static_cast<FilledPathPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> lock(d->m_mutex);
   d->m_root->make_ready();
   return Subset(d->m_root);
 }
 
+uint64_t
+fastuidraw::FilledPath::
+memory_usage(void) const
+{
+  FilledPathPrivate *d;
+  uint64_t return_value(0u);
+
+  d = static_cast<FilledPathPrivate*>(m_d);
+  std::lock_guard<std::mutex> lock(d->m_mutex);
+  for (SubsetPrivate *S : d->m_subsets)
+    {
+      return_value += S->memory_usage();
+    }
+  return return_value;
+}
+
+void
+fastuidraw::FilledPath::
+prepare(unsigned int num_threads) const
+{
+  FilledPathPrivate *d;
+  d = static_cast<FilledPathPrivate*>(m_d);
+
+  /* triangulate the leaves in parallel and then build
+   * the merged data of the parents bottom up.
+   */
+  SubsetPrivate::make_ready_leaves(make_c_array(d->m_leaves), num_threads);
+
+  std::lock_guard<std::mutex> lock(d->m_mutex);
+  d->m_root->make_ready();
+}
+
+void
+fastuidraw::FilledPath::
+prepare(c_array<const vec3> clip_equations,
+        const float3x3 &clip_matrix_local,
+        unsigned int max_attribute_cnt,
+        unsigned int max_index_cnt,
+        unsigned int num_threads) const
+{
+  FilledPathPrivate *d;
+  ScratchSpacePrivate scratch;
+  std::vector<SubsetPrivate*> leaves;
+  std::vector<unsigned int> selected;
+  unsigned int num_selected;
+
+  d = static_cast<FilledPathPrivate*>(m_d);
+
+  /* first triangulate, in parallel, all leaves in the region
+   * so that selecting the subsets below, which needs the
+   * sizes of the leaves, does not triangulate.
+   */
+  SubsetPrivate::adjust_clip_equations(scratch, clip_equations, clip_matrix_local);
+  d->m_root->collect_leaves(scratch, &leaves);
+  SubsetPrivate::make_ready_leaves(make_c_array(leaves), num_threads);
+
+  /* make the merged data of the subsets select_subsets()
+   * returns for the same arguments.
+   */
+  std::lock_guard<std::mutex> lock(d->m_mutex);
+  selected.resize(d->m_subsets.size());
+  num_selected = d->m_root->select_subsets(scratch, clip_equations, clip_matrix_local,
+                                           max_attribute_cnt, max_index_cnt,
+                                           make_c_array(selected));
+  for (unsigned int i = 0; i < num_selected; ++i)
+    {
+      d->m_subsets[selected[i]]->make_ready();
+    }
+}
+
+enum fastuidraw::return_code
+fastuidraw::FilledPath::
+save(c_string filename) const
+{
+  FilledPathPrivate *d;
+  detail::AttributeDataFileWriter writer;
+  const Rect &bb(bounding_box());
+
+  d = static_cast<FilledPathPrivate*>(m_d);
+  SubsetPrivate::make_ready_leaves(make_c_array(d->m_leaves), 1);
+
+  writer.add_vec2(bb.m_min_point);
+  writer.add_vec2(bb.m_max_point);
+  d->m_root->save(writer);
+
+  return writer.write(filename, detail::filled_path_file, filled_path_file_version);
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::FilledPath>
+fastuidraw::FilledPath::
+load(c_string filename)
+{
+  detail::AttributeDataFileReader reader;
+  std::vector<SubsetPrivate*> subsets;
+  SubsetPrivate *root;
+  Rect bb;
+
+  if (reader.open(filename, detail::filled_path_file, filled_path_file_version) == routine_fail
+      || !reader.read_vec2(&bb.m_min_point)
+      || !reader.read_vec2(&bb.m_max_point))
+    {
+      return nullptr;
+    }
+
+  root = SubsetPrivate::load_root_subset(reader, subsets);
+  if (root == nullptr)
+    {
+      return nullptr;
+    }
+
+  if (!reader.at_end())
+    {
+      FASTUIDRAWdelete(root);
+      return nullptr;
+    }
+
+  return FASTUIDRAWnew FilledPath(FASTUIDRAWnew FilledPathPrivate(root, subsets, bb));
+}
+
+void
+fastuidraw::FilledPath::
+fast_triangulation(bool v)
+{
+  fast_triangulation_enabled = v;
+}
+
+bool
+fastuidraw::FilledPath::
+fast_triangulation(void)
+{
+  return fast_triangulation_enabled;
+}
+
+void
+fastuidraw::FilledPath::
+triangulation_arena(bool v)
+{
+  fastuidraw_gluTessUseArena(v ? FASTUIDRAW_GLU_TRUE : FASTUIDRAW_GLU_FALSE);
+}
+
+bool
+fastuidraw::FilledPath::
+triangulation_arena(void)
+{
+  return fastuidraw_gluTessUseArena() == FASTUIDRAW_GLU_TRUE;
+}
+
+uint64_t
+fastuidraw::FilledPath::
+triangulation_heap_allocation_count(void)
+{
+  return fastuidraw_gluTessHeapAllocationCount();
+}
+
 unsigned int
 fastuidraw::FilledPath::
 select_subsets(ScratchSpace &work_room,
@@ -3556,26 +4834,11 @@ select_subsets(ScratchSpace &work_room,
 
   d = static_cast<FilledPathPrivate*>(m_d);
   FASTUIDRAWassert(dst.size() >= d->m_subsets.size());
-  /* TODO:
-   *   - have another method in SubsetPrivate called
-   *     "fast_select_subsets" which ignores the requirements
-   *     coming from max_attribute_cnt and max_index_cnt.
-   *     By ignoring this requirement, we do NOT need
-   *     to do call make_ready() for any SubsetPrivate
-   *     object chosen.
-   *   - have the fast_select_subsets() also return
-   *     if paths needed require triangulation.
-   *   - if there such, spawn a thread and let the
-   *     caller decide if to wait for the thread to
-   *     finish before proceeding or to do something
-   *     else (like use a lower level of detail that
-   *     is ready). Another alternatic is to return
-   *     what Subset's need to have triangulation done
-   *     and spawn a set of threads to do the job (!)
-   *   - All this work means we need to make SubsetPrivate
-   *     thread safe (with regards to the SubsetPrivate
-   *     being made ready via make_ready()).
+
+  /* triangulation of subsets can be done ahead of
+   * time across threads with prepare().
    */
+  std::lock_guard<std::mutex> lock(d->m_mutex);
   return_value = d->m_root->select_subsets(*static_cast<ScratchSpacePrivate*>(work_room.m_d),
                                            clip_equations, clip_matrix_local,
                                            max_attribute_cnt, max_index_cnt, dst);
@@ -3594,6 +4857,8 @@ select_subsets_no_culling(unsigned int max_attribute_cnt,
 
   d = static_cast<FilledPathPrivate*>(m_d);
   FASTUIDRAWassert(dst.size() >= d->m_subsets.size());
+
+  std::lock_guard<std::mutex> lock(d->m_mutex);
   d->m_root->select_subsets_all_unculled(dst, max_attribute_cnt,
                                          max_index_cnt, return_value);
 
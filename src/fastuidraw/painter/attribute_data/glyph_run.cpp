@@ -21,6 +21,7 @@
 #include <map>
 #include <algorithm>
 #include <private/util_private.hpp>
+#include <private/bounding_box.hpp>
 
 namespace
 {
@@ -34,11 +35,23 @@ namespace
                const fastuidraw::GlyphAttributePacker &packer,
                fastuidraw::GlyphRenderer renderer);
 
+    /* returns true if each glyph of the range that has
+     * attribute data is resident, see Glyph::resident().
+     */
+    bool
+    all_resident(unsigned int begin, unsigned int cnt) const;
+
     std::vector<fastuidraw::PainterAttribute> m_attribs;
     std::vector<fastuidraw::PainterIndex> m_indices;
 
     std::vector<unsigned int> m_glyph_attribs_start;
     std::vector<unsigned int> m_glyph_indices_start;
+
+    /* the glyphs, used to mark glyphs as used in the
+     * GlyphCache when they are drawn and to skip those
+     * that are not resident.
+     */
+    std::vector<fastuidraw::Glyph> m_glyphs;
   };
 
   class SubSequence:public fastuidraw::PainterAttributeWriter
@@ -76,9 +89,13 @@ namespace
                unsigned int *num_indices_written) const override;
 
   private:
-    fastuidraw::c_array<const fastuidraw::PainterIndex> m_indices;
-    fastuidraw::c_array<const fastuidraw::PainterAttribute> m_attributes;
-    unsigned int m_attribute_start, m_number_glyphs;
+    const PerGlyphRender *m_data;
+    unsigned int m_begin, m_end;
+
+    /* if false, write_data() checks each glyph for
+     * being resident and skips those that are not.
+     */
+    bool m_all_resident;
   };
 
   class GlyphLocation
@@ -86,6 +103,11 @@ namespace
   public:
     fastuidraw::vec2 m_position;
     float m_scale;
+
+    /* bounding box of the glyph as positioned by the
+     * GlyphAttributePacker, empty if the glyph is not valid
+     */
+    fastuidraw::BoundingBox<float> m_bounding_box;
   };
 
   class GlyphRunPrivate:fastuidraw::noncopyable
@@ -164,17 +186,10 @@ void
 SubSequence::
 set_src(const PerGlyphRender *data, unsigned int begin, unsigned int cnt)
 {
-  using namespace fastuidraw;
-
-  m_indices = make_c_array(data->m_indices);
-  m_indices = m_indices.sub_array(data->m_glyph_indices_start[begin],
-                                  data->m_glyph_indices_start[begin + cnt] - data->m_glyph_indices_start[begin]);
-
-  m_attributes = make_c_array(data->m_attribs);
-  m_attributes = m_attributes.sub_array(data->m_glyph_attribs_start[begin],
-                                        data->m_glyph_attribs_start[begin + cnt] - data->m_glyph_attribs_start[begin]);
-  m_attribute_start = data->m_glyph_attribs_start[begin];
-  m_number_glyphs = cnt;
+  m_data = data;
+  m_begin = begin;
+  m_end = begin + cnt;
+  m_all_resident = data->all_resident(begin, cnt);
 }
 
 unsigned int
@@ -191,7 +206,7 @@ initialize_state(fastuidraw::PainterAttributeWriter::WriteState *dst) const
   dst->m_state[0] = 0;
   dst->m_min_attributes_for_next = 4;
   dst->m_min_indices_for_next = 6;
-  return m_number_glyphs > 0;
+  return m_begin < m_end;
 }
 
 bool
@@ -203,32 +218,45 @@ write_data(fastuidraw::c_array<fastuidraw::PainterAttribute> dst_attribs,
            unsigned int *num_attribs_written,
            unsigned int *num_indices_written) const
 {
-  using namespace fastuidraw;
-
-  c_array<const PainterIndex> src_indices;
-  c_array<const PainterAttribute> src_attributes;
   unsigned int &a(*num_attribs_written);
   unsigned int &i(*num_indices_written);
   unsigned int &glyph(state->m_state[0]);
 
-  src_attributes = m_attributes.sub_array(4 * glyph);
-  src_indices = m_indices.sub_array(6 * glyph);
-
-  for (a = 0, i = 0;
-       a + 4u < dst_attribs.size() && i + 6u < dst_indices.size() && glyph < m_number_glyphs; ++glyph)
+  for (a = 0, i = 0; m_begin + glyph < m_end; ++glyph)
     {
-      for (unsigned int aa = 0; aa < 4; ++aa, ++a)
+      unsigned int g(m_begin + glyph);
+      unsigned int attrib_start(m_data->m_glyph_attribs_start[g]);
+      unsigned int num_attribs(m_data->m_glyph_attribs_start[g + 1] - attrib_start);
+      unsigned int index_start(m_data->m_glyph_indices_start[g]);
+      unsigned int num_indices(m_data->m_glyph_indices_start[g + 1] - index_start);
+
+      /* the data of a glyph that is not resident is not yet
+       * written to the backing store of the GlyphAtlas, drawing
+       * it would read stale texels; skip the glyph instead.
+       */
+      if (num_attribs == 0
+          || (!m_all_resident && !m_data->m_glyphs[g].resident()))
+        {
+          continue;
+        }
+
+      if (a + num_attribs > dst_attribs.size() || i + num_indices > dst_indices.size())
+        {
+          break;
+        }
+
+      for (unsigned int ii = 0; ii < num_indices; ++ii, ++i)
         {
-          dst_attribs[a] = src_attributes[a];
+          dst_indices[i] = m_data->m_indices[index_start + ii] + index_addition + a - attrib_start;
         }
 
-      for (unsigned int ii = 0; ii < 6; ++ii, ++i)
+      for (unsigned int aa = 0; aa < num_attribs; ++aa, ++a)
         {
-          dst_indices[i] = src_indices[i] + index_addition - m_attribute_start;
+          dst_attribs[a] = m_data->m_attribs[attrib_start + aa];
         }
     }
 
-  return (glyph < m_number_glyphs);
+  return (m_begin + glyph < m_end);
 }
 
 //////////////////////////////////////////
@@ -243,9 +271,11 @@ set_values(GlyphRunPrivate *p,
 
   unsigned int num(p->m_glyph_locations.size());
   unsigned int num_indices(0), num_attribs(0);
-  std::vector<Glyph> tmp_glyphs(num);
   c_array<const GlyphMetrics> glyph_metrics(make_c_array(p->m_glyphs));
-  c_array<Glyph> glyphs(make_c_array(tmp_glyphs));
+  c_array<Glyph> glyphs;
+
+  m_glyphs.resize(num);
+  glyphs = make_c_array(m_glyphs);
 
   m_glyph_indices_start.resize(num + 1);
   m_glyph_attribs_start.resize(num + 1);
@@ -304,6 +334,21 @@ set_values(GlyphRunPrivate *p,
     }
 }
 
+bool
+PerGlyphRender::
+all_resident(unsigned int begin, unsigned int cnt) const
+{
+  for (unsigned int g = begin, endg = begin + cnt; g < endg; ++g)
+    {
+      if (m_glyph_attribs_start[g] != m_glyph_attribs_start[g + 1]
+          && !m_glyphs[g].resident())
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
 ////////////////////////////////////////
 // GlyphRunPrivate methods
 template<typename T>
@@ -329,7 +374,16 @@ add_glyphs(const fastuidraw::FontBase *font,
       L.m_position = positions[i];
       if (dst_glyphs[i].valid())
         {
+          fastuidraw::vec2 bl, tr;
+
           L.m_scale = m_format_size / dst_glyphs[i].units_per_EM();
+          m_packer->glyph_position_from_metrics(dst_glyphs[i], positions[i],
+                                                L.m_scale, &bl, &tr);
+          if (bl != tr)
+            {
+              L.m_bounding_box.union_point(bl);
+              L.m_bounding_box.union_point(tr);
+            }
         }
       else
         {
@@ -501,6 +555,13 @@ subsequence(GlyphRenderer renderer, unsigned int begin, unsigned int cnt) const
   const PerGlyphRender *data;
   data = d->fetch_render_data(renderer);
   d->m_subsequence.set_src(data, begin, cnt);
+  if (cnt > 0)
+    {
+      /* the glyphs are about to be drawn, mark them as
+       * used so that the GlyphCache does not evict them.
+       */
+      d->m_cache->mark_glyphs_used(make_c_array(data->m_glyphs).sub_array(begin, cnt));
+    }
 
   return d->m_subsequence;
 }
@@ -529,3 +590,73 @@ subsequence(GlyphRenderer renderer) const
 {
   return subsequence(renderer, 0, number_glyphs());
 }
+
+bool
+fastuidraw::GlyphRun::
+all_resident(GlyphRenderer renderer, unsigned int begin, unsigned int cnt) const
+{
+  GlyphRunPrivate *d;
+  d = static_cast<GlyphRunPrivate*>(m_d);
+
+  if (begin >= d->m_glyphs.size())
+    {
+      return true;
+    }
+
+  cnt = t_min(cnt, static_cast<unsigned int>(d->m_glyphs.size()) - begin);
+  return d->fetch_render_data(renderer)->all_resident(begin, cnt);
+}
+
+bool
+fastuidraw::GlyphRun::
+all_resident(GlyphRenderer renderer) const
+{
+  return all_resident(renderer, 0, number_glyphs());
+}
+
+bool
+fastuidraw::GlyphRun::
+bounding_box(unsigned int begin, unsigned int cnt, Rect *out_bb_box) const
+{
+  GlyphRunPrivate *d;
+  BoundingBox<float> box;
+
+  d = static_cast<GlyphRunPrivate*>(m_d);
+  if (begin < d->m_glyph_locations.size())
+    {
+      cnt = t_min(cnt, static_cast<unsigned int>(d->m_glyph_locations.size()) - begin);
+      for (unsigned int g = begin, endg = begin + cnt; g < endg; ++g)
+        {
+          box.union_box(d->m_glyph_locations[g].m_bounding_box);
+        }
+    }
+
+  if (box.empty())
+    {
+      out_bb_box->m_min_point = vec2(0.0f, 0.0f);
+      out_bb_box->m_max_point = vec2(0.0f, 0.0f);
+      return false;
+    }
+  else
+    {
+      out_bb_box->m_min_point = box.min_point();
+      out_bb_box->m_max_point = box.max_point();
+      return true;
+    }
+}
+
+fastuidraw::c_array<const fastuidraw::Glyph>
+fastuidraw::GlyphRun::
+rendered_glyphs(GlyphRenderer renderer, unsigned int begin, unsigned int cnt) const
+{
+  GlyphRunPrivate *d;
+  d = static_cast<GlyphRunPrivate*>(m_d);
+
+  if (begin >= d->m_glyphs.size())
+    {
+      return c_array<const Glyph>();
+    }
+
+  cnt = t_min(cnt, static_cast<unsigned int>(d->m_glyphs.size()) - begin);
+  return make_c_array(d->fetch_render_data(renderer)->m_glyphs).sub_array(begin, cnt);
+}
@@ -73,9 +73,38 @@ namespace
       return fastuidraw::make_c_array(m_indices);
     }
 
+    fastuidraw::c_array<const fastuidraw::Glyph>
+    glyphs(void) const
+    {
+      return fastuidraw::make_c_array(m_glyphs);
+    }
+
+    /* returns true if each glyph that has attribute
+     * data is resident, see Glyph::resident().
+     */
+    bool
+    all_resident(void) const;
+
+    /* gives the attribute and index data of only those glyphs
+     * that are resident; the arrays are valid until the next
+     * call to resident_attributes_indices().
+     */
+    void
+    resident_attributes_indices(fastuidraw::c_array<const fastuidraw::PainterAttribute> *out_attributes,
+                                fastuidraw::c_array<const fastuidraw::PainterIndex> *out_indices);
+
   private:
     std::vector<fastuidraw::PainterAttribute> m_attribs;
     std::vector<fastuidraw::PainterIndex> m_indices;
+    std::vector<fastuidraw::Glyph> m_glyphs;
+
+    /* range of m_attribs and m_indices of each glyph */
+    std::vector<unsigned int> m_glyph_attribs_start;
+    std::vector<unsigned int> m_glyph_indices_start;
+
+    /* the data of the resident glyphs when not all are */
+    std::vector<fastuidraw::PainterAttribute> m_resident_attribs;
+    std::vector<fastuidraw::PainterIndex> m_resident_indices;
   };
 
   class PerAddedGlyph
@@ -164,7 +193,7 @@ namespace
     select_all(fastuidraw::c_array<unsigned int> dst,
                unsigned int &current) const;
 
-    const GlyphAttributesIndices&
+    GlyphAttributesIndices&
     attributes_indices(fastuidraw::GlyphRenderer R);
 
     fastuidraw::c_array<const unsigned int>
@@ -335,17 +364,34 @@ set_values(fastuidraw::c_array<const fastuidraw::Glyph> glyphs,
 
   unsigned int num_attrs(0), num_indices(0);
 
-  for (Glyph G : glyphs)
+  m_glyphs.assign(glyphs.begin(), glyphs.end());
+  m_glyph_attribs_start.resize(glyphs.size() + 1);
+  m_glyph_indices_start.resize(glyphs.size() + 1);
+  for (unsigned int g = 0; g < glyphs.size(); ++g)
     {
+      Glyph G(glyphs[g]);
+      unsigned int a(0), i(0);
+
       if (G.valid())
         {
-          unsigned int a, i;
-
           packer.compute_needed_room(G.renderer(), G.attributes(), &i, &a);
-          num_indices += i;
-          num_attrs += a;
         }
+
+      /* set_values() below only writes the data of a
+       * glyph if it needs both attributes and indices.
+       */
+      if (a == 0 || i == 0)
+        {
+          a = i = 0;
+        }
+
+      m_glyph_attribs_start[g] = num_attrs;
+      m_glyph_indices_start[g] = num_indices;
+      num_indices += i;
+      num_attrs += a;
     }
+  m_glyph_attribs_start.back() = num_attrs;
+  m_glyph_indices_start.back() = num_indices;
 
   m_attribs.resize(num_attrs);
   m_indices.resize(num_indices);
@@ -387,6 +433,64 @@ set_values(fastuidraw::c_array<const fastuidraw::Glyph> glyphs,
     }
 }
 
+bool
+GlyphAttributesIndices::
+all_resident(void) const
+{
+  for (unsigned int g = 0, endg = m_glyphs.size(); g < endg; ++g)
+    {
+      if (m_glyph_attribs_start[g] != m_glyph_attribs_start[g + 1]
+          && !m_glyphs[g].resident())
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+void
+GlyphAttributesIndices::
+resident_attributes_indices(fastuidraw::c_array<const fastuidraw::PainterAttribute> *out_attributes,
+                            fastuidraw::c_array<const fastuidraw::PainterIndex> *out_indices)
+{
+  using namespace fastuidraw;
+
+  if (all_resident())
+    {
+      *out_attributes = attributes();
+      *out_indices = indices();
+      return;
+    }
+
+  /* the data of a glyph that is not resident is not yet
+   * written to the backing store of the GlyphAtlas, drawing
+   * it would read stale texels; skip the glyph instead.
+   */
+  m_resident_attribs.clear();
+  m_resident_indices.clear();
+  for (unsigned int g = 0, endg = m_glyphs.size(); g < endg; ++g)
+    {
+      unsigned int attrib_start(m_glyph_attribs_start[g]);
+      unsigned int attrib_end(m_glyph_attribs_start[g + 1]);
+      unsigned int offset(m_resident_attribs.size());
+
+      if (attrib_start == attrib_end || !m_glyphs[g].resident())
+        {
+          continue;
+        }
+
+      m_resident_attribs.insert(m_resident_attribs.end(),
+                                m_attribs.begin() + attrib_start,
+                                m_attribs.begin() + attrib_end);
+      for (unsigned int i = m_glyph_indices_start[g], endi = m_glyph_indices_start[g + 1]; i < endi; ++i)
+        {
+          m_resident_indices.push_back(m_indices[i] + offset - attrib_start);
+        }
+    }
+  *out_attributes = make_c_array(m_resident_attribs);
+  *out_indices = make_c_array(m_resident_indices);
+}
+
 //////////////////////////////////
 // Splitter methods
 enum Splitter::place_element_t
@@ -765,13 +869,13 @@ select_all(fastuidraw::c_array<unsigned int> dst, unsigned int &current) const
     }
 }
 
-const GlyphAttributesIndices&
+GlyphAttributesIndices&
 GlyphSubsetPrivate::
 attributes_indices(fastuidraw::GlyphRenderer R)
 {
   using namespace fastuidraw;
 
-  std::map<GlyphRenderer, GlyphAttributesIndices>::const_iterator iter;
+  std::map<GlyphRenderer, GlyphAttributesIndices>::iterator iter;
   if (!m_data.empty() && m_glyph_atlas_clear_count != m_owner->cache()->number_times_atlas_cleared())
     {
       m_glyph_atlas_clear_count = m_owner->cache()->number_times_atlas_cleared();
@@ -781,6 +885,10 @@ attributes_indices(fastuidraw::GlyphRenderer R)
   iter = m_data.find(R);
   if (iter != m_data.end())
     {
+      /* the glyphs are about to be drawn, mark them as
+       * used so that the GlyphCache does not evict them.
+       */
+      m_owner->cache()->mark_glyphs_used(iter->second.glyphs());
       return iter->second;
     }
 
@@ -891,10 +999,27 @@ attributes_and_indices(GlyphRenderer render,
   GlyphSubsetPrivate *d;
 
   d = static_cast<GlyphSubsetPrivate*>(m_d);
-  const GlyphAttributesIndices &values(d->attributes_indices(render));
+  d->attributes_indices(render).resident_attributes_indices(out_attributes, out_indices);
+}
+
+bool
+fastuidraw::GlyphSequence::Subset::
+all_resident(GlyphRenderer render)
+{
+  GlyphSubsetPrivate *d;
 
-  *out_attributes = values.attributes();
-  *out_indices = values.indices();
+  d = static_cast<GlyphSubsetPrivate*>(m_d);
+  return d->attributes_indices(render).all_resident();
+}
+
+fastuidraw::c_array<const fastuidraw::Glyph>
+fastuidraw::GlyphSequence::Subset::
+rendered_glyphs(GlyphRenderer render)
+{
+  GlyphSubsetPrivate *d;
+
+  d = static_cast<GlyphSubsetPrivate*>(m_d);
+  return d->attributes_indices(render).glyphs();
 }
 
 fastuidraw::c_array<const unsigned int>
@@ -201,6 +201,21 @@ z_range(unsigned int i) const
     range_type<int>(0, 0);
 }
 
+uint64_t
+fastuidraw::PainterAttributeData::
+memory_usage(void) const
+{
+  PainterAttributeDataPrivate *d;
+  d = static_cast<PainterAttributeDataPrivate*>(m_d);
+  return sizeof(PainterAttribute) * d->m_attribute_data.capacity()
+    + sizeof(PainterIndex) * d->m_index_data.capacity()
+    + sizeof(c_array<const PainterAttribute>) * d->m_attribute_chunks.capacity()
+    + sizeof(c_array<const PainterIndex>) * d->m_index_chunks.capacity()
+    + sizeof(range_type<int>) * d->m_z_ranges.capacity()
+    + sizeof(unsigned int) * d->m_non_empty_index_data_chunks.capacity()
+    + sizeof(int) * d->m_index_adjust_chunks.capacity();
+}
+
 fastuidraw::c_array<const unsigned int>
 fastuidraw::PainterAttributeData::
 non_empty_index_data_chunks(void) const
@@ -19,6 +19,8 @@
 #include <vector>
 #include <complex>
 #include <algorithm>
+#include <functional>
+#include <atomic>
 
 #include <fastuidraw/tessellated_path.hpp>
 #include <fastuidraw/partitioned_tessellated_path.hpp>
@@ -35,6 +37,8 @@
 #include <private/path_util_private.hpp>
 #include <private/point_attribute_data_merger.hpp>
 #include <private/clip.hpp>
+#include <private/attribute_data_file.hpp>
+#include <private/worker_pool.hpp>
 
 namespace
 {
@@ -308,6 +312,26 @@ namespace
                        const fastuidraw::PartitionedTessellatedPath &P,
                        std::vector<SubsetPrivate*> &out_values);
 
+    /* Use edge data read from a file instead of making it
+     * from the subset, the data is deleted if this is already
+     * ready; must not have children.
+     */
+    void
+    make_ready_from_data(fastuidraw::PainterAttributeData *data);
+
+    /* add the values that determine the attribute data of
+     * this SubsetPrivate to a hash.
+     */
+    uint64_t
+    signature(uint64_t h) const;
+
+    uint64_t
+    memory_usage(void) const
+    {
+      return sizeof(SubsetPrivate)
+        + ((m_painter_data) ? m_painter_data->memory_usage() : 0u);
+    }
+
   private:
     class PostProcessVariables
     {
@@ -848,9 +872,18 @@ namespace
   {
   public:
     PreparedAttributeData(void):
+      m_loaded(nullptr),
       m_ready(false)
     {}
 
+    ~PreparedAttributeData()
+    {
+      if (m_loaded)
+        {
+          FASTUIDRAWdelete(m_loaded);
+        }
+    }
+
     /* must be called before the first call to data().
      */
     void
@@ -867,11 +900,36 @@ namespace
           m_data.set_data(T(P, st));
           m_ready = true;
         }
-      return m_data;
+      return (m_loaded) ? *m_loaded : m_data;
+    }
+
+    /* Use data read from a file instead of making it, the
+     * data is deleted if it is already made.
+     */
+    void
+    set_loaded(fastuidraw::PainterAttributeData *data)
+    {
+      if (m_ready)
+        {
+          FASTUIDRAWdelete(data);
+        }
+      else
+        {
+          m_loaded = data;
+          m_ready = true;
+        }
+    }
+
+    uint64_t
+    memory_usage(void) const
+    {
+      return m_data.memory_usage()
+        + ((m_loaded) ? m_loaded->memory_usage() : 0u);
     }
 
   private:
     fastuidraw::PainterAttributeData m_data;
+    fastuidraw::PainterAttributeData *m_loaded;
     bool m_ready;
   };
 
@@ -1001,6 +1059,44 @@ namespace
     fetch_create(float thresh,
                  std::vector<ThreshWithData> &values);
 
+    /* hash of the values that determine the attribute
+     * data, a file written by StrokedPath::save() can only
+     * be loaded by a StrokedPath with the same signature.
+     */
+    uint64_t
+    signature(void) const;
+
+    void
+    save(fastuidraw::detail::AttributeDataFileWriter &writer);
+
+    bool
+    load(fastuidraw::detail::AttributeDataFileReader &reader);
+
+    static
+    void
+    save_rounded(fastuidraw::detail::AttributeDataFileWriter &writer,
+                 const std::vector<ThreshWithData> &values);
+
+    static
+    bool
+    load_rounded(fastuidraw::detail::AttributeDataFileReader &reader,
+                 std::vector<ThreshWithData> *out_values);
+
+    static
+    void
+    adopt_rounded(std::vector<ThreshWithData> &values,
+                  std::vector<ThreshWithData> &loaded);
+
+    static
+    uint64_t
+    memory_usage_rounded(const std::vector<ThreshWithData> &values);
+
+    uint64_t
+    memory_usage(void) const;
+
+    void
+    prepare(unsigned int num_threads);
+
     bool m_has_arcs;
     fastuidraw::reference_counted_ptr<const fastuidraw::PartitionedTessellatedPath> m_path_partioned;
     SubsetPrivate* m_root;
@@ -1020,6 +1116,50 @@ namespace
     std::vector<ThreshWithData> m_rounded_caps;
   };
 
+
+  /* version of the files of StrokedPath::save(), increment
+   * whenever the contents of the files change.
+   */
+  const uint32_t stroked_path_file_version = 1u;
+
+  uint64_t
+  fnv1a(uint64_t h, uint32_t v)
+  {
+    for (unsigned int i = 0; i < 4; ++i, v >>= 8u)
+      {
+        h ^= (v & 0xFFu);
+        h *= 1099511628211ull;
+      }
+    return h;
+  }
+
+  uint64_t
+  fnv1a(uint64_t h, const fastuidraw::vec2 &v)
+  {
+    h = fnv1a(h, fastuidraw::pack_float(v.x()));
+    h = fnv1a(h, fastuidraw::pack_float(v.y()));
+    return h;
+  }
+
+  /* Run tasks across the threads of the shared worker pool,
+   * handing out one task at a time since their costs vary a
+   * great deal; the calling thread is one of the threads.
+   */
+  void
+  run_tasks(const std::vector<std::function<void()> > &tasks,
+            unsigned int num_threads)
+  {
+    std::atomic<unsigned int> next(0);
+
+    num_threads = fastuidraw::t_min(num_threads, static_cast<unsigned int>(tasks.size()));
+    fastuidraw::detail::WorkerPool::global().run(num_threads, [&next, &tasks](unsigned int)
+      {
+        for (unsigned int i = next++; i < tasks.size(); i = next++)
+          {
+            tasks[i]();
+          }
+      });
+  }
 }
 
 ///////////////////////////
@@ -1322,6 +1462,56 @@ make_ready_from_subset(void)
   m_sizes_ready = true;
 }
 
+void
+SubsetPrivate::
+make_ready_from_data(fastuidraw::PainterAttributeData *data)
+{
+  FASTUIDRAWassert(!has_children());
+  if (m_ready)
+    {
+      FASTUIDRAWdelete(data);
+      return;
+    }
+
+  FASTUIDRAWassert(m_painter_data == nullptr);
+  m_ready = true;
+  m_painter_data = data;
+  m_num_attributes = m_painter_data->attribute_data_chunk(0).size();
+  m_num_indices = m_painter_data->index_data_chunk(0).size();
+  m_sizes_ready = true;
+}
+
+uint64_t
+SubsetPrivate::
+signature(uint64_t h) const
+{
+  h = fnv1a(h, has_children());
+  h = fnv1a(h, bounding_box().m_min_point);
+  h = fnv1a(h, bounding_box().m_max_point);
+  for (const auto &chain : segment_chains())
+    {
+      h = fnv1a(h, chain.m_segments.size());
+      for (const auto &S : chain.m_segments)
+        {
+          h = fnv1a(h, S.m_start_pt);
+          h = fnv1a(h, S.m_end_pt);
+        }
+    }
+
+  h = fnv1a(h, join_values().size());
+  for (const auto &J : join_values())
+    {
+      h = fnv1a(h, J.m_position);
+    }
+
+  h = fnv1a(h, cap_values().size());
+  for (const auto &C : cap_values())
+    {
+      h = fnv1a(h, C.m_position);
+    }
+  return h;
+}
+
 void
 SubsetPrivate::
 ready_sizes_from_children(void)
@@ -1773,6 +1963,315 @@ fetch_create(float thresh, std::vector<ThreshWithData> &values)
     }
 }
 
+void
+StrokedPathPrivate::
+prepare(unsigned int num_threads)
+{
+  std::vector<std::function<void()> > tasks;
+  std::vector<std::vector<SubsetPrivate*> > parents_by_depth;
+
+  /* Each of the join and cap styles and the edges of each
+   * SubsetPrivate without children is made independently of
+   * the others. The joins and caps are listed first because
+   * each is a large task.
+   */
+  tasks.push_back([this]() { m_bevel_joins.data(m_cap_join_tracking, m_root); });
+  tasks.push_back([this]() { m_miter_clip_joins.data(m_cap_join_tracking, m_root); });
+  tasks.push_back([this]() { m_miter_joins.data(m_cap_join_tracking, m_root); });
+  tasks.push_back([this]() { m_miter_bevel_joins.data(m_cap_join_tracking, m_root); });
+  tasks.push_back([this]() { m_arc_rounded_joins.data(m_cap_join_tracking, m_root); });
+  tasks.push_back([this]() { m_square_caps.data(m_cap_join_tracking, m_root); });
+  tasks.push_back([this]() { m_adjustable_caps.data(m_cap_join_tracking, m_root); });
+  tasks.push_back([this]() { m_flat_caps.data(m_cap_join_tracking, m_root); });
+  tasks.push_back([this]() { m_arc_rounded_caps.data(m_cap_join_tracking, m_root); });
+  tasks.push_back([this]() { fetch_create<RoundedJoinCreator>(1.0f, m_rounded_joins); });
+  tasks.push_back([this]() { fetch_create<RoundedCapCreator>(1.0f, m_rounded_caps); });
+
+  std::function<void (SubsetPrivate*, unsigned int)> visit;
+  visit = [&](SubsetPrivate *S, unsigned int depth)
+    {
+      if (S->has_children())
+        {
+          if (parents_by_depth.size() <= depth)
+            {
+              parents_by_depth.resize(depth + 1);
+            }
+          parents_by_depth[depth].push_back(S);
+          visit(S->child(0), depth + 1);
+          visit(S->child(1), depth + 1);
+        }
+      else
+        {
+          tasks.push_back([S]() { S->make_ready(); });
+        }
+    };
+  visit(m_root, 0);
+  run_tasks(tasks, num_threads);
+
+  /* the merged data of a SubsetPrivate with children needs
+   * the data of its children, so go from the deepest level
+   * up; the SubsetPrivate objects of a level are independent.
+   */
+  for (unsigned int d = parents_by_depth.size(); d > 0; --d)
+    {
+      tasks.clear();
+      for (SubsetPrivate *S : parents_by_depth[d - 1])
+        {
+          tasks.push_back([S]() { S->make_ready(); });
+        }
+      run_tasks(tasks, num_threads);
+    }
+}
+
+uint64_t
+StrokedPathPrivate::
+signature(void) const
+{
+  uint64_t h(14695981039346656037ull);
+
+  h = fnv1a(h, m_has_arcs);
+  h = fnv1a(h, m_subsets.size());
+  for (const SubsetPrivate *S : m_subsets)
+    {
+      h = S->signature(h);
+    }
+  return h;
+}
+
+void
+StrokedPathPrivate::
+save_rounded(fastuidraw::detail::AttributeDataFileWriter &writer,
+             const std::vector<ThreshWithData> &values)
+{
+  writer.add(values.size());
+  for (const ThreshWithData &v : values)
+    {
+      writer.add_float(v.m_thresh);
+      writer.add_data(*v.m_data);
+    }
+}
+
+void
+StrokedPathPrivate::
+save(fastuidraw::detail::AttributeDataFileWriter &writer)
+{
+  uint64_t h(signature());
+
+  writer.add(static_cast<uint32_t>(h & 0xFFFFFFFFu));
+  writer.add(static_cast<uint32_t>(h >> 32u));
+
+  for (SubsetPrivate *S : m_subsets)
+    {
+      if (!S->has_children())
+        {
+          S->make_ready();
+          writer.add_data(S->painter_data());
+        }
+    }
+
+  writer.add_data(m_bevel_joins.data(m_cap_join_tracking, m_root));
+  writer.add_data(m_miter_clip_joins.data(m_cap_join_tracking, m_root));
+  writer.add_data(m_miter_joins.data(m_cap_join_tracking, m_root));
+  writer.add_data(m_miter_bevel_joins.data(m_cap_join_tracking, m_root));
+  writer.add_data(m_arc_rounded_joins.data(m_cap_join_tracking, m_root));
+  writer.add_data(m_square_caps.data(m_cap_join_tracking, m_root));
+  writer.add_data(m_adjustable_caps.data(m_cap_join_tracking, m_root));
+  writer.add_data(m_flat_caps.data(m_cap_join_tracking, m_root));
+  writer.add_data(m_arc_rounded_caps.data(m_cap_join_tracking, m_root));
+
+  /* the rounded joins and caps are saved for each threshold
+   * already requested, but always with at least the first.
+   */
+  fetch_create<RoundedJoinCreator>(1.0f, m_rounded_joins);
+  fetch_create<RoundedCapCreator>(1.0f, m_rounded_caps);
+  save_rounded(writer, m_rounded_joins);
+  save_rounded(writer, m_rounded_caps);
+}
+
+bool
+StrokedPathPrivate::
+load_rounded(fastuidraw::detail::AttributeDataFileReader &reader,
+             std::vector<ThreshWithData> *out_values)
+{
+  uint32_t cnt;
+
+  if (!reader.read(&cnt))
+    {
+      return false;
+    }
+
+  for (uint32_t i = 0; i < cnt; ++i)
+    {
+      ThreshWithData v;
+
+      /* the thresholds are 1.0, 0.5, 0.25, ... as made
+       * by fetch_create().
+       */
+      if (!reader.read_float(&v.m_thresh)
+          || v.m_thresh != ((i == 0) ? 1.0f : 0.5f * out_values->back().m_thresh))
+        {
+          return false;
+        }
+
+      v.m_data = FASTUIDRAWnew fastuidraw::PainterAttributeData();
+      out_values->push_back(v);
+      if (!reader.read_data(v.m_data))
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+void
+StrokedPathPrivate::
+adopt_rounded(std::vector<ThreshWithData> &values,
+              std::vector<ThreshWithData> &loaded)
+{
+  /* keep those already made, the thresholds of both
+   * are the same sequence.
+   */
+  for (unsigned int i = 0; i < loaded.size(); ++i)
+    {
+      if (i < values.size())
+        {
+          FASTUIDRAWdelete(loaded[i].m_data);
+        }
+      else
+        {
+          values.push_back(loaded[i]);
+        }
+    }
+  loaded.clear();
+}
+
+uint64_t
+StrokedPathPrivate::
+memory_usage_rounded(const std::vector<ThreshWithData> &values)
+{
+  uint64_t return_value(0u);
+
+  for (const ThreshWithData &v : values)
+    {
+      return_value += v.m_data->memory_usage();
+    }
+  return return_value;
+}
+
+uint64_t
+StrokedPathPrivate::
+memory_usage(void) const
+{
+  uint64_t return_value(0u);
+
+  for (const SubsetPrivate *S : m_subsets)
+    {
+      return_value += S->memory_usage();
+    }
+
+  return_value += m_bevel_joins.memory_usage()
+    + m_miter_clip_joins.memory_usage()
+    + m_miter_joins.memory_usage()
+    + m_miter_bevel_joins.memory_usage()
+    + m_arc_rounded_joins.memory_usage()
+    + m_square_caps.memory_usage()
+    + m_adjustable_caps.memory_usage()
+    + m_flat_caps.memory_usage()
+    + m_arc_rounded_caps.memory_usage()
+    + memory_usage_rounded(m_rounded_joins)
+    + memory_usage_rounded(m_rounded_caps);
+
+  return return_value;
+}
+
+bool
+StrokedPathPrivate::
+load(fastuidraw::detail::AttributeDataFileReader &reader)
+{
+  uint32_t h0, h1;
+  uint64_t h(signature());
+
+  if (!reader.read(&h0) || !reader.read(&h1)
+      || h0 != static_cast<uint32_t>(h & 0xFFFFFFFFu)
+      || h1 != static_cast<uint32_t>(h >> 32u))
+    {
+      return false;
+    }
+
+  /* read everything first so that nothing is changed
+   * if the file is not valid.
+   */
+  std::vector<fastuidraw::PainterAttributeData*> data;
+  std::vector<ThreshWithData> rounded_joins, rounded_caps;
+  unsigned int num_leaves(0);
+  bool valid(true);
+
+  for (SubsetPrivate *S : m_subsets)
+    {
+      num_leaves += (S->has_children()) ? 0u : 1u;
+    }
+
+  for (unsigned int i = 0, endi = num_leaves + 9; valid && i < endi; ++i)
+    {
+      data.push_back(FASTUIDRAWnew fastuidraw::PainterAttributeData());
+      valid = reader.read_data(data.back());
+    }
+
+  valid = valid
+    && load_rounded(reader, &rounded_joins)
+    && load_rounded(reader, &rounded_caps)
+    && reader.at_end();
+
+  /* the edge data of a subset is in chunk 0 */
+  for (unsigned int i = 0; valid && i < num_leaves; ++i)
+    {
+      valid = !data[i]->attribute_data_chunks().empty()
+        && !data[i]->index_data_chunks().empty();
+    }
+
+  if (!valid)
+    {
+      for (fastuidraw::PainterAttributeData *p : data)
+        {
+          FASTUIDRAWdelete(p);
+        }
+      for (const ThreshWithData &v : rounded_joins)
+        {
+          FASTUIDRAWdelete(v.m_data);
+        }
+      for (const ThreshWithData &v : rounded_caps)
+        {
+          FASTUIDRAWdelete(v.m_data);
+        }
+      return false;
+    }
+
+  unsigned int current(0);
+  for (SubsetPrivate *S : m_subsets)
+    {
+      if (!S->has_children())
+        {
+          S->make_ready_from_data(data[current++]);
+        }
+    }
+
+  m_bevel_joins.set_loaded(data[current++]);
+  m_miter_clip_joins.set_loaded(data[current++]);
+  m_miter_joins.set_loaded(data[current++]);
+  m_miter_bevel_joins.set_loaded(data[current++]);
+  m_arc_rounded_joins.set_loaded(data[current++]);
+  m_square_caps.set_loaded(data[current++]);
+  m_adjustable_caps.set_loaded(data[current++]);
+  m_flat_caps.set_loaded(data[current++]);
+  m_arc_rounded_caps.set_loaded(data[current++]);
+  FASTUIDRAWassert(current == data.size());
+
+  adopt_rounded(m_rounded_joins, rounded_joins);
+  adopt_rounded(m_rounded_caps, rounded_caps);
+
+  return true;
+}
+
 //////////////////////////////////////////////
 // fastuidraw::StrokedPath::SubsetSelection methods
 fastuidraw::StrokedPath::SubsetSelection::
@@ -2094,6 +2593,24 @@ root_subset(void) const
   return Subset(d->m_root);
 }
 
+uint64_t
+fastuidraw::StrokedPath::
+memory_usage(void) const
+{
+  StrokedPathPrivate *d;
+  d = static_cast<StrokedPathPrivate*>(m_d);
+  return d->memory_usage();
+}
+
+void
+fastuidraw::StrokedPath::
+prepare(unsigned int num_threads) const
+{
+  StrokedPathPrivate *d;
+  d = static_cast<StrokedPathPrivate*>(m_d);
+  d->prepare(t_max(1u, num_threads));
+}
+
 const fastuidraw::PartitionedTessellatedPath&
 fastuidraw::StrokedPath::
 partitioned_path(void) const
@@ -2103,6 +2620,34 @@ partitioned_path(void) const
   return *d->m_path_partioned;
 }
 
+enum fastuidraw::return_code
+fastuidraw::StrokedPath::
+save(c_string filename) const
+{
+  StrokedPathPrivate *d;
+  detail::AttributeDataFileWriter writer;
+
+  d = static_cast<StrokedPathPrivate*>(m_d);
+  d->save(writer);
+  return writer.write(filename, detail::stroked_path_file, stroked_path_file_version);
+}
+
+enum fastuidraw::return_code
+fastuidraw::StrokedPath::
+load(c_string filename) const
+{
+  StrokedPathPrivate *d;
+  detail::AttributeDataFileReader reader;
+
+  d = static_cast<StrokedPathPrivate*>(m_d);
+  if (reader.open(filename, detail::stroked_path_file, stroked_path_file_version) == routine_fail
+      || !d->load(reader))
+    {
+      return routine_fail;
+    }
+  return routine_success;
+}
+
 const fastuidraw::PainterAttributeData&
 fastuidraw::StrokedPath::
 square_caps(void) const
@@ -36,6 +36,8 @@
 #include <private/bounding_box.hpp>
 #include <private/rect_atlas.hpp>
 #include <private/painter_backend/painter_packer.hpp>
+#include <private/painter_backend/painter_command_list_private.hpp>
+#include <private/painter_backend/painter_display_list_private.hpp>
 
 namespace
 {
@@ -1185,6 +1187,17 @@ namespace
     A.m_attrib1.x() = fastuidraw::pack_float(normal.x());
     A.m_attrib1.y() = fastuidraw::pack_float(normal.y());
 
+    /* the shader does not read the remaining lanes, but they are
+     * still copied to the backend; a PainterAttribute does not
+     * initialize its values, so leaving them unset would send
+     * uninitialized memory and make the attribute data, and any
+     * checksum of it such as that of the null backend, differ
+     * from run to run.
+     */
+    A.m_attrib1.z() = 0u;
+    A.m_attrib1.w() = 0u;
+    A.m_attrib2 = fastuidraw::uvec4(0u);
+
     return A;
   }
 
@@ -1551,6 +1564,9 @@ namespace
     void
     rotate(float angle);
 
+    fastuidraw::BoundingBox<float>
+    compute_draw_bounds(fastuidraw::c_array<const fastuidraw::vec2> pts);
+
     fastuidraw::BoundingBox<float>
     compute_clip_intersect_rect(const fastuidraw::Painter::NormalizedCoordRect &rect,
                                 float additional_pixel_slack);
@@ -1574,6 +1590,16 @@ namespace
     void
     end_coverage_buffer(void);
 
+    void
+    set_draw_bounds(fastuidraw::PainterPackerData &p);
+
+    /* true if the draws need their bounds, see set_draw_bounds() */
+    bool
+    draw_bounds_needed(void) const
+    {
+      return m_draw_reorder_window > 0u && !m_recording_list;
+    }
+
     void
     draw_generic(fastuidraw::PainterItemShader *shader,
                  const fastuidraw::PainterData &draw,
@@ -1881,6 +1907,40 @@ namespace
     compute_glyph_renderer(float format_size,
                            const fastuidraw::Painter::GlyphRendererChooser &chooser);
 
+    void
+    begin_recording(const fastuidraw::reference_counted_ptr<fastuidraw::PainterCommandList> &list,
+                    fastuidraw::detail::PainterCommandListPrivate *list_d);
+
+    void
+    end_recording(void);
+
+    /* When recording to a PainterCommandList there is no deferred
+     * coverage buffer, so shader anti-aliasing is not possible and
+     * requesting it fails the recording.
+     */
+    bool
+    shader_anti_aliasing(bool apply_anti_aliasing) const
+    {
+      if (apply_anti_aliasing && m_recording_list)
+        {
+          recording_failed();
+          return false;
+        }
+      return apply_anti_aliasing;
+    }
+
+    /* To be called when content that a PainterCommandList cannot
+     * hold (draws that need a deferred coverage buffer or layers
+     * with effects) is drawn while recording; end_recording() then
+     * drops the recorded content, see PainterCommandList::recording_failed().
+     */
+    void
+    recording_failed(void) const
+    {
+      FASTUIDRAWassert(m_recording_list_d);
+      m_recording_list_d->m_recording_failed = true;
+    }
+
     DefaultGlyphRendererChooser m_default_glyph_renderer_chooser;
     fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker> m_root_packer;
     ExtendedPool::PackedItemMatrix m_root_identity_matrix;
@@ -1889,6 +1949,12 @@ namespace
     fastuidraw::vec2 m_viewport_dimensions;
     fastuidraw::vec2 m_one_pixel_width;
     float m_curve_flatness;
+    unsigned int m_draw_reorder_window;
+
+    /* if non-empty, bounds in normalized device coordinates
+     * of the draws being made, see draw_generic().
+     */
+    fastuidraw::BoundingBox<float> m_draw_bounds;
     int m_current_z, m_draw_data_added_count;
     ClipRectState m_clip_rect_state;
     std::vector<occluder_stack_entry> m_occluder_stack;
@@ -1903,6 +1969,19 @@ namespace
     fastuidraw::reference_counted_ptr<fastuidraw::PainterEngine> m_backend_factory;
     fastuidraw::reference_counted_ptr<fastuidraw::PainterBackend> m_backend;
     fastuidraw::PainterEngine::PerformanceHints m_hints;
+
+    /* created on the first Painter::begin() to a PainterCommandList;
+     * while recording, m_root_packer and m_record_packer are swapped.
+     */
+    fastuidraw::reference_counted_ptr<fastuidraw::detail::PainterBackendRecord> m_record_backend;
+    fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker> m_record_packer;
+    fastuidraw::reference_counted_ptr<fastuidraw::PainterCommandList> m_recording_list;
+    fastuidraw::detail::PainterCommandListPrivate *m_recording_list_d;
+
+    /* created on the first draw of a PainterDisplayList that
+     * needs to be recorded.
+     */
+    fastuidraw::reference_counted_ptr<fastuidraw::Painter> m_display_list_recorder;
     fastuidraw::reference_counted_ptr<fastuidraw::PainterEffectBrush> m_brush_fx;
     fastuidraw::PainterShaderSet m_default_shaders;
     fastuidraw::PainterBrushShader *m_default_brush_shader;
@@ -2170,7 +2249,8 @@ init_for_stroking(PainterPrivate &painter,
 
   if ((!m_join_attribute_data || m_shader[drawing_joins]->coverage_shader())
       && (!m_cap_attribute_data || m_shader[drawing_caps]->coverage_shader())
-      && !m_shader[drawing_joins]->coverage_shader())
+      && !m_shader[drawing_joins]->coverage_shader()
+      && !painter.draw_bounds_needed())
     {
       cvg_normalized_rect = nullptr;
     }
@@ -3172,9 +3252,11 @@ PainterPrivate(const fastuidraw::reference_counted_ptr<fastuidraw::PainterEngine
   m_viewport_dimensions(1.0f, 1.0f),
   m_one_pixel_width(1.0f, 1.0f),
   m_curve_flatness(0.5f),
+  m_draw_reorder_window(0),
   m_backend_factory(backend_factory),
   m_backend(backend_factory->create_backend()),
   m_hints(backend_factory->hints()),
+  m_recording_list_d(nullptr),
   m_current_brush_adjust(nullptr)
 {
   /* By calling PainterBackend::default_shaders(), we make the shaders
@@ -3351,6 +3433,34 @@ compute_clip_intersect_polygon(fastuidraw::c_array<const fastuidraw::vec3> polyg
   return return_value;
 }
 
+fastuidraw::BoundingBox<float>
+PainterPrivate::
+compute_draw_bounds(fastuidraw::c_array<const fastuidraw::vec2> pts)
+{
+  using namespace fastuidraw;
+
+  const float3x3 &transform(m_clip_rect_state.item_matrix());
+  BoundingBox<float> return_value;
+
+  /* Unlike compute_clip_intersect_polygon(), do not clip the
+   * polygon; instead give up (returning an empty box) if a
+   * point is not in front of the viewer.
+   */
+  for (const vec2 &pt : pts)
+    {
+      vec3 clip_pt(transform * vec3(pt.x(), pt.y(), 1.0f));
+
+      if (clip_pt.z() <= 0.0f)
+        {
+          return BoundingBox<float>();
+        }
+      return_value.union_point(vec2(clip_pt) * (1.0f / clip_pt.z()));
+    }
+  return_value.intersect_against(m_clip_store.current_bb());
+
+  return return_value;
+}
+
 fastuidraw::BoundingBox<float>
 PainterPrivate::
 compute_clip_intersect_rect(const fastuidraw::Painter::NormalizedCoordRect &rect,
@@ -3412,7 +3522,7 @@ PainterPrivate::
 begin_coverage_buffer_normalized_rect(const fastuidraw::Rect &normalized_rect,
                                       bool non_empty)
 {
-  if (non_empty)
+  if (non_empty && !m_recording_list)
     {
       /* intersect normalized_rect with the current */
       m_deferred_coverage_stack.push_back(m_deferred_coverage_stack_entry_factory.fetch(normalized_rect, this));
@@ -3797,6 +3907,26 @@ select_filled_path(const fastuidraw::Path &path)
   return path.tessellation(thresh).filled(thresh);
 }
 
+void
+PainterPrivate::
+set_draw_bounds(fastuidraw::PainterPackerData &p)
+{
+  /* The bounds are only needed by a PainterPacker that reorders
+   * draws. What a draw touches is within the bounding box of the
+   * current clipping region because of the clip equations and
+   * occluders; a caller that knows a smaller region sets it in
+   * m_draw_bounds.
+   */
+  if (draw_bounds_needed())
+    {
+      p.m_bounds = m_clip_store.current_bb();
+      if (!m_draw_bounds.empty())
+        {
+          p.m_bounds.intersect_against(m_draw_bounds);
+        }
+    }
+}
+
 void
 PainterPrivate::
 draw_generic(fastuidraw::PainterItemShader *shader,
@@ -3811,6 +3941,12 @@ draw_generic(fastuidraw::PainterItemShader *shader,
   fastuidraw::PainterPacker *cvg_packer(deferred_coverage_packer());
   fastuidraw::PainterPacker::DeferredCoverageReadParams coverage_buffer;
 
+  if (shader->coverage_shader() && m_recording_list)
+    {
+      recording_failed();
+      return;
+    }
+
   if (shader->coverage_shader() && cvg_packer)
     {
       FASTUIDRAWassert(!m_deferred_coverage_stack.empty());
@@ -3838,6 +3974,7 @@ draw_generic(fastuidraw::PainterItemShader *shader,
       p.m_brush_adjust = *m_current_brush_adjust;
       FASTUIDRAWassert(p.m_brush_adjust);
     }
+  set_draw_bounds(p);
 
   packer()->draw_generic(coverage_buffer, shader, p,
                          attrib_chunks, index_chunks, index_adjusts,
@@ -3861,6 +3998,12 @@ draw_generic(fastuidraw::PainterItemShader *shader,
   requires_coverage_buffer = src.requires_coverage_buffer()
     || (shader && shader->coverage_shader());
 
+  if (requires_coverage_buffer && m_recording_list)
+    {
+      recording_failed();
+      return 0;
+    }
+
   if (requires_coverage_buffer && cvg_packer)
     {
       FASTUIDRAWassert(!m_deferred_coverage_stack.empty());
@@ -3893,6 +4036,7 @@ draw_generic(fastuidraw::PainterItemShader *shader,
       p.m_brush_adjust = *m_current_brush_adjust;
       FASTUIDRAWassert(p.m_brush_adjust);
     }
+  set_draw_bounds(p);
   return_value = packer()->draw_generic(coverage_buffer, shader, p, src, z);
   ++m_draw_data_added_count;
   return return_value;
@@ -4151,6 +4295,8 @@ stroke_path(const fastuidraw::PainterStrokeShader &shader,
   StrokingAttributeWriter::StrokingMethod method;
   fastuidraw::BoundingBox<float> coverage_buffer_bb;
 
+  apply_anti_aliasing = shader_anti_aliasing(apply_anti_aliasing);
+
   tp = (path.has_arcs()) ?
     Painter::stroking_method_arc:
     Painter::stroking_method_linear;
@@ -4192,7 +4338,16 @@ stroke_path(const fastuidraw::PainterStrokeShader &shader,
       begin_coverage_buffer_normalized_rect(coverage_buffer_bb.as_rect(), !coverage_buffer_bb.empty());
     }
 
+  /* coverage_buffer_bb is the bounding box of the selected
+   * subsets inflated by the stroking distances.
+   */
+  if (draw_bounds_needed())
+    {
+      m_draw_bounds = coverage_buffer_bb;
+    }
+
   draw_generic(nullptr, draw, m_work_room.m_effect_stroker);
+  m_draw_bounds.clear();
 
   if (requires_coverage_buffer)
     {
@@ -4214,6 +4369,7 @@ stroke_path(const fastuidraw::PainterStrokeShader &shader,
   BoundingBox<float> coverage_buffer_bb;
   bool requires_coverage_buffer;
 
+  apply_anti_aliasing = shader_anti_aliasing(apply_anti_aliasing);
   requires_coverage_buffer =
     m_work_room.m_non_effect_stroker.init_for_stroking(*this, shader,
                                                        draw.m_item_shader_data.m_packed_value.packed_data(),
@@ -4229,7 +4385,16 @@ stroke_path(const fastuidraw::PainterStrokeShader &shader,
       begin_coverage_buffer_normalized_rect(coverage_buffer_bb.as_rect(), !coverage_buffer_bb.empty());
     }
 
+  /* init_for_stroking() also computes coverage_buffer_bb
+   * when the draw bounds are needed.
+   */
+  if (draw_bounds_needed())
+    {
+      m_draw_bounds = coverage_buffer_bb;
+    }
+
   draw_generic(nullptr, draw, m_work_room.m_non_effect_stroker);
+  m_draw_bounds.clear();
 
   if (requires_coverage_buffer)
     {
@@ -4372,6 +4537,19 @@ fill_path(const fastuidraw::PainterFillShader &shader,
       m_work_room.m_fill_aa_fuzz.m_total_increment_z = 0;
     }
 
+  if (draw_bounds_needed())
+    {
+      BoundingBox<float> bb;
+
+      for (unsigned int s : m_work_room.m_fill_subset.m_subsets)
+        {
+          bb.union_box(filled_path.subset(s).bounding_box());
+        }
+
+      /* a pixel of slack for the anti-alias fuzz */
+      m_draw_bounds = compute_clip_intersect_rect(bb.as_rect(), 1.0f, 0.0f);
+    }
+
   draw_generic(shader.item_shader().get(), draw,
                make_c_array(m_work_room.m_fill_opaque.m_attrib_chunks),
                make_c_array(m_work_room.m_fill_opaque.m_index_chunks),
@@ -4383,6 +4561,7 @@ fill_path(const fastuidraw::PainterFillShader &shader,
     {
       draw_anti_alias_fuzz(shader, draw, m_work_room.m_fill_aa_fuzz);
     }
+  m_draw_bounds.clear();
 
   m_current_z += m_work_room.m_fill_aa_fuzz.m_total_increment_z;
 }
@@ -4537,6 +4716,15 @@ fill_rounded_rect(const fastuidraw::PainterFillShader &shader,
   fill_rect_with_side_points(shader, draw, r_min, false, m_current_z + total_incr_z);
   fill_rect_with_side_points(shader, draw, r_max, false, m_current_z + total_incr_z);
 
+  /* the corners and the anti-alias fuzz are within the
+   * rounded rect (plus a pixel for the fuzz); the rects
+   * above set their own bounds.
+   */
+  if (draw_bounds_needed())
+    {
+      m_draw_bounds = compute_clip_intersect_rect(R, 1.0f, 0.0f);
+    }
+
   for (int i = 0; i < 4; ++i)
     {
       m_current_brush_adjust = &rect_transforms.m_packed_adjusts[i];
@@ -4598,6 +4786,7 @@ fill_rounded_rect(const fastuidraw::PainterFillShader &shader,
           m_current_brush_adjust = nullptr;
         }
     }
+  m_draw_bounds.clear();
   m_current_z += total_incr_z;
 }
 
@@ -4739,6 +4928,13 @@ fill_convex_polygon(bool allow_sw_clipping,
         }
     }
 
+  if (draw_bounds_needed())
+    {
+      m_draw_bounds = (apply_anti_aliasing) ?
+        cvg_bb :
+        compute_draw_bounds(pts);
+    }
+
   ready_aa_polygon_attribs(pts, apply_anti_aliasing);
   ready_non_aa_polygon_attribs(pts);
 
@@ -4757,6 +4953,7 @@ fill_convex_polygon(bool allow_sw_clipping,
                    0, z);
       end_coverage_buffer();
     }
+  m_draw_bounds.clear();
 
   return m_work_room.m_polygon.m_fuzz_increment_z;
 }
@@ -4873,6 +5070,79 @@ compute_glyph_renderer(float format_size,
     }
 }
 
+void
+PainterPrivate::
+begin_recording(const fastuidraw::reference_counted_ptr<fastuidraw::PainterCommandList> &list,
+                fastuidraw::detail::PainterCommandListPrivate *list_d)
+{
+  FASTUIDRAWassert(!m_recording_list);
+  if (!m_record_packer)
+    {
+      m_record_backend = FASTUIDRAWnew fastuidraw::detail::PainterBackendRecord(*m_backend);
+      m_record_packer = FASTUIDRAWnew fastuidraw::PainterPacker(m_default_brush_shader, m_stats, m_record_backend,
+                                                                m_backend_factory->painter_shader_registrar(),
+                                                                m_backend_factory->configuration_base());
+    }
+
+  list_d->clear();
+  list_d->m_engine = m_backend_factory;
+  m_record_backend->target(list_d);
+  m_record_packer->resource_list(&list_d->m_resources);
+  m_recording_list = list;
+  m_recording_list_d = list_d;
+  std::swap(m_root_packer, m_record_packer);
+
+  /* a recorded segment might not fit into a mapping of
+   * m_backend when the list is merged.
+   */
+  if (m_record_backend->store_size_unknown())
+    {
+      recording_failed();
+    }
+}
+
+void
+PainterPrivate::
+end_recording(void)
+{
+  FASTUIDRAWassert(m_recording_list);
+  m_recording_list_d->m_z_extent = m_current_z - 1;
+  if (m_recording_list_d->m_recording_failed)
+    {
+      /* rather than retain content with draws missing,
+       * retain no content at all.
+       */
+      m_recording_list_d->m_segments.clear();
+      m_recording_list_d->m_z_extent = 0;
+      m_recording_list_d->m_glyphs.clear();
+      m_recording_list_d->m_resources.clear();
+    }
+
+  /* the list may be drawn over several frames; instead of keeping
+   * the atlases locked and the frame of the GlyphCache active, pin
+   * the glyphs it draws and hold the resources of its shader data.
+   * The pin is made before Painter::end() unlocks the atlases so
+   * the glyph data recorded is still where the list references it.
+   */
+  m_recording_list_d->m_glyph_pin =
+    m_backend_factory->glyph_cache().pin_glyphs(make_c_array(m_recording_list_d->m_glyphs));
+  m_recording_list_d->m_glyphs.clear();
+  m_root_packer->resource_list(nullptr);
+
+  m_record_backend->target(nullptr);
+  m_recording_list.clear();
+  m_recording_list_d = nullptr;
+  std::swap(m_root_packer, m_record_packer);
+
+  /* apply a value given to Painter::draw_reorder_window()
+   * while recording
+   */
+  if (m_root_packer->draw_reorder_window() != m_draw_reorder_window)
+    {
+      m_root_packer->draw_reorder_window(m_draw_reorder_window);
+    }
+}
+
 //////////////////////////////////
 // fastuidraw::Painter methods
 fastuidraw::Painter::
@@ -4920,8 +5190,12 @@ begin(const reference_counted_ptr<PainterSurface> &surface,
   image_atlas().lock_resources();
   colorstop_atlas().lock_resources();
   glyph_atlas().lock_resources();
+  glyph_cache().begin_frame();
 
-  d->m_backend->on_painter_begin();
+  if (!d->m_recording_list)
+    {
+      d->m_backend->on_painter_begin();
+    }
   d->m_viewport = surface->viewport();
   d->m_effects_layer_factory.begin(*surface);
   d->m_deferred_coverage_stack_entry_factory.begin(*surface);
@@ -4975,6 +5249,36 @@ begin(const reference_counted_ptr<PainterSurface> &surface,
   begin(surface, float3x3(ortho), clear_color_buffer);
 }
 
+void
+fastuidraw::Painter::
+begin(const reference_counted_ptr<PainterCommandList> &list,
+      const float3x3 &initial_transformation)
+{
+  PainterPrivate *d;
+  detail::PainterCommandListPrivate *list_d;
+
+  d = static_cast<PainterPrivate*>(m_d);
+  list_d = static_cast<detail::PainterCommandListPrivate*>(list->m_d);
+
+  d->begin_recording(list, list_d);
+  begin(list_d->m_surface, initial_transformation, false);
+}
+
+void
+fastuidraw::Painter::
+begin(const reference_counted_ptr<PainterCommandList> &list,
+      enum screen_orientation orientation)
+{
+  PainterPrivate *d;
+  detail::PainterCommandListPrivate *list_d;
+
+  d = static_cast<PainterPrivate*>(m_d);
+  list_d = static_cast<detail::PainterCommandListPrivate*>(list->m_d);
+
+  d->begin_recording(list, list_d);
+  begin(list_d->m_surface, orientation, false);
+}
+
 fastuidraw::c_array<const fastuidraw::PainterSurface* const>
 fastuidraw::Painter::
 end(void)
@@ -5023,10 +5327,16 @@ end(void)
   d->m_effects_layer_factory.end();
   d->m_root_packer->end();
 
+  if (d->m_recording_list)
+    {
+      d->end_recording();
+    }
+
   /* unlock resources after the commands are sent to the GPU */
   image_atlas().unlock_resources();
   colorstop_atlas().unlock_resources();
   glyph_atlas().unlock_resources();
+  glyph_cache().end_frame();
 
   return make_c_array(d->m_active_surfaces);
 }
@@ -5051,6 +5361,12 @@ flush(const reference_counted_ptr<PainterSurface> &new_surface)
       return routine_fail;
     }
 
+  if (d->m_recording_list)
+    {
+      /* flushing would restart the z-values of the recording */
+      return routine_fail;
+    }
+
   if (!d->m_effects_layer_stack.empty())
     {
       return routine_fail;
@@ -5291,6 +5607,130 @@ queue_action(const reference_counted_ptr<const PainterDrawBreakAction> &action)
   d->packer()->draw_break(action);
 }
 
+void
+fastuidraw::Painter::
+draw_command_list(const PainterCommandList &list)
+{
+  PainterPrivate *d;
+  detail::PainterCommandListPrivate *list_d;
+
+  d = static_cast<PainterPrivate*>(m_d);
+  list_d = static_cast<detail::PainterCommandListPrivate*>(list.m_d);
+
+  /* the shader IDs and groups of the headers of the list
+   * are only meaningful for the registrar that made them.
+   */
+  FASTUIDRAWassert(!list_d->m_engine || list_d->m_engine == d->m_backend_factory);
+  if (list_d->m_segments.empty() || d->m_clip_rect_state.m_all_content_culled)
+    {
+      return;
+    }
+
+  d->packer()->draw_command_list(*list_d, d->m_current_z - 1);
+  d->m_current_z += list_d->m_z_extent;
+  ++d->m_draw_data_added_count;
+}
+
+void
+fastuidraw::Painter::
+draw_display_list(const PainterDisplayList &list)
+{
+  PainterPrivate *d;
+  detail::PainterDisplayListPrivate *list_d;
+  detail::PainterCommandListPrivate *cl_d;
+  enum detail::PainterDisplayListPrivate::draw_method_t method;
+  ivec2 dims;
+
+  d = static_cast<PainterPrivate*>(m_d);
+  list_d = static_cast<detail::PainterDisplayListPrivate*>(list.m_d);
+  if (d->m_clip_rect_state.m_all_content_culled)
+    {
+      return;
+    }
+
+  dims = d->m_viewport.m_dimensions;
+  if (!list_d->m_list || list_d->m_list->dimensions() != dims)
+    {
+      list_d->clear();
+      list_d->m_list = FASTUIDRAWnew PainterCommandList(dims);
+    }
+  cl_d = static_cast<detail::PainterCommandListPrivate*>(list_d->m_list->m_d);
+
+  method = list_d->compute_draw_method(*cl_d, d->m_backend_factory.get(), dims,
+                                       transformation(),
+                                       d->m_clip_rect_state.clip_equations());
+  if (method == detail::PainterDisplayListPrivate::draw_retained)
+    {
+      ++list_d->m_number_replays;
+    }
+  else if (method == detail::PainterDisplayListPrivate::record_and_draw)
+    {
+      Painter *recorder;
+      PainterPrivate *recorder_d;
+      PainterClipEquations base_clip;
+      uvec3 atlas_releases;
+
+      /* record with a different Painter, so that the state of
+       * this Painter is not affected, under the current
+       * transformation.
+       */
+      if (!d->m_display_list_recorder)
+        {
+          d->m_display_list_recorder = FASTUIDRAWnew Painter(d->m_backend_factory);
+        }
+      recorder = d->m_display_list_recorder.get();
+      recorder_d = static_cast<PainterPrivate*>(recorder->m_d);
+
+      list_d->clear();
+      atlas_releases = detail::PainterDisplayListPrivate::atlas_releases(*d->m_backend_factory);
+      recorder->begin(list_d->m_list, transformation());
+      if (!matrix_has_perspective(transformation()))
+        {
+          /* Do not clip or cull against the viewport so that the
+           * list can be drawn under a transformation that shows
+           * content outside of the viewport of the recording.
+           * PainterClipEquations() is z >= 0, i.e. no clipping.
+           */
+          recorder_d->m_clip_rect_state.clip_equations(PainterClipEquations());
+          recorder_d->m_clip_store.reset(recorder_d->m_clip_rect_state.clip_equations().m_clip_equations);
+        }
+      base_clip = recorder_d->m_clip_rect_state.clip_equations();
+      list.draw_content(*recorder);
+      recorder->end();
+
+      list_d->recorded(*cl_d, dims, transformation(), base_clip, atlas_releases);
+      method = list_d->compute_draw_method(*cl_d, d->m_backend_factory.get(), dims,
+                                           transformation(),
+                                           d->m_clip_rect_state.clip_equations());
+    }
+
+  if (method == detail::PainterDisplayListPrivate::draw_directly)
+    {
+      save();
+      list.draw_content(*this);
+      restore();
+      return;
+    }
+
+  FASTUIDRAWassert(method == detail::PainterDisplayListPrivate::draw_retained);
+  if (cl_d->m_segments.empty())
+    {
+      return;
+    }
+
+  d->packer()->draw_command_list(*cl_d, d->m_current_z - 1, make_c_array(list_d->m_patches));
+  d->m_current_z += cl_d->m_z_extent;
+  ++d->m_draw_data_added_count;
+
+  /* glyphs skipped because they were not resident are only
+   * drawn once the content is recorded again.
+   */
+  if (cl_d->m_skipped_glyphs)
+    {
+      list_d->clear();
+    }
+}
+
 void
 fastuidraw::Painter::
 fill_convex_polygon(const PainterFillShader &shader,
@@ -5634,14 +6074,40 @@ draw_glyphs(const PainterGlyphShader &shader, const PainterData &draw,
                                       make_c_array(d->m_work_room.m_glyph.m_subsets));
   d->m_work_room.m_glyph.m_attribs.resize(num);
   d->m_work_room.m_glyph.m_indices.resize(num);
+
+  BoundingBox<float> bb;
   for (unsigned int k = 0; k < num; ++k)
     {
       unsigned int I(d->m_work_room.m_glyph.m_subsets[k]);
       GlyphSequence::Subset S(glyph_sequence.subset(I));
+      if (d->draw_bounds_needed())
+        {
+          Rect R;
+          if (S.bounding_box(&R))
+            {
+              bb.union_box(R);
+            }
+        }
+      if (d->m_recording_list)
+        {
+          c_array<const Glyph> glyphs(S.rendered_glyphs(renderer));
+
+          d->m_recording_list_d->m_glyphs.insert(d->m_recording_list_d->m_glyphs.end(),
+                                                 glyphs.begin(), glyphs.end());
+          if (!S.all_resident(renderer))
+            {
+              d->m_recording_list_d->m_skipped_glyphs = true;
+            }
+        }
       S.attributes_and_indices(renderer,
                    &d->m_work_room.m_glyph.m_attribs[k],
                    &d->m_work_room.m_glyph.m_indices[k]);
     }
+
+  if (!bb.empty())
+    {
+      d->m_draw_bounds = d->compute_clip_intersect_rect(bb.as_rect(), 1.0f, 0.0f);
+    }
   d->draw_generic(shader.shader(renderer.m_type).get(),
                   draw,
                   make_c_array(d->m_work_room.m_glyph.m_attribs),
@@ -5649,6 +6115,7 @@ draw_glyphs(const PainterGlyphShader &shader, const PainterData &draw,
                   c_array<const int>(),
                   c_array<const unsigned int>(),
                   d->m_current_z);
+  d->m_draw_bounds.clear();
 
   return renderer;
 }
@@ -5682,10 +6149,32 @@ draw_glyphs(const PainterGlyphShader &shader, const PainterData &draw,
       return renderer;
     }
 
+  if (d->m_recording_list)
+    {
+      c_array<const Glyph> glyphs(glyph_run.rendered_glyphs(renderer, begin, count));
+
+      d->m_recording_list_d->m_glyphs.insert(d->m_recording_list_d->m_glyphs.end(),
+                                             glyphs.begin(), glyphs.end());
+      if (!glyph_run.all_resident(renderer, begin, count))
+        {
+          d->m_recording_list_d->m_skipped_glyphs = true;
+        }
+    }
+
+  if (d->draw_bounds_needed())
+    {
+      Rect bb;
+      if (glyph_run.bounding_box(begin, count, &bb))
+        {
+          d->m_draw_bounds = d->compute_clip_intersect_rect(bb, 1.0f, 0.0f);
+        }
+    }
+
   d->draw_generic(shader.shader(renderer.m_type).get(),
                   draw,
                   glyph_run.subsequence(renderer, begin, count),
                   d->m_current_z);
+  d->m_draw_bounds.clear();
 
   return renderer;
 }
@@ -5933,6 +6422,33 @@ curve_flatness(void)
   return d->m_curve_flatness;
 }
 
+void
+fastuidraw::Painter::
+draw_reorder_window(unsigned int v)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  d->m_draw_reorder_window = v;
+
+  /* while recording, m_root_packer is the packer of the
+   * recording which does not reorder; the value is applied
+   * to the real root packer by end_recording().
+   */
+  if (!d->m_recording_list)
+    {
+      d->m_root_packer->draw_reorder_window(v);
+    }
+}
+
+unsigned int
+fastuidraw::Painter::
+draw_reorder_window(void) const
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  return d->m_draw_reorder_window;
+}
+
 void
 fastuidraw::Painter::
 save(void)
@@ -6039,12 +6555,22 @@ begin_layer(const reference_counted_ptr<const PainterEffect> &effect,
   BlendMode old_blend_mode(d->packer()->blend_mode());
   BlendMode copy_blend_mode(d->m_default_shaders.blend_shaders().blend_mode(blend_porter_duff_src));
 
+  /* A PainterCommandList cannot hold offscreen layers,
+   * so an effect fails the recording.
+   */
+  int number_passes(effect->number_passes());
+  if (d->m_recording_list && number_passes > 0)
+    {
+      d->recording_failed();
+      number_passes = 0;
+    }
+
   /* We must walk the passes in -REVERSE- order because the first element rendered
    * is the top of d->m_effects_layer_stack which is a STACK. We want the pass 0
    * to be at the top of the stack, thus we want the render passes in -reverse-
    * order.
    */
-  for (int pass = effect->number_passes() - 1; pass >= 0; --pass)
+  for (int pass = number_passes - 1; pass >= 0; --pass)
     {
       /* get the EffectsLayer that gives the PainterPacker and what to blit
        * when the layer is done
@@ -6834,6 +7360,7 @@ label(enum query_stats_t st)
       EASY(num_ends);
       EASY(num_layers);
       EASY(num_deferred_coverages);
+      EASY(num_draw_breaks_avoided);
     default:
       return "unknown";
     }
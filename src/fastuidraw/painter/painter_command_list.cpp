@@ -0,0 +1,144 @@
+/*!
+ * \file painter_command_list.cpp
+ * \brief file painter_command_list.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#include <fastuidraw/painter/painter_command_list.hpp>
+#include <private/painter_backend/painter_command_list_private.hpp>
+#include <private/util_private.hpp>
+
+///////////////////////////////////////////////
+// fastuidraw::PainterCommandList methods
+fastuidraw::PainterCommandList::
+PainterCommandList(ivec2 dimensions)
+{
+  m_d = FASTUIDRAWnew detail::PainterCommandListPrivate(dimensions);
+}
+
+fastuidraw::PainterCommandList::
+~PainterCommandList()
+{
+  detail::PainterCommandListPrivate *d;
+  d = static_cast<detail::PainterCommandListPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+fastuidraw::ivec2
+fastuidraw::PainterCommandList::
+dimensions(void) const
+{
+  detail::PainterCommandListPrivate *d;
+  d = static_cast<detail::PainterCommandListPrivate*>(m_d);
+  return d->m_surface->dimensions();
+}
+
+bool
+fastuidraw::PainterCommandList::
+empty(void) const
+{
+  return number_indices() == 0;
+}
+
+unsigned int
+fastuidraw::PainterCommandList::
+number_segments(void) const
+{
+  detail::PainterCommandListPrivate *d;
+  d = static_cast<detail::PainterCommandListPrivate*>(m_d);
+  return d->m_segments.size();
+}
+
+unsigned int
+fastuidraw::PainterCommandList::
+number_attributes(void) const
+{
+  detail::PainterCommandListPrivate *d;
+  unsigned int return_value(0);
+
+  d = static_cast<detail::PainterCommandListPrivate*>(m_d);
+  for (const auto &s : d->m_segments)
+    {
+      return_value += s.m_attributes.size();
+    }
+  return return_value;
+}
+
+unsigned int
+fastuidraw::PainterCommandList::
+number_indices(void) const
+{
+  detail::PainterCommandListPrivate *d;
+  unsigned int return_value(0);
+
+  d = static_cast<detail::PainterCommandListPrivate*>(m_d);
+  for (const auto &s : d->m_segments)
+    {
+      return_value += s.m_indices.size();
+    }
+  return return_value;
+}
+
+unsigned int
+fastuidraw::PainterCommandList::
+number_store_blocks(void) const
+{
+  detail::PainterCommandListPrivate *d;
+  unsigned int return_value(0);
+
+  d = static_cast<detail::PainterCommandListPrivate*>(m_d);
+  for (const auto &s : d->m_segments)
+    {
+      return_value += s.m_store.size();
+    }
+  return return_value;
+}
+
+int
+fastuidraw::PainterCommandList::
+z_extent(void) const
+{
+  detail::PainterCommandListPrivate *d;
+  d = static_cast<detail::PainterCommandListPrivate*>(m_d);
+  return d->m_z_extent;
+}
+
+bool
+fastuidraw::PainterCommandList::
+all_glyphs_resident(void) const
+{
+  detail::PainterCommandListPrivate *d;
+  d = static_cast<detail::PainterCommandListPrivate*>(m_d);
+  return !d->m_skipped_glyphs;
+}
+
+bool
+fastuidraw::PainterCommandList::
+recording_failed(void) const
+{
+  detail::PainterCommandListPrivate *d;
+  d = static_cast<detail::PainterCommandListPrivate*>(m_d);
+  return d->m_recording_failed;
+}
+
+void
+fastuidraw::PainterCommandList::
+clear(void)
+{
+  detail::PainterCommandListPrivate *d;
+  d = static_cast<detail::PainterCommandListPrivate*>(m_d);
+  d->clear();
+}
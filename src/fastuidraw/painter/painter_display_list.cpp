@@ -0,0 +1,88 @@
+/*!
+ * \file painter_display_list.cpp
+ * \brief file painter_display_list.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#include <fastuidraw/painter/painter_display_list.hpp>
+#include <private/painter_backend/painter_display_list_private.hpp>
+#include <private/util_private.hpp>
+
+///////////////////////////////////////////////
+// fastuidraw::PainterDisplayList methods
+fastuidraw::PainterDisplayList::
+PainterDisplayList(void)
+{
+  m_d = FASTUIDRAWnew detail::PainterDisplayListPrivate();
+}
+
+fastuidraw::PainterDisplayList::
+~PainterDisplayList()
+{
+  detail::PainterDisplayListPrivate *d;
+  d = static_cast<detail::PainterDisplayListPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+void
+fastuidraw::PainterDisplayList::
+clear(void)
+{
+  detail::PainterDisplayListPrivate *d;
+  d = static_cast<detail::PainterDisplayListPrivate*>(m_d);
+  d->clear();
+  if (d->m_list)
+    {
+      d->m_list->clear();
+    }
+}
+
+float
+fastuidraw::PainterDisplayList::
+magnification_tolerance(void) const
+{
+  detail::PainterDisplayListPrivate *d;
+  d = static_cast<detail::PainterDisplayListPrivate*>(m_d);
+  return d->m_magnification_tolerance;
+}
+
+fastuidraw::PainterDisplayList&
+fastuidraw::PainterDisplayList::
+magnification_tolerance(float v)
+{
+  detail::PainterDisplayListPrivate *d;
+  d = static_cast<detail::PainterDisplayListPrivate*>(m_d);
+  d->m_magnification_tolerance = t_max(1.0f, v);
+  return *this;
+}
+
+unsigned int
+fastuidraw::PainterDisplayList::
+number_recordings(void) const
+{
+  detail::PainterDisplayListPrivate *d;
+  d = static_cast<detail::PainterDisplayListPrivate*>(m_d);
+  return d->m_number_recordings;
+}
+
+unsigned int
+fastuidraw::PainterDisplayList::
+number_replays(void) const
+{
+  detail::PainterDisplayListPrivate *d;
+  d = static_cast<detail::PainterDisplayListPrivate*>(m_d);
+  return d->m_number_replays;
+}
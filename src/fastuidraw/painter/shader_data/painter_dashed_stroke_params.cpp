@@ -48,8 +48,41 @@ namespace
     float m_first_interval_start;
     float m_first_interval_start_on_looping;
     std::vector<fastuidraw::PainterDashedStrokeParams::DashPatternElement> m_dash_pattern;
+
+    /* all levels of the packed dash pattern, see the
+     * description of PainterDashedStrokeParams.
+     */
     std::vector<uint32_t> m_dash_pattern_packed;
   };
+
+  void
+  pack_dash_pattern_levels(float total_length, std::vector<uint32_t> *dst)
+  {
+    using namespace fastuidraw;
+
+    /* on entry, dst holds level 0 without padding */
+    uint32_t pad(pack_float(total_length * 2.0f + 1.0f));
+    unsigned int level_begin(0), num_blocks;
+
+    dst->resize(FASTUIDRAW_ROUND_UP_MULTIPLE_OF4(dst->size()), pad);
+    num_blocks = dst->size() / 4;
+    while (num_blocks > 1)
+      {
+        unsigned int next_level_begin(dst->size());
+
+        /* the values of a level are increasing, thus the
+         * largest value of a block is its last value.
+         */
+        for (unsigned int b = 0; b < num_blocks; ++b)
+          {
+            uint32_t v((*dst)[level_begin + 4 * b + 3]);
+            dst->push_back(v);
+          }
+        dst->resize(FASTUIDRAW_ROUND_UP_MULTIPLE_OF4(dst->size()), pad);
+        level_begin = next_level_begin;
+        num_blocks = (dst->size() - level_begin) / 4;
+      }
+  }
 }
 
 ///////////////////////////////////
@@ -219,6 +252,7 @@ dash_pattern(c_array<const DashPatternElement> f)
           total_length += d->m_dash_pattern[i].m_space_length;
           d->m_dash_pattern_packed[j + 1] = pack_float(total_length);
         }
+      pack_dash_pattern_levels(d->m_total_length, &d->m_dash_pattern_packed);
     }
 
   return *this;
@@ -232,7 +266,7 @@ data_size(void) const
   d = static_cast<PainterDashedStrokedParamsPrivate*>(m_d);
 
   return FASTUIDRAW_NUMBER_BLOCK4_NEEDED(stroke_static_data_size)
-    + FASTUIDRAW_NUMBER_BLOCK4_NEEDED(2 * d->m_dash_pattern.size());
+    + FASTUIDRAW_NUMBER_BLOCK4_NEEDED(d->m_dash_pattern_packed.size());
 }
 
 void
@@ -250,19 +284,15 @@ pack_data(c_array<uvec4> pdst) const
   dst[stroke_total_length_offset] = pack_float(d->m_total_length);
   dst[stroke_first_interval_start_offset] = pack_float(d->m_first_interval_start);
   dst[stroke_first_interval_start_on_looping_offset] = pack_float(d->m_first_interval_start_on_looping);
-  dst[stroke_number_intervals_offset] = d->m_dash_pattern_packed.size();
+  dst[stroke_number_intervals_offset] = 2 * d->m_dash_pattern.size();
 
   if (!d->m_dash_pattern_packed.empty())
     {
       c_array<uint32_t> dst_pattern;
+
+      /* the padding of each level is already in m_dash_pattern_packed */
       dst_pattern = dst.sub_array(FASTUIDRAW_ROUND_UP_MULTIPLE_OF4(stroke_static_data_size));
       std::copy(d->m_dash_pattern_packed.begin(), d->m_dash_pattern_packed.end(), dst_pattern.begin());
-      for(unsigned int i = d->m_dash_pattern_packed.size(), endi = dst_pattern.size(); i < endi; ++i)
-        {
-          //make the last entry larger than the total length so a
-          //shader can use that to know when it has reached the end.
-          dst_pattern[i] = pack_float(d->m_total_length * 2.0f + 1.0f);
-        }
     }
 }
 
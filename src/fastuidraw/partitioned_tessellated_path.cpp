@@ -19,6 +19,7 @@
 #include <vector>
 #include <complex>
 #include <algorithm>
+#include <atomic>
 
 #include <fastuidraw/tessellated_path.hpp>
 #include <fastuidraw/path.hpp>
@@ -29,15 +30,24 @@
 #include <private/bounding_box.hpp>
 #include <private/path_util_private.hpp>
 #include <private/clip.hpp>
+#include <private/worker_pool.hpp>
 
 namespace
 {
   enum
     {
       splitting_threshhold = 50,
-      max_recursion_depth = 10
+      max_recursion_depth = 10,
+
+      /* only split a subset with at least this many
+       * segments across threads
+       */
+      thread_splitting_threshhold = 2048
     };
 
+  /* value of PartitionedTessellatedPath::number_build_threads() */
+  std::atomic<unsigned int> number_build_threads_value(1u);
+
   class SubsetBuilder:fastuidraw::noncopyable
   {
   public:
@@ -176,7 +186,7 @@ namespace
 
     static
     SubsetPrivate*
-    create(SubsetBuilder &builder,
+    create(SubsetBuilder &builder, unsigned int num_threads,
            std::vector<SubsetPrivate*> &out_values);
 
     const fastuidraw::Rect&
@@ -221,6 +231,16 @@ namespace
       return fastuidraw::make_c_array(m_caps);
     }
 
+    uint64_t
+    memory_usage(void) const
+    {
+      return sizeof(SubsetPrivate)
+        + sizeof(segment) * (m_segments.capacity() + m_prev_start_segments.capacity())
+        + sizeof(segment_chain) * m_chains.capacity()
+        + sizeof(join) * m_joins.capacity()
+        + sizeof(cap) * m_caps.capacity();
+    }
+
     void
     select_subsets(bool miter_hunting,
                    ScratchSpace &scratch,
@@ -232,13 +252,21 @@ namespace
 
   private:
     /* creation will steal the vector<> values of
-     * the passed SubsetBuilder
+     * the passed SubsetBuilder; the ID is assigned
+     * afterwards by assign_ids().
      */
     SubsetPrivate(int recursion_depth, SubsetBuilder &builder,
-                  std::vector<SubsetPrivate*> &out_values);
+                  unsigned int num_threads);
 
     void
-    make_children(int recursion_depth, std::vector<SubsetPrivate*> &out_values);
+    make_children(int recursion_depth, unsigned int num_threads);
+
+    /* assign the ID's in the order of a depth first walk with
+     * a parent before its children, as the build was done when
+     * it was always on a single thread.
+     */
+    void
+    assign_ids(std::vector<SubsetPrivate*> &out_values);
 
     int
     choose_splitting_coordinate(float &split_value);
@@ -288,24 +316,24 @@ namespace
 // SubsetPrivate methods
 SubsetPrivate*
 SubsetPrivate::
-create(SubsetBuilder &builder,
+create(SubsetBuilder &builder, unsigned int num_threads,
        std::vector<SubsetPrivate*> &out_values)
 {
   SubsetPrivate *root;
 
-  root = FASTUIDRAWnew SubsetPrivate(0, builder, out_values);
+  root = FASTUIDRAWnew SubsetPrivate(0, builder, fastuidraw::t_max(1u, num_threads));
+  root->assign_ids(out_values);
   return root;
 }
 
 SubsetPrivate::
 SubsetPrivate(int recursion_depth, SubsetBuilder &builder,
-              std::vector<SubsetPrivate*> &out_values):
-  m_ID(out_values.size()),
+              unsigned int num_threads):
+  m_ID(0),
   m_children(nullptr, nullptr),
   m_bounding_box(builder.m_bbox),
   m_join_bounding_box(builder.m_join_bbox)
 {
-  out_values.push_back(this);
   m_segments.swap(builder.m_segments);
   m_joins.swap(builder.m_joins);
   m_caps.swap(builder.m_caps);
@@ -343,7 +371,20 @@ SubsetPrivate(int recursion_depth, SubsetBuilder &builder,
   if (m_segments.size() >= splitting_threshhold
       && recursion_depth <= max_recursion_depth)
     {
-      make_children(recursion_depth, out_values);
+      make_children(recursion_depth, num_threads);
+    }
+}
+
+void
+SubsetPrivate::
+assign_ids(std::vector<SubsetPrivate*> &out_values)
+{
+  m_ID = out_values.size();
+  out_values.push_back(this);
+  if (m_children[0])
+    {
+      m_children[0]->assign_ids(out_values);
+      m_children[1]->assign_ids(out_values);
     }
 }
 
@@ -501,7 +542,7 @@ choose_splitting_coordinate(float &split_value)
 
 void
 SubsetPrivate::
-make_children(int recursion_depth, std::vector<SubsetPrivate*> &out_values)
+make_children(int recursion_depth, unsigned int num_threads)
 {
   int splitting_coordinate(-1);
   float splitting_value;
@@ -551,8 +592,35 @@ make_children(int recursion_depth, std::vector<SubsetPrivate*> &out_values)
         }
     }
 
-  m_children[0]= FASTUIDRAWnew SubsetPrivate(recursion_depth + 1, before_split, out_values);
-  m_children[1]= FASTUIDRAWnew SubsetPrivate(recursion_depth + 1, after_split, out_values);
+  /* the children of a subset do not depend on each other,
+   * so if there are threads left and enough segments to make
+   * it worth handing work to another thread, make the children
+   * as two jobs of the shared worker pool and split the threads
+   * between them.
+   */
+  if (num_threads > 1 && m_segments.size() >= thread_splitting_threshhold)
+    {
+      unsigned int other_threads(num_threads / 2);
+
+      fastuidraw::detail::WorkerPool::global().run(2, [&, this](unsigned int job)
+        {
+          if (job == 0)
+            {
+              m_children[0] = FASTUIDRAWnew SubsetPrivate(recursion_depth + 1, before_split,
+                                                          num_threads - other_threads);
+            }
+          else
+            {
+              m_children[1] = FASTUIDRAWnew SubsetPrivate(recursion_depth + 1, after_split,
+                                                          other_threads);
+            }
+        });
+    }
+  else
+    {
+      m_children[0]= FASTUIDRAWnew SubsetPrivate(recursion_depth + 1, before_split, num_threads);
+      m_children[1]= FASTUIDRAWnew SubsetPrivate(recursion_depth + 1, after_split, num_threads);
+    }
 }
 
 void
@@ -695,7 +763,7 @@ PartitionedTessellatedPathPrivate(const fastuidraw::TessellatedPath &P)
   builder.process_joins(P.join_data());
   builder.process_caps(P.cap_data());
   m_has_arcs = builder.m_has_arcs;
-  m_root_subset = SubsetPrivate::create(builder, m_subsets);
+  m_root_subset = SubsetPrivate::create(builder, number_build_threads_value, m_subsets);
 }
 
 PartitionedTessellatedPathPrivate::
@@ -709,7 +777,7 @@ PartitionedTessellatedPathPrivate(fastuidraw::c_array<const fastuidraw::Tessella
   builder.process_caps(caps);
   builder.process_joins(joins);
   m_has_arcs = builder.m_has_arcs;
-  m_root_subset = SubsetPrivate::create(builder, m_subsets);
+  m_root_subset = SubsetPrivate::create(builder, number_build_threads_value, m_subsets);
 }
 
 PartitionedTessellatedPathPrivate::
@@ -921,6 +989,21 @@ has_arcs(void) const
   return d->m_has_arcs;
 }
 
+uint64_t
+fastuidraw::PartitionedTessellatedPath::
+memory_usage(void) const
+{
+  PartitionedTessellatedPathPrivate *d;
+  uint64_t return_value(0u);
+
+  d = static_cast<PartitionedTessellatedPathPrivate*>(m_d);
+  for (const SubsetPrivate *S : d->m_subsets)
+    {
+      return_value += S->memory_usage();
+    }
+  return return_value;
+}
+
 unsigned int
 fastuidraw::PartitionedTessellatedPath::
 number_subsets(void) const
@@ -1008,3 +1091,17 @@ select_subsets(c_array<const vec3> clip_equations,
       dst_d->m_join_subset_ids = make_c_array(dst_d->m_subset_ids);
     }
 }
+
+void
+fastuidraw::PartitionedTessellatedPath::
+number_build_threads(unsigned int v)
+{
+  number_build_threads_value = t_max(1u, v);
+}
+
+unsigned int
+fastuidraw::PartitionedTessellatedPath::
+number_build_threads(void)
+{
+  return number_build_threads_value;
+}
@@ -20,6 +20,10 @@
 #include <algorithm>
 #include <cmath>
 #include <vector>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
 #include <fastuidraw/path.hpp>
 #include <fastuidraw/tessellated_path.hpp>
 #include <private/util_private.hpp>
@@ -27,6 +31,8 @@
 #include <private/path_util_private.hpp>
 #include <private/bounding_box.hpp>
 #include <private/bezier_util.hpp>
+#include <private/contour_tessellation_cache.hpp>
+#include <private/worker_pool.hpp>
 
 namespace
 {
@@ -170,6 +176,125 @@ namespace
     unsigned int m_minimum_tessellation_recursion;
   };
 
+  /* A node of the tessellation of a Bezier curve with N control
+   * points, N being 3 or 4. It computes the same values as an
+   * ArcTessellatorStateNode whose regions are BezierTessRegion
+   * objects, but the control points are held in fixed size arrays
+   * so that no allocation or virtual call is made per split of
+   * the curve. Each curve is still tessellated on its own (a
+   * tessellation_state only sees its own interpolator) and the
+   * Wang bounds are evaluated with scalar code; nothing here is
+   * batched across curves.
+   */
+  template<unsigned int N>
+  class BezierTessNode
+  {
+  public:
+    typedef fastuidraw::vecN<fastuidraw::vec2, N> Points;
+
+    BezierTessNode(const Points &pts, unsigned int depth);
+
+    float
+    max_distance(void) const
+    {
+      return m_max_distance;
+    }
+
+    unsigned int
+    recursion_depth(void) const
+    {
+      return m_recursion_depth;
+    }
+
+    void
+    add_segment(fastuidraw::TessellatedPath::SegmentStorage *out_data) const;
+
+    BezierTessNode
+    splitL(void) const
+    {
+      return BezierTessNode(m_L, m_recursion_depth + 1);
+    }
+
+    BezierTessNode
+    splitR(void) const
+    {
+      return BezierTessNode(m_R, m_recursion_depth + 1);
+    }
+
+    /* Wang's formula applied to each half: an upper bound
+     * on the distance between the curve and the two line
+     * segments start-mid and mid-end.
+     */
+    float
+    line_segments_distance(void) const;
+
+    /* Use the two line segments start-mid and mid-end
+     * instead of the arc.
+     */
+    void
+    use_line_segments(float distance)
+    {
+      m_arc.m_too_flat = true;
+      m_max_distance = distance;
+    }
+
+  private:
+    static
+    void
+    split(const Points &src, Points *L, Points *R);
+
+    static
+    float
+    distance_to_line_segment(const Points &pts);
+
+    float
+    distance_to_arc(const Points &pts) const;
+
+    static
+    float
+    distance_to_arc_raw(const Points &pts, unsigned int depth,
+                        const ArcSegment &A);
+
+    static
+    float
+    wang_distance(const Points &pts);
+
+    Points m_L, m_R;
+    ArcSegment m_arc;
+    float m_max_distance;
+    unsigned int m_recursion_depth;
+  };
+
+  template<unsigned int N>
+  class BezierTessellationState:public fastuidraw::PathContour::tessellation_state
+  {
+  public:
+    explicit
+    BezierTessellationState(fastuidraw::c_array<const fastuidraw::vec2> pts);
+
+    virtual
+    unsigned int
+    recursion_depth(void) const
+    {
+      return m_recursion_depth;
+    }
+
+    virtual
+    void
+    resume_tessellation(const fastuidraw::TessellatedPath::TessellationParams &tess_params,
+                        fastuidraw::TessellatedPath::SegmentStorage *out_data,
+                        float *out_max_distance);
+
+  private:
+    void
+    resume_tessellation_worker(const BezierTessNode<N> &node,
+                               const fastuidraw::TessellatedPath::TessellationParams &tess_params,
+                               std::vector<BezierTessNode<N> > *dst);
+
+    std::vector<BezierTessNode<N> > m_nodes;
+    unsigned int m_recursion_depth;
+  };
+
   class InterpolatorBasePrivate
   {
   public:
@@ -294,6 +419,11 @@ namespace
     std::vector<fastuidraw::reference_counted_ptr<const fastuidraw::PathContour::interpolator_base> > m_interpolators;
     bool m_ended;
 
+    /* tessellation of the contour once it is ended, filled
+     * and used by TessellatedPath
+     */
+    fastuidraw::detail::ContourTessellationCache m_tess_cache;
+
   private:
     void
     update(void)
@@ -316,6 +446,98 @@ namespace
   };
 
   class PathPrivate;
+  class TessellatedPathList;
+
+  /* a tessellation considered by TessellatedPathList::end_frame() */
+  class EvictionCandidate
+  {
+  public:
+    TessellatedPathList *m_list;
+    unsigned int m_level;
+    unsigned int m_last_used;
+    uint64_t m_bytes, m_derived_bytes;
+    bool m_evict;
+  };
+
+  /* bytes of a TessellatedPathList not yet released by
+   * TessellatedPathList::end_frame() and if all of its
+   * tessellations are to be released.
+   */
+  class EvictionListState
+  {
+  public:
+    EvictionListState(void):
+      m_bytes(0u),
+      m_clear(false)
+    {}
+
+    uint64_t m_bytes;
+    bool m_clear;
+  };
+
+  /* a cached contour tessellation considered by
+   * TessellatedPathList::evict()
+   */
+  class EvictionCacheCandidate
+  {
+  public:
+    fastuidraw::detail::ContourTessellationCache *m_cache;
+    unsigned int m_last_used;
+    uint64_t m_bytes;
+  };
+
+  /* What TessellatedPathList::end_frame() releases. The data is
+   * collected while the lists are locked and released after the
+   * locks are dropped, because it can own Path objects (for
+   * example the bounding paths of the subsets of a FilledPath)
+   * whose destruction locks tessellated_path_lists_mutex.
+   */
+  class EvictionVictims
+  {
+  public:
+    typedef fastuidraw::reference_counted_ptr<const fastuidraw::TessellatedPath> TessellatedPathRef;
+    typedef fastuidraw::reference_counted_ptr<fastuidraw::TessellatedPath::Refiner> RefinerRef;
+    typedef fastuidraw::detail::ContourTessellationCache::Entry CacheEntry;
+
+    void
+    release(void)
+    {
+      for (const TessellatedPathRef &p : m_release_derived)
+        {
+          p->release_derived_data();
+        }
+      m_release_derived.clear();
+      m_tessellations.clear();
+      m_refiners.clear();
+      m_cache_entries.clear();
+    }
+
+    /* tessellations whose derived data is released */
+    std::vector<TessellatedPathRef> m_release_derived;
+
+    /* tessellations, refiners and cached contour tessellations
+     * removed, destroyed when the last reference goes.
+     */
+    std::vector<TessellatedPathRef> m_tessellations;
+    std::vector<RefinerRef> m_refiners;
+    std::vector<fastuidraw::reference_counted_ptr<const CacheEntry> > m_cache_entries;
+  };
+
+  /* all TessellatedPathList objects, for the memory budget of
+   * Path::end_tessellation_frame(); these are plain values so
+   * that a Path may be made or destroyed during static
+   * initialization or at exit.
+   */
+  std::mutex tessellated_path_lists_mutex;
+  TessellatedPathList *tessellated_path_lists = nullptr;
+  std::atomic<uint64_t> tessellation_memory_budget_bytes(0u);
+  std::atomic<unsigned int> current_tessellation_frame(0u);
+
+  /* all ContourTessellationCache objects, see
+   * ContourTessellationCache::list_head().
+   */
+  std::mutex contour_tessellation_caches_mutex;
+  fastuidraw::detail::ContourTessellationCache *contour_tessellation_caches = nullptr;
 
   class TessellatedPathList
   {
@@ -326,24 +548,196 @@ namespace
 
     explicit
     TessellatedPathList(void):
-      m_done(false)
-    {}
+      m_done(false),
+      m_background_refinement(false),
+      m_worker_task(0),
+      m_worker_running(false),
+      m_cancel_worker(false),
+      m_worker_target(0.0f),
+      m_prev_list(nullptr)
+    {
+      std::lock_guard<std::mutex> m(tessellated_path_lists_mutex);
 
-    const TessellatedPathRef&
-    tessellation(const fastuidraw::Path &path, float max_distance);
+      m_next_list = tessellated_path_lists;
+      if (m_next_list)
+        {
+          m_next_list->m_prev_list = this;
+        }
+      tessellated_path_lists = this;
+    }
+
+    ~TessellatedPathList()
+    {
+      clear();
+
+      std::lock_guard<std::mutex> m(tessellated_path_lists_mutex);
+      if (m_prev_list)
+        {
+          m_prev_list->m_next_list = m_next_list;
+        }
+      else
+        {
+          tessellated_path_lists = m_next_list;
+        }
+
+      if (m_next_list)
+        {
+          m_next_list->m_prev_list = m_prev_list;
+        }
+    }
+
+    /* returns by value because with background refinement
+     * the worker may add elements to m_data concurrently;
+     * the element stays alive until clear().
+     */
+    TessellatedPathRef
+    tessellation(const fastuidraw::Path &path, float max_distance,
+                 bool *out_meets_tolerance);
 
     void
     clear(void)
     {
+      stop_worker();
       m_data.clear();
+      m_last_used.clear();
       m_refiner = nullptr;
       m_done = false;
     }
 
+    /* bytes of the tessellations and of the
+     * objects made from them.
+     */
+    uint64_t
+    memory_usage(void);
+
+    /* sum of memory_usage() of all TessellatedPathList
+     * objects.
+     */
+    static
+    uint64_t
+    total_memory_usage(void);
+
+    /* ends the current frame and evicts the least recently
+     * used data until the memory budget is met.
+     */
+    static
+    void
+    end_frame(void);
+
+    void
+    background_refinement(bool v)
+    {
+      if (!v)
+        {
+          wait_for_worker();
+        }
+      m_background_refinement = v;
+    }
+
+    bool
+    background_refinement(void) const
+    {
+      return m_background_refinement;
+    }
+
   private:
+    /* selects data of the candidates and of the cached contour
+     * tessellations not used in frame, oldest first, to release
+     * until total is no more than budget and moves it out of the
+     * lists and caches into victims; called by end_frame() with
+     * tessellated_path_lists_mutex locked.
+     */
+    static
+    void
+    evict(uint64_t budget, uint64_t total, unsigned int frame,
+          std::vector<EvictionCandidate> &candidates,
+          std::map<TessellatedPathList*, EvictionListState> &lists,
+          EvictionVictims *victims);
+
+    /* refine until the last element of m_data has max_distance()
+     * no more than max_distance, refinement is exhausted or
+     * m_cancel_worker is set; m_mutex must NOT be locked.
+     */
+    void
+    refine(float max_distance);
+
+    /* the body of the refinement task posted to the
+     * shared worker pool
+     */
+    void
+    worker_refine(void);
+
+    /* returns the index into m_data of the coarsest
+     * tessellation whose max_distance() is no more
+     * than max_distance.
+     */
+    unsigned int
+    select(float max_distance);
+
+    /* mark an element of m_data as used in the current
+     * frame and return it; m_mutex must be locked.
+     */
+    TessellatedPathRef
+    use(unsigned int idx)
+    {
+      FASTUIDRAWassert(idx < m_data.size());
+      m_last_used[idx] = current_tessellation_frame;
+      return m_data[idx];
+    }
+
+    void
+    wait_for_worker(void)
+    {
+      std::unique_lock<std::mutex> m(m_mutex);
+      m_worker_done.wait(m, [this]() { return !m_worker_running; });
+    }
+
+    void
+    stop_worker(void)
+    {
+      m_cancel_worker = true;
+      {
+        std::lock_guard<std::mutex> m(m_mutex);
+        if (m_worker_running && fastuidraw::detail::WorkerPool::global().cancel(m_worker_task))
+          {
+            /* the task had not started, it never will */
+            m_worker_running = false;
+          }
+      }
+      wait_for_worker();
+      m_cancel_worker = false;
+    }
+
+    /* protects m_data, m_done, m_worker_running, m_worker_task and
+     * m_worker_target; while the worker runs, only the worker uses
+     * m_refiner.
+     */
+    std::mutex m_mutex;
     bool m_done;
     fastuidraw::reference_counted_ptr<TessellatedPath::Refiner> m_refiner;
     std::vector<TessellatedPathRef> m_data;
+
+    /* the frame in which each element of m_data was last
+     * returned by tessellation(), also protected by m_mutex.
+     */
+    std::vector<unsigned int> m_last_used;
+
+    bool m_background_refinement;
+    /* refinement runs as a task of the shared worker pool so
+     * that the number of threads refining does not grow with
+     * the number of paths; m_worker_done is signaled when
+     * m_worker_running becomes false.
+     */
+    uint64_t m_worker_task;
+    std::condition_variable m_worker_done;
+    bool m_worker_running;
+    std::atomic<bool> m_cancel_worker;
+    float m_worker_target;
+
+    /* links of tessellated_path_lists, protected by
+     * tessellated_path_lists_mutex
+     */
+    TessellatedPathList *m_prev_list, *m_next_list;
   };
 
   class PathPrivate:fastuidraw::noncopyable
@@ -364,6 +758,12 @@ namespace
     void
     start_contour_if_necessary(void);
 
+    /* recompute m_is_flat and m_bb from m_contours, needed
+     * when a contour is removed or replaced
+     */
+    void
+    recompute_contour_summary(void);
+
     std::vector<fastuidraw::reference_counted_ptr<fastuidraw::PathContour> > m_contours;
     enum fastuidraw::PathEnums::edge_type_t m_next_edge_type;
 
@@ -377,6 +777,9 @@ namespace
     bool m_is_flat;
     fastuidraw::reference_counted_ptr<const fastuidraw::ShaderFilledPath> m_shader_filled_path;
   };
+
+  /* value of PathContour::bezier::fast_tessellation() */
+  std::atomic<bool> fast_bezier_tessellation_enabled(true);
 }
 
 /////////////////////////////////
@@ -608,76 +1011,308 @@ resume_tessellation_worker(const ArcTessellatorStateNode &node,
     }
 }
 
-////////////////////////////////////////////
-// fastuidraw::PathContour::interpolator_base methods
-fastuidraw::PathContour::interpolator_base::
-interpolator_base(PathContour &contour,
-                  const vec2 &end, enum PathEnums::edge_type_t tp)
+//////////////////////////////////
+// BezierTessNode methods
+template<unsigned int N>
+BezierTessNode<N>::
+BezierTessNode(const Points &pts, unsigned int depth):
+  m_recursion_depth(depth)
 {
-  InterpolatorBasePrivate *d;
-  PathContourPrivate *c_d;
-
-  c_d = static_cast<PathContourPrivate*>(contour.m_d);
-  m_d = d = FASTUIDRAWnew InterpolatorBasePrivate();
-
-  d->m_end = end;
-  if (c_d->m_interpolators.empty())
+  split(pts, &m_L, &m_R);
+  m_arc = ArcSegment(pts[0], m_L[N - 1], pts[N - 1]);
+  if (m_arc.m_too_flat)
     {
-      d->m_type = PathEnums::starts_new_edge;
-      d->m_start = c_d->m_start_pt;
+      m_max_distance = fastuidraw::t_max(distance_to_line_segment(m_L),
+                                         distance_to_line_segment(m_R));
     }
   else
     {
-      InterpolatorBasePrivate *prev_d;
-      prev_d = static_cast<InterpolatorBasePrivate*>(c_d->m_interpolators.back()->m_d);
-
-      d->m_type = tp;
-      d->m_start = prev_d->m_end;
+      m_max_distance = fastuidraw::t_max(distance_to_arc(m_L),
+                                         distance_to_arc(m_R));
     }
-  c_d->m_interpolators.push_back(this);
 }
 
-fastuidraw::PathContour::interpolator_base::
-~interpolator_base(void)
+template<unsigned int N>
+void
+BezierTessNode<N>::
+split(const Points &src, Points *L, Points *R)
 {
-  InterpolatorBasePrivate *d;
-  d = static_cast<InterpolatorBasePrivate*>(m_d);
-  FASTUIDRAWdelete(d);
-  m_d = nullptr;
-}
+  /* De Casteljau's algorithm at t = 0.5, see
+   * BezierTessRegion::create_children(); the
+   * arithmetic is done in the same order so that
+   * the values are the same.
+   */
+  Points w(src);
 
-const fastuidraw::vec2&
-fastuidraw::PathContour::interpolator_base::
-start_pt(void) const
-{
-  InterpolatorBasePrivate *d;
-  d = static_cast<InterpolatorBasePrivate*>(m_d);
-  return d->m_start;
+  (*L)[0] = src[0];
+  (*R)[N - 1] = src[N - 1];
+  for (unsigned int i = 1; i < N; ++i)
+    {
+      for (unsigned int j = 0; j < N - i; ++j)
+        {
+          w[j] = 0.5f * w[j] + 0.5f * w[j + 1];
+        }
+      (*L)[i] = w[0];
+      (*R)[N - 1 - i] = w[N - 1 - i];
+    }
 }
 
-const fastuidraw::vec2&
-fastuidraw::PathContour::interpolator_base::
-end_pt(void) const
+template<unsigned int N>
+float
+BezierTessNode<N>::
+distance_to_line_segment(const Points &pts)
 {
-  InterpolatorBasePrivate *d;
-  d = static_cast<InterpolatorBasePrivate*>(m_d);
-  return d->m_end;
+  /* the curve is bounded by the convex hull of the control
+   * points of each of its halves.
+   */
+  Points L, R;
+  float return_value(0.0f);
+
+  split(pts, &L, &R);
+  for (unsigned int i = 0; i < N; ++i)
+    {
+      return_value = fastuidraw::t_max(return_value, compute_distance(pts[0], L[i], pts[N - 1]));
+      return_value = fastuidraw::t_max(return_value, compute_distance(pts[0], R[i], pts[N - 1]));
+    }
+  return return_value;
 }
 
-enum fastuidraw::PathEnums::edge_type_t
-fastuidraw::PathContour::interpolator_base::
-edge_type(void) const
+template<unsigned int N>
+float
+BezierTessNode<N>::
+distance_to_arc(const Points &pts) const
 {
-  InterpolatorBasePrivate *d;
-  d = static_cast<InterpolatorBasePrivate*>(m_d);
-  return d->m_type;
+  ArcSegment A(m_arc);
+
+  A.m_circle_sector_boundary[0] = pts[0];
+  A.m_circle_sector_boundary[1] = pts[N - 1];
+  return distance_to_arc_raw(pts, fastuidraw::uint32_log2(N), A);
 }
 
-enum fastuidraw::return_code
-fastuidraw::PathContour::interpolator_base::
-add_to_builder(ShaderFilledPath::Builder*, float) const
+template<unsigned int N>
+float
+BezierTessNode<N>::
+distance_to_arc_raw(const Points &pts, unsigned int depth,
+                    const ArcSegment &A)
 {
-  return routine_fail;
+  Points L, R;
+
+  split(pts, &L, &R);
+  if (depth <= 1)
+    {
+      return A.distance(L[N - 1]);
+    }
+  else
+    {
+      return fastuidraw::t_max(distance_to_arc_raw(L, depth - 1, A),
+                               distance_to_arc_raw(R, depth - 1, A));
+    }
+}
+
+template<unsigned int N>
+float
+BezierTessNode<N>::
+wang_distance(const Points &pts)
+{
+  /* Wang's formula: the distance between a Bezier curve of
+   * degree n and the line segment connecting its end points is
+   * no more than n * (n - 1) / 8 times the largest magnitude of
+   * the second differences of its control points.
+   */
+  const float n(N - 1);
+  float m(0.0f);
+
+  for (unsigned int i = 0; i + 2 < N; ++i)
+    {
+      m = fastuidraw::t_max(m, (pts[i] - 2.0f * pts[i + 1] + pts[i + 2]).magnitudeSq());
+    }
+  return 0.125f * n * (n - 1.0f) * fastuidraw::t_sqrt(m);
+}
+
+template<unsigned int N>
+float
+BezierTessNode<N>::
+line_segments_distance(void) const
+{
+  return fastuidraw::t_max(wang_distance(m_L), wang_distance(m_R));
+}
+
+template<unsigned int N>
+void
+BezierTessNode<N>::
+add_segment(fastuidraw::TessellatedPath::SegmentStorage *out_data) const
+{
+  if (m_arc.m_too_flat)
+    {
+      out_data->add_line_segment(m_L[0], m_L[N - 1]);
+      out_data->add_line_segment(m_R[0], m_R[N - 1]);
+    }
+  else
+    {
+      out_data->add_arc_segment(m_L[0], m_R[N - 1],
+                                m_arc.m_center,
+                                m_arc.m_radius,
+                                m_arc.m_angle);
+    }
+}
+
+///////////////////////////////////////////
+// BezierTessellationState methods
+template<unsigned int N>
+BezierTessellationState<N>::
+BezierTessellationState(fastuidraw::c_array<const fastuidraw::vec2> pts):
+  m_recursion_depth(0)
+{
+  typename BezierTessNode<N>::Points P;
+
+  FASTUIDRAWassert(pts.size() == N);
+  std::copy(pts.begin(), pts.end(), P.begin());
+  m_nodes.push_back(BezierTessNode<N>(P, 0));
+}
+
+template<unsigned int N>
+void
+BezierTessellationState<N>::
+resume_tessellation(const fastuidraw::TessellatedPath::TessellationParams &tess_params,
+                    fastuidraw::TessellatedPath::SegmentStorage *out_data,
+                    float *out_max_distance)
+{
+  std::vector<BezierTessNode<N> > new_nodes;
+
+  new_nodes.reserve(2 * m_nodes.size());
+  for(const BezierTessNode<N> &node : m_nodes)
+    {
+      resume_tessellation_worker(node, tess_params, &new_nodes);
+    }
+
+  std::swap(new_nodes, m_nodes);
+  *out_max_distance = 0.0f;
+  m_recursion_depth = 0;
+  for(const BezierTessNode<N> &node : m_nodes)
+    {
+      node.add_segment(out_data);
+      m_recursion_depth = fastuidraw::t_max(m_recursion_depth, node.recursion_depth());
+      *out_max_distance = fastuidraw::t_max(*out_max_distance, node.max_distance());
+    }
+}
+
+template<unsigned int N>
+void
+BezierTessellationState<N>::
+resume_tessellation_worker(const BezierTessNode<N> &node,
+                           const fastuidraw::TessellatedPath::TessellationParams &tess_params,
+                           std::vector<BezierTessNode<N> > *dst)
+{
+  /* same as PathContour::bezier::minimum_tessellation_recursion() */
+  const unsigned int minimum_recursion(1 + fastuidraw::uint32_log2(N));
+  unsigned int recurse_level;
+  bool split;
+
+  recurse_level = node.recursion_depth();
+  split = (recurse_level == 0 || recurse_level < minimum_recursion);
+  if (!split
+      && tess_params.m_max_distance > 0.0f
+      && recurse_level <= tess_params.m_max_recursion
+      && node.max_distance() > tess_params.m_max_distance)
+    {
+      float d;
+
+      /* The distance to the arc is only estimated from
+       * points of the curve; when it is too large, Wang's
+       * formula may still show that line segments meet
+       * the tolerance, which ends the recursion early.
+       */
+      d = node.line_segments_distance();
+      if (d <= tess_params.m_max_distance)
+        {
+          dst->push_back(node);
+          dst->back().use_line_segments(d);
+          return;
+        }
+      split = true;
+    }
+
+  if (split)
+    {
+      resume_tessellation_worker(node.splitL(), tess_params, dst);
+      resume_tessellation_worker(node.splitR(), tess_params, dst);
+    }
+  else
+    {
+      dst->push_back(node);
+    }
+}
+
+////////////////////////////////////////////
+// fastuidraw::PathContour::interpolator_base methods
+fastuidraw::PathContour::interpolator_base::
+interpolator_base(PathContour &contour,
+                  const vec2 &end, enum PathEnums::edge_type_t tp)
+{
+  InterpolatorBasePrivate *d;
+  PathContourPrivate *c_d;
+
+  c_d = static_cast<PathContourPrivate*>(contour.m_d);
+  m_d = d = FASTUIDRAWnew InterpolatorBasePrivate();
+
+  d->m_end = end;
+  if (c_d->m_interpolators.empty())
+    {
+      d->m_type = PathEnums::starts_new_edge;
+      d->m_start = c_d->m_start_pt;
+    }
+  else
+    {
+      InterpolatorBasePrivate *prev_d;
+      prev_d = static_cast<InterpolatorBasePrivate*>(c_d->m_interpolators.back()->m_d);
+
+      d->m_type = tp;
+      d->m_start = prev_d->m_end;
+    }
+  c_d->m_interpolators.push_back(this);
+}
+
+fastuidraw::PathContour::interpolator_base::
+~interpolator_base(void)
+{
+  InterpolatorBasePrivate *d;
+  d = static_cast<InterpolatorBasePrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+const fastuidraw::vec2&
+fastuidraw::PathContour::interpolator_base::
+start_pt(void) const
+{
+  InterpolatorBasePrivate *d;
+  d = static_cast<InterpolatorBasePrivate*>(m_d);
+  return d->m_start;
+}
+
+const fastuidraw::vec2&
+fastuidraw::PathContour::interpolator_base::
+end_pt(void) const
+{
+  InterpolatorBasePrivate *d;
+  d = static_cast<InterpolatorBasePrivate*>(m_d);
+  return d->m_end;
+}
+
+enum fastuidraw::PathEnums::edge_type_t
+fastuidraw::PathContour::interpolator_base::
+edge_type(void) const
+{
+  InterpolatorBasePrivate *d;
+  d = static_cast<InterpolatorBasePrivate*>(m_d);
+  return d->m_type;
+}
+
+enum fastuidraw::return_code
+fastuidraw::PathContour::interpolator_base::
+add_to_builder(ShaderFilledPath::Builder*, float) const
+{
+  return routine_fail;
 }
 
 //////////////////////////////////////////////
@@ -977,6 +1612,46 @@ deep_copy(PathContour &contour) const
   return FASTUIDRAWnew bezier(contour, tmp, end_pt(), edge_type());
 }
 
+fastuidraw::reference_counted_ptr<fastuidraw::PathContour::tessellation_state>
+fastuidraw::PathContour::bezier::
+produce_tessellation(const TessellatedPath::TessellationParams &tess_params,
+                     TessellatedPath::SegmentStorage *out_data,
+                     float *out_max_distance) const
+{
+  reference_counted_ptr<tessellation_state> return_value;
+  c_array<const vec2> p(pts());
+
+  if (!fast_bezier_tessellation_enabled || p.size() < 3 || p.size() > 4)
+    {
+      return interpolator_generic::produce_tessellation(tess_params, out_data, out_max_distance);
+    }
+
+  if (p.size() == 3)
+    {
+      return_value = FASTUIDRAWnew BezierTessellationState<3>(p);
+    }
+  else
+    {
+      return_value = FASTUIDRAWnew BezierTessellationState<4>(p);
+    }
+  return_value->resume_tessellation(tess_params, out_data, out_max_distance);
+  return return_value;
+}
+
+void
+fastuidraw::PathContour::bezier::
+fast_tessellation(bool v)
+{
+  fast_bezier_tessellation_enabled = v;
+}
+
+bool
+fastuidraw::PathContour::bezier::
+fast_tessellation(void)
+{
+  return fast_bezier_tessellation_enabled;
+}
+
 unsigned int
 fastuidraw::PathContour::bezier::
 minimum_tessellation_recursion(void) const
@@ -1457,6 +2132,15 @@ is_flat(void) const
   return d->is_flat();
 }
 
+fastuidraw::detail::ContourTessellationCache&
+fastuidraw::PathContour::
+tessellation_cache(void) const
+{
+  PathContourPrivate *d;
+  d = static_cast<PathContourPrivate*>(m_d);
+  return d->m_tess_cache;
+}
+
 fastuidraw::reference_counted_ptr<fastuidraw::PathContour>
 fastuidraw::PathContour::
 deep_copy(void) const
@@ -1509,57 +2193,55 @@ approximate_bounding_box(Rect *out_bb) const
 
 /////////////////////////////////
 // TessellatedPathList methods
-const typename TessellatedPathList::TessellatedPathRef&
+unsigned int
 TessellatedPathList::
-tessellation(const fastuidraw::Path &path, float max_distance)
+select(float max_distance)
 {
   using namespace fastuidraw;
   using namespace detail;
 
-  if (m_data.empty())
-    {
-      TessellationParams params;
-      m_data.push_back(FASTUIDRAWnew TessellatedPath(path, params, &m_refiner));
-    }
+  typename std::vector<TessellatedPathRef>::const_iterator iter;
 
-  if (max_distance <= 0.0 || path.is_flat())
-    {
-      return m_data.front();
-    }
+  FASTUIDRAWassert(m_data.back()->max_distance() <= max_distance);
+  iter = std::lower_bound(m_data.begin(),
+                          m_data.end(),
+                          max_distance,
+                          reverse_compare_max_distance);
 
-  if (m_data.back()->max_distance() <= max_distance)
-    {
-      typename std::vector<TessellatedPathRef>::const_iterator iter;
-      iter = std::lower_bound(m_data.begin(),
-                              m_data.end(),
-                              max_distance,
-                              reverse_compare_max_distance);
-
-      FASTUIDRAWassert(iter != m_data.end());
-      FASTUIDRAWassert(*iter);
-      FASTUIDRAWassert((*iter)->max_distance() <= max_distance);
-      return *iter;
-    }
+  FASTUIDRAWassert(iter != m_data.end());
+  FASTUIDRAWassert(*iter);
+  FASTUIDRAWassert((*iter)->max_distance() <= max_distance);
+  return iter - m_data.begin();
+}
 
-  if (m_done)
-    {
-      return m_data.back();
-    }
+void
+TessellatedPathList::
+refine(float max_distance)
+{
+  using namespace fastuidraw;
+  using namespace detail;
 
-  float current_max_distance;
+  float current_max_distance, last_max_distance;
+  bool done;
 
-  current_max_distance = m_data.back()->max_distance();
+  {
+    std::lock_guard<std::mutex> m(m_mutex);
+    current_max_distance = last_max_distance = m_data.back()->max_distance();
+    done = m_done;
+  }
 
-  while(!m_done && m_data.back()->max_distance() > max_distance)
+  while(!done && !m_cancel_worker && last_max_distance > max_distance)
     {
       current_max_distance *= 0.5f;
-      while(!m_done && m_data.back()->max_distance() > current_max_distance)
+      while(!done && !m_cancel_worker && last_max_distance > current_max_distance)
         {
           TessellatedPathRef ref;
 
           m_refiner->refine_tessellation(current_max_distance, 1);
           ref = m_refiner->tessellated_path();
 
+          std::lock_guard<std::mutex> m(m_mutex);
+
           /* we only add a tessellation if it is finer than the last one
            * added. However, we do not abort if it is not as sometimes
            * (especially with arc-tessellation) more refinement can make
@@ -1568,6 +2250,7 @@ tessellation(const fastuidraw::Path &path, float max_distance)
           if (m_data.back()->max_distance() > ref->max_distance())
             {
               m_data.push_back(ref);
+              m_last_used.push_back(current_tessellation_frame);
             }
 
           /* We set an absolute abort at max_refine_recursion_limit
@@ -1577,12 +2260,443 @@ tessellation(const fastuidraw::Path &path, float max_distance)
           if (ref->max_recursion() > MAX_REFINE_RECURSION_LIMIT)
             {
               m_done = true;
-              m_refiner = nullptr;
             }
+
+          /* the worker may be asked for a finer tolerance
+           * while it runs.
+           */
+          if (m_worker_running)
+            {
+              max_distance = t_min(max_distance, m_worker_target);
+            }
+
+          last_max_distance = m_data.back()->max_distance();
+          done = m_done;
         }
     }
+}
 
-  return m_data.back();
+void
+TessellatedPathList::
+worker_refine(void)
+{
+  float target;
+
+  {
+    std::lock_guard<std::mutex> m(m_mutex);
+    target = m_worker_target;
+  }
+
+  refine(target);
+
+  std::lock_guard<std::mutex> m(m_mutex);
+  m_worker_running = false;
+  if (m_done)
+    {
+      m_refiner = nullptr;
+    }
+  m_worker_done.notify_all();
+}
+
+typename TessellatedPathList::TessellatedPathRef
+TessellatedPathList::
+tessellation(const fastuidraw::Path &path, float max_distance,
+             bool *out_meets_tolerance)
+{
+  using namespace fastuidraw;
+
+  bool dummy;
+
+  if (!out_meets_tolerance)
+    {
+      out_meets_tolerance = &dummy;
+    }
+
+  if (!m_background_refinement)
+    {
+      /* the worker of a previous background refinement
+       * may still be using m_refiner.
+       */
+      wait_for_worker();
+    }
+
+  std::unique_lock<std::mutex> m(m_mutex);
+  if (m_data.empty())
+    {
+      TessellationParams params;
+      m_data.push_back(FASTUIDRAWnew TessellatedPath(path, params, &m_refiner));
+      m_last_used.push_back(current_tessellation_frame);
+    }
+
+  if (max_distance <= 0.0 || path.is_flat())
+    {
+      *out_meets_tolerance = true;
+      return use(0);
+    }
+
+  if (m_data.back()->max_distance() <= max_distance)
+    {
+      *out_meets_tolerance = true;
+      return use(select(max_distance));
+    }
+
+  if (m_done)
+    {
+      *out_meets_tolerance = false;
+      return use(m_data.size() - 1);
+    }
+
+  if (m_background_refinement)
+    {
+      if (m_worker_running)
+        {
+          m_worker_target = t_min(m_worker_target, max_distance);
+        }
+      else
+        {
+          m_worker_target = max_distance;
+          m_worker_running = true;
+          m_worker_task = detail::WorkerPool::global().post([this]() { worker_refine(); });
+        }
+      *out_meets_tolerance = false;
+      return use(m_data.size() - 1);
+    }
+
+  m.unlock();
+  refine(max_distance);
+  m.lock();
+
+  if (m_done)
+    {
+      m_refiner = nullptr;
+    }
+
+  *out_meets_tolerance = (m_data.back()->max_distance() <= max_distance);
+  return use(m_data.size() - 1);
+}
+
+uint64_t
+TessellatedPathList::
+memory_usage(void)
+{
+  std::lock_guard<std::mutex> m(m_mutex);
+  uint64_t return_value(0u);
+
+  for (const TessellatedPathRef &p : m_data)
+    {
+      return_value += p->memory_usage();
+    }
+  return return_value;
+}
+
+uint64_t
+TessellatedPathList::
+total_memory_usage(void)
+{
+  std::lock_guard<std::mutex> m(tessellated_path_lists_mutex);
+  uint64_t return_value(0u);
+
+  for (TessellatedPathList *p = tessellated_path_lists; p; p = p->m_next_list)
+    {
+      return_value += p->memory_usage();
+    }
+
+  typedef fastuidraw::detail::ContourTessellationCache ContourTessellationCache;
+  std::lock_guard<std::mutex> caches_lock(ContourTessellationCache::list_mutex());
+  for (ContourTessellationCache *c = ContourTessellationCache::list_head(); c; c = c->next_in_list())
+    {
+      return_value += c->memory_usage();
+    }
+  return return_value;
+}
+
+void
+TessellatedPathList::
+end_frame(void)
+{
+  typedef EvictionCandidate Candidate;
+  typedef EvictionListState ListState;
+  typedef fastuidraw::detail::ContourTessellationCache ContourTessellationCache;
+
+  uint64_t budget(tessellation_memory_budget_bytes);
+  unsigned int frame(current_tessellation_frame++);
+  EvictionVictims victims;
+
+  if (budget == 0u)
+    {
+      return;
+    }
+
+  {
+    std::lock_guard<std::mutex> lists_lock(tessellated_path_lists_mutex);
+    std::vector<Candidate> candidates;
+    std::map<TessellatedPathList*, ListState> lists;
+    uint64_t total(0u);
+
+    /* data used in the frame that just ended is kept, as is
+     * all the data of a Path whose worker is still refining.
+     */
+    for (TessellatedPathList *p = tessellated_path_lists; p; p = p->m_next_list)
+      {
+        std::lock_guard<std::mutex> m(p->m_mutex);
+        ListState &state(lists[p]);
+
+        for (unsigned int i = 0, endi = p->m_data.size(); i < endi; ++i)
+          {
+            Candidate C;
+
+            C.m_list = p;
+            C.m_level = i;
+            C.m_last_used = p->m_last_used[i];
+            C.m_derived_bytes = p->m_data[i]->derived_memory_usage();
+            C.m_bytes = p->m_data[i]->memory_usage();
+            C.m_evict = false;
+
+            total += C.m_bytes;
+            state.m_bytes += C.m_bytes;
+            if (!p->m_worker_running && C.m_last_used != frame)
+              {
+                candidates.push_back(C);
+              }
+          }
+      }
+
+    /* the list mutex of the caches is never locked together
+     * with the mutex of a TessellatedPathList, since a Path
+     * (and so a ContourTessellationCache) can be made or
+     * destroyed while the latter is locked.
+     */
+    {
+      std::lock_guard<std::mutex> m(ContourTessellationCache::list_mutex());
+      for (ContourTessellationCache *c = ContourTessellationCache::list_head(); c; c = c->next_in_list())
+        {
+          total += c->memory_usage();
+        }
+    }
+
+    if (total > budget)
+      {
+        evict(budget, total, frame, candidates, lists, &victims);
+      }
+  }
+
+  victims.release();
+}
+
+void
+TessellatedPathList::
+evict(uint64_t budget, uint64_t total, unsigned int frame,
+      std::vector<EvictionCandidate> &candidates,
+      std::map<TessellatedPathList*, EvictionListState> &lists,
+      EvictionVictims *victims)
+{
+  typedef EvictionCandidate Candidate;
+  typedef EvictionCacheCandidate CacheCandidate;
+  typedef fastuidraw::detail::ContourTessellationCache ContourTessellationCache;
+
+  /* oldest first; among those last used in the same frame,
+   * release the finer, i.e. larger, tessellations first.
+   */
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [](const Candidate &a, const Candidate &b)
+                   {
+                     return a.m_last_used < b.m_last_used
+                       || (a.m_last_used == b.m_last_used && a.m_level > b.m_level);
+                   });
+
+  /* first release the FilledPath, StrokedPath and other data
+   * made from the tessellations, since those are made again
+   * cheaper than a tessellation is refined again.
+   */
+  for (Candidate &C : candidates)
+    {
+      if (total <= budget)
+        {
+          return;
+        }
+
+      if (C.m_derived_bytes > 0u)
+        {
+          std::lock_guard<std::mutex> m(C.m_list->m_mutex);
+
+          victims->m_release_derived.push_back(C.m_list->m_data[C.m_level]);
+          total -= C.m_derived_bytes;
+          C.m_bytes -= C.m_derived_bytes;
+          lists[C.m_list].m_bytes -= C.m_derived_bytes;
+        }
+    }
+
+  /* then the cached tessellations of the contours, which only
+   * speed up tessellating a Path again after it is edited.
+   */
+  {
+    std::lock_guard<std::mutex> m(ContourTessellationCache::list_mutex());
+    std::vector<CacheCandidate> cache_candidates;
+
+    for (ContourTessellationCache *c = ContourTessellationCache::list_head(); c; c = c->next_in_list())
+      {
+        CacheCandidate C;
+
+        C.m_cache = c;
+        C.m_last_used = c->last_used();
+        C.m_bytes = c->memory_usage();
+        if (C.m_bytes > 0u && C.m_last_used != frame)
+          {
+            cache_candidates.push_back(C);
+          }
+      }
+
+    std::stable_sort(cache_candidates.begin(), cache_candidates.end(),
+                     [](const CacheCandidate &a, const CacheCandidate &b)
+                     {
+                       return a.m_last_used < b.m_last_used;
+                     });
+
+    for (const CacheCandidate &C : cache_candidates)
+      {
+        if (total <= budget)
+          {
+            return;
+          }
+
+        victims->m_cache_entries.push_back(C.m_cache->take());
+        total -= std::min(total, C.m_bytes);
+      }
+  }
+
+  /* then release the tessellations; the intermediate levels
+   * can be removed alone because finer levels still meet the
+   * tolerances they met, but the starting tessellation and the
+   * finest level (which the Refiner continues from) are only
+   * removed by removing all tessellations of the Path.
+   */
+  for (Candidate &C : candidates)
+    {
+      EvictionListState &state(lists[C.m_list]);
+
+      if (total <= budget)
+        {
+          break;
+        }
+
+      if (state.m_clear)
+        {
+          continue;
+        }
+
+      if (C.m_level == 0u || C.m_level + 1u == C.m_list->m_data.size())
+        {
+          state.m_clear = true;
+          total -= state.m_bytes;
+          state.m_bytes = 0u;
+        }
+      else
+        {
+          C.m_evict = true;
+          total -= C.m_bytes;
+          state.m_bytes -= C.m_bytes;
+        }
+    }
+
+  /* remove in decreasing order of level so that the
+   * levels yet to remove keep their index.
+   */
+  std::sort(candidates.begin(), candidates.end(),
+            [](const Candidate &a, const Candidate &b)
+            {
+              return a.m_level > b.m_level;
+            });
+
+  for (const Candidate &C : candidates)
+    {
+      if (C.m_evict && !lists[C.m_list].m_clear)
+        {
+          std::lock_guard<std::mutex> m(C.m_list->m_mutex);
+          victims->m_tessellations.push_back(C.m_list->m_data[C.m_level]);
+          C.m_list->m_data.erase(C.m_list->m_data.begin() + C.m_level);
+          C.m_list->m_last_used.erase(C.m_list->m_last_used.begin() + C.m_level);
+        }
+    }
+
+  /* the worker of a list with candidates is not running, so
+   * the data of the list can be taken without stopping it.
+   */
+  for (const auto &v : lists)
+    {
+      if (v.second.m_clear)
+        {
+          TessellatedPathList *p(v.first);
+          std::lock_guard<std::mutex> m(p->m_mutex);
+
+          FASTUIDRAWassert(!p->m_worker_running);
+          victims->m_tessellations.insert(victims->m_tessellations.end(),
+                                          p->m_data.begin(), p->m_data.end());
+          victims->m_refiners.push_back(p->m_refiner);
+          p->m_data.clear();
+          p->m_last_used.clear();
+          p->m_refiner = nullptr;
+          p->m_done = false;
+        }
+    }
+}
+
+//////////////////////////////////////////////////////
+// fastuidraw::detail::ContourTessellationCache methods
+fastuidraw::detail::ContourTessellationCache::
+ContourTessellationCache(void):
+  m_memory_usage(0u),
+  m_last_used(0u),
+  m_prev(nullptr)
+{
+  std::lock_guard<std::mutex> m(contour_tessellation_caches_mutex);
+
+  m_next = contour_tessellation_caches;
+  if (m_next)
+    {
+      m_next->m_prev = this;
+    }
+  contour_tessellation_caches = this;
+}
+
+fastuidraw::detail::ContourTessellationCache::
+~ContourTessellationCache()
+{
+  std::lock_guard<std::mutex> m(contour_tessellation_caches_mutex);
+
+  if (m_prev)
+    {
+      m_prev->m_next = m_next;
+    }
+  else
+    {
+      contour_tessellation_caches = m_next;
+    }
+
+  if (m_next)
+    {
+      m_next->m_prev = m_prev;
+    }
+}
+
+std::mutex&
+fastuidraw::detail::ContourTessellationCache::
+list_mutex(void)
+{
+  return contour_tessellation_caches_mutex;
+}
+
+fastuidraw::detail::ContourTessellationCache*
+fastuidraw::detail::ContourTessellationCache::
+list_head(void)
+{
+  return contour_tessellation_caches;
+}
+
+unsigned int
+fastuidraw::detail::ContourTessellationCache::
+current_frame(void)
+{
+  return current_tessellation_frame;
 }
 
 /////////////////////////////////
@@ -1631,6 +2745,19 @@ clear_tesses(void)
   m_tess_list.clear();
 }
 
+void
+PathPrivate::
+recompute_contour_summary(void)
+{
+  m_is_flat = true;
+  for (unsigned int i = 0, endi = m_contours.size(); i + 1 < endi; ++i)
+    {
+      m_is_flat = m_is_flat && m_contours[i]->is_flat();
+    }
+  m_start_check_bb = 0u;
+  m_bb = fastuidraw::BoundingBox<float>();
+}
+
 void
 PathPrivate::
 start_contour_if_necessary(void)
@@ -1712,6 +2839,7 @@ add_contour(const reference_counted_ptr<const PathContour> &pcontour)
   if (!contour->ended())
     {
       contour = contour->deep_copy();
+      contour->end();
     }
 
   d->m_is_flat = d->m_is_flat && contour->is_flat();
@@ -1771,6 +2899,46 @@ add_contours(const Path &path)
   return *this;
 }
 
+fastuidraw::Path&
+fastuidraw::Path::
+replace_contour(unsigned int i,
+                const reference_counted_ptr<const PathContour> &pcontour)
+{
+  PathPrivate *d;
+  reference_counted_ptr<PathContour> contour;
+
+  d = static_cast<PathPrivate*>(m_d);
+  FASTUIDRAWassert(i < d->m_contours.size());
+  FASTUIDRAWassert(pcontour);
+
+  contour = pcontour.const_cast_ptr<PathContour>();
+  if (!contour->ended())
+    {
+      contour = contour->deep_copy();
+      contour->end();
+    }
+
+  d->m_contours[i] = contour;
+  d->recompute_contour_summary();
+  d->clear_tesses();
+  return *this;
+}
+
+fastuidraw::Path&
+fastuidraw::Path::
+remove_contour(unsigned int i)
+{
+  PathPrivate *d;
+
+  d = static_cast<PathPrivate*>(m_d);
+  FASTUIDRAWassert(i < d->m_contours.size());
+
+  d->m_contours.erase(d->m_contours.begin() + i);
+  d->recompute_contour_summary();
+  d->clear_tesses();
+  return *this;
+}
+
 fastuidraw::Path&
 fastuidraw::Path::
 move(const fastuidraw::vec2 &pt)
@@ -1842,10 +3010,79 @@ tessellation(void) const
 const fastuidraw::TessellatedPath&
 fastuidraw::Path::
 tessellation(float max_distance) const
+{
+  return tessellation(max_distance, nullptr);
+}
+
+const fastuidraw::TessellatedPath&
+fastuidraw::Path::
+tessellation(float max_distance, bool *out_meets_tolerance) const
+{
+  PathPrivate *d;
+  d = static_cast<PathPrivate*>(m_d);
+  return *d->m_tess_list.tessellation(*this, max_distance, out_meets_tolerance);
+}
+
+void
+fastuidraw::Path::
+background_refinement(bool v)
+{
+  PathPrivate *d;
+  d = static_cast<PathPrivate*>(m_d);
+  d->m_tess_list.background_refinement(v);
+}
+
+bool
+fastuidraw::Path::
+background_refinement(void) const
 {
   PathPrivate *d;
   d = static_cast<PathPrivate*>(m_d);
-  return *d->m_tess_list.tessellation(*this, max_distance);
+  return d->m_tess_list.background_refinement();
+}
+
+uint64_t
+fastuidraw::Path::
+tessellation_memory_usage(void) const
+{
+  PathPrivate *d;
+  uint64_t return_value;
+
+  d = static_cast<PathPrivate*>(m_d);
+  return_value = d->m_tess_list.memory_usage();
+  for (const auto &c : d->m_contours)
+    {
+      return_value += c->tessellation_cache().memory_usage();
+    }
+  return return_value;
+}
+
+uint64_t
+fastuidraw::Path::
+total_tessellation_memory_usage(void)
+{
+  return TessellatedPathList::total_memory_usage();
+}
+
+void
+fastuidraw::Path::
+tessellation_memory_budget(uint64_t bytes)
+{
+  tessellation_memory_budget_bytes = bytes;
+}
+
+uint64_t
+fastuidraw::Path::
+tessellation_memory_budget(void)
+{
+  return tessellation_memory_budget_bytes;
+}
+
+void
+fastuidraw::Path::
+end_tessellation_frame(void)
+{
+  TessellatedPathList::end_frame();
 }
 
 bool
@@ -29,6 +29,7 @@
 #include <private/util_private.hpp>
 #include <private/bounding_box.hpp>
 #include <private/path_util_private.hpp>
+#include <private/contour_tessellation_cache.hpp>
 
 namespace
 {
@@ -277,6 +278,16 @@ namespace
              std::vector<fastuidraw::TessellatedPath::segment> &segments,
              float edge_max_distance);
 
+    /* add an edge whose segments already have all values
+     * that depend only on their contour computed, i.e. as
+     * held by a detail::ContourTessellationCache.
+     */
+    void
+    add_cached_edge(TessellatedPathBuildingState &b,
+                    unsigned int contour, unsigned int edge,
+                    const std::vector<fastuidraw::TessellatedPath::segment> &segments,
+                    float edge_max_distance);
+
     void
     end_contour(TessellatedPathBuildingState &b);
 
@@ -855,6 +866,33 @@ add_edge(TessellatedPathBuildingState &builder,
     }
 }
 
+void
+TessellatedPathPrivate::
+add_cached_edge(TessellatedPathBuildingState &builder,
+                unsigned int o, unsigned int e,
+                const std::vector<fastuidraw::TessellatedPath::segment> &segments,
+                float edge_max_distance)
+{
+  using namespace fastuidraw;
+
+  unsigned int needed;
+
+  needed = segments.size();
+  FASTUIDRAWassert(needed > 0u);
+
+  m_contours[o].m_edges[e].m_edge_range = range_type<unsigned int>(builder.m_loc, builder.m_loc + needed);
+  builder.m_loc += needed;
+  m_max_distance = t_max(m_max_distance, edge_max_distance);
+
+  std::list<std::vector<TessellatedPath::segment> >::iterator t;
+  t = builder.m_temp.insert(builder.m_temp.end(), segments);
+
+  if (e == 0)
+    {
+      builder.m_start_contour = t;
+    }
+}
+
 void
 TessellatedPathPrivate::
 end_contour(TessellatedPathBuildingState &builder)
@@ -1287,7 +1325,7 @@ TessellatedPath(Refiner *p, float max_distance,
 
       for(unsigned int e = 0, ende = contour.m_edges.size(); e < ende; ++e)
         {
-          const RefinerEdge edge(contour.m_edges[e]);
+          RefinerEdge &edge(ref_d->m_contours[o].m_edges[e]);
           SegmentStorage segment_storage;
           float tmp;
 
@@ -1297,11 +1335,20 @@ TessellatedPath(Refiner *p, float max_distance,
           if (edge.m_tess_state)
             {
               edge.m_tess_state->resume_tessellation(d->m_params, &segment_storage, &tmp);
-              d->m_max_recursion = t_max(d->m_max_recursion, edge.m_tess_state->recursion_depth());
             }
           else
             {
-              edge.m_interpolator->produce_tessellation(d->m_params, &segment_storage, &tmp);
+              /* the edge either has no state to resume from or its
+               * starting tessellation came from the cache of the
+               * PathContour; keep the state so that later refinements
+               * resume from it.
+               */
+              edge.m_tess_state = edge.m_interpolator->produce_tessellation(d->m_params, &segment_storage, &tmp);
+            }
+
+          if (edge.m_tess_state)
+            {
+              d->m_max_recursion = t_max(d->m_max_recursion, edge.m_tess_state->recursion_depth());
             }
 
           d->add_edge(builder, o, e, work_room, tmp);
@@ -1339,9 +1386,27 @@ TessellatedPath(const Path &input,
     }
 
   TessellatedPathBuildingState builder;
+  bool fast_bezier(PathContour::bezier::fast_tessellation());
   for(unsigned int o = 0, endo = input.number_contours(); o < endo; ++o)
     {
+      typedef detail::ContourTessellationCache ContourTessellationCache;
+
       const reference_counted_ptr<const PathContour> &contour(input.contour(o));
+      reference_counted_ptr<const ContourTessellationCache::Entry> cached;
+      reference_counted_ptr<ContourTessellationCache::Entry> new_cached;
+
+      /* only an ended contour can no longer change, thus only
+       * the tessellation of an ended contour is cached.
+       */
+      if (contour->ended())
+        {
+          cached = contour->tessellation_cache().fetch(d->m_params, fast_bezier);
+          if (!cached)
+            {
+              new_cached = FASTUIDRAWnew ContourTessellationCache::Entry(d->m_params, fast_bezier,
+                                                                         contour->number_interpolators());
+            }
+        }
 
       if (refiner_d)
         {
@@ -1361,24 +1426,75 @@ TessellatedPath(const Path &input,
           FASTUIDRAWassert(work_room.empty());
           segment_storage.m_d = &work_room;
 
-          tess_state = interpolator->produce_tessellation(d->m_params, &segment_storage, &tmp);
-          if (tess_state)
-            {
-              d->m_max_recursion = t_max(d->m_max_recursion, tess_state->recursion_depth());
-            }
-
           if (refiner_d)
             {
-              refiner_d->m_contours[o].m_edges[e].m_tess_state = tess_state;
+              /* for a cached edge, the Refiner produces the tessellation
+               * state of the edge on its first refinement of the edge.
+               */
               refiner_d->m_contours[o].m_edges[e].m_interpolator = interpolator;
             }
 
-          d->add_edge(builder, o, e, work_room, tmp);
+          if (cached)
+            {
+              const ContourTessellationCache::Edge &edge(cached->m_edges[e]);
+
+              d->m_max_recursion = t_max(d->m_max_recursion, edge.m_recursion_depth);
+              d->add_cached_edge(builder, o, e, edge.m_segments, edge.m_max_distance);
+            }
+          else
+            {
+              tess_state = interpolator->produce_tessellation(d->m_params, &segment_storage, &tmp);
+              if (tess_state)
+                {
+                  d->m_max_recursion = t_max(d->m_max_recursion, tess_state->recursion_depth());
+                }
+
+              if (new_cached)
+                {
+                  ContourTessellationCache::Edge &edge(new_cached->m_edges[e]);
+
+                  edge.m_max_distance = tmp;
+                  edge.m_recursion_depth = (tess_state) ? tess_state->recursion_depth() : 0u;
+                }
+
+              if (refiner_d)
+                {
+                  refiner_d->m_contours[o].m_edges[e].m_tess_state = tess_state;
+                }
+              d->add_edge(builder, o, e, work_room, tmp);
+            }
           d->m_contours[o].m_edges[e].m_edge_type = interpolator->edge_type();
         }
 
-      d->end_contour(builder);
+      if (cached)
+        {
+          d->m_bounding_box.union_box(cached->m_bounding_box);
+          d->m_has_arcs = d->m_has_arcs || cached->m_has_arcs;
+        }
+      else
+        {
+          d->end_contour(builder);
+        }
       d->m_contours[o].m_is_closed = contour->closed();
+
+      if (new_cached)
+        {
+          /* take the segments after end_contour() so that
+           * the values local to the contour are also cached.
+           */
+          std::list<std::vector<segment> >::const_iterator t(builder.m_start_contour);
+          for (unsigned int e = 0, ende = new_cached->m_edges.size(); e < ende; ++e, ++t)
+            {
+              FASTUIDRAWassert(t != builder.m_temp.end());
+              new_cached->m_edges[e].m_segments = *t;
+              for (const segment &S : *t)
+                {
+                  union_segment(S, new_cached->m_bounding_box);
+                  new_cached->m_has_arcs = new_cached->m_has_arcs || (S.m_type == arc_segment);
+                }
+            }
+          contour->tessellation_cache().store(new_cached);
+        }
     }
   d->finalize(builder);
 }
@@ -1713,3 +1829,70 @@ partitioned(void) const
     }
   return *(d->m_partitioned);
 }
+
+uint64_t
+fastuidraw::TessellatedPath::
+memory_usage(void) const
+{
+  TessellatedPathPrivate *d;
+  uint64_t return_value;
+
+  d = static_cast<TessellatedPathPrivate*>(m_d);
+  return_value = sizeof(TessellatedPathPrivate)
+    + sizeof(segment) * d->m_segment_data.capacity()
+    + sizeof(segment_chain) * d->m_segment_chain_data.capacity()
+    + sizeof(join) * d->m_join_data.capacity()
+    + sizeof(cap) * d->m_cap_data.capacity()
+    + sizeof(TessellatedContour) * d->m_contours.capacity();
+
+  for (const TessellatedContour &C : d->m_contours)
+    {
+      return_value += sizeof(Edge) * C.m_edges.capacity();
+    }
+
+  return return_value + derived_memory_usage();
+}
+
+uint64_t
+fastuidraw::TessellatedPath::
+derived_memory_usage(void) const
+{
+  TessellatedPathPrivate *d;
+  uint64_t return_value(0u);
+
+  d = static_cast<TessellatedPathPrivate*>(m_d);
+  if (d->m_stroked)
+    {
+      return_value += d->m_stroked->memory_usage();
+    }
+
+  if (d->m_filled)
+    {
+      return_value += d->m_filled->memory_usage();
+    }
+
+  if (d->m_partitioned)
+    {
+      return_value += d->m_partitioned->memory_usage();
+    }
+
+  for (const auto &L : d->m_linearization)
+    {
+      return_value += L->memory_usage();
+    }
+
+  return return_value;
+}
+
+void
+fastuidraw::TessellatedPath::
+release_derived_data(void) const
+{
+  TessellatedPathPrivate *d;
+
+  d = static_cast<TessellatedPathPrivate*>(m_d);
+  d->m_stroked.clear();
+  d->m_filled.clear();
+  d->m_partitioned.clear();
+  d->m_linearization.clear();
+}
@@ -41,6 +41,9 @@ namespace
     int m_restricted_rays_max_recursion;
     unsigned int m_banded_rays_max_recursion;
     float m_banded_rays_average_number_curves_thresh;
+    unsigned int m_distance_field_generation_threads;
+    bool m_distance_field_simd;
+    bool m_distance_field_reference_generator;
 
     std::mutex m_mutex;
     unsigned int m_number_fonts_alive;
@@ -55,6 +58,9 @@ namespace
       m_restricted_rays_max_recursion(12),
       m_banded_rays_max_recursion(11),
       m_banded_rays_average_number_curves_thresh(2.5f),
+      m_distance_field_generation_threads(1),
+      m_distance_field_simd(true),
+      m_distance_field_reference_generator(false),
       m_number_fonts_alive(0),
       m_current_unqiue_id(0)
     {}
@@ -117,6 +123,30 @@ IMPLEMENT(int, restricted_rays_max_recursion)
 IMPLEMENT(unsigned int, banded_rays_max_recursion)
 IMPLEMENT(float, banded_rays_average_number_curves_thresh)
 
+/* values that do not affect the generated data and
+ * thus can be changed while fonts are alive.
+ */
+#define IMPLEMENT_UNRESTRICTED(T, X)                                    \
+  T                                                                     \
+  fastuidraw::GlyphGenerateParams::                                     \
+  X(void)                                                               \
+  {                                                                     \
+    std::lock_guard<std::mutex> m(GlyphGenerateParamValues::object().m_mutex); \
+    return GlyphGenerateParamValues::object().m_##X;                    \
+  }                                                                     \
+  enum fastuidraw::return_code                                          \
+  fastuidraw::GlyphGenerateParams::                                     \
+  X(T v)                                                                \
+  {                                                                     \
+    std::lock_guard<std::mutex> m(GlyphGenerateParamValues::object().m_mutex); \
+    GlyphGenerateParamValues::object().m_##X = v;                       \
+    return routine_success;                                             \
+  }
+
+IMPLEMENT_UNRESTRICTED(unsigned int, distance_field_generation_threads)
+IMPLEMENT_UNRESTRICTED(bool, distance_field_simd)
+IMPLEMENT_UNRESTRICTED(bool, distance_field_reference_generator)
+
 ///////////////////////////////////////////
 // fastuidraw::FontBase methods
 fastuidraw::FontBase::
@@ -142,3 +172,32 @@ get_implement(fastuidraw::FontBase, FontBasePrivate,
 
 get_implement(fastuidraw::FontBase, FontBasePrivate,
               unsigned int, unique_id)
+
+void
+fastuidraw::FontBase::
+compute_path(GlyphRenderer render, GlyphMetrics glyph_metrics,
+             Path &path) const
+{
+  GlyphRenderData *data;
+  vec2 render_size;
+
+  data = compute_rendering_data(render, glyph_metrics, path, render_size);
+  if (data)
+    {
+      FASTUIDRAWdelete(data);
+    }
+}
+
+uint64_t
+fastuidraw::FontBase::
+content_hash(void) const
+{
+  return 0u;
+}
+
+int
+fastuidraw::FontBase::
+face_index(void) const
+{
+  return 0;
+}
@@ -16,6 +16,12 @@
  *
  */
 
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <map>
 #include <fastuidraw/text/font_freetype.hpp>
 #include <fastuidraw/text/glyph_generate_params.hpp>
 #include <fastuidraw/text/glyph_render_data.hpp>
@@ -232,12 +238,23 @@ namespace
   class FaceAndEncoding
   {
   public:
-    FaceAndEncoding(void):
-      m_current_encoding(static_cast<enum fastuidraw::CharacterEncoding::encoding_value_t>(0))
+    explicit
+    FaceAndEncoding(const fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeFace> &face):
+      m_face(face),
+      m_current_encoding(static_cast<enum fastuidraw::CharacterEncoding::encoding_value_t>(0)),
+      m_thread_owned(false),
+      m_in_use(false)
     {}
 
     fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeFace> m_face;
     enum fastuidraw::CharacterEncoding::encoding_value_t m_current_encoding;
+
+    /* true if the face is owned by a single thread (see
+     * FontFreeType::per_thread_faces()) instead of the pool;
+     * m_in_use is only accessed by the owning thread.
+     */
+    bool m_thread_owned;
+    bool m_in_use;
   };
 
   class FontFreeTypePrivate
@@ -252,6 +269,10 @@ namespace
 
       fastuidraw::FreeTypeFace *m_p;
       enum fastuidraw::CharacterEncoding::encoding_value_t *m_current_encoding;
+
+    private:
+      FontFreeTypePrivate *m_q;
+      FaceAndEncoding *m_entry;
     };
 
     FontFreeTypePrivate(fastuidraw::FontFreeType *p,
@@ -261,10 +282,29 @@ namespace
 
     ~FontFreeTypePrivate();
 
+    /* Create a face from m_generator, returns nullptr on failure;
+     * does not add the face to the pool.
+     */
+    FaceAndEncoding*
+    create_face(void);
+
+    /* Get a face for exclusive use; blocks until a face of the
+     * pool is free if the pool is already at m_max_faces faces.
+     * Returns nullptr only if no face can be created at all.
+     */
+    FaceAndEncoding*
+    acquire_face(void);
+
+    void
+    release_face(FaceAndEncoding *f);
+
     static
     void
     load_glyph(FT_Face face, uint32_t glyph_code);
 
+    uint64_t
+    content_hash(void);
+
     void
     compute_rendering_data_coverage(int pixel_size,
                                     fastuidraw::GlyphMetrics glyph_metrics,
@@ -278,6 +318,14 @@ namespace
                                           fastuidraw::Path &path,
                                           fastuidraw::vec2 &render_size);
 
+    /* computes the same path as the compute_rendering_data_XXX()
+     * methods without generating any rendering data.
+     */
+    void
+    compute_path(fastuidraw::GlyphRenderer render,
+                 fastuidraw::GlyphMetrics glyph_metrics,
+                 fastuidraw::Path &path);
+
     template<typename T>
     void
     compute_rendering_data_rays(fastuidraw::GlyphMetrics glyph_metrics,
@@ -310,12 +358,30 @@ namespace
     fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeLib> m_lib;
     fastuidraw::FontFreeType *m_p;
 
-    /* for now we have a static number of m_faces we use for parallel
-     * glyph generation
+    /* Pool of faces used for parallel glyph generation; faces are
+     * created on demand up to m_max_faces. Threads wait on
+     * m_pool_condition for a face of m_free_faces when all
+     * m_max_faces are in use. All but the counters are
+     * protected by m_pool_mutex.
      */
-    std::vector<FaceAndEncoding> m_faces;
+    std::mutex m_pool_mutex;
+    std::condition_variable m_pool_condition;
+    std::vector<FaceAndEncoding*> m_faces;
+    std::vector<FaceAndEncoding*> m_free_faces;
+    std::map<std::thread::id, FaceAndEncoding*> m_thread_faces;
+    unsigned int m_number_faces_being_created;
+    std::atomic<unsigned int> m_max_faces;
+    std::atomic<bool> m_per_thread_faces;
+    std::atomic<unsigned int> m_number_face_acquires;
+    std::atomic<unsigned int> m_number_face_waits;
+    std::atomic<uint64_t> m_face_wait_time;
     bool m_all_faces_null;
     unsigned int m_number_glyphs;
+    int m_face_index;
+
+    /* hash of the font file, computed on first use */
+    std::once_flag m_content_hash_computed;
+    uint64_t m_content_hash;
   };
 }
 
@@ -323,28 +389,29 @@ namespace
 // FontFreeTypePrivate::FaceGrabber methods
 FontFreeTypePrivate::FaceGrabber::
 FaceGrabber(FontFreeTypePrivate *q):
-  m_p(nullptr)
+  m_p(nullptr),
+  m_current_encoding(nullptr),
+  m_q(q),
+  m_entry(q->acquire_face())
 {
-  while(!m_p && !q->m_all_faces_null)
+  if (m_entry)
     {
-      for(unsigned int i = 0, endi = q->m_faces.size(); i < endi && !m_p; ++i)
-        {
-          const fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeFace> &face(q->m_faces[i].m_face);
-          if (face && face->try_lock())
-            {
-              m_p = face.get();
-              m_current_encoding = &q->m_faces[i].m_current_encoding;
-            }
-        }
+      /* the face is ours alone, but keep to the contract of
+       * FreeTypeFace that its FT_Face is used with its lock held.
+       */
+      m_entry->m_face->lock();
+      m_p = m_entry->m_face.get();
+      m_current_encoding = &m_entry->m_current_encoding;
     }
 }
 
 FontFreeTypePrivate::FaceGrabber::
 ~FaceGrabber()
 {
-  if (m_p)
+  if (m_entry)
     {
-      m_p->unlock();
+      m_entry->m_face->unlock();
+      m_q->release_face(m_entry);
     }
 }
 
@@ -358,31 +425,157 @@ FontFreeTypePrivate(fastuidraw::FontFreeType *p,
   m_generator(generator),
   m_lib(lib),
   m_p(p),
-  m_faces(num_faces),
+  m_number_faces_being_created(0),
+  m_max_faces(fastuidraw::t_max(1u, num_faces)),
+  m_per_thread_faces(false),
+  m_number_face_acquires(0),
+  m_number_face_waits(0),
+  m_face_wait_time(0),
   m_all_faces_null(true),
-  m_number_glyphs(0)
+  m_number_glyphs(0),
+  m_face_index(0),
+  m_content_hash(0)
 {
   if (!m_lib)
     {
       m_lib = FASTUIDRAWnew fastuidraw::FreeTypeLib();
     }
 
-  for(unsigned int i = 0; i < m_faces.size(); ++i)
+  /* only the first face is created up front, the
+   * rest are created when there is demand for them.
+   */
+  FaceAndEncoding *f(create_face());
+  if (f)
+    {
+      m_all_faces_null = false;
+      m_number_glyphs = f->m_face->face()->num_glyphs;
+      m_face_index = f->m_face->face()->face_index;
+      FASTUIDRAWwarn_assert(f->m_face->face()->face_flags & FT_FACE_FLAG_SCALABLE);
+      m_faces.push_back(f);
+      m_free_faces.push_back(f);
+    }
+}
+
+FontFreeTypePrivate::
+~FontFreeTypePrivate()
+{
+  FASTUIDRAWassert(m_free_faces.size() == m_faces.size());
+  for (FaceAndEncoding *f : m_faces)
+    {
+      FASTUIDRAWdelete(f);
+    }
+  for (const auto &v : m_thread_faces)
+    {
+      FASTUIDRAWdelete(v.second);
+    }
+}
+
+FaceAndEncoding*
+FontFreeTypePrivate::
+create_face(void)
+{
+  fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeFace> face;
+
+  face = m_generator->create_face(m_lib);
+  if (!face || !face->face())
+    {
+      return nullptr;
+    }
+  FT_Set_Transform(face->face(), nullptr, nullptr);
+  return FASTUIDRAWnew FaceAndEncoding(face);
+}
+
+FaceAndEncoding*
+FontFreeTypePrivate::
+acquire_face(void)
+{
+  FaceAndEncoding *f;
+
+  if (m_all_faces_null)
+    {
+      return nullptr;
+    }
+
+  std::unique_lock<std::mutex> lock(m_pool_mutex);
+  ++m_number_face_acquires;
+
+  if (m_per_thread_faces)
+    {
+      std::thread::id id(std::this_thread::get_id());
+      std::map<std::thread::id, FaceAndEncoding*>::iterator iter;
+
+      iter = m_thread_faces.find(id);
+      if (iter != m_thread_faces.end())
+        {
+          f = iter->second;
+        }
+      else
+        {
+          /* create the face without holding the pool
+           * lock, FreeType face creation is slow.
+           */
+          lock.unlock();
+          f = create_face();
+          lock.lock();
+          if (f)
+            {
+              f->m_thread_owned = true;
+              m_thread_faces[id] = f;
+            }
+        }
+
+      /* a thread that acquires a face while already holding
+       * its own face falls back to the pool.
+       */
+      if (f && !f->m_in_use)
+        {
+          f->m_in_use = true;
+          return f;
+        }
+    }
+
+  if (m_free_faces.empty()
+      && m_faces.size() + m_number_faces_being_created < m_max_faces)
     {
-      m_faces[i].m_face = m_generator->create_face(m_lib);
-      if (m_faces[i].m_face && m_faces[i].m_face->face())
+      ++m_number_faces_being_created;
+      lock.unlock();
+      f = create_face();
+      lock.lock();
+      --m_number_faces_being_created;
+      if (f)
         {
-          m_all_faces_null = false;
-          m_number_glyphs = m_faces[i].m_face->face()->num_glyphs;
-          FT_Set_Transform(m_faces[i].m_face->face(), nullptr, nullptr);
-          FASTUIDRAWwarn_assert(m_faces[i].m_face->face()->face_flags & FT_FACE_FLAG_SCALABLE);
+          m_faces.push_back(f);
+          return f;
         }
     }
+
+  if (m_free_faces.empty())
+    {
+      std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+
+      ++m_number_face_waits;
+      m_pool_condition.wait(lock, [this]() { return !m_free_faces.empty(); });
+      m_face_wait_time += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+  f = m_free_faces.back();
+  m_free_faces.pop_back();
+  return f;
 }
 
+void
 FontFreeTypePrivate::
-~FontFreeTypePrivate()
+release_face(FaceAndEncoding *f)
 {
+  if (f->m_thread_owned)
+    {
+      f->m_in_use = false;
+      return;
+    }
+
+  std::lock_guard<std::mutex> lock(m_pool_mutex);
+  m_free_faces.push_back(f);
+  m_pool_condition.notify_one();
 }
 
 void
@@ -400,6 +593,44 @@ load_glyph(FT_Face face, uint32_t glyph_code)
   FT_Load_Glyph(face, glyph_code, load_flags);
 }
 
+uint64_t
+FontFreeTypePrivate::
+content_hash(void)
+{
+  std::call_once(m_content_hash_computed, [this]()
+    {
+      FaceGrabber p(this);
+      FT_ULong length(0);
+
+      /* a table tag of 0 loads the entire font file; this only
+       * works for SFNT based fonts (TrueType and OpenType), the
+       * others are left with a hash of 0 and are not cached on disk.
+       */
+      if (!p.m_p || !p.m_p->face()
+          || FT_Load_Sfnt_Table(p.m_p->face(), 0, 0, nullptr, &length) != 0
+          || length == 0)
+        {
+          return;
+        }
+
+      std::vector<FT_Byte> bytes(length);
+      if (FT_Load_Sfnt_Table(p.m_p->face(), 0, 0, &bytes[0], &length) != 0)
+        {
+          return;
+        }
+
+      /* 64-bit FNV-1a */
+      uint64_t h(14695981039346656037ull);
+      for (FT_Byte b : bytes)
+        {
+          h ^= b;
+          h *= 1099511628211ull;
+        }
+      m_content_hash = (h != 0u) ? h : 1u;
+    });
+  return m_content_hash;
+}
+
 void
 FontFreeTypePrivate::
 compute_rendering_data_coverage(int pixel_size,
@@ -456,6 +687,44 @@ compute_rendering_data_coverage(int pixel_size,
     }
 }
 
+void
+FontFreeTypePrivate::
+compute_path(fastuidraw::GlyphRenderer render,
+             fastuidraw::GlyphMetrics glyph_metrics,
+             fastuidraw::Path &path)
+{
+  FaceGrabber p(this);
+
+  if (!p.m_p || !p.m_p->face())
+    {
+      return;
+    }
+
+  FT_Face face(p.m_p->face());
+  uint32_t glyph_code(glyph_metrics.glyph_code());
+
+  if (render.m_type == fastuidraw::coverage_glyph)
+    {
+      /* the path of a coverage glyph is from the outline
+       * hinted at the pixel size of the glyph.
+       */
+      font_coordinate_converter C(face, render.m_pixel_size);
+
+      FT_Set_Pixel_Sizes(face, render.m_pixel_size, render.m_pixel_size);
+      FT_Load_Glyph(face, glyph_code, FT_LOAD_NO_BITMAP);
+      IntPathCreator::decompose_to_path(&face->glyph->outline, path, C);
+    }
+  else
+    {
+      fastuidraw::detail::IntPath int_path_ecm;
+      fastuidraw::detail::IntBezierCurve::transformation<float> identity_tr;
+
+      load_glyph(face, glyph_code);
+      IntPathCreator::decompose_to_path(&face->glyph->outline, int_path_ecm, 1);
+      int_path_ecm.add_to_path(identity_tr, &path);
+    }
+}
+
 void
 FontFreeTypePrivate::
 compute_rendering_data_distance_field(fastuidraw::GlyphMetrics glyph_metrics,
@@ -539,7 +808,10 @@ compute_rendering_data_distance_field(fastuidraw::GlyphMetrics glyph_metrics,
 
   int_path_ecm.extract_render_data(texel_distance, image_sz, max_distance, tr,
                                    fastuidraw::CustomFillRuleFunction(fill_rule),
-                                   &output);
+                                   &output,
+                                   fastuidraw::GlyphGenerateParams::distance_field_generation_threads(),
+                                   fastuidraw::GlyphGenerateParams::distance_field_simd(),
+                                   fastuidraw::GlyphGenerateParams::distance_field_reference_generator());
 }
 
 template<typename T>
@@ -818,6 +1090,123 @@ compute_rendering_data(GlyphRenderer render, GlyphMetrics glyph_metrics,
     }
 }
 
+void
+fastuidraw::FontFreeType::
+compute_path(GlyphRenderer render, GlyphMetrics glyph_metrics,
+             Path &path) const
+{
+  FontFreeTypePrivate *d;
+  d = static_cast<FontFreeTypePrivate*>(m_d);
+  d->compute_path(render, glyph_metrics, path);
+}
+
+uint64_t
+fastuidraw::FontFreeType::
+content_hash(void) const
+{
+  FontFreeTypePrivate *d;
+  d = static_cast<FontFreeTypePrivate*>(m_d);
+  return d->content_hash();
+}
+
+int
+fastuidraw::FontFreeType::
+face_index(void) const
+{
+  FontFreeTypePrivate *d;
+  d = static_cast<FontFreeTypePrivate*>(m_d);
+  return d->m_face_index;
+}
+
+void
+fastuidraw::FontFreeType::
+max_number_faces(unsigned int v)
+{
+  FontFreeTypePrivate *d;
+  d = static_cast<FontFreeTypePrivate*>(m_d);
+
+  /* faces already created are kept */
+  d->m_max_faces = t_max(1u, v);
+}
+
+unsigned int
+fastuidraw::FontFreeType::
+max_number_faces(void) const
+{
+  FontFreeTypePrivate *d;
+  d = static_cast<FontFreeTypePrivate*>(m_d);
+  return d->m_max_faces;
+}
+
+unsigned int
+fastuidraw::FontFreeType::
+number_faces(void) const
+{
+  FontFreeTypePrivate *d;
+  d = static_cast<FontFreeTypePrivate*>(m_d);
+
+  std::lock_guard<std::mutex> lock(d->m_pool_mutex);
+  return d->m_faces.size() + d->m_thread_faces.size();
+}
+
+void
+fastuidraw::FontFreeType::
+per_thread_faces(bool v)
+{
+  FontFreeTypePrivate *d;
+  d = static_cast<FontFreeTypePrivate*>(m_d);
+  d->m_per_thread_faces = v;
+}
+
+bool
+fastuidraw::FontFreeType::
+per_thread_faces(void) const
+{
+  FontFreeTypePrivate *d;
+  d = static_cast<FontFreeTypePrivate*>(m_d);
+  return d->m_per_thread_faces;
+}
+
+unsigned int
+fastuidraw::FontFreeType::
+number_face_acquires(void) const
+{
+  FontFreeTypePrivate *d;
+  d = static_cast<FontFreeTypePrivate*>(m_d);
+  return d->m_number_face_acquires;
+}
+
+unsigned int
+fastuidraw::FontFreeType::
+number_face_waits(void) const
+{
+  FontFreeTypePrivate *d;
+  d = static_cast<FontFreeTypePrivate*>(m_d);
+  return d->m_number_face_waits;
+}
+
+uint64_t
+fastuidraw::FontFreeType::
+face_wait_time_us(void) const
+{
+  FontFreeTypePrivate *d;
+  d = static_cast<FontFreeTypePrivate*>(m_d);
+  return d->m_face_wait_time;
+}
+
+void
+fastuidraw::FontFreeType::
+reset_face_pool_counters(void)
+{
+  FontFreeTypePrivate *d;
+  d = static_cast<FontFreeTypePrivate*>(m_d);
+
+  std::lock_guard<std::mutex> lock(d->m_pool_mutex);
+  d->m_number_face_acquires = 0;
+  d->m_number_face_waits = 0;
+  d->m_face_wait_time = 0;
+}
+
 const fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeFace::GeneratorBase>&
 fastuidraw::FontFreeType::
 face_generator(void) const
@@ -18,6 +18,11 @@
 
 #include <atomic>
 #include <mutex>
+#include <vector>
+#include <deque>
+#include <map>
+#include <chrono>
+#include <algorithm>
 #include <fastuidraw/text/glyph_atlas.hpp>
 
 #include <private/interval_allocator.hpp>
@@ -43,6 +48,20 @@ namespace
     int m_count;
   };
 
+  /* data of an allocation waiting to be written to the store;
+   * an upload whose region is deallocated before it is written
+   * is marked dead and dropped when it reaches the front of the
+   * queue.
+   */
+  class PendingUpload
+  {
+  public:
+    int m_location;
+    uint64_t m_ticket;
+    bool m_dead;
+    std::vector<uint32_t> m_values;
+  };
+
   class GlyphAtlasPrivate
   {
   public:
@@ -53,10 +72,24 @@ namespace
       m_data_allocator(pstore->size()),
       m_data_allocated(0),
       m_number_times_cleared(0),
+      m_number_times_compacted(0),
+      m_number_times_released(0),
       m_lock_resource_counter(0),
-      m_clear_issued(false)
+      m_clear_issued(false),
+      m_last_ticket(0),
+      m_resident_ticket(0),
+      m_bytes_pending(0),
+      m_upload_byte_budget(0),
+      m_upload_time_budget_us(0),
+      m_frame_bytes_uploaded(0),
+      m_frame_upload_time(0),
+      m_frame_uploaded_any(false)
     {
       FASTUIDRAWassert(m_store);
+      for (auto &v : m_stats)
+        {
+          v = 0;
+        }
     };
 
     ~GlyphAtlasPrivate()
@@ -68,9 +101,16 @@ namespace
     clear_implement(void)
     {
       m_data_allocator.reset(m_data_allocator.size());
+      m_data_allocated = 0;
       ++m_number_times_cleared;
+      ++m_number_times_released;
+      increment_stat(fastuidraw::GlyphAtlas::num_clears);
       m_clear_issued = false;
       m_delayed_deallocates.clear();
+      m_pending_uploads.clear();
+      m_pending_uploads_by_location.clear();
+      m_bytes_pending = 0;
+      update_resident_ticket();
     }
 
     void
@@ -78,8 +118,68 @@ namespace
     {
       m_data_allocated -= count;
       m_data_allocator.free_interval(location, count);
+      ++m_number_times_released;
+      increment_stat(fastuidraw::GlyphAtlas::num_deallocations);
+
+      /* the region may be allocated again, so its queued
+       * data must not be written after that.
+       */
+      std::map<int, PendingUpload*>::iterator iter;
+
+      iter = m_pending_uploads_by_location.find(location);
+      if (iter != m_pending_uploads_by_location.end())
+        {
+          PendingUpload *P(iter->second);
+
+          m_bytes_pending -= sizeof(uint32_t) * P->m_values.size();
+          P->m_dead = true;
+          std::vector<uint32_t>().swap(P->m_values);
+          m_pending_uploads_by_location.erase(iter);
+          update_resident_ticket();
+        }
     }
 
+    /* Must be called with m_mutex locked; drops the dead
+     * uploads at the front of m_pending_uploads and sets
+     * m_resident_ticket from the upload at the front.
+     */
+    void
+    update_resident_ticket(void)
+    {
+      while (!m_pending_uploads.empty() && m_pending_uploads.front().m_dead)
+        {
+          m_pending_uploads.pop_front();
+        }
+
+      m_resident_ticket = (m_pending_uploads.empty()) ?
+        m_last_ticket :
+        m_pending_uploads.front().m_ticket - 1u;
+    }
+
+    /* Must be called with m_mutex locked; writes queued data to
+     * the store, if use_budget is true, only within the budget
+     * of the current upload frame.
+     */
+    void
+    upload_pending(bool use_budget);
+
+    bool
+    use_upload_queue(void) const
+    {
+      return m_upload_byte_budget != 0 || m_upload_time_budget_us != 0;
+    }
+
+    void
+    increment_stat(enum fastuidraw::GlyphAtlas::stats_t st, uint64_t v = 1)
+    {
+      FASTUIDRAWassert(st < fastuidraw::GlyphAtlas::current_data_allocated);
+      m_stats[st].fetch_add(v, std::memory_order_relaxed);
+    }
+
+    /* copy a region to a lower location, the ranges may overlap */
+    void
+    move_region(int dst, int src, int count);
+
     fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlasBackingStoreBase> m_store;
     fastuidraw::reference_counted_ptr<const fastuidraw::GlyphAtlasBackingStoreBase> m_store_constant;
     fastuidraw::interval_allocator m_data_allocator;
@@ -88,11 +188,109 @@ namespace
     std::mutex m_mutex;
     std::atomic<unsigned int> m_data_allocated;
     std::atomic<unsigned int> m_number_times_cleared;
+    std::atomic<unsigned int> m_number_times_compacted;
+    std::atomic<unsigned int> m_number_times_released;
     std::atomic<int> m_lock_resource_counter;
     std::atomic<bool> m_clear_issued;
+
+    /* the counters of GlyphAtlas::stats_t */
+    std::atomic<uint64_t> m_stats[fastuidraw::GlyphAtlas::current_data_allocated];
+
+    /* data queued to be written to the store in order of
+     * ticket; m_last_ticket is the ticket of the last
+     * allocation and all allocations with ticket no more
+     * than m_resident_ticket are written to the store.
+     * The uploads of m_pending_uploads that are not dead
+     * are also keyed by location (pushing and popping at
+     * the ends of a std::deque does not move its elements)
+     * and m_bytes_pending is the size of their data.
+     */
+    std::deque<PendingUpload> m_pending_uploads;
+    std::map<int, PendingUpload*> m_pending_uploads_by_location;
+    uint64_t m_last_ticket;
+    std::atomic<uint64_t> m_resident_ticket;
+    std::atomic<uint64_t> m_bytes_pending;
+
+    /* upload budget and how much of it is spent in the
+     * current upload frame.
+     */
+    std::atomic<unsigned int> m_upload_byte_budget;
+    std::atomic<unsigned int> m_upload_time_budget_us;
+    uint64_t m_frame_bytes_uploaded;
+    std::chrono::steady_clock::duration m_frame_upload_time;
+    bool m_frame_uploaded_any;
   };
 }
 
+///////////////////////////////////////////
+// GlyphAtlasPrivate methods
+void
+GlyphAtlasPrivate::
+upload_pending(bool use_budget)
+{
+  std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+  std::chrono::steady_clock::duration time_budget(std::chrono::microseconds(m_upload_time_budget_us.load()));
+  uint64_t byte_budget(m_upload_byte_budget);
+
+  if (m_pending_uploads.empty())
+    {
+      return;
+    }
+
+  while (!m_pending_uploads.empty())
+    {
+      PendingUpload &P(m_pending_uploads.front());
+      uint64_t bytes(sizeof(uint32_t) * P.m_values.size());
+      std::chrono::steady_clock::duration elapsed(std::chrono::steady_clock::now() - start);
+
+      if (P.m_dead)
+        {
+          m_pending_uploads.pop_front();
+          continue;
+        }
+
+      /* always write something each frame so that a single
+       * allocation larger than the budget is still written.
+       */
+      if (use_budget && m_frame_uploaded_any
+          && ((byte_budget != 0 && m_frame_bytes_uploaded + bytes > byte_budget)
+              || (time_budget.count() != 0 && m_frame_upload_time + elapsed >= time_budget)))
+        {
+          break;
+        }
+
+      m_store->set_values(P.m_location, fastuidraw::make_c_array(P.m_values));
+      increment_stat(fastuidraw::GlyphAtlas::num_bytes_uploaded, bytes);
+      m_frame_bytes_uploaded += bytes;
+      m_frame_uploaded_any = true;
+      m_bytes_pending -= bytes;
+      m_pending_uploads_by_location.erase(P.m_location);
+      m_pending_uploads.pop_front();
+    }
+
+  m_frame_upload_time += std::chrono::steady_clock::now() - start;
+  update_resident_ticket();
+}
+
+void
+GlyphAtlasPrivate::
+move_region(int dst, int src, int count)
+{
+  FASTUIDRAWassert(dst < src);
+
+  /* copy_values() requires that the ranges do not overlap;
+   * since dst < src, copying in pieces of at most (src - dst)
+   * from front to back only reads values not yet overwritten.
+   */
+  int step(src - dst);
+  for (int offset = 0; offset < count; offset += step)
+    {
+      int n(fastuidraw::t_min(step, count - offset));
+      m_store->copy_values(dst + offset, src + offset, n);
+    }
+  increment_stat(fastuidraw::GlyphAtlas::num_bytes_moved, sizeof(uint32_t) * count);
+}
+
 ///////////////////////////////////////////
 // fastuidraw::GlyphAtlasBackingStoreBase methods
 fastuidraw::GlyphAtlasBackingStoreBase::
@@ -112,7 +310,7 @@ fastuidraw::GlyphAtlasBackingStoreBase::
 
 unsigned int
 fastuidraw::GlyphAtlasBackingStoreBase::
-size(void)
+size(void) const
 {
   GlyphAtlasBackingStoreBasePrivate *d;
   d = static_cast<GlyphAtlasBackingStoreBasePrivate*>(m_d);
@@ -130,6 +328,20 @@ resize(unsigned int new_size)
   d->m_size = new_size;
 }
 
+bool
+fastuidraw::GlyphAtlasBackingStoreBase::
+can_copy_values(void) const
+{
+  return false;
+}
+
+void
+fastuidraw::GlyphAtlasBackingStoreBase::
+copy_values(unsigned int, unsigned int, unsigned int)
+{
+  FASTUIDRAWassert(!"GlyphAtlasBackingStoreBase::copy_values() not implemented");
+}
+
 ///////////////////////////////////////////////
 // fastuidraw::GlyphAtlas methods
 fastuidraw::GlyphAtlas::
@@ -149,7 +361,7 @@ fastuidraw::GlyphAtlas::
 
 int
 fastuidraw::GlyphAtlas::
-allocate_data(c_array<const uint32_t> pdata)
+allocate_data(c_array<const uint32_t> pdata, bool allow_resize)
 {
   if (pdata.empty())
     {
@@ -163,22 +375,50 @@ allocate_data(c_array<const uint32_t> pdata)
 
   int return_value;
   return_value = d->m_data_allocator.allocate_interval(pdata.size());
+  if (return_value == -1 && !allow_resize)
+    {
+      return -1;
+    }
+
   if (return_value == -1)
     {
       d->m_store->resize(pdata.size() + 2 * d->m_store->size());
       d->m_data_allocator.resize(d->m_store->size());
+      d->increment_stat(num_resizes);
       return_value = d->m_data_allocator.allocate_interval(pdata.size());
       FASTUIDRAWassert(return_value != -1);
     }
 
   d->m_data_allocated += pdata.size();
-  d->m_store->set_values(return_value, pdata);
+  d->increment_stat(num_allocations);
+  ++d->m_last_ticket;
+  if (d->use_upload_queue())
+    {
+      d->m_pending_uploads.push_back(PendingUpload());
+
+      PendingUpload &P(d->m_pending_uploads.back());
+      P.m_location = return_value;
+      P.m_ticket = d->m_last_ticket;
+      P.m_dead = false;
+      P.m_values.assign(pdata.begin(), pdata.end());
+      d->m_pending_uploads_by_location[return_value] = &P;
+      d->m_bytes_pending += sizeof(uint32_t) * pdata.size();
+    }
+  else
+    {
+      d->m_store->set_values(return_value, pdata);
+      d->increment_stat(num_bytes_uploaded, sizeof(uint32_t) * pdata.size());
+      if (d->m_pending_uploads.empty())
+        {
+          d->m_resident_ticket = d->m_last_ticket;
+        }
+    }
   return return_value;
 }
 
 void
 fastuidraw::GlyphAtlas::
-deallocate_data(int location, int count)
+deallocate_data(int location, int count, bool allow_delay)
 {
   GlyphAtlasPrivate *d;
   d = static_cast<GlyphAtlasPrivate*>(m_d);
@@ -190,7 +430,7 @@ deallocate_data(int location, int count)
     }
 
   FASTUIDRAWassert(count > 0);
-  if (d->m_lock_resource_counter == 0)
+  if (d->m_lock_resource_counter == 0 || !allow_delay)
     {
       std::lock_guard<std::mutex> m(d->m_mutex);
       d->deallocate_implement(location, count);
@@ -216,6 +456,171 @@ data_allocated(void)
   return d->m_data_allocated;
 }
 
+unsigned int
+fastuidraw::GlyphAtlas::
+largest_free_interval(void)
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_mutex);
+  return d->m_data_allocator.largest_free_interval();
+}
+
+int
+fastuidraw::GlyphAtlas::
+lowest_free_location(void)
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_mutex);
+  std::vector<range_type<int> > free_intervals;
+
+  d->m_data_allocator.free_intervals(&free_intervals);
+  return (free_intervals.empty()) ?
+    d->m_data_allocator.size() :
+    free_intervals.front().m_begin;
+}
+
+enum fastuidraw::return_code
+fastuidraw::GlyphAtlas::
+compact(c_array<const range_type<int> > regions,
+        c_array<int> out_locations)
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+
+  FASTUIDRAWassert(regions.size() == out_locations.size());
+  if (!d->m_store->can_copy_values() || d->m_lock_resource_counter != 0)
+    {
+      return routine_fail;
+    }
+
+  std::lock_guard<std::mutex> m(d->m_mutex);
+  std::vector<range_type<int> > free_or_moved, pinned;
+
+  /* moving data that is not yet written would move stale
+   * values, so write all queued data first.
+   */
+  d->upload_pending(false);
+  std::vector<unsigned int> order;
+  int size(d->m_data_allocator.size());
+
+  /* the regions that are neither free nor moved are pinned */
+  d->m_data_allocator.free_intervals(&free_or_moved);
+  order.clear();
+  for (unsigned int i = 0; i < regions.size(); ++i)
+    {
+      /* empty regions are not backed by the allocator, they stay put */
+      out_locations[i] = regions[i].m_begin;
+      if (regions[i].m_end > regions[i].m_begin)
+        {
+          FASTUIDRAWassert(d->m_data_allocator.interval_status(regions[i].m_begin,
+                                                               regions[i].difference())
+                           == interval_allocator::completely_allocated);
+          free_or_moved.push_back(regions[i]);
+          order.push_back(i);
+        }
+    }
+
+  std::sort(free_or_moved.begin(), free_or_moved.end(),
+            [](const range_type<int> &a, const range_type<int> &b)
+            {
+              return a.m_begin < b.m_begin;
+            });
+
+  int pos(0);
+  for (const range_type<int> &R : free_or_moved)
+    {
+      FASTUIDRAWassert(R.m_begin >= pos);
+      if (R.m_begin > pos)
+        {
+          pinned.push_back(range_type<int>(pos, R.m_begin));
+        }
+      pos = R.m_end;
+    }
+  if (pos < size)
+    {
+      pinned.push_back(range_type<int>(pos, size));
+    }
+
+  /* Place the regions in order of location, each at the lowest
+   * location after the previously placed region that does not
+   * intersect a pinned region. A region is never placed after
+   * where it currently is, so copying the regions in this order
+   * never overwrites data that has yet to be copied.
+   */
+  std::sort(order.begin(), order.end(),
+            [regions](unsigned int a, unsigned int b)
+            {
+              return regions[a].m_begin < regions[b].m_begin;
+            });
+
+  bool moved(false);
+  unsigned int p(0);
+
+  pos = 0;
+  for (unsigned int i : order)
+    {
+      int sz(regions[i].difference());
+
+      /* the pinned regions are sorted and disjoint and pos only
+       * increases, so a pinned region skipped here ends at or
+       * before pos and never needs to be looked at again.
+       */
+      while (p < pinned.size() && pinned[p].m_begin < pos + sz)
+        {
+          pos = t_max(pos, pinned[p].m_end);
+          ++p;
+        }
+
+      FASTUIDRAWassert(pos <= regions[i].m_begin);
+      out_locations[i] = pos;
+      if (pos != regions[i].m_begin)
+        {
+          d->move_region(pos, regions[i].m_begin, sz);
+          moved = true;
+        }
+      pos += sz;
+    }
+
+  /* rebuild the allocator from the pinned and moved regions */
+  d->m_data_allocator.reset(size);
+  for (const range_type<int> &R : pinned)
+    {
+      bool R_ok;
+      R_ok = d->m_data_allocator.allocate_interval_at(R.m_begin, R.difference());
+      FASTUIDRAWunused(R_ok);
+      FASTUIDRAWassert(R_ok);
+    }
+  for (unsigned int i : order)
+    {
+      bool R_ok;
+      R_ok = d->m_data_allocator.allocate_interval_at(out_locations[i], regions[i].difference());
+      FASTUIDRAWunused(R_ok);
+      FASTUIDRAWassert(R_ok);
+    }
+
+  if (moved)
+    {
+      ++d->m_number_times_compacted;
+      ++d->m_number_times_released;
+      d->increment_stat(num_compactions);
+    }
+
+  return routine_success;
+}
+
+unsigned int
+fastuidraw::GlyphAtlas::
+number_times_compacted(void) const
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+  return d->m_number_times_compacted;
+}
+
 void
 fastuidraw::GlyphAtlas::
 clear(void)
@@ -243,6 +648,103 @@ number_times_cleared(void) const
   return d->m_number_times_cleared;
 }
 
+unsigned int
+fastuidraw::GlyphAtlas::
+number_times_released(void) const
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+  return d->m_number_times_released;
+}
+
+uint64_t
+fastuidraw::GlyphAtlas::
+query_stat(enum stats_t st) const
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+
+  switch (st)
+    {
+    case current_data_allocated:
+      return d->m_data_allocated;
+
+    case current_store_size:
+      return d->m_store->size();
+
+    case current_free_room:
+      {
+        std::lock_guard<std::mutex> m(d->m_mutex);
+        return d->m_store->size() - d->m_data_allocated;
+      }
+
+    case current_largest_free_interval:
+      {
+        std::lock_guard<std::mutex> m(d->m_mutex);
+        return d->m_data_allocator.largest_free_interval();
+      }
+
+    case current_bytes_pending:
+      return d->m_bytes_pending;
+
+    case number_stats:
+      return 0;
+
+    default:
+      return d->m_stats[st].load(std::memory_order_relaxed);
+    }
+}
+
+void
+fastuidraw::GlyphAtlas::
+query_stats(c_array<uint64_t> dst) const
+{
+  for (unsigned int i = 0; i < dst.size() && i < number_stats; ++i)
+    {
+      dst[i] = query_stat(static_cast<enum stats_t>(i));
+    }
+}
+
+void
+fastuidraw::GlyphAtlas::
+reset_stats(void)
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+
+  for (auto &v : d->m_stats)
+    {
+      v.store(0, std::memory_order_relaxed);
+    }
+}
+
+fastuidraw::c_string
+fastuidraw::GlyphAtlas::
+label(enum stats_t st)
+{
+#define EASY(X) case X: return #X
+
+  switch (st)
+    {
+      EASY(num_allocations);
+      EASY(num_deallocations);
+      EASY(num_bytes_uploaded);
+      EASY(num_bytes_moved);
+      EASY(num_resizes);
+      EASY(num_clears);
+      EASY(num_compactions);
+      EASY(current_data_allocated);
+      EASY(current_store_size);
+      EASY(current_free_room);
+      EASY(current_largest_free_interval);
+      EASY(current_bytes_pending);
+    default:
+      return "unknown";
+    }
+
+#undef EASY
+}
+
 void
 fastuidraw::GlyphAtlas::
 flush(void) const
@@ -250,9 +752,79 @@ flush(void) const
   GlyphAtlasPrivate *d;
   d = static_cast<GlyphAtlasPrivate*>(m_d);
   std::lock_guard<std::mutex> m(d->m_mutex);
+  d->upload_pending(d->use_upload_queue());
   d->m_store->flush();
 }
 
+void
+fastuidraw::GlyphAtlas::
+upload_byte_budget(unsigned int v)
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+  d->m_upload_byte_budget = v;
+}
+
+unsigned int
+fastuidraw::GlyphAtlas::
+upload_byte_budget(void) const
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+  return d->m_upload_byte_budget;
+}
+
+void
+fastuidraw::GlyphAtlas::
+upload_time_budget_us(unsigned int v)
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+  d->m_upload_time_budget_us = v;
+}
+
+unsigned int
+fastuidraw::GlyphAtlas::
+upload_time_budget_us(void) const
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+  return d->m_upload_time_budget_us;
+}
+
+void
+fastuidraw::GlyphAtlas::
+begin_upload_frame(void)
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_mutex);
+  d->m_frame_bytes_uploaded = 0;
+  d->m_frame_upload_time = std::chrono::steady_clock::duration::zero();
+  d->m_frame_uploaded_any = false;
+}
+
+uint64_t
+fastuidraw::GlyphAtlas::
+last_upload_ticket(void) const
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_mutex);
+  return d->m_last_ticket;
+}
+
+bool
+fastuidraw::GlyphAtlas::
+upload_resident(uint64_t ticket) const
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+  return ticket <= d->m_resident_ticket;
+}
+
 const fastuidraw::reference_counted_ptr<const fastuidraw::GlyphAtlasBackingStoreBase>&
 fastuidraw::GlyphAtlas::
 store(void) const
@@ -19,10 +19,20 @@
 
 #include <map>
 #include <vector>
+#include <deque>
+#include <thread>
+#include <algorithm>
+#include <atomic>
 #include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <fastuidraw/util/math.hpp>
 #include <fastuidraw/text/glyph_cache.hpp>
 #include <fastuidraw/text/glyph_render_data.hpp>
+#include <fastuidraw/text/glyph_render_data_restricted_rays.hpp>
+#include <fastuidraw/text/glyph_render_data_banded_rays.hpp>
 #include <private/util_private.hpp>
+#include <private/glyph_disk_cache.hpp>
 
 namespace
 {
@@ -41,12 +51,18 @@ namespace
     explicit
     GlyphAtlasProxyPrivate(GlyphCachePrivate *c):
       m_total_allocated(0),
-      m_cache(c)
+      m_cache(c),
+      m_recorder(nullptr)
     {}
 
     unsigned int m_total_allocated;
     std::vector<GlyphDataAlloc> m_data_locations;
     GlyphCachePrivate *m_cache;
+
+    /* if non-null, allocations are recorded for the disk
+     * cache instead of being made on the atlas.
+     */
+    fastuidraw::detail::GlyphDiskCacheRecorder *m_recorder;
   };
 
   class GlyphMetricsPrivate
@@ -80,7 +96,10 @@ namespace
 
     void
     clear(void)
-    {}
+    {
+      m_ready = false;
+      m_font.clear();
+    }
 
     /* owner */
     GlyphCachePrivate *m_cache;
@@ -112,20 +131,116 @@ namespace
     void
     remove_from_atlas(void);
 
+    /* Remove the glyph's data from the atlas immediately
+     * (i.e. not delayed by GlyphAtlas::lock_resources())
+     * and mark it as not uploaded.
+     */
+    void
+    evict_from_atlas(void);
+
     enum fastuidraw::return_code
     upload_to_atlas(fastuidraw::GlyphMetrics metrics,
                     fastuidraw::GlyphAtlasProxy &S,
                     fastuidraw::GlyphAttribute::Array &T);
 
+    /* set m_last_used_frame to the current frame of m_cache */
+    void
+    mark_used(void);
+
+    /* upload the data of m_disk_entry to the atlas */
+    enum fastuidraw::return_code
+    upload_disk_entry_to_atlas(fastuidraw::GlyphAtlasProxy &S,
+                               fastuidraw::GlyphAttribute::Array &T);
+
+    /* If the glyph is to be recorded to the disk cache of m_cache,
+     * upload m_glyph_data to fake locations to find the attribute
+     * words that hold atlas locations and record the glyph; the
+     * probe also sets m_relocations.
+     */
+    void
+    probe_atlas_locations(fastuidraw::GlyphAtlasProxy &S,
+                          fastuidraw::GlyphAttribute::Array &T);
+
+    /* Upload m_glyph_data twice to recorder; m_attributes is
+     * left empty.
+     */
+    enum fastuidraw::return_code
+    probe_passes(fastuidraw::GlyphAtlasProxy &S,
+                 fastuidraw::GlyphAttribute::Array &T,
+                 fastuidraw::detail::GlyphDiskCacheRecorder *recorder,
+                 fastuidraw::c_array<float> costs);
+
+    /* Set m_relocations of a glyph uploaded to the atlas by
+     * generating its rendering data again and probing it; called
+     * (through GlyphCache::compute_relocations()) by a compaction
+     * that may move the glyph. Sets m_relocations_probed.
+     */
+    void
+    compute_relocations(fastuidraw::GlyphMetrics metrics,
+                        fastuidraw::GlyphAtlasProxy &S,
+                        fastuidraw::GlyphAttribute::Array &T);
+
+    /* Apply the change of location of each element of
+     * m_data_locations to m_attributes.
+     */
+    void
+    relocate_attributes(fastuidraw::c_array<const int> deltas);
+
+    void
+    set_render_cost_info(fastuidraw::c_array<const fastuidraw::c_string> labels,
+                         fastuidraw::c_array<const float> values);
+
     /* location into m_cache->m_glyphs  */
     unsigned int m_cache_location;
 
     fastuidraw::GlyphRenderer m_render;
     GlyphMetricsPrivate *m_metrics;
 
+    /* true while a thread is generating the rendering
+     * data of the glyph outside of m_cache->m_glyphs_mutex;
+     * other threads requesting the same glyph wait on
+     * m_cache->m_glyphs_generated until it is false.
+     */
+    bool m_in_flight;
+
+    /* incremented each time clear() is called so that a
+     * generation that completes after the glyph was removed
+     * from the cache does not write to the recycled slot.
+     */
+    unsigned int m_generation;
+
+    /* value of m_cache->m_current_frame when the glyph
+     * was last used; the eviction order is by this value.
+     */
+    std::atomic<unsigned int> m_last_used_frame;
+
+    /* number of pins (see GlyphCache::pin_glyphs()) on the
+     * glyph; a pinned glyph is neither evicted nor moved by
+     * a compaction. Protected by m_cache->m_glyphs_mutex.
+     */
+    unsigned int m_pin_count;
+
     std::vector<fastuidraw::GlyphAttribute> m_attributes;
     bool m_uploaded_to_atlas;
 
+    /* value of GlyphAtlas::last_upload_ticket() after the
+     * data of the glyph was uploaded.
+     */
+    uint64_t m_upload_ticket;
+
+    /* if m_relocatable is true, the data of the glyph can be
+     * moved by GlyphAtlas::compact(); m_relocations holds pairs
+     * (word of m_attributes, element of m_data_locations) of the
+     * attribute words that hold the location of the data. The
+     * relocations are only computed on upload when the glyph
+     * is recorded to the disk cache, otherwise the first time
+     * a compaction may move the glyph; m_relocations_probed is
+     * true once they were computed, successfully or not.
+     */
+    bool m_relocatable;
+    bool m_relocations_probed;
+    std::vector<uint32_t> m_relocations;
+
     /* Path of the glyph */
     fastuidraw::Path m_path;
 
@@ -135,6 +250,17 @@ namespace
     /* data to generate glyph data */
     fastuidraw::GlyphRenderData *m_glyph_data;
 
+    /* if non-null, the glyph data comes from the disk cache
+     * of m_cache; the entry stays valid for the lifetime of
+     * m_cache.
+     */
+    const fastuidraw::detail::GlyphDiskCacheEntry *m_disk_entry;
+
+    /* true if m_path has yet to be computed, which is the
+     * case for glyphs whose data comes from the disk cache.
+     */
+    std::atomic<bool> m_path_pending;
+
     std::vector<fastuidraw::GlyphRenderCostInfo> m_render_cost_info;
   };
 
@@ -291,6 +417,210 @@ namespace
     uint32_t m_glyph_code;
   };
 
+  /* Dense table of the metrics of the glyphs of a single font
+   * indexed by glyph code. A slot is written once, with the
+   * metrics mutex of the GlyphCache locked, after the metrics
+   * it points to are ready; reading does not lock.
+   */
+  class DenseMetricsTable:fastuidraw::noncopyable
+  {
+  public:
+    explicit
+    DenseMetricsTable(const fastuidraw::FontBase *font):
+      m_key(font),
+      m_font(font),
+      m_slots(font->number_glyphs())
+    {
+      for (auto &slot : m_slots)
+        {
+          slot.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    GlyphMetricsPrivate*
+    fetch(uint32_t glyph_code) const
+    {
+      FASTUIDRAWassert(glyph_code < m_slots.size());
+      return m_slots[glyph_code].load(std::memory_order_acquire);
+    }
+
+    void
+    publish(uint32_t glyph_code, GlyphMetricsPrivate *p)
+    {
+      FASTUIDRAWassert(glyph_code < m_slots.size());
+      FASTUIDRAWassert(p->m_ready);
+      m_slots[glyph_code].store(p, std::memory_order_release);
+    }
+
+    /* the font of the table, m_key is never changed so
+     * that readers can compare against it without locking;
+     * m_font keeps the font alive until the table is
+     * deleted by GlyphCache::clear_cache().
+     */
+    const fastuidraw::FontBase *m_key;
+    fastuidraw::reference_counted_ptr<const fastuidraw::FontBase> m_font;
+
+  private:
+    std::vector<std::atomic<GlyphMetricsPrivate*> > m_slots;
+  };
+
+  /* The set of DenseMetricsTable objects of a GlyphCache sorted
+   * by font; a DenseMetricsTableList is never modified once it
+   * is published, instead a new list is made and published.
+   */
+  class DenseMetricsTableList
+  {
+  public:
+    DenseMetricsTable*
+    find(const fastuidraw::FontBase *font) const
+    {
+      auto iter = std::lower_bound(m_tables.begin(), m_tables.end(), font,
+                                   [](const DenseMetricsTable *t,
+                                      const fastuidraw::FontBase *f)
+                                   {
+                                     return t->m_key < f;
+                                   });
+
+      return (iter != m_tables.end() && (*iter)->m_key == font) ?
+        *iter : nullptr;
+    }
+
+    std::vector<DenseMetricsTable*> m_tables;
+  };
+
+  /* Returns the labels of the render costs of glyphs of a
+   * given type; used for glyphs from the disk cache which
+   * do not have a GlyphRenderData from which to get them.
+   */
+  fastuidraw::c_array<const fastuidraw::c_string>
+  render_info_labels(enum fastuidraw::glyph_type tp)
+  {
+    switch (tp)
+      {
+      case fastuidraw::restricted_rays_glyph:
+        {
+          fastuidraw::GlyphRenderDataRestrictedRays R;
+          return R.render_info_labels();
+        }
+      case fastuidraw::banded_rays_glyph:
+        {
+          fastuidraw::GlyphRenderDataBandedRays R;
+          return R.render_info_labels();
+        }
+      default:
+        return fastuidraw::c_array<const fastuidraw::c_string>();
+      }
+  }
+
+  class PrefetchTicketPrivate
+  {
+  public:
+    PrefetchTicketPrivate(unsigned int number_glyphs, unsigned int number_jobs,
+                          const fastuidraw::reference_counted_ptr<fastuidraw::GlyphCache::PrefetchCallback> &callback):
+      m_number_glyphs(number_glyphs),
+      m_number_glyphs_generated(0),
+      m_remaining_jobs(number_jobs),
+      m_cancelled(false),
+      m_callback(callback)
+    {}
+
+    mutable std::mutex m_mutex;
+    mutable std::condition_variable m_done_condition;
+    unsigned int m_number_glyphs;
+    std::atomic<unsigned int> m_number_glyphs_generated;
+
+    /* protected by m_mutex */
+    unsigned int m_remaining_jobs;
+    bool m_cancelled;
+
+    fastuidraw::reference_counted_ptr<fastuidraw::GlyphCache::PrefetchCallback> m_callback;
+  };
+
+  /* A portion of the glyphs of a prefetch_glyphs() call,
+   * prefetches are split so that several threads can
+   * work on one prefetch.
+   */
+  class PrefetchJob
+  {
+  public:
+    enum
+      {
+        max_glyphs_per_job = 32
+      };
+
+    /* Called when the job is done or discarded; signals the ticket
+     * and calls its callback if this was the last job of the ticket.
+     */
+    void
+    complete(bool cancelled);
+
+    fastuidraw::reference_counted_ptr<fastuidraw::GlyphCache::PrefetchTicket> m_ticket;
+    PrefetchTicketPrivate *m_ticket_private;
+    fastuidraw::GlyphRenderer m_render;
+    std::vector<fastuidraw::GlyphSource> m_sources;
+
+    /* keep the fonts alive until the job is done */
+    std::vector<fastuidraw::reference_counted_ptr<const fastuidraw::FontBase> > m_fonts;
+  };
+
+  /* A glyph that GlyphCachePrivate::evict_and_allocate() may evict */
+  class EvictionCandidate
+  {
+  public:
+    explicit
+    EvictionCandidate(GlyphDataPrivate *q):
+      m_glyph(q),
+      m_generation(q->m_generation)
+    {}
+
+    GlyphDataPrivate *m_glyph;
+    unsigned int m_generation;
+  };
+
+  /* A glyph pinned by GlyphCache::pin_glyphs(); the pin is only
+   * released if the glyph was not removed from the cache since,
+   * i.e. if m_generation still matches.
+   */
+  class PinnedGlyph
+  {
+  public:
+    explicit
+    PinnedGlyph(GlyphDataPrivate *q):
+      m_glyph(q),
+      m_generation(q->m_generation)
+    {}
+
+    GlyphDataPrivate *m_glyph;
+    unsigned int m_generation;
+  };
+
+  /* A glyph claimed for generation by a thread; if
+   * m_regenerate is true, the glyph already has its path
+   * and only the rendering data that was released when
+   * the glyph was evicted is generated again.
+   */
+  class ClaimedGlyph
+  {
+  public:
+    ClaimedGlyph(GlyphDataPrivate *q, fastuidraw::GlyphMetrics metrics,
+                 bool regenerate = false):
+      m_glyph(q),
+      m_metrics(metrics),
+      m_generation(q->m_generation),
+      m_regenerate(regenerate),
+      m_render(q->m_render),
+      m_glyph_data(nullptr)
+    {}
+
+    GlyphDataPrivate *m_glyph;
+    fastuidraw::GlyphMetrics m_metrics;
+    unsigned int m_generation;
+    bool m_regenerate;
+    fastuidraw::GlyphRenderer m_render;
+    fastuidraw::GlyphRenderData *m_glyph_data;
+    fastuidraw::vec2 m_render_size;
+  };
+
   class GlyphCachePrivate
   {
   public:
@@ -300,6 +630,192 @@ namespace
 
     ~GlyphCachePrivate();
 
+    /* Must be called with m_glyphs_mutex locked. Fetches the
+     * GlyphDataPrivate of a glyph; if the glyph has not yet
+     * been generated and no other thread is generating it,
+     * marks the glyph as in-flight and adds it to the list
+     * of glyphs that the caller is to generate.
+     */
+    GlyphDataPrivate*
+    fetch_or_claim(const glyph_key &key, fastuidraw::GlyphMetrics metrics,
+                   GlyphMetricsPrivate *metrics_private,
+                   std::vector<ClaimedGlyph> *claimed);
+
+    /* Generate the rendering data for the glyphs claimed
+     * by fetch_or_claim(). The lock is released while the
+     * data is computed and reacquired to publish the data.
+     */
+    void
+    generate_claimed(std::unique_lock<std::mutex> &lock,
+                     fastuidraw::c_array<ClaimedGlyph> claimed);
+
+    /* Must be called with m_glyphs_mutex locked. If the glyph
+     * needs its rendering data generated again before it can be
+     * uploaded (because it was evicted from the atlas after the
+     * data was released), marks it as in-flight and adds it to
+     * claimed; returns true if the glyph is claimed or another
+     * thread is generating it.
+     */
+    bool
+    claim_for_upload(GlyphDataPrivate *q, fastuidraw::GlyphMetrics metrics,
+                     std::vector<ClaimedGlyph> *claimed);
+
+    /* Must be called with m_glyphs_mutex locked by lock. Generates
+     * again the rendering data of those glyphs that need it to be
+     * uploaded, in the same way as fetch_or_claim() and
+     * generate_claimed() do for new glyphs, so that the lock is
+     * not held while the data is computed. An element of glyphs
+     * is set to nullptr if the glyph was removed from the cache
+     * while the lock was released, i.e. if its generation is no
+     * longer the matching element of generations; metrics holds
+     * the metrics of each glyph. The glyphs should be marked as
+     * used first so that other threads do not evict them while
+     * the lock is released.
+     */
+    void
+    regenerate_evicted(std::unique_lock<std::mutex> &lock,
+                       fastuidraw::c_array<GlyphDataPrivate*> glyphs,
+                       fastuidraw::c_array<const unsigned int> generations,
+                       fastuidraw::c_array<const fastuidraw::GlyphMetrics> metrics);
+
+    /* Must be called with m_glyphs_mutex locked. Allocate
+     * data on the atlas, evicting glyphs if the atlas is at
+     * its size limit.
+     */
+    int
+    allocate_data(fastuidraw::c_array<const uint32_t> pdata);
+
+    /* Must be called with m_glyphs_mutex locked. Evict glyphs
+     * in LRU order until pdata can be allocated without resizing
+     * the atlas, growing the atlas only if there is nothing left
+     * that can be evicted. The glyphs are sorted once per frame
+     * into m_eviction_candidates and later calls of the same
+     * frame continue from where the previous call stopped.
+     */
+    int
+    evict_and_allocate(fastuidraw::c_array<const uint32_t> pdata);
+
+    /* Must be called with m_glyphs_mutex locked. Compacts the
+     * atlas moving the data of the glyphs that are relocatable
+     * and records in m_moved_glyphs those glyphs whose data moved.
+     */
+    enum fastuidraw::return_code
+    compact_atlas(void);
+
+    /* Start a new frame epoch; glyphs whose m_last_used_frame
+     * equals m_current_frame are protected from eviction.
+     */
+    void
+    advance_frame(void)
+    {
+      ++m_current_frame;
+    }
+
+    /* Must be called with m_glyphs_mutex locked by lock;
+     * waits until the named glyph is not in-flight.
+     */
+    void
+    wait_until_generated(std::unique_lock<std::mutex> &lock,
+                         GlyphDataPrivate *q)
+    {
+      m_glyphs_generated.wait(lock, [q]() { return !q->m_in_flight; });
+    }
+
+    /* Compute the key of a glyph in m_disk_cache; returns false
+     * if the disk cache is not in use or the font cannot be
+     * cached on disk.
+     */
+    bool
+    disk_cache_key(const fastuidraw::FontBase *font, uint32_t glyph_code,
+                   fastuidraw::GlyphRenderer render,
+                   fastuidraw::detail::GlyphDiskCacheKey *out_key);
+
+    /* Add v to the statistic st of the cache */
+    void
+    increment_stat(enum fastuidraw::GlyphCache::stats_t st, uint64_t v = 1)
+    {
+      m_stats[st].fetch_add(v, std::memory_order_relaxed);
+    }
+
+    /* Compute the rendering data of a glyph, recording the
+     * time taken to the statistics of the cache.
+     */
+    fastuidraw::GlyphRenderData*
+    compute_rendering_data(fastuidraw::GlyphRenderer render,
+                           fastuidraw::GlyphMetrics metrics,
+                           fastuidraw::Path &path,
+                           fastuidraw::vec2 &render_size);
+
+    /* Set the metrics of p from m_disk_cache; returns
+     * false if the glyph is not in m_disk_cache.
+     */
+    bool
+    fetch_metrics_from_disk_cache(const fastuidraw::FontBase *font,
+                                  uint32_t glyph_code,
+                                  GlyphMetricsPrivate *p);
+
+    /* Must be called with m_glyphs_metrics_mutex locked. Fetch
+     * the metrics of a glyph, taking them from m_disk_cache if
+     * possible. If the returned metrics are not ready, the caller
+     * is to compute them with FontBase::compute_metrics() and then
+     * call metrics_ready().
+     */
+    GlyphMetricsPrivate*
+    fetch_metrics(const fastuidraw::FontBase *font, uint32_t glyph_code,
+                  DenseMetricsTable *table);
+
+    /* Must be called with m_glyphs_metrics_mutex locked. Marks
+     * the metrics as ready and if table is non-null, publishes
+     * the metrics to table.
+     */
+    static
+    void
+    metrics_ready(GlyphMetricsPrivate *p, DenseMetricsTable *table)
+    {
+      p->m_ready = true;
+      if (table)
+        {
+          table->publish(p->m_glyph_code, p);
+        }
+    }
+
+    /* Returns the DenseMetricsTable of a font or nullptr if the
+     * font does not have one; does not lock. Must be called either
+     * with m_glyphs_metrics_mutex locked or within the lifetime of
+     * a DenseMetricsReader; the returned table may only be used
+     * while that lock or reader is held.
+     */
+    DenseMetricsTable*
+    dense_metrics_table(const fastuidraw::FontBase *font)
+    {
+      const DenseMetricsTableList *list;
+
+      /* sequentially consistent, see clear_dense_metrics_tables() */
+      list = m_dense_metrics.load(std::memory_order_seq_cst);
+      return (list) ? list->find(font) : nullptr;
+    }
+
+    /* Must be called with m_glyphs_metrics_mutex locked. Returns
+     * the DenseMetricsTable of a font, creating it if necessary.
+     */
+    DenseMetricsTable*
+    fetch_or_create_dense_metrics_table(const fastuidraw::FontBase *font);
+
+    /* Must be called with m_glyphs_metrics_mutex locked and before
+     * the metrics in m_glyph_metrics are cleared. Unpublishes all
+     * DenseMetricsTable objects, waits for the readers that may
+     * still see them to leave and then deletes them, so that no
+     * reader can fetch a GlyphMetricsPrivate that is recycled.
+     */
+    void
+    clear_dense_metrics_tables(void);
+
+    /* Returns the metrics of a glyph from its dense table if the
+     * metrics are already published; does not lock.
+     */
+    GlyphMetricsPrivate*
+    fetch_published_metrics(const fastuidraw::FontBase *font, uint32_t glyph_code);
+
     /* When the atlas is full, we will clear the atlas, but save
      *  the values in m_glyphs but mark them as not having been
      *  uploaded, this way returned values are safe and we do
@@ -307,10 +823,148 @@ namespace
      */
 
     std::mutex m_glyphs_mutex, m_glyphs_metrics_mutex;
+    std::condition_variable m_glyphs_generated;
+
+    /* frame tracking for LRU eviction; m_active_frames
+     * is protected by m_glyphs_mutex.
+     */
+    std::atomic<unsigned int> m_current_frame;
+    int m_active_frames;
+    std::atomic<unsigned int> m_atlas_size_limit;
+
+    /* number of eviction passes for number_times_atlas_cleared();
+     * it is not reset by GlyphCache::reset_stats() since it must
+     * never go backwards.
+     */
+    std::atomic<unsigned int> m_eviction_generation;
+
+    /* glyphs not used in m_eviction_candidates_frame sorted
+     * in LRU order, the ones before m_next_eviction_candidate
+     * are already evicted; protected by m_glyphs_mutex.
+     */
+    std::vector<EvictionCandidate> m_eviction_candidates;
+    unsigned int m_next_eviction_candidate;
+    unsigned int m_eviction_candidates_frame;
+
+    /* glyphs moved by the last call to compact_atlas(),
+     * protected by m_glyphs_mutex.
+     */
+    std::vector<GlyphDataPrivate*> m_moved_glyphs;
+    std::vector<fastuidraw::Glyph> m_moved_glyphs_return;
+
+    /* glyphs of each pin made by GlyphCache::pin_glyphs() keyed
+     * by the value it returned, protected by m_glyphs_mutex.
+     */
+    std::map<uint64_t, std::vector<PinnedGlyph> > m_pins;
+    uint64_t m_next_pin;
+
+    /* Must be called without m_prefetch_mutex locked; signals
+     * the prefetch threads to stop and waits for them to finish
+     * the job they are working on.
+     */
+    void
+    stop_prefetch_threads(void);
+
+    /* Must be called with m_prefetch_mutex locked */
+    void
+    start_prefetch_threads(void);
+
+    void
+    prefetch_thread_main(void);
+
+    /* threads and queue of prefetch_glyphs(); all but
+     * m_prefetch_thread_count are protected by
+     * m_prefetch_mutex.
+     */
+    std::mutex m_prefetch_mutex;
+    std::condition_variable m_prefetch_condition;
+    std::deque<PrefetchJob*> m_prefetch_jobs;
+    std::vector<std::thread> m_prefetch_threads;
+    bool m_prefetch_stop;
+    std::atomic<unsigned int> m_prefetch_thread_count;
+
+    /* glyph data loaded from and recorded to disk */
+    fastuidraw::detail::GlyphDiskCache m_disk_cache;
+    std::atomic<bool> m_use_disk_cache;
+    std::atomic<bool> m_record_to_disk_cache;
+
+    /* dense per-font metrics tables; all the tables and lists
+     * made since the last clear_dense_metrics_tables() are kept
+     * in m_dense_metrics_tables and m_dense_metrics_lists
+     * (protected by m_glyphs_metrics_mutex) since lists that are
+     * replaced may still be in use by readers. The number of
+     * readers that do not lock is m_dense_metrics_readers, see
+     * DenseMetricsReader.
+     */
+    std::atomic<bool> m_use_dense_metrics;
+    std::atomic<DenseMetricsTableList*> m_dense_metrics;
+    std::atomic<unsigned int> m_dense_metrics_readers;
+    std::vector<DenseMetricsTable*> m_dense_metrics_tables;
+    std::vector<DenseMetricsTableList*> m_dense_metrics_lists;
+
+    /* values of GlyphCache::query_stat(), see increment_stat() */
+    std::atomic<uint64_t> m_stats[fastuidraw::GlyphCache::number_stats];
+
     fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlas> m_atlas;
     Store<glyph_key, GlyphDataPrivate> m_glyphs;
     Store<glyph_metrics_key, GlyphMetricsPrivate> m_glyph_metrics;
     fastuidraw::GlyphCache *m_p;
+
+    /* set to GlyphCache::compute_relocations() which can make
+     * the GlyphAtlasProxy and GlyphAttribute::Array that
+     * GlyphDataPrivate::compute_relocations() needs.
+     */
+    void (*m_compute_relocations)(void *glyph);
+  };
+
+  /* Marks a span in which the dense metrics tables of a
+   * GlyphCachePrivate are read without locking; the tables
+   * fetched in the span may only be used until end() or the
+   * destructor. A DenseMetricsReader must not be active while
+   * m_glyphs_metrics_mutex is locked by the same thread since
+   * clear_dense_metrics_tables() waits for all readers with
+   * that mutex locked.
+   */
+  class DenseMetricsReader:fastuidraw::noncopyable
+  {
+  public:
+    explicit
+    DenseMetricsReader(GlyphCachePrivate *c, bool start_reading = false):
+      m_cache(c),
+      m_active(false)
+    {
+      if (start_reading)
+        {
+          begin();
+        }
+    }
+
+    ~DenseMetricsReader()
+    {
+      end();
+    }
+
+    void
+    begin(void)
+    {
+      FASTUIDRAWassert(!m_active);
+      m_active = true;
+      m_cache->m_dense_metrics_readers.fetch_add(1, std::memory_order_seq_cst);
+    }
+
+    void
+    end(void)
+    {
+      if (m_active)
+        {
+          m_active = false;
+          m_cache->m_dense_metrics_readers.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+  private:
+    GlyphCachePrivate *m_cache;
+    bool m_active;
   };
 }
 
@@ -321,8 +975,17 @@ GlyphDataPrivate(GlyphCachePrivate *c, unsigned int I):
   GlyphAtlasProxyPrivate(c),
   m_cache_location(I),
   m_metrics(nullptr),
+  m_in_flight(false),
+  m_generation(0),
+  m_last_used_frame(0),
+  m_pin_count(0),
   m_uploaded_to_atlas(false),
-  m_glyph_data(nullptr)
+  m_upload_ticket(0),
+  m_relocatable(false),
+  m_relocations_probed(false),
+  m_glyph_data(nullptr),
+  m_disk_entry(nullptr),
+  m_path_pending(false)
 {}
 
 GlyphDataPrivate::
@@ -330,8 +993,17 @@ GlyphDataPrivate(void):
   GlyphAtlasProxyPrivate(nullptr),
   m_cache_location(~0u),
   m_metrics(nullptr),
+  m_in_flight(false),
+  m_generation(0),
+  m_last_used_frame(0),
+  m_pin_count(0),
   m_uploaded_to_atlas(false),
-  m_glyph_data(nullptr)
+  m_upload_ticket(0),
+  m_relocatable(false),
+  m_relocations_probed(false),
+  m_glyph_data(nullptr),
+  m_disk_entry(nullptr),
+  m_path_pending(false)
 {}
 
 GlyphDataPrivate::
@@ -355,7 +1027,29 @@ remove_from_atlas(void)
         }
       m_data_locations.clear();
     }
+  m_total_allocated = 0;
+  m_uploaded_to_atlas = false;
+  m_relocatable = false;
+  m_relocations_probed = false;
+  m_relocations.clear();
+}
+
+void
+GlyphDataPrivate::
+evict_from_atlas(void)
+{
+  FASTUIDRAWassert(m_cache);
+  for (const GlyphDataAlloc &g : m_data_locations)
+    {
+      m_cache->m_atlas->deallocate_data(g.m_location, g.m_size, false);
+    }
+  m_data_locations.clear();
+  m_attributes.clear();
+  m_total_allocated = 0;
   m_uploaded_to_atlas = false;
+  m_relocatable = false;
+  m_relocations_probed = false;
+  m_relocations.clear();
 }
 
 void
@@ -378,6 +1072,22 @@ clear(void)
   m_attributes.clear();
   m_metrics = nullptr;
   m_path.clear();
+  m_disk_entry = nullptr;
+  m_path_pending = false;
+  m_in_flight = false;
+  m_last_used_frame = 0;
+  m_pin_count = 0;
+  ++m_generation;
+}
+
+void
+GlyphDataPrivate::
+mark_used(void)
+{
+  if (m_cache)
+    {
+      m_last_used_frame = m_cache->m_current_frame.load();
+    }
 }
 
 enum fastuidraw::return_code
@@ -388,6 +1098,11 @@ upload_to_atlas(fastuidraw::GlyphMetrics metrics,
 {
   enum fastuidraw::return_code return_value;
 
+  /* mark the glyph as used in the current frame so that
+   * uploading other glyphs of the frame does not evict it.
+   */
+  mark_used();
+
   if (m_uploaded_to_atlas)
     {
       return fastuidraw::routine_success;
@@ -398,29 +1113,39 @@ upload_to_atlas(fastuidraw::GlyphMetrics metrics,
       return fastuidraw::routine_fail;
     }
 
-  FASTUIDRAWassert(m_glyph_data);
   FASTUIDRAWassert(m_attributes.empty());
+  if (m_disk_entry)
+    {
+      return upload_disk_entry_to_atlas(S, T);
+    }
 
   if (!m_glyph_data)
     {
-      m_glyph_data = m_metrics->m_font->compute_rendering_data(m_render, metrics, m_path, m_render_size);
+      /* The glyph lost its backing on the atlas, (for example
+       * from clear_atlas() or eviction) after its rendering data
+       * was released, regenerate it. The callers regenerate such
+       * glyphs without the lock beforehand (see
+       * GlyphCachePrivate::regenerate_evicted()), this is only
+       * reached if the glyph was evicted again meanwhile. The path
+       * of the glyph is already computed, so use a scratch path.
+       */
+      fastuidraw::Path scratch;
+      m_glyph_data = m_cache->compute_rendering_data(m_render, metrics,
+                                                     scratch, m_render_size);
     }
 
+  probe_atlas_locations(S, T);
+
   fastuidraw::c_array<const fastuidraw::c_string> render_cost_labels(m_glyph_data->render_info_labels());
   std::vector<float> tmp(render_cost_labels.size(), 0.0f);
 
   return_value = m_glyph_data->upload_to_atlas(S, T, fastuidraw::make_c_array(tmp));
   if (return_value == fastuidraw::routine_success)
     {
-      m_render_cost_info.resize(render_cost_labels.size() + 1);
-      for (unsigned int i = 0; i < render_cost_labels.size(); ++i)
-        {
-          m_render_cost_info[i].m_label = render_cost_labels[i];
-          m_render_cost_info[i].m_value = tmp[i];
-        }
-      m_render_cost_info.back().m_label = "SizeOnCacheInKB";
-      m_render_cost_info.back().m_value = static_cast<float>(S.total_allocated() * 4) / 1024.0f;
+      set_render_cost_info(render_cost_labels, fastuidraw::make_c_array(tmp));
       m_uploaded_to_atlas = true;
+      m_upload_ticket = m_cache->m_atlas->last_upload_ticket();
+      m_cache->increment_stat(fastuidraw::GlyphCache::num_glyphs_uploaded);
     }
   else
     {
@@ -433,30 +1158,975 @@ upload_to_atlas(fastuidraw::GlyphMetrics metrics,
   return return_value;
 }
 
-/////////////////////////////////////////////////
-// GlyphCachePrivate methods
-GlyphCachePrivate::
-GlyphCachePrivate(fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlas> patlas,
+enum fastuidraw::return_code
+GlyphDataPrivate::
+upload_disk_entry_to_atlas(fastuidraw::GlyphAtlasProxy &S,
+                           fastuidraw::GlyphAttribute::Array &T)
+{
+  const fastuidraw::detail::GlyphDiskCacheEntry *e(m_disk_entry);
+  std::vector<int> locations(e->m_chunks.size());
+  std::vector<float> costs(e->m_render_costs.size());
+
+  for (unsigned int i = 0; i < e->m_chunks.size(); ++i)
+    {
+      locations[i] = S.allocate_data(e->m_chunks[i]);
+      if (locations[i] == -1)
+        {
+          remove_from_atlas();
+          return fastuidraw::routine_fail;
+        }
+    }
+
+  T.resize(e->number_attributes());
+  e->relocated_attributes(fastuidraw::make_c_array(locations),
+                          fastuidraw::make_c_array(m_attributes));
+
+  for (unsigned int i = 0; i < costs.size(); ++i)
+    {
+      costs[i] = fastuidraw::unpack_float(e->m_render_costs[i]);
+    }
+  set_render_cost_info(render_info_labels(m_render.m_type),
+                       fastuidraw::make_c_array(costs));
+  m_uploaded_to_atlas = true;
+  m_upload_ticket = m_cache->m_atlas->last_upload_ticket();
+  m_cache->increment_stat(fastuidraw::GlyphCache::num_glyphs_uploaded);
+  m_relocations.assign(e->m_relocations.begin(), e->m_relocations.end());
+  m_relocatable = true;
+  m_relocations_probed = true;
+
+  return fastuidraw::routine_success;
+}
+
+void
+GlyphDataPrivate::
+probe_atlas_locations(fastuidraw::GlyphAtlasProxy &S,
+                      fastuidraw::GlyphAttribute::Array &T)
+{
+  fastuidraw::detail::GlyphDiskCacheKey key;
+  bool record;
+
+  record = m_cache->m_record_to_disk_cache
+    && m_cache->disk_cache_key(m_metrics->m_font.get(), m_metrics->m_glyph_code,
+                               m_render, &key)
+    && !m_cache->m_disk_cache.contains(key);
+
+  if (!record)
+    {
+      return;
+    }
+
+  fastuidraw::detail::GlyphDiskCacheRecorder recorder;
+  std::vector<float> costs(m_glyph_data->render_info_labels().size(), 0.0f);
+
+  if (probe_passes(S, T, &recorder, fastuidraw::make_c_array(costs)) != fastuidraw::routine_success)
+    {
+      return;
+    }
+
+  /* m_relocatable and m_relocations_probed are reset by
+   * remove_from_atlas() if the upload that follows fails.
+   */
+  m_relocations_probed = true;
+  m_relocatable = (recorder.compute_relocations(&m_relocations) == fastuidraw::routine_success);
+
+  fastuidraw::detail::GlyphDiskCacheMetrics metrics;
+  std::vector<uint32_t> words;
+
+  metrics.m_horizontal_layout_offset = m_metrics->m_horizontal_layout_offset;
+  metrics.m_vertical_layout_offset = m_metrics->m_vertical_layout_offset;
+  metrics.m_size = m_metrics->m_size;
+  metrics.m_advance = m_metrics->m_advance;
+  metrics.m_units_per_EM = m_metrics->m_units_per_EM;
+  if (recorder.pack_entry(key, metrics, m_render_size,
+                          fastuidraw::make_c_array(costs),
+                          &words) == fastuidraw::routine_success)
+    {
+      m_cache->m_disk_cache.add(&words);
+    }
+}
+
+enum fastuidraw::return_code
+GlyphDataPrivate::
+probe_passes(fastuidraw::GlyphAtlasProxy &S,
+             fastuidraw::GlyphAttribute::Array &T,
+             fastuidraw::detail::GlyphDiskCacheRecorder *recorder,
+             fastuidraw::c_array<float> costs)
+{
+  /* upload twice to the recorder to find what attribute
+   * values depend on the location of the data in the atlas.
+   */
+  enum fastuidraw::return_code R(fastuidraw::routine_success);
+
+  m_recorder = recorder;
+  for (unsigned int pass = 0; pass < 2 && R == fastuidraw::routine_success; ++pass)
+    {
+      R = m_glyph_data->upload_to_atlas(S, T, costs);
+      recorder->end_pass(fastuidraw::make_c_array(m_attributes));
+      m_attributes.clear();
+    }
+  m_recorder = nullptr;
+
+  return R;
+}
+
+void
+GlyphDataPrivate::
+compute_relocations(fastuidraw::GlyphMetrics metrics,
+                    fastuidraw::GlyphAtlasProxy &S,
+                    fastuidraw::GlyphAttribute::Array &T)
+{
+  FASTUIDRAWassert(m_uploaded_to_atlas);
+  FASTUIDRAWassert(!m_relocations_probed);
+  FASTUIDRAWassert(!m_glyph_data);
+
+  fastuidraw::Path scratch;
+  fastuidraw::vec2 render_size;
+  std::vector<fastuidraw::GlyphAttribute> attributes;
+  fastuidraw::detail::GlyphDiskCacheRecorder recorder(false);
+
+  m_relocations_probed = true;
+  m_glyph_data = m_cache->compute_rendering_data(m_render, metrics, scratch, render_size);
+
+  std::vector<float> costs(m_glyph_data->render_info_labels().size(), 0.0f);
+
+  /* the probe writes to m_attributes which holds the
+   * attributes of the data on the atlas.
+   */
+  attributes.swap(m_attributes);
+  m_relocatable =
+    probe_passes(S, T, &recorder, fastuidraw::make_c_array(costs)) == fastuidraw::routine_success
+    && recorder.compute_relocations(&m_relocations) == fastuidraw::routine_success;
+  m_attributes.swap(attributes);
+
+  FASTUIDRAWdelete(m_glyph_data);
+  m_glyph_data = nullptr;
+}
+
+void
+GlyphDataPrivate::
+relocate_attributes(fastuidraw::c_array<const int> deltas)
+{
+  FASTUIDRAWassert(m_relocatable);
+  FASTUIDRAWassert(deltas.size() == m_data_locations.size());
+  for (unsigned int i = 0; i + 1 < m_relocations.size(); i += 2)
+    {
+      uint32_t word(m_relocations[i]), chunk(m_relocations[i + 1]);
+
+      FASTUIDRAWassert(word < 4u * m_attributes.size());
+      FASTUIDRAWassert(chunk < deltas.size());
+      m_attributes[word >> 2u].m_data[word & 3u] += static_cast<uint32_t>(deltas[chunk]);
+    }
+}
+
+void
+GlyphDataPrivate::
+set_render_cost_info(fastuidraw::c_array<const fastuidraw::c_string> labels,
+                     fastuidraw::c_array<const float> values)
+{
+  unsigned int cnt(fastuidraw::t_min(labels.size(), values.size()));
+
+  m_render_cost_info.resize(cnt + 1);
+  for (unsigned int i = 0; i < cnt; ++i)
+    {
+      m_render_cost_info[i].m_label = labels[i];
+      m_render_cost_info[i].m_value = values[i];
+    }
+  m_render_cost_info.back().m_label = "SizeOnCacheInKB";
+  m_render_cost_info.back().m_value = static_cast<float>(m_total_allocated * 4) / 1024.0f;
+}
+
+/////////////////////////////////////////////////
+// GlyphCachePrivate methods
+GlyphCachePrivate::
+GlyphCachePrivate(fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlas> patlas,
                   fastuidraw::GlyphCache *p):
+  m_current_frame(1),
+  m_active_frames(0),
+  m_atlas_size_limit(0),
+  m_eviction_generation(0),
+  m_next_eviction_candidate(0),
+  m_eviction_candidates_frame(0),
+  m_next_pin(1),
+  m_use_disk_cache(false),
+  m_record_to_disk_cache(false),
+  m_use_dense_metrics(false),
+  m_dense_metrics(nullptr),
+  m_dense_metrics_readers(0),
   m_atlas(patlas),
-  m_p(p)
-{}
+  m_p(p),
+  m_compute_relocations(nullptr)
+{
+  for (auto &v : m_stats)
+    {
+      v = 0;
+    }
+  m_prefetch_stop = false;
+  m_prefetch_thread_count = fastuidraw::t_max(1u, std::thread::hardware_concurrency()) - 1u;
+  m_prefetch_thread_count = fastuidraw::t_max(1u, m_prefetch_thread_count.load());
+}
 
 GlyphCachePrivate::
 ~GlyphCachePrivate()
 {
-  for(GlyphDataPrivate *p : m_glyphs.data())
-    {
-      p->clear();
-      FASTUIDRAWdelete(p);
-    }
+  /* stop the prefetch threads before anything else since
+   * they generate glyphs through m_p; the queued jobs are
+   * cancelled.
+   */
+  stop_prefetch_threads();
+  for (PrefetchJob *job : m_prefetch_jobs)
+    {
+      job->complete(true);
+      FASTUIDRAWdelete(job);
+    }
+  m_prefetch_jobs.clear();
+
+  for(GlyphDataPrivate *p : m_glyphs.data())
+    {
+      p->clear();
+      FASTUIDRAWdelete(p);
+    }
+
+  for(GlyphMetricsPrivate *p : m_glyph_metrics.data())
+    {
+      FASTUIDRAWdelete(p);
+    }
+
+  for (DenseMetricsTable *p : m_dense_metrics_tables)
+    {
+      FASTUIDRAWdelete(p);
+    }
+
+  for (DenseMetricsTableList *p : m_dense_metrics_lists)
+    {
+      FASTUIDRAWdelete(p);
+    }
+}
+
+GlyphDataPrivate*
+GlyphCachePrivate::
+fetch_or_claim(const glyph_key &key, fastuidraw::GlyphMetrics metrics,
+               GlyphMetricsPrivate *metrics_private,
+               std::vector<ClaimedGlyph> *claimed)
+{
+  GlyphDataPrivate *q;
+
+  q = m_glyphs.fetch_or_allocate(this, key);
+  if (q->m_render.valid())
+    {
+      increment_stat(fastuidraw::GlyphCache::num_glyph_hits);
+    }
+  else
+    {
+      fastuidraw::detail::GlyphDiskCacheKey disk_key;
+
+      increment_stat(fastuidraw::GlyphCache::num_glyph_misses);
+      q->m_render = key.m_render;
+      q->m_metrics = metrics_private;
+      if (disk_cache_key(key.m_font, key.m_glyph_code, key.m_render, &disk_key))
+        {
+          q->m_disk_entry = m_disk_cache.fetch(disk_key);
+          if (q->m_disk_entry)
+            {
+              /* the path of the glyph is computed on demand
+               * by Glyph::path().
+               */
+              q->m_render_size = q->m_disk_entry->m_render_size;
+              q->m_path_pending = true;
+              increment_stat(fastuidraw::GlyphCache::num_disk_cache_hits);
+              return q;
+            }
+        }
+
+      q->m_in_flight = true;
+      FASTUIDRAWassert(!q->m_glyph_data);
+      claimed->push_back(ClaimedGlyph(q, metrics));
+    }
+  return q;
+}
+
+void
+GlyphCachePrivate::
+generate_claimed(std::unique_lock<std::mutex> &lock,
+                 fastuidraw::c_array<ClaimedGlyph> claimed)
+{
+  if (claimed.empty())
+    {
+      return;
+    }
+
+  /* The expensive part, computing the rendering data, is
+   * done without holding m_glyphs_mutex so that different
+   * glyphs can be generated in parallel by different threads.
+   * The ClaimedGlyph values only hold data that the cache
+   * does not modify while the glyph is in-flight.
+   */
+  std::vector<fastuidraw::Path> paths(claimed.size());
+
+  lock.unlock();
+  for (unsigned int i = 0; i < claimed.size(); ++i)
+    {
+      ClaimedGlyph &g(claimed[i]);
+      g.m_glyph_data = compute_rendering_data(g.m_render, g.m_metrics,
+                                              paths[i], g.m_render_size);
+    }
+  lock.lock();
+
+  for (unsigned int i = 0; i < claimed.size(); ++i)
+    {
+      ClaimedGlyph &g(claimed[i]);
+      GlyphDataPrivate *q(g.m_glyph);
+
+      if (q->m_generation == g.m_generation)
+        {
+          FASTUIDRAWassert(q->m_in_flight);
+          FASTUIDRAWassert(!q->m_glyph_data);
+          q->m_glyph_data = g.m_glyph_data;
+          if (!g.m_regenerate)
+            {
+              /* a regenerated glyph keeps its path since
+               * other threads may be reading it.
+               */
+              q->m_path.swap(paths[i]);
+              q->m_render_size = g.m_render_size;
+            }
+          q->m_in_flight = false;
+        }
+      else if (g.m_glyph_data)
+        {
+          /* the glyph was removed from the cache while
+           * it was being generated, discard the data.
+           */
+          FASTUIDRAWdelete(g.m_glyph_data);
+        }
+    }
+  m_glyphs_generated.notify_all();
+}
+
+bool
+GlyphCachePrivate::
+claim_for_upload(GlyphDataPrivate *q, fastuidraw::GlyphMetrics metrics,
+                 std::vector<ClaimedGlyph> *claimed)
+{
+  if (q->m_in_flight)
+    {
+      return true;
+    }
+
+  if (!q->m_render.valid()
+      || q->m_uploaded_to_atlas
+      || q->m_disk_entry
+      || q->m_glyph_data)
+    {
+      return false;
+    }
+
+  q->m_in_flight = true;
+  claimed->push_back(ClaimedGlyph(q, metrics, true));
+  return true;
+}
+
+void
+GlyphCachePrivate::
+regenerate_evicted(std::unique_lock<std::mutex> &lock,
+                   fastuidraw::c_array<GlyphDataPrivate*> glyphs,
+                   fastuidraw::c_array<const unsigned int> generations,
+                   fastuidraw::c_array<const fastuidraw::GlyphMetrics> metrics)
+{
+  std::vector<ClaimedGlyph> claimed;
+  bool wait(false);
+
+  FASTUIDRAWassert(glyphs.size() == generations.size());
+  FASTUIDRAWassert(glyphs.size() == metrics.size());
+  for (unsigned int i = 0; i < glyphs.size(); ++i)
+    {
+      if (glyphs[i] && claim_for_upload(glyphs[i], metrics[i], &claimed))
+        {
+          wait = true;
+        }
+    }
+
+  if (!wait)
+    {
+      return;
+    }
+
+  increment_stat(fastuidraw::GlyphCache::num_glyphs_regenerated, claimed.size());
+  generate_claimed(lock, fastuidraw::make_c_array(claimed));
+  for (unsigned int i = 0; i < glyphs.size(); ++i)
+    {
+      if (glyphs[i])
+        {
+          wait_until_generated(lock, glyphs[i]);
+        }
+    }
+
+  for (unsigned int i = 0; i < glyphs.size(); ++i)
+    {
+      if (glyphs[i] && glyphs[i]->m_generation != generations[i])
+        {
+          glyphs[i] = nullptr;
+        }
+    }
+}
+
+void
+GlyphCachePrivate::
+stop_prefetch_threads(void)
+{
+  std::vector<std::thread> threads;
+
+  {
+    std::lock_guard<std::mutex> M(m_prefetch_mutex);
+    m_prefetch_stop = true;
+    m_prefetch_condition.notify_all();
+    threads.swap(m_prefetch_threads);
+  }
+
+  for (std::thread &t : threads)
+    {
+      t.join();
+    }
+
+  std::lock_guard<std::mutex> M(m_prefetch_mutex);
+  m_prefetch_stop = false;
+}
+
+void
+GlyphCachePrivate::
+start_prefetch_threads(void)
+{
+  while (m_prefetch_threads.size() < m_prefetch_thread_count)
+    {
+      m_prefetch_threads.push_back(std::thread(&GlyphCachePrivate::prefetch_thread_main, this));
+    }
+}
+
+void
+GlyphCachePrivate::
+prefetch_thread_main(void)
+{
+  std::unique_lock<std::mutex> lock(m_prefetch_mutex);
+  std::vector<fastuidraw::Glyph> glyphs;
+
+  for (;;)
+    {
+      PrefetchJob *job;
+
+      m_prefetch_condition.wait(lock, [this]()
+                                {
+                                  return m_prefetch_stop || !m_prefetch_jobs.empty();
+                                });
+      if (m_prefetch_stop)
+        {
+          return;
+        }
+
+      job = m_prefetch_jobs.front();
+      m_prefetch_jobs.pop_front();
+      lock.unlock();
+
+      fastuidraw::c_array<const fastuidraw::GlyphSource> sources;
+
+      sources = fastuidraw::make_c_array(job->m_sources);
+      glyphs.resize(sources.size());
+      m_p->fetch_glyphs(job->m_render, sources,
+                        fastuidraw::make_c_array(glyphs),
+                        false);
+      glyphs.clear();
+
+      job->m_ticket_private->m_number_glyphs_generated += job->m_sources.size();
+      job->complete(false);
+      FASTUIDRAWdelete(job);
+
+      lock.lock();
+    }
+}
+
+bool
+GlyphCachePrivate::
+disk_cache_key(const fastuidraw::FontBase *font, uint32_t glyph_code,
+               fastuidraw::GlyphRenderer render,
+               fastuidraw::detail::GlyphDiskCacheKey *out_key)
+{
+  uint64_t hash;
+
+  if (!m_use_disk_cache && !m_record_to_disk_cache)
+    {
+      return false;
+    }
+
+  hash = font->content_hash();
+  if (hash == 0u)
+    {
+      return false;
+    }
+
+  *out_key = fastuidraw::detail::GlyphDiskCacheKey(hash, font->face_index(),
+                                                   glyph_code, render);
+  return true;
+}
+
+bool
+GlyphCachePrivate::
+fetch_metrics_from_disk_cache(const fastuidraw::FontBase *font,
+                              uint32_t glyph_code,
+                              GlyphMetricsPrivate *p)
+{
+  const fastuidraw::detail::GlyphDiskCacheEntry *e;
+  uint64_t hash;
+
+  if (!m_use_disk_cache)
+    {
+      return false;
+    }
+
+  hash = font->content_hash();
+  if (hash == 0u)
+    {
+      return false;
+    }
+
+  e = m_disk_cache.fetch_metrics(hash, font->face_index(), glyph_code);
+  if (!e)
+    {
+      return false;
+    }
+
+  p->m_horizontal_layout_offset = e->m_metrics.m_horizontal_layout_offset;
+  p->m_vertical_layout_offset = e->m_metrics.m_vertical_layout_offset;
+  p->m_size = e->m_metrics.m_size;
+  p->m_advance = e->m_metrics.m_advance;
+  p->m_units_per_EM = e->m_metrics.m_units_per_EM;
+  return true;
+}
+
+fastuidraw::GlyphRenderData*
+GlyphCachePrivate::
+compute_rendering_data(fastuidraw::GlyphRenderer render,
+                       fastuidraw::GlyphMetrics metrics,
+                       fastuidraw::Path &path,
+                       fastuidraw::vec2 &render_size)
+{
+  std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+  fastuidraw::GlyphRenderData *return_value;
+  uint64_t ns;
+
+  return_value = metrics.font()->compute_rendering_data(render, metrics, path, render_size);
+  ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+  /* the stats of the glyph types are in the same
+   * order as the enumeration glyph_type.
+   */
+  if (render.m_type <= fastuidraw::banded_rays_glyph)
+    {
+      increment_stat(static_cast<enum fastuidraw::GlyphCache::stats_t>(fastuidraw::GlyphCache::num_coverage_glyphs_generated + render.m_type));
+      increment_stat(static_cast<enum fastuidraw::GlyphCache::stats_t>(fastuidraw::GlyphCache::coverage_generation_ns + render.m_type), ns);
+    }
+  return return_value;
+}
+
+GlyphMetricsPrivate*
+GlyphCachePrivate::
+fetch_metrics(const fastuidraw::FontBase *font, uint32_t glyph_code,
+              DenseMetricsTable *table)
+{
+  GlyphMetricsPrivate *p;
+
+  p = m_glyph_metrics.fetch_or_allocate(this, glyph_metrics_key(font, glyph_code));
+  increment_stat((p->m_ready) ?
+                 fastuidraw::GlyphCache::num_metrics_hits :
+                 fastuidraw::GlyphCache::num_metrics_misses);
+  if (!p->m_ready)
+    {
+      p->m_font = font;
+      p->m_glyph_code = glyph_code;
+      if (fetch_metrics_from_disk_cache(font, glyph_code, p))
+        {
+          metrics_ready(p, table);
+        }
+    }
+  else if (table)
+    {
+      table->publish(glyph_code, p);
+    }
+  return p;
+}
+
+DenseMetricsTable*
+GlyphCachePrivate::
+fetch_or_create_dense_metrics_table(const fastuidraw::FontBase *font)
+{
+  DenseMetricsTable *table;
+  DenseMetricsTableList *list, *prev_list;
+
+  table = dense_metrics_table(font);
+  if (table)
+    {
+      return table;
+    }
+
+  table = FASTUIDRAWnew DenseMetricsTable(font);
+  m_dense_metrics_tables.push_back(table);
+
+  list = FASTUIDRAWnew DenseMetricsTableList();
+  m_dense_metrics_lists.push_back(list);
+
+  prev_list = m_dense_metrics.load(std::memory_order_relaxed);
+  if (prev_list)
+    {
+      list->m_tables = prev_list->m_tables;
+    }
+  list->m_tables.insert(std::upper_bound(list->m_tables.begin(), list->m_tables.end(), table,
+                                         [](const DenseMetricsTable *a, const DenseMetricsTable *b)
+                                         {
+                                           return a->m_key < b->m_key;
+                                         }),
+                        table);
+  m_dense_metrics.store(list, std::memory_order_release);
+
+  return table;
+}
+
+void
+GlyphCachePrivate::
+clear_dense_metrics_tables(void)
+{
+  /* A reader increments m_dense_metrics_readers before it loads
+   * m_dense_metrics; since both sides use sequentially consistent
+   * operations, once the count is seen as zero after storing
+   * nullptr, every reader that comes afterwards sees nullptr and
+   * no reader can hold one of the tables anymore.
+   */
+  m_dense_metrics.store(nullptr, std::memory_order_seq_cst);
+  while (m_dense_metrics_readers.load(std::memory_order_seq_cst) != 0)
+    {
+      std::this_thread::yield();
+    }
+
+  for (DenseMetricsTable *p : m_dense_metrics_tables)
+    {
+      FASTUIDRAWdelete(p);
+    }
+  m_dense_metrics_tables.clear();
+
+  for (DenseMetricsTableList *p : m_dense_metrics_lists)
+    {
+      FASTUIDRAWdelete(p);
+    }
+  m_dense_metrics_lists.clear();
+}
+
+GlyphMetricsPrivate*
+GlyphCachePrivate::
+fetch_published_metrics(const fastuidraw::FontBase *font, uint32_t glyph_code)
+{
+  DenseMetricsReader R(this, true);
+  DenseMetricsTable *table;
+
+  table = dense_metrics_table(font);
+  return (table) ? table->fetch(glyph_code) : nullptr;
+}
+
+int
+GlyphCachePrivate::
+allocate_data(fastuidraw::c_array<const uint32_t> pdata)
+{
+  unsigned int limit(m_atlas_size_limit);
+  int L;
+
+  if (limit == 0 || m_atlas->store()->size() < limit)
+    {
+      return m_atlas->allocate_data(pdata);
+    }
+
+  L = m_atlas->allocate_data(pdata, false);
+  if (L == -1)
+    {
+      L = evict_and_allocate(pdata);
+    }
+  return L;
+}
+
+int
+GlyphCachePrivate::
+evict_and_allocate(fastuidraw::c_array<const uint32_t> pdata)
+{
+  unsigned int current_frame(m_current_frame);
+  bool evicted(false);
+
+  /* Between frames, first try to make room by compacting the atlas;
+   * a compaction moves glyphs instead of forcing them to be
+   * generated and uploaded again.
+   */
+  if (m_active_frames == 0
+      && m_atlas->store()->size() - m_atlas->data_allocated() >= pdata.size()
+      && compact_atlas() == fastuidraw::routine_success)
+    {
+      int L;
+
+      L = m_atlas->allocate_data(pdata, false);
+      if (L != -1)
+        {
+          return L;
+        }
+    }
+
+  /* glyphs used after the candidates were sorted are used in
+   * the current frame, so the sorted candidates stay valid
+   * until the frame changes.
+   */
+  if (m_eviction_candidates_frame != current_frame)
+    {
+      m_eviction_candidates.clear();
+      m_next_eviction_candidate = 0;
+      m_eviction_candidates_frame = current_frame;
+      for (GlyphDataPrivate *g : m_glyphs.data())
+        {
+          if (g->m_render.valid()
+              && !g->m_data_locations.empty()
+              && g->m_last_used_frame != current_frame
+              && g->m_pin_count == 0)
+            {
+              m_eviction_candidates.push_back(EvictionCandidate(g));
+            }
+        }
+
+      std::sort(m_eviction_candidates.begin(), m_eviction_candidates.end(),
+                [](const EvictionCandidate &a, const EvictionCandidate &b)
+                {
+                  return a.m_glyph->m_last_used_frame < b.m_glyph->m_last_used_frame;
+                });
+    }
+
+  while (m_next_eviction_candidate < m_eviction_candidates.size())
+    {
+      const EvictionCandidate &C(m_eviction_candidates[m_next_eviction_candidate++]);
+      GlyphDataPrivate *g(C.m_glyph);
+      int L;
+
+      /* skip glyphs removed, cleared from the atlas, used
+       * or pinned since the candidates were sorted.
+       */
+      if (g->m_generation != C.m_generation
+          || !g->m_render.valid()
+          || g->m_data_locations.empty()
+          || g->m_last_used_frame == current_frame
+          || g->m_pin_count != 0)
+        {
+          continue;
+        }
+
+      if (!evicted)
+        {
+          /* evicting changes the location of glyph data, which
+           * is seen by number_times_atlas_cleared(); so only
+           * count a pass when a glyph is actually evicted.
+           */
+          evicted = true;
+          ++m_eviction_generation;
+          increment_stat(fastuidraw::GlyphCache::num_eviction_passes);
+        }
+
+      increment_stat(fastuidraw::GlyphCache::num_data_evicted, g->m_total_allocated);
+      increment_stat(fastuidraw::GlyphCache::num_glyphs_evicted);
+      g->evict_from_atlas();
+
+      L = m_atlas->allocate_data(pdata, false);
+      if (L != -1)
+        {
+          return L;
+        }
+    }
+
+  /* everything left is used in the current frame or pinned, grow the atlas */
+  return m_atlas->allocate_data(pdata);
+}
+
+enum fastuidraw::return_code
+GlyphCachePrivate::
+compact_atlas(void)
+{
+  std::vector<fastuidraw::range_type<int> > regions;
+  std::vector<int> locations, deltas;
+  std::vector<GlyphDataPrivate*> glyphs;
+  int lowest_free;
+
+  if (!m_atlas->store()->can_copy_values())
+    {
+      return fastuidraw::routine_fail;
+    }
+
+  /* the data of pinned glyphs and of glyphs that are not
+   * relocatable is not passed to GlyphAtlas::compact() which
+   * then keeps it where it is. The relocations of a glyph are
+   * only computed if its data is not before lowest_free, since
+   * otherwise the compaction would not move it anyways.
+   */
+  lowest_free = m_atlas->lowest_free_location();
+  for (GlyphDataPrivate *g : m_glyphs.data())
+    {
+      if (!g->m_uploaded_to_atlas || g->m_data_locations.empty()
+          || g->m_pin_count != 0)
+        {
+          continue;
+        }
+
+      if (!g->m_relocations_probed && g->m_glyph_data == nullptr)
+        {
+          bool may_move(false);
+
+          for (const GlyphDataAlloc &A : g->m_data_locations)
+            {
+              may_move = may_move || A.m_location >= lowest_free;
+            }
+
+          if (may_move)
+            {
+              m_compute_relocations(g);
+            }
+        }
+
+      if (g->m_relocatable)
+        {
+          glyphs.push_back(g);
+          for (const GlyphDataAlloc &A : g->m_data_locations)
+            {
+              regions.push_back(fastuidraw::range_type<int>(A.m_location, A.m_location + A.m_size));
+            }
+        }
+    }
+
+  locations.resize(regions.size());
+  if (m_atlas->compact(fastuidraw::make_c_array(regions),
+                       fastuidraw::make_c_array(locations)) == fastuidraw::routine_fail)
+    {
+      return fastuidraw::routine_fail;
+    }
+
+  unsigned int r(0);
+
+  m_moved_glyphs.clear();
+  for (GlyphDataPrivate *g : glyphs)
+    {
+      bool moved(false);
+
+      deltas.resize(g->m_data_locations.size());
+      for (unsigned int i = 0; i < deltas.size(); ++i, ++r)
+        {
+          deltas[i] = locations[r] - g->m_data_locations[i].m_location;
+          g->m_data_locations[i].m_location = locations[r];
+          moved = moved || (deltas[i] != 0);
+        }
+
+      if (moved)
+        {
+          g->relocate_attributes(fastuidraw::make_c_array(deltas));
+          m_moved_glyphs.push_back(g);
+        }
+    }
+
+  if (!m_moved_glyphs.empty())
+    {
+      increment_stat(fastuidraw::GlyphCache::num_atlas_compactions);
+    }
+
+  return fastuidraw::routine_success;
+}
+
+//////////////////////////////////////////////
+// PrefetchJob methods
+void
+PrefetchJob::
+complete(bool cancelled)
+{
+  bool last_job;
 
-  for(GlyphMetricsPrivate *p : m_glyph_metrics.data())
+  {
+    std::lock_guard<std::mutex> M(m_ticket_private->m_mutex);
+
+    FASTUIDRAWassert(m_ticket_private->m_remaining_jobs > 0);
+    --m_ticket_private->m_remaining_jobs;
+    m_ticket_private->m_cancelled = m_ticket_private->m_cancelled || cancelled;
+    last_job = (m_ticket_private->m_remaining_jobs == 0);
+    if (last_job)
+      {
+        m_ticket_private->m_done_condition.notify_all();
+      }
+  }
+
+  if (last_job && m_ticket_private->m_callback)
     {
-      FASTUIDRAWdelete(p);
+      m_ticket_private->m_callback->on_prefetch_complete(*m_ticket);
     }
 }
 
+//////////////////////////////////////////////
+// fastuidraw::GlyphCache::PrefetchTicket methods
+fastuidraw::GlyphCache::PrefetchTicket::
+PrefetchTicket(void *d):
+  m_d(d)
+{}
+
+fastuidraw::GlyphCache::PrefetchTicket::
+~PrefetchTicket()
+{
+  PrefetchTicketPrivate *d;
+  d = static_cast<PrefetchTicketPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+bool
+fastuidraw::GlyphCache::PrefetchTicket::
+done(void) const
+{
+  PrefetchTicketPrivate *d;
+  d = static_cast<PrefetchTicketPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> M(d->m_mutex);
+  return d->m_remaining_jobs == 0;
+}
+
+bool
+fastuidraw::GlyphCache::PrefetchTicket::
+cancelled(void) const
+{
+  PrefetchTicketPrivate *d;
+  d = static_cast<PrefetchTicketPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> M(d->m_mutex);
+  return d->m_cancelled;
+}
+
+void
+fastuidraw::GlyphCache::PrefetchTicket::
+wait(void) const
+{
+  PrefetchTicketPrivate *d;
+  d = static_cast<PrefetchTicketPrivate*>(m_d);
+
+  std::unique_lock<std::mutex> M(d->m_mutex);
+  d->m_done_condition.wait(M, [d]() { return d->m_remaining_jobs == 0; });
+}
+
+unsigned int
+fastuidraw::GlyphCache::PrefetchTicket::
+number_glyphs(void) const
+{
+  PrefetchTicketPrivate *d;
+  d = static_cast<PrefetchTicketPrivate*>(m_d);
+  return d->m_number_glyphs;
+}
+
+unsigned int
+fastuidraw::GlyphCache::PrefetchTicket::
+number_glyphs_generated(void) const
+{
+  PrefetchTicketPrivate *d;
+  d = static_cast<PrefetchTicketPrivate*>(m_d);
+  return d->m_number_glyphs_generated;
+}
+
 //////////////////////////////////////////////
 // fastuidraw::GlyphAtlasProxy methods
 int
@@ -467,7 +2137,12 @@ allocate_data(c_array<const uint32_t> pdata)
   GlyphAtlasProxyPrivate *d;
 
   d = static_cast<GlyphAtlasProxyPrivate*>(m_d);
-  L = d->m_cache->m_atlas->allocate_data(pdata);
+  if (d->m_recorder)
+    {
+      return d->m_recorder->allocate_data(pdata);
+    }
+
+  L = d->m_cache->allocate_data(pdata);
   if (L != -1)
     {
       GlyphDataAlloc A;
@@ -620,10 +2295,27 @@ upload_to_atlas(void) const
       return routine_fail;
     }
 
-  std::lock_guard<std::mutex> m(p->m_cache->m_glyphs_mutex);
+  std::unique_lock<std::mutex> m(p->m_cache->m_glyphs_mutex);
+  GlyphDataPrivate *q(p);
+  unsigned int generation(p->m_generation);
+  GlyphMetrics glyph_metrics(p->m_metrics);
+
+  /* the data of a glyph evicted from the atlas is generated
+   * again without holding the lock.
+   */
+  p->mark_used();
+  p->m_cache->regenerate_evicted(m, c_array<GlyphDataPrivate*>(&q, 1),
+                                 c_array<const unsigned int>(&generation, 1),
+                                 c_array<const GlyphMetrics>(&glyph_metrics, 1));
+  if (!q)
+    {
+      /* removed from the cache while the lock was released */
+      return routine_fail;
+    }
+
   GlyphAtlasProxy S(p);
   GlyphAttribute::Array T(&p->m_attributes);
-  return p->upload_to_atlas(metrics(), S, T);
+  return p->upload_to_atlas(glyph_metrics, S, T);
 }
 
 bool
@@ -637,6 +2329,18 @@ uploaded_to_atlas(void) const
   return p->m_uploaded_to_atlas;
 }
 
+bool
+fastuidraw::Glyph::
+resident(void) const
+{
+  GlyphDataPrivate *p;
+
+  p = static_cast<GlyphDataPrivate*>(m_opaque);
+  FASTUIDRAWassert(p != nullptr && p->m_render.valid());
+  return p->m_uploaded_to_atlas
+    && p->m_cache->m_atlas->upload_resident(p->m_upload_ticket);
+}
+
 const fastuidraw::Path&
 fastuidraw::Glyph::
 path(void) const
@@ -644,6 +2348,25 @@ path(void) const
   GlyphDataPrivate *p;
   p = static_cast<GlyphDataPrivate*>(m_opaque);
   FASTUIDRAWassert(p != nullptr && p->m_render.valid());
+  if (p->m_path_pending)
+    {
+      /* the glyph data came from the disk cache which does
+       * not store the path; generate only the path, without
+       * holding the lock, and then store it unless another
+       * thread did so first.
+       */
+      GlyphMetrics metrics(p->m_metrics);
+      Path path;
+
+      metrics.font()->compute_path(p->m_render, metrics, path);
+
+      std::lock_guard<std::mutex> m(p->m_cache->m_glyphs_mutex);
+      if (p->m_path_pending)
+        {
+          p->m_path.swap(path);
+          p->m_path_pending = false;
+        }
+    }
   return p->m_path;
 }
 
@@ -729,7 +2452,11 @@ set_implement(fastuidraw::GlyphMetricsValue, GlyphMetricsPrivate, float, units_p
 fastuidraw::GlyphCache::
 GlyphCache(reference_counted_ptr<GlyphAtlas> patlas)
 {
-  m_d = FASTUIDRAWnew GlyphCachePrivate(patlas, this);
+  GlyphCachePrivate *d;
+
+  d = FASTUIDRAWnew GlyphCachePrivate(patlas, this);
+  d->m_compute_relocations = &compute_relocations;
+  m_d = d;
 }
 
 fastuidraw::GlyphCache::
@@ -751,20 +2478,32 @@ fetch_glyph_metrics(const FontBase *font, uint32_t glyph_code)
     }
 
   GlyphCachePrivate *d;
-  GlyphMetricsPrivate *p;
+  GlyphMetricsPrivate *p(nullptr);
+  DenseMetricsTable *table(nullptr);
 
   d = static_cast<GlyphCachePrivate*>(m_d);
-  glyph_metrics_key K(glyph_code, font);
+  if (d->m_use_dense_metrics)
+    {
+      p = d->fetch_published_metrics(font, glyph_code);
+    }
+
+  if (p)
+    {
+      d->increment_stat(num_metrics_hits);
+      return GlyphMetrics(p);
+    }
 
   std::lock_guard<std::mutex> m(d->m_glyphs_metrics_mutex);
-  p = d->m_glyph_metrics.fetch_or_allocate(d, K);
+  if (d->m_use_dense_metrics)
+    {
+      table = d->fetch_or_create_dense_metrics_table(font);
+    }
+  p = d->fetch_metrics(font, glyph_code, table);
   if (!p->m_ready)
     {
       GlyphMetricsValue v(p);
-      p->m_font = font;
-      p->m_glyph_code = glyph_code;
       font->compute_metrics(glyph_code, v);
-      p->m_ready = true;
+      d->metrics_ready(p, table);
     }
   return GlyphMetrics(p);
 }
@@ -785,25 +2524,81 @@ fetch_glyph_metrics(const FontBase *font,
     }
 
   unsigned int num_glyphs_of_font(font->number_glyphs());
+  unsigned int num_missing(glyph_codes.size());
+  DenseMetricsTable *table(nullptr);
+  DenseMetricsReader R(d);
+
+  /* first take without locking those metrics already
+   * published in the dense table of the font.
+   */
+  if (d->m_use_dense_metrics)
+    {
+      R.begin();
+      table = d->dense_metrics_table(font);
+    }
+
+  if (table)
+    {
+      unsigned int num_hits(0);
+
+      num_missing = 0;
+      for (unsigned int i = 0; i < glyph_codes.size(); ++i)
+        {
+          GlyphMetricsPrivate *p;
+
+          p = (glyph_codes[i] < num_glyphs_of_font) ?
+            table->fetch(glyph_codes[i]) :
+            nullptr;
+
+          out_metrics[i] = GlyphMetrics(p);
+          if (p)
+            {
+              ++num_hits;
+            }
+          else if (glyph_codes[i] < num_glyphs_of_font)
+            {
+              ++num_missing;
+            }
+        }
+      d->increment_stat(num_metrics_hits, num_hits);
+    }
+
+  else
+    {
+      std::fill(out_metrics.begin(), out_metrics.end(), GlyphMetrics());
+    }
+
+  /* the reader must end before locking since clear_cache()
+   * waits for the readers with the mutex locked.
+   */
+  R.end();
+  if (num_missing == 0)
+    {
+      return;
+    }
+
   std::lock_guard<std::mutex> m(d->m_glyphs_metrics_mutex);
+  table = (d->m_use_dense_metrics) ?
+    d->fetch_or_create_dense_metrics_table(font) :
+    nullptr;
 
   for (unsigned int i = 0; i < glyph_codes.size(); ++i)
     {
       if (glyph_codes[i] < num_glyphs_of_font)
         {
-          GlyphMetricsPrivate *p;
-          glyph_metrics_key K(glyph_codes[i], font);
-
-          p = d->m_glyph_metrics.fetch_or_allocate(d, K);
-          if (!p->m_ready)
+          if (!out_metrics[i].valid())
             {
-              GlyphMetricsValue v(p);
-              p->m_font = font;
-              p->m_glyph_code = glyph_codes[i];
-              font->compute_metrics(glyph_codes[i], v);
-              p->m_ready = true;
+              GlyphMetricsPrivate *p;
+
+              p = d->fetch_metrics(font, glyph_codes[i], table);
+              if (!p->m_ready)
+                {
+                  GlyphMetricsValue v(p);
+                  font->compute_metrics(glyph_codes[i], v);
+                  d->metrics_ready(p, table);
+                }
+              out_metrics[i] = GlyphMetrics(p);
             }
-          out_metrics[i] = GlyphMetrics(p);
         }
       else
         {
@@ -818,29 +2613,85 @@ fetch_glyph_metrics(c_array<const GlyphSource> glyph_sources,
                     c_array<GlyphMetrics> out_metrics)
 {
   GlyphCachePrivate *d;
+  const FontBase *prev_font(nullptr);
+  DenseMetricsTable *table(nullptr);
+  bool have_missing(false);
+
   d = static_cast<GlyphCachePrivate*>(m_d);
-  std::lock_guard<std::mutex> m(d->m_glyphs_metrics_mutex);
+
+  /* first take without locking those metrics already
+   * published in the dense table of their font.
+   */
+  unsigned int num_hits(0);
+  bool use_dense_metrics(d->m_use_dense_metrics);
+  DenseMetricsReader R(d);
+  if (use_dense_metrics)
+    {
+      R.begin();
+    }
 
   for (unsigned int i = 0; i < glyph_sources.size(); ++i)
     {
-      GlyphMetricsPrivate *p;
+      const FontBase *font(glyph_sources[i].m_font);
+      GlyphMetricsPrivate *p(nullptr);
 
-      if (glyph_sources[i].m_font)
+      if (font && use_dense_metrics)
         {
-          glyph_metrics_key K(glyph_sources[i]);
-          p = d->m_glyph_metrics.fetch_or_allocate(d, K);
-          if (!p->m_ready)
+          if (font != prev_font)
+            {
+              table = d->dense_metrics_table(font);
+              prev_font = font;
+            }
+
+          if (table && glyph_sources[i].m_glyph_code < font->number_glyphs())
             {
-              GlyphMetricsValue v(p);
-              p->m_font = glyph_sources[i].m_font;
-              p->m_glyph_code = glyph_sources[i].m_glyph_code;
-              glyph_sources[i].m_font->compute_metrics(glyph_sources[i].m_glyph_code, v);
-              p->m_ready = true;
+              p = table->fetch(glyph_sources[i].m_glyph_code);
             }
         }
-      else
+
+      out_metrics[i] = GlyphMetrics(p);
+      have_missing = have_missing || (font && !p);
+      num_hits += (p) ? 1 : 0;
+    }
+  d->increment_stat(num_metrics_hits, num_hits);
+  R.end();
+
+  if (!have_missing)
+    {
+      return;
+    }
+
+  std::lock_guard<std::mutex> m(d->m_glyphs_metrics_mutex);
+  prev_font = nullptr;
+  table = nullptr;
+  for (unsigned int i = 0; i < glyph_sources.size(); ++i)
+    {
+      const FontBase *font(glyph_sources[i].m_font);
+      uint32_t glyph_code(glyph_sources[i].m_glyph_code);
+      DenseMetricsTable *glyph_table;
+      GlyphMetricsPrivate *p;
+
+      if (!font || out_metrics[i].valid())
+        {
+          continue;
+        }
+
+      if (font != prev_font)
+        {
+          table = (d->m_use_dense_metrics) ?
+            d->fetch_or_create_dense_metrics_table(font) :
+            nullptr;
+          prev_font = font;
+        }
+
+      /* glyph codes beyond the font do not have a slot */
+      glyph_table = (glyph_code < font->number_glyphs()) ? table : nullptr;
+      p = d->fetch_metrics(font, glyph_code, glyph_table);
+      if (!p->m_ready)
         {
-          p = nullptr;
+          GlyphMetricsValue v(p);
+          font->compute_metrics(glyph_code, v);
+          d->metrics_ready(p, glyph_table);
         }
       out_metrics[i] = GlyphMetrics(p);
     }
@@ -862,109 +2713,269 @@ fetch_glyph(GlyphRenderer render, const FontBase *font,
   d = static_cast<GlyphCachePrivate*>(m_d);
 
   GlyphDataPrivate *q;
+  unsigned int generation;
   glyph_key src(font, glyph_code, render);
+  GlyphMetrics metrics(fetch_glyph_metrics(font, glyph_code));
+  std::vector<ClaimedGlyph> claimed;
+
+  std::unique_lock<std::mutex> m(d->m_glyphs_mutex);
+  q = d->fetch_or_claim(src, metrics,
+                        static_cast<GlyphMetricsPrivate*>(metrics.m_d),
+                        &claimed);
+  generation = q->m_generation;
+  d->generate_claimed(m, make_c_array(claimed));
+  d->wait_until_generated(m, q);
+
+  if (q->m_generation != generation)
+    {
+      /* another thread removed the glyph from the cache while
+       * m_glyphs_mutex was released and its slot may now hold
+       * a different glyph; the metrics may have been removed
+       * too, so start over.
+       */
+      m.unlock();
+      return fetch_glyph(render, font, glyph_code, upload_to_atlas);
+    }
+  q->mark_used();
 
-  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
-  q = d->m_glyphs.fetch_or_allocate(d, src);
+  if (upload_to_atlas)
+    {
+      /* the data of a glyph evicted from the atlas is
+       * generated again without holding the lock.
+       */
+      d->regenerate_evicted(m, c_array<GlyphDataPrivate*>(&q, 1),
+                            c_array<const unsigned int>(&generation, 1),
+                            c_array<const GlyphMetrics>(&metrics, 1));
+      if (!q)
+        {
+          m.unlock();
+          return fetch_glyph(render, font, glyph_code, upload_to_atlas);
+        }
+
+      GlyphAtlasProxy S(q);
+      GlyphAttribute::Array T(&q->m_attributes);
+      q->upload_to_atlas(GlyphMetrics(q->m_metrics), S, T);
+    }
+
+  return Glyph(q);
+}
+
+void
+fastuidraw::GlyphCache::
+fetch_glyphs(GlyphRenderer render, const FontBase *font,
+             c_array<const uint32_t> glyph_codes,
+             c_array<Glyph> out_glyphs,
+             bool upload_to_atlas)
+{
+  std::vector<GlyphMetrics> tmp_metrics_store(glyph_codes.size());
+  c_array<GlyphMetrics> tmp_metrics(make_c_array(tmp_metrics_store));
+  c_array<const GlyphMetrics> tmp_metrics_c(tmp_metrics);
+
+  fetch_glyph_metrics(font, glyph_codes, tmp_metrics);
+  fetch_glyphs(render, tmp_metrics_c, out_glyphs, upload_to_atlas);
+}
+
+void
+fastuidraw::GlyphCache::
+fetch_glyphs(GlyphRenderer render,
+             c_array<const GlyphSource> glyph_sources,
+             c_array<Glyph> out_glyphs,
+             bool upload_to_atlas)
+{
+  std::vector<GlyphMetrics> tmp_metrics_store(glyph_sources.size());
+  c_array<GlyphMetrics> tmp_metrics(make_c_array(tmp_metrics_store));
+  c_array<const GlyphMetrics> tmp_metrics_c(tmp_metrics);
+
+  fetch_glyph_metrics(glyph_sources, tmp_metrics);
+  fetch_glyphs(render, tmp_metrics_c, out_glyphs, upload_to_atlas);
+}
+
+void
+fastuidraw::GlyphCache::
+fetch_glyphs(GlyphRenderer render,
+             c_array<const GlyphMetrics> glyph_metrics,
+             c_array<Glyph> out_glyphs,
+             bool upload_to_atlas)
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+
+  std::vector<ClaimedGlyph> claimed;
+  std::vector<unsigned int> generations(out_glyphs.size());
+  std::unique_lock<std::mutex> m(d->m_glyphs_mutex);
 
-  if (!q->m_render.valid())
+  /* first pass: fetch all glyphs, claiming those that
+   * are not yet generated and not being generated by
+   * another thread.
+   */
+  for(unsigned int i = 0; i < glyph_metrics.size(); ++i)
     {
-      GlyphMetrics m;
+      if (glyph_metrics[i].valid())
+        {
+          GlyphDataPrivate *q;
+          glyph_key src(glyph_metrics[i].font().get(),
+                        glyph_metrics[i].glyph_code(),
+                        render);
+          GlyphMetricsPrivate *mp;
 
-      q->m_render = render;
-      FASTUIDRAWassert(!q->m_glyph_data);
-      m = fetch_glyph_metrics(font, glyph_code);
-      q->m_metrics = static_cast<GlyphMetricsPrivate*>(m.m_d);
-      q->m_glyph_data = font->compute_rendering_data(q->m_render, m,
-                                                     q->m_path, q->m_render_size);
+          mp = static_cast<GlyphMetricsPrivate*>(glyph_metrics[i].m_d);
+          q = d->fetch_or_claim(src, glyph_metrics[i], mp, &claimed);
+          generations[i] = q->m_generation;
+          out_glyphs[i] = Glyph(q);
+        }
+      else
+        {
+          out_glyphs[i] = Glyph();
+        }
+    }
+
+  /* second pass: generate the glyphs claimed by this thread
+   * without the lock held, then wait on any glyphs that
+   * other threads are generating.
+   */
+  d->generate_claimed(m, make_c_array(claimed));
+  for(unsigned int i = 0; i < out_glyphs.size(); ++i)
+    {
+      GlyphDataPrivate *q;
+
+      q = static_cast<GlyphDataPrivate*>(out_glyphs[i].m_opaque);
+      if (q)
+        {
+          d->wait_until_generated(m, q);
+        }
+    }
+
+  /* third pass: drop the glyphs that another thread removed
+   * from the cache while the lock was released (their slots may
+   * now hold different glyphs, and glyph_metrics[i] may be gone
+   * too, so they are not fetched again), mark the others as used
+   * and generate again the data of those evicted from the atlas.
+   */
+  std::vector<GlyphDataPrivate*> glyphs(out_glyphs.size(), nullptr);
+  for(unsigned int i = 0; i < out_glyphs.size(); ++i)
+    {
+      GlyphDataPrivate *q;
+
+      q = static_cast<GlyphDataPrivate*>(out_glyphs[i].m_opaque);
+      if (q && q->m_generation == generations[i])
+        {
+          q->mark_used();
+          glyphs[i] = q;
+        }
+    }
+
+  if (upload_to_atlas)
+    {
+      d->regenerate_evicted(m, make_c_array(glyphs), make_c_array(generations),
+                            glyph_metrics);
+    }
+
+  /* last pass: upload the glyphs with the lock held */
+  for(unsigned int i = 0; i < out_glyphs.size(); ++i)
+    {
+      GlyphDataPrivate *q(glyphs[i]);
+
+      out_glyphs[i] = Glyph(q);
+      if (q && upload_to_atlas)
+        {
+          GlyphAtlasProxy S(q);
+          GlyphAttribute::Array T(&q->m_attributes);
+          q->upload_to_atlas(GlyphMetrics(q->m_metrics), S, T);
+        }
+    }
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::GlyphCache::PrefetchTicket>
+fastuidraw::GlyphCache::
+prefetch_glyphs(GlyphRenderer render,
+                c_array<const GlyphSource> glyph_sources,
+                const reference_counted_ptr<PrefetchCallback> &callback)
+{
+  GlyphCachePrivate *d;
+  std::vector<PrefetchJob*> jobs;
+  unsigned int number_glyphs(0);
+
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  for (const GlyphSource &src : glyph_sources)
+    {
+      if (!src.m_font || !src.m_font->can_create_rendering_data(render.m_type))
+        {
+          continue;
+        }
+
+      if (jobs.empty() || jobs.back()->m_sources.size() >= PrefetchJob::max_glyphs_per_job)
+        {
+          jobs.push_back(FASTUIDRAWnew PrefetchJob());
+          jobs.back()->m_render = render;
+        }
+
+      PrefetchJob *job(jobs.back());
+      if (job->m_fonts.empty() || job->m_fonts.back() != src.m_font)
+        {
+          job->m_fonts.push_back(src.m_font);
+        }
+      job->m_sources.push_back(src);
+      ++number_glyphs;
+    }
+
+  PrefetchTicketPrivate *ticket_private;
+  reference_counted_ptr<PrefetchTicket> ticket;
+
+  ticket_private = FASTUIDRAWnew PrefetchTicketPrivate(number_glyphs, jobs.size(), callback);
+  ticket = FASTUIDRAWnew PrefetchTicket(ticket_private);
+
+  if (jobs.empty())
+    {
+      if (callback)
+        {
+          callback->on_prefetch_complete(*ticket);
+        }
+      return ticket;
     }
 
-  if (upload_to_atlas)
+  std::lock_guard<std::mutex> M(d->m_prefetch_mutex);
+  for (PrefetchJob *job : jobs)
     {
-      GlyphAtlasProxy S(q);
-      GlyphAttribute::Array T(&q->m_attributes);
-      q->upload_to_atlas(GlyphMetrics(q->m_metrics), S, T);
+      job->m_ticket = ticket;
+      job->m_ticket_private = ticket_private;
+      d->m_prefetch_jobs.push_back(job);
     }
+  d->start_prefetch_threads();
+  d->m_prefetch_condition.notify_all();
 
-  return Glyph(q);
+  return ticket;
 }
 
 void
 fastuidraw::GlyphCache::
-fetch_glyphs(GlyphRenderer render, const FontBase *font,
-             c_array<const uint32_t> glyph_codes,
-             c_array<Glyph> out_glyphs,
-             bool upload_to_atlas)
+prefetch_thread_count(unsigned int v)
 {
-  std::vector<GlyphMetrics> tmp_metrics_store(glyph_codes.size());
-  c_array<GlyphMetrics> tmp_metrics(make_c_array(tmp_metrics_store));
-  c_array<const GlyphMetrics> tmp_metrics_c(tmp_metrics);
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
 
-  fetch_glyph_metrics(font, glyph_codes, tmp_metrics);
-  fetch_glyphs(render, tmp_metrics_c, out_glyphs, upload_to_atlas);
-}
+  v = t_max(v, 1u);
+  if (v == d->m_prefetch_thread_count)
+    {
+      return;
+    }
 
-void
-fastuidraw::GlyphCache::
-fetch_glyphs(GlyphRenderer render,
-             c_array<const GlyphSource> glyph_sources,
-             c_array<Glyph> out_glyphs,
-             bool upload_to_atlas)
-{
-  std::vector<GlyphMetrics> tmp_metrics_store(glyph_sources.size());
-  c_array<GlyphMetrics> tmp_metrics(make_c_array(tmp_metrics_store));
-  c_array<const GlyphMetrics> tmp_metrics_c(tmp_metrics);
+  d->stop_prefetch_threads();
 
-  fetch_glyph_metrics(glyph_sources, tmp_metrics);
-  fetch_glyphs(render, tmp_metrics_c, out_glyphs, upload_to_atlas);
+  std::lock_guard<std::mutex> M(d->m_prefetch_mutex);
+  d->m_prefetch_thread_count = v;
+  if (!d->m_prefetch_jobs.empty())
+    {
+      d->start_prefetch_threads();
+    }
 }
 
-void
+unsigned int
 fastuidraw::GlyphCache::
-fetch_glyphs(GlyphRenderer render,
-             c_array<const GlyphMetrics> glyph_metrics,
-             c_array<Glyph> out_glyphs,
-             bool upload_to_atlas)
+prefetch_thread_count(void) const
 {
   GlyphCachePrivate *d;
   d = static_cast<GlyphCachePrivate*>(m_d);
-
-  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
-  for(unsigned int i = 0; i < glyph_metrics.size(); ++i)
-    {
-      if (glyph_metrics[i].valid())
-        {
-          glyph_key src(glyph_metrics[i].font().get(),
-                        glyph_metrics[i].glyph_code(),
-                        render);
-          GlyphDataPrivate *q;
-
-          q = d->m_glyphs.fetch_or_allocate(d, src);
-          if (!q->m_render.valid())
-            {
-              GlyphMetrics m(glyph_metrics[i]);
-
-              q->m_render = render;
-              FASTUIDRAWassert(!q->m_glyph_data);
-              q->m_metrics = static_cast<GlyphMetricsPrivate*>(m.m_d);
-              q->m_glyph_data = src.m_font->compute_rendering_data(q->m_render, m,
-                                                                   q->m_path, q->m_render_size);
-            }
-
-          if (upload_to_atlas)
-            {
-              GlyphAtlasProxy S(q);
-              GlyphAttribute::Array T(&q->m_attributes);
-              q->upload_to_atlas(GlyphMetrics(q->m_metrics), S, T);
-            }
-
-          out_glyphs[i] = Glyph(q);
-        }
-      else
-        {
-          out_glyphs[i] = Glyph();
-        }
-    }
+  return d->m_prefetch_thread_count;
 }
 
 enum fastuidraw::return_code
@@ -1055,6 +3066,7 @@ clear_atlas(void)
   d = static_cast<GlyphCachePrivate*>(m_d);
 
   d->m_atlas->clear();
+  d->increment_stat(num_atlas_clears);
   std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
   for(GlyphDataPrivate *g : d->m_glyphs.data())
     {
@@ -1064,7 +3076,60 @@ clear_atlas(void)
        */
       g->m_uploaded_to_atlas = false;
       g->m_data_locations.clear();
+      g->m_attributes.clear();
+      g->m_total_allocated = 0;
+      g->m_relocatable = false;
+      g->m_relocations_probed = false;
+      g->m_relocations.clear();
+    }
+}
+
+enum fastuidraw::return_code
+fastuidraw::GlyphCache::
+compact_atlas(void)
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
+  if (d->m_active_frames != 0)
+    {
+      return routine_fail;
+    }
+  return d->compact_atlas();
+}
+
+void
+fastuidraw::GlyphCache::
+compute_relocations(void *glyph)
+{
+  GlyphDataPrivate *g;
+
+  g = static_cast<GlyphDataPrivate*>(glyph);
+
+  GlyphAtlasProxy S(g);
+  GlyphAttribute::Array T(&g->m_attributes);
+  g->compute_relocations(GlyphMetrics(g->m_metrics), S, T);
+}
+
+fastuidraw::c_array<const fastuidraw::Glyph>
+fastuidraw::GlyphCache::
+glyphs_moved_by_last_compaction(void)
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
+  d->m_moved_glyphs_return.clear();
+  for (GlyphDataPrivate *g : d->m_moved_glyphs)
+    {
+      /* skip glyphs removed from the cache since the compaction */
+      if (g->m_render.valid())
+        {
+          d->m_moved_glyphs_return.push_back(Glyph(g));
+        }
     }
+  return make_c_array(d->m_moved_glyphs_return);
 }
 
 void
@@ -1078,7 +3143,10 @@ clear_cache(void)
   std::lock_guard<std::mutex> m2(d->m_glyphs_metrics_mutex);
   d->m_atlas->clear();
   d->m_glyphs.clear();
+  d->clear_dense_metrics_tables();
   d->m_glyph_metrics.clear();
+  d->m_moved_glyphs.clear();
+  d->increment_stat(num_cache_clears);
 }
 
 unsigned int
@@ -1092,7 +3160,272 @@ number_times_atlas_cleared(void)
    */
   GlyphCachePrivate *d;
   d = static_cast<GlyphCachePrivate*>(m_d);
-  return d->m_atlas->number_times_cleared();
+  return d->m_atlas->number_times_cleared()
+    + d->m_atlas->number_times_compacted()
+    + d->m_eviction_generation;
+}
+
+void
+fastuidraw::GlyphCache::
+atlas_size_limit(unsigned int v)
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  d->m_atlas_size_limit = v;
+}
+
+unsigned int
+fastuidraw::GlyphCache::
+atlas_size_limit(void) const
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  return d->m_atlas_size_limit;
+}
+
+void
+fastuidraw::GlyphCache::
+begin_frame(void)
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
+  if (d->m_active_frames++ == 0)
+    {
+      d->advance_frame();
+      d->m_atlas->begin_upload_frame();
+    }
+}
+
+void
+fastuidraw::GlyphCache::
+end_frame(void)
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
+  FASTUIDRAWassert(d->m_active_frames > 0);
+  if (--d->m_active_frames == 0)
+    {
+      /* the draws of the frame are sent, the glyphs
+       * used in the frame are no longer protected.
+       */
+      d->advance_frame();
+    }
+}
+
+void
+fastuidraw::GlyphCache::
+mark_glyphs_used(c_array<const Glyph> glyphs)
+{
+  GlyphCachePrivate *d;
+  unsigned int frame;
+
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  frame = d->m_current_frame;
+  for (const Glyph &g : glyphs)
+    {
+      GlyphDataPrivate *p;
+
+      p = static_cast<GlyphDataPrivate*>(g.m_opaque);
+      if (p)
+        {
+          FASTUIDRAWassert(p->m_cache == d);
+          p->m_last_used_frame = frame;
+        }
+    }
+}
+
+uint64_t
+fastuidraw::GlyphCache::
+pin_glyphs(c_array<const Glyph> glyphs)
+{
+  GlyphCachePrivate *d;
+  uint64_t return_value;
+
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  if (glyphs.empty())
+    {
+      return 0u;
+    }
+
+  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
+  std::vector<PinnedGlyph> &pins(d->m_pins[d->m_next_pin]);
+
+  return_value = d->m_next_pin++;
+  pins.reserve(glyphs.size());
+  for (const Glyph &g : glyphs)
+    {
+      GlyphDataPrivate *p;
+
+      p = static_cast<GlyphDataPrivate*>(g.m_opaque);
+      if (p && p->m_render.valid())
+        {
+          FASTUIDRAWassert(p->m_cache == d);
+          ++p->m_pin_count;
+          pins.push_back(PinnedGlyph(p));
+        }
+    }
+  return return_value;
+}
+
+void
+fastuidraw::GlyphCache::
+unpin_glyphs(uint64_t pin)
+{
+  GlyphCachePrivate *d;
+  std::map<uint64_t, std::vector<PinnedGlyph> >::iterator iter;
+
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
+  iter = d->m_pins.find(pin);
+  if (iter == d->m_pins.end())
+    {
+      return;
+    }
+
+  for (const PinnedGlyph &P : iter->second)
+    {
+      /* a glyph removed from the cache lost its pins */
+      if (P.m_glyph->m_generation == P.m_generation)
+        {
+          FASTUIDRAWassert(P.m_glyph->m_pin_count > 0);
+          --P.m_glyph->m_pin_count;
+        }
+    }
+  d->m_pins.erase(iter);
+}
+
+enum fastuidraw::return_code
+fastuidraw::GlyphCache::
+load_disk_cache(c_string filename)
+{
+  GlyphCachePrivate *d;
+  enum return_code R;
+
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  R = d->m_disk_cache.load(filename);
+  if (R == routine_success)
+    {
+      d->m_use_disk_cache = true;
+    }
+  return R;
+}
+
+enum fastuidraw::return_code
+fastuidraw::GlyphCache::
+save_disk_cache(c_string filename)
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  return d->m_disk_cache.save(filename);
+}
+
+void
+fastuidraw::GlyphCache::
+record_to_disk_cache(bool v)
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  d->m_record_to_disk_cache = v;
+}
+
+bool
+fastuidraw::GlyphCache::
+record_to_disk_cache(void) const
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  return d->m_record_to_disk_cache;
+}
+
+uint64_t
+fastuidraw::GlyphCache::
+query_stat(enum stats_t st) const
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  return (st < number_stats) ?
+    d->m_stats[st].load(std::memory_order_relaxed) :
+    0u;
+}
+
+void
+fastuidraw::GlyphCache::
+query_stats(c_array<uint64_t> dst) const
+{
+  for (unsigned int i = 0; i < dst.size() && i < number_stats; ++i)
+    {
+      dst[i] = query_stat(static_cast<enum stats_t>(i));
+    }
+}
+
+void
+fastuidraw::GlyphCache::
+reset_stats(void)
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  for (auto &v : d->m_stats)
+    {
+      v.store(0, std::memory_order_relaxed);
+    }
+}
+
+fastuidraw::c_string
+fastuidraw::GlyphCache::
+label(enum stats_t st)
+{
+#define EASY(X) case X: return #X
+
+  switch (st)
+    {
+      EASY(num_glyph_hits);
+      EASY(num_glyph_misses);
+      EASY(num_disk_cache_hits);
+      EASY(num_metrics_hits);
+      EASY(num_metrics_misses);
+      EASY(num_coverage_glyphs_generated);
+      EASY(num_distance_field_glyphs_generated);
+      EASY(num_restricted_rays_glyphs_generated);
+      EASY(num_banded_rays_glyphs_generated);
+      EASY(coverage_generation_ns);
+      EASY(distance_field_generation_ns);
+      EASY(restricted_rays_generation_ns);
+      EASY(banded_rays_generation_ns);
+      EASY(num_glyphs_uploaded);
+      EASY(num_glyphs_evicted);
+      EASY(num_eviction_passes);
+      EASY(num_data_evicted);
+      EASY(num_glyphs_regenerated);
+      EASY(num_atlas_clears);
+      EASY(num_cache_clears);
+      EASY(num_atlas_compactions);
+    default:
+      return "unknown";
+    }
+
+#undef EASY
+}
+
+void
+fastuidraw::GlyphCache::
+dense_glyph_metrics(bool v)
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  d->m_use_dense_metrics = v;
+}
+
+bool
+fastuidraw::GlyphCache::
+dense_glyph_metrics(void) const
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  return d->m_use_dense_metrics;
 }
 
 fastuidraw::GlyphCache::AllocationHandle